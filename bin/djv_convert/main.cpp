@@ -0,0 +1,714 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvAV/IO.h>
+#include <djvAV/IOThreadPool.h>
+#include <djvAV/ImageConvert.h>
+#include <djvAV/OCIOSystem.h>
+
+#include <djvCore/Context.h>
+#include <djvCore/Error.h>
+#include <djvCore/FileInfo.h>
+#include <djvCore/ResourceSystem.h>
+#include <djvCore/StringFormat.h>
+#include <djvCore/TextSystem.h>
+#include <djvCore/Timer.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include <iomanip>
+#include <iostream>
+
+using namespace djv;
+
+namespace _OCIO = OCIO_NAMESPACE;
+
+namespace djv
+{
+    //! This namespace provides functionality for djv_convert.
+    namespace Convert
+    {
+        namespace
+        {
+            //! Convert an image, applying the color space conversion first
+            //! since it requires floating point data.
+            std::shared_ptr<AV::Image::Image> convertImage(
+                const std::shared_ptr<AV::Image::Image>& image,
+                const AV::Image::Info& info,
+                const _OCIO::ConstProcessorRcPtr& processor,
+                const std::shared_ptr<AV::Image::Convert>& convert)
+            {
+                auto out = image;
+                if (processor)
+                {
+                    const uint8_t channelCount = AV::Image::getChannelCount(out->getType());
+                    const uint8_t ocioChannelCount = (2 == channelCount || 4 == channelCount) ? 4 : 3;
+                    const AV::Image::Info floatInfo(out->getSize(), AV::Image::getFloatType(ocioChannelCount, 32));
+                    auto tmp = AV::Image::Image::create(floatInfo);
+                    tmp->setPluginName(out->getPluginName());
+                    tmp->setTags(out->getTags());
+                    convert->process(*out, floatInfo, *tmp);
+                    _OCIO::PackedImageDesc desc(
+                        reinterpret_cast<float*>(tmp->getData()),
+                        floatInfo.size.w,
+                        floatInfo.size.h,
+                        ocioChannelCount);
+                    processor->apply(desc);
+                    out = tmp;
+                }
+                const auto& outInfo = out->getInfo();
+                if (outInfo.size != info.size || outInfo.type != info.type || outInfo.layout != info.layout)
+                {
+                    auto tmp = AV::Image::Image::create(info);
+                    tmp->setPluginName(out->getPluginName());
+                    tmp->setTags(out->getTags());
+                    convert->process(*out, info, *tmp);
+                    out = tmp;
+                }
+                return out;
+            }
+
+        } // namespace
+
+        class Application : public CmdLine::Application
+        {
+            DJV_NON_COPYABLE(Application);
+
+        protected:
+            void _init(std::list<std::string>&);
+
+            Application();
+
+        public:
+            static std::shared_ptr<Application> create(std::list<std::string>&);
+
+            void run() override;
+            void tick() override;
+
+        protected:
+            void _parseCmdLine(std::list<std::string>&) override;
+            void _printUsage() override;
+
+        private:
+            void _ocioInit(const std::shared_ptr<AV::Image::Image>&);
+            void _printStats();
+
+            std::string _input;
+            std::string _output;
+            std::unique_ptr<Core::Frame::Range> _startEnd;
+            std::unique_ptr<size_t> _layer;
+            std::unique_ptr<AV::Image::Size> _resize;
+            std::unique_ptr<AV::Image::Type> _type;
+            std::unique_ptr<size_t> _threadCount;
+            std::unique_ptr<std::string> _ocioConfig;
+            std::unique_ptr<std::string> _ocioImage;
+            std::unique_ptr<std::string> _ocioDisplay;
+            std::unique_ptr<std::string> _ocioView;
+
+            AV::Image::Info _info;
+            size_t _frameCount = 0;
+            Core::Frame::Index _startIndex = 0;
+            Core::Frame::Index _endIndex = Core::Frame::invalidIndex;
+            size_t _convertQueueMax = 0;
+            bool _readFinished = false;
+            bool _ocioInitialized = false;
+            _OCIO::ConstProcessorRcPtr _ocioProcessor;
+            std::shared_ptr<AV::IO::IRead> _read;
+            std::shared_ptr<AV::IO::IWrite> _write;
+            std::shared_ptr<AV::IO::ThreadPool> _threadPool;
+            std::shared_ptr<AV::Image::Convert> _convert;
+            std::list<std::future<std::shared_ptr<AV::Image::Image> > > _convertQueue;
+            Core::Frame::Number _writeFrame = 0;
+            size_t _writeCount = 0;
+            size_t _writeByteCount = 0;
+            std::chrono::steady_clock::time_point _startTime;
+            std::shared_ptr<Core::Time::Timer> _statsTimer;
+        };
+
+        void Application::_init(std::list<std::string>& args)
+        {
+            CmdLine::Application::_init(args);
+
+            _parseCmdLine(args);
+        }
+
+        Application::Application()
+        {}
+
+        std::shared_ptr<Application> Application::create(std::list<std::string>& args)
+        {
+            auto out = std::shared_ptr<Application>(new Application);
+            out->_init(args);
+            return out;
+        }
+
+        void Application::run()
+        {
+            auto textSystem = getSystemT<Core::TextSystem>();
+            auto io = getSystemT<AV::IO::System>();
+
+            // Apply the color space options.
+            if (_ocioConfig || _ocioDisplay || _ocioView || _ocioImage)
+            {
+                auto ocioSystem = getSystemT<AV::OCIO::System>();
+                if (_ocioConfig)
+                {
+                    ocioSystem->addConfig(*_ocioConfig);
+                }
+                auto config = ocioSystem->observeCurrentConfig()->get();
+                if (_ocioDisplay)
+                {
+                    config.display = *_ocioDisplay;
+                }
+                if (_ocioView)
+                {
+                    config.view = *_ocioView;
+                }
+                if (_ocioImage)
+                {
+                    config.fileColorSpaces[std::string()] = *_ocioImage;
+                }
+                ocioSystem->setCurrentConfig(config);
+            }
+
+            // Open the input. The read queue is the first of the bounded
+            // queues in the pipeline; the decoded frames are taken from it
+            // and converted on the I/O thread pool, and the converted frames
+            // are handed to the write queue in order. The decoding and
+            // conversion share the I/O thread pool so the thread count
+            // limits the number of frames in flight rather than adding
+            // threads.
+            _threadPool = io->getThreadPool();
+            const size_t threadCount = _threadCount ? *_threadCount : _threadPool->getThreadCount();
+            _convertQueueMax = threadCount * 2;
+            Core::FileSystem::FileInfo inputFileInfo(_input);
+            if (Core::FileSystem::FileType::File == inputFileInfo.getType())
+            {
+                const auto fileSequence = Core::FileSystem::FileInfo::getFileSequence(
+                    inputFileInfo.getPath(),
+                    io->getSequenceExtensions());
+                if (fileSequence.getSequence().getFrameCount() > 1)
+                {
+                    inputFileInfo = fileSequence;
+                }
+            }
+            AV::IO::ReadOptions readOptions;
+            readOptions.layer = _layer ? *_layer : 0;
+            readOptions.videoQueueSize = _convertQueueMax;
+            _read = io->read(inputFileInfo, readOptions);
+            const auto info = _read->getInfo().get();
+            if (readOptions.layer >= info.video.size())
+            {
+                throw std::runtime_error(Core::String::Format("{0}: {1}").
+                    arg(_input).
+                    arg(textSystem->getText(DJV_TEXT("djv_convert_layer_error"))));
+            }
+            const auto& videoInfo = info.video[readOptions.layer];
+
+            // Find the frames to convert.
+            const auto& sequence = videoInfo.sequence;
+            _frameCount = 1;
+            if (sequence.getFrameCount() > 0)
+            {
+                _endIndex = sequence.getLastIndex();
+                if (_startEnd)
+                {
+                    _startIndex = sequence.getIndex(_startEnd->getMin());
+                    _endIndex = sequence.getIndex(_startEnd->getMax());
+                    if (Core::Frame::invalidIndex == _startIndex || Core::Frame::invalidIndex == _endIndex)
+                    {
+                        throw std::runtime_error(Core::String::Format("{0}: {1}").
+                            arg("-start_end").
+                            arg(textSystem->getText(DJV_TEXT("djv_convert_start_end_error"))));
+                    }
+                }
+                _frameCount = static_cast<size_t>(std::max(_endIndex - _startIndex + 1, static_cast<Core::Frame::Index>(1)));
+            }
+
+            // Get the output image information. If only one of the resize
+            // dimensions is given the other is computed from the aspect ratio.
+            AV::Image::Size size = videoInfo.info.size;
+            if (_resize)
+            {
+                const float aspect = videoInfo.info.size.getAspectRatio();
+                if (_resize->w > 0 && _resize->h > 0)
+                {
+                    size = *_resize;
+                }
+                else if (_resize->w > 0 && aspect > 0.F)
+                {
+                    size = AV::Image::Size(_resize->w, static_cast<uint16_t>(_resize->w / aspect));
+                }
+                else if (_resize->h > 0)
+                {
+                    size = AV::Image::Size(static_cast<uint16_t>(_resize->h * aspect), _resize->h);
+                }
+            }
+            _info = AV::Image::Info(size, _type ? *_type : videoInfo.info.type);
+
+            // Open the output.
+            Core::FileSystem::FileInfo outputFileInfo(_output);
+            if (_frameCount > 1 && io->canSequence(outputFileInfo))
+            {
+                _writeFrame = sequence.getFrame(_startIndex);
+                size_t pad = 0;
+                const std::string& number = outputFileInfo.getPath().getNumber();
+                if (!number.empty())
+                {
+                    std::stringstream ss(number);
+                    ss >> _writeFrame;
+                    pad = number.size() > 1 && '0' == number[0] ? number.size() : 0;
+                }
+                outputFileInfo = Core::FileSystem::FileInfo(
+                    outputFileInfo.getPath(),
+                    Core::FileSystem::FileType::Sequence,
+                    Core::Frame::Sequence(_writeFrame, _writeFrame + _frameCount - 1, pad));
+            }
+            AV::IO::Info ioInfo;
+            ioInfo.video.push_back(AV::IO::VideoInfo(_info, videoInfo.speed));
+            AV::IO::WriteOptions writeOptions;
+            writeOptions.videoQueueSize = _convertQueueMax;
+            _write = io->write(outputFileInfo, ioInfo, writeOptions);
+
+            // Start the pipeline.
+            // The frames are converted in thread pool tasks, which already
+            // run in parallel.
+            _convert = AV::Image::Convert::create(AV::Image::ConvertBackend::CPU, getSystemT<Core::ResourceSystem>());
+            _convert->setThreadCount(1);
+            _read->setThreadCount(threadCount);
+            _write->setThreadCount(threadCount);
+            if (_startIndex > 0)
+            {
+                _read->seek(_startIndex, AV::IO::Direction::Forward);
+            }
+            _read->setPlayback(true);
+            _startTime = std::chrono::steady_clock::now();
+
+            _statsTimer = Core::Time::Timer::create(shared_from_this());
+            _statsTimer->setRepeating(true);
+            _statsTimer->start(
+                Core::Time::getTime(Core::Time::TimerValue::Slow),
+                [this](const std::chrono::steady_clock::time_point&, const Core::Time::Duration&)
+                {
+                    _printStats();
+                });
+
+            CmdLine::Application::run();
+
+            // Cancel any conversions that have not started and release the
+            // pipeline before the systems are destroyed.
+            _statsTimer->stop();
+            _threadPool->cancel(this);
+            for (auto& i : _convertQueue)
+            {
+                try
+                {
+                    i.get();
+                }
+                catch (const std::exception&)
+                {}
+            }
+            _convertQueue.clear();
+            _write.reset();
+            _read.reset();
+        }
+
+        void Application::tick()
+        {
+            CmdLine::Application::tick();
+
+            // Take decoded frames from the read queue and start converting
+            // them, as long as there is room in the conversion queue.
+            std::vector<std::shared_ptr<AV::Image::Image> > images;
+            bool readError = false;
+            if (!_readFinished)
+            {
+                std::lock_guard<std::mutex> readLock(_read->getMutex());
+                auto& readQueue = _read->getVideoQueue();
+                while (!_readFinished && !readQueue.isEmpty() && _convertQueue.size() + images.size() < _convertQueueMax)
+                {
+                    const auto frame = readQueue.popFrame();
+                    if (!frame.image &&
+                        (Core::Frame::invalid == frame.frame ||
+                         Core::Frame::invalidIndex == _endIndex ||
+                         (frame.frame >= _startIndex && frame.frame <= _endIndex)))
+                    {
+                        // The reader queues an empty image for a frame that
+                        // cannot be read.
+                        readError = true;
+                        _readFinished = true;
+                    }
+                    else if (Core::Frame::invalid == frame.frame || Core::Frame::invalidIndex == _endIndex)
+                    {
+                        images.push_back(frame.image);
+                    }
+                    else if (frame.frame > _endIndex)
+                    {
+                        _readFinished = true;
+                    }
+                    else if (frame.frame >= _startIndex)
+                    {
+                        // Frames before the start may be queued before the
+                        // seek is processed, they are skipped.
+                        images.push_back(frame.image);
+                        if (frame.frame == _endIndex)
+                        {
+                            _readFinished = true;
+                        }
+                    }
+                }
+                if (readQueue.isEmpty() && readQueue.isFinished())
+                {
+                    _readFinished = true;
+                }
+            }
+            if (_readFinished)
+            {
+                _read->setPlayback(false);
+            }
+            if (readError)
+            {
+                auto textSystem = getSystemT<Core::TextSystem>();
+                std::cout << Core::Error::format(std::runtime_error(Core::String::Format("{0}: {1}").
+                    arg(_input).
+                    arg(textSystem->getText(DJV_TEXT("djv_convert_read_error"))))) << std::endl;
+                CmdLine::Application::exit(1);
+                return;
+            }
+            for (const auto& image : images)
+            {
+                if (!_ocioInitialized)
+                {
+                    _ocioInit(image);
+                }
+                const auto info = _info;
+                const auto processor = _ocioProcessor;
+                const auto convert = _convert;
+                _convertQueue.push_back(_threadPool->run<std::shared_ptr<AV::Image::Image> >(
+                    AV::IO::TaskPriority::Queue,
+                    [image, info, processor, convert]
+                    {
+                        return convertImage(image, info, processor, convert);
+                    },
+                    this));
+            }
+
+            // Hand the converted frames to the write queue in order, as long
+            // as there is room in the write queue.
+            {
+                std::lock_guard<std::mutex> writeLock(_write->getMutex());
+                auto& writeQueue = _write->getVideoQueue();
+                while (_convertQueue.size() &&
+                    writeQueue.getCount() < writeQueue.getMax() &&
+                    _convertQueue.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                {
+                    const auto image = _convertQueue.front().get();
+                    _convertQueue.pop_front();
+                    writeQueue.addFrame(AV::IO::VideoFrame(_writeFrame, image));
+                    ++_writeFrame;
+                    ++_writeCount;
+                    _writeByteCount += image->getDataByteCount();
+                }
+                if (_readFinished && !_convertQueue.size())
+                {
+                    writeQueue.setFinished(true);
+                }
+            }
+
+            // Stop the run loop when the writer has finished, the pipeline is
+            // released when run() returns.
+            if (!_write->isRunning())
+            {
+                _printStats();
+                CmdLine::Application::exit(0);
+            }
+        }
+
+        void Application::_ocioInit(const std::shared_ptr<AV::Image::Image>& image)
+        {
+            _ocioInitialized = true;
+            if (_ocioConfig || _ocioDisplay || _ocioView || _ocioImage)
+            {
+                auto ocioSystem = getSystemT<AV::OCIO::System>();
+                const auto config = ocioSystem->observeCurrentConfig()->get();
+                AV::OCIO::Convert colorSpace;
+                auto i = config.fileColorSpaces.find(image->getPluginName());
+                if (i != config.fileColorSpaces.end())
+                {
+                    colorSpace.input = i->second;
+                }
+                else
+                {
+                    i = config.fileColorSpaces.find(std::string());
+                    if (i != config.fileColorSpaces.end())
+                    {
+                        colorSpace.input = i->second;
+                    }
+                }
+                colorSpace.output = ocioSystem->getColorSpace(config.display, config.view);
+                if (colorSpace.isValid())
+                {
+                    auto ocioConfig = _OCIO::GetCurrentConfig();
+                    _ocioProcessor = ocioConfig->getProcessor(colorSpace.input.c_str(), colorSpace.output.c_str());
+                }
+            }
+        }
+
+        void Application::_printStats()
+        {
+            const std::chrono::duration<float> delta = std::chrono::steady_clock::now() - _startTime;
+            const float seconds = delta.count();
+            const float fps = seconds > 0.F ? (_writeCount / seconds) : 0.F;
+            const float mbps = seconds > 0.F ? (_writeByteCount / static_cast<float>(Core::Memory::megabyte) / seconds) : 0.F;
+            std::cout << _writeCount << "/" << _frameCount << " " <<
+                std::fixed << std::setprecision(2) << fps << " fps " << mbps << " MB/s" << std::endl;
+        }
+
+        void Application::_parseCmdLine(std::list<std::string>& args)
+        {
+            CmdLine::Application::_parseCmdLine(args);
+            if (0 == getExitCode())
+            {
+                auto textSystem = getSystemT<Core::TextSystem>();
+                auto i = args.begin();
+                while (i != args.end())
+                {
+                    if ("-start_end" == *i)
+                    {
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-start_end").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        Core::Frame::Number min = 0;
+                        Core::Frame::Number max = 0;
+                        {
+                            std::stringstream ss(*i);
+                            ss >> min;
+                        }
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-start_end").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        {
+                            std::stringstream ss(*i);
+                            ss >> max;
+                        }
+                        i = args.erase(i);
+                        _startEnd.reset(new Core::Frame::Range(min, max));
+                    }
+                    else if ("-layer" == *i)
+                    {
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-layer").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        int value = 0;
+                        std::stringstream ss(*i);
+                        ss >> value;
+                        i = args.erase(i);
+                        _layer.reset(new size_t(std::max(value, 0)));
+                    }
+                    else if ("-resize" == *i)
+                    {
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-resize").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        AV::Image::Size value;
+                        std::stringstream ss(*i);
+                        ss >> value;
+                        i = args.erase(i);
+                        _resize.reset(new AV::Image::Size(value));
+                    }
+                    else if ("-type" == *i)
+                    {
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-type").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        AV::Image::Type value = AV::Image::Type::None;
+                        std::stringstream ss(*i);
+                        ss >> value;
+                        i = args.erase(i);
+                        _type.reset(new AV::Image::Type(value));
+                    }
+                    else if ("-threads" == *i)
+                    {
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-threads").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        int value = 0;
+                        std::stringstream ss(*i);
+                        ss >> value;
+                        i = args.erase(i);
+                        _threadCount.reset(new size_t(std::max(value, 1)));
+                    }
+                    else if ("-ocio_config" == *i)
+                    {
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-ocio_config").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        _ocioConfig.reset(new std::string(*i));
+                        i = args.erase(i);
+                    }
+                    else if ("-ocio_display" == *i)
+                    {
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-ocio_display").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        _ocioDisplay.reset(new std::string(*i));
+                        i = args.erase(i);
+                    }
+                    else if ("-ocio_view" == *i)
+                    {
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-ocio_view").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        _ocioView.reset(new std::string(*i));
+                        i = args.erase(i);
+                    }
+                    else if ("-ocio_image" == *i)
+                    {
+                        i = args.erase(i);
+                        if (args.end() == i)
+                        {
+                            throw std::runtime_error(Core::String::Format("{0}: {1}").
+                                arg("-ocio_image").
+                                arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                        }
+                        _ocioImage.reset(new std::string(*i));
+                        i = args.erase(i);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+                if (!args.size())
+                {
+                    _printUsage();
+                    exit(1);
+                }
+                else if (2 == args.size())
+                {
+                    _input = args.front();
+                    args.pop_front();
+                    _output = args.front();
+                    args.pop_front();
+                }
+                else
+                {
+                    throw std::runtime_error(textSystem->getText(DJV_TEXT("djv_convert_input_output_error")));
+                }
+            }
+        }
+
+        void Application::_printUsage()
+        {
+            auto textSystem = getSystemT<Core::TextSystem>();
+            std::cout << std::endl;
+            std::cout << " " << textSystem->getText(DJV_TEXT("djv_convert_cli_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << " " << textSystem->getText(DJV_TEXT("djv_convert_cli_usage")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_usage_format")) << std::endl;
+            std::cout << std::endl;
+            std::cout << " " << textSystem->getText(DJV_TEXT("djv_convert_cli_options")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_start_end")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_start_end_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_layer")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_layer_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_resize")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_resize_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_type")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_type_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_threads")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_threads_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << " " << textSystem->getText(DJV_TEXT("djv_convert_cli_options_ocio")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_ocio_config")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_ocio_config_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_ocio_display")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_ocio_display_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_ocio_view")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_ocio_view_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_ocio_image")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_option_ocio_image_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << " " << textSystem->getText(DJV_TEXT("djv_convert_cli_examples")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_example_1")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_example_1_description")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_example_2")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_convert_cli_example_2_description")) << std::endl;
+            std::cout << std::endl;
+
+            CmdLine::Application::_printUsage();
+        }
+
+    } // namespace Convert
+} // namespace djv
+
+int main(int argc, char** argv)
+{
+    int r = 1;
+    try
+    {
+        auto args = Convert::Application::args(argc, argv);
+        auto app = Convert::Application::create(args);
+        if (0 == app->getExitCode())
+        {
+            app->run();
+        }
+        r = app->getExitCode();
+    }
+    catch (const std::exception & e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+    }
+    return r;
+}
@@ -25,10 +25,10 @@ struct Exposure
 };
 
 varying vec2 Texture;
+varying vec4 Color;
 
 uniform int         imageChannels;
 uniform int         colorMode;
-uniform vec4        color;
 uniform mat4        colorMatrix;
 uniform bool        colorMatrixEnabled;
 uniform bool        colorInvert;
@@ -39,6 +39,9 @@ uniform bool        exposureEnabled;
 uniform float       softClip;
 uniform int         imageChannelDisplay;
 uniform sampler2D   textureSampler;
+uniform bool        imageYUV;
+uniform sampler2D   textureSamplerU;
+uniform sampler2D   textureSamplerV;
 
 // djv::AV::Image::Channels
 #define IMAGE_CHANNELS_L    1
@@ -74,6 +77,20 @@ vec4 colorMatrixFunc(vec4 value, mat4 color)
     return tmp;
 };
 
+// Convert planar Y'CbCr with BT.709 limited range coefficients to RGB.
+vec4 yuvFunc(float y, float u, float v)
+{
+    y = (y - 16.0 / 255.0) * (255.0 / 219.0);
+    u = (u - 128.0 / 255.0) * (255.0 / 224.0);
+    v = (v - 128.0 / 255.0) * (255.0 / 224.0);
+    vec4 tmp;
+    tmp[0] = y + 1.5748 * v;
+    tmp[1] = y - 0.187324 * u - 0.468124 * v;
+    tmp[2] = y + 1.8556 * u;
+    tmp[3] = 1.0;
+    return clamp(tmp, 0.0, 1.0);
+}
+
 vec4 levelsFunc(vec4 value, Levels data)
 {
     vec4 tmp;
@@ -130,44 +147,55 @@ void main()
 {
     if (COLOR_MODE_SOLID_COLOR == colorMode)
     {
-        gl_FragColor = color;
+        gl_FragColor = Color;
     }
     else if (COLOR_MODE_COLOR_WITH_TEXTURE_ALPHA == colorMode)
     {
         vec4 t = texture2D(textureSampler, Texture);
-        gl_FragColor.r = color.r;
-        gl_FragColor.g = color.g;
-        gl_FragColor.b = color.b;
-        gl_FragColor.a = color.a * t.r;
+        gl_FragColor.r = Color.r;
+        gl_FragColor.g = Color.g;
+        gl_FragColor.b = Color.b;
+        gl_FragColor.a = Color.a * t.r;
     }
     else if (COLOR_MODE_COLOR_WITH_TEXTURE_ALPHA_R == colorMode)
     {
         vec4 t = texture2D(textureSampler, Texture);
-        gl_FragColor.r = color.r;
+        gl_FragColor.r = Color.r;
         gl_FragColor.g = 0.0;
         gl_FragColor.b = 0.0;
-        gl_FragColor.a = color.a * t.r;
+        gl_FragColor.a = Color.a * t.r;
     }
     else if (COLOR_MODE_COLOR_WITH_TEXTURE_ALPHA_G == colorMode)
     {
         vec4 t = texture2D(textureSampler, Texture);
         gl_FragColor.r = 0.0;
-        gl_FragColor.g = color.g;
+        gl_FragColor.g = Color.g;
         gl_FragColor.b = 0.0;
-        gl_FragColor.a = color.a * t.g;
+        gl_FragColor.a = Color.a * t.g;
     }
     else if (COLOR_MODE_COLOR_WITH_TEXTURE_ALPHA_B == colorMode)
     {
         vec4 t = texture2D(textureSampler, Texture);
         gl_FragColor.r = 0.0;
         gl_FragColor.g = 0.0;
-        gl_FragColor.b = color.b;
-        gl_FragColor.a = color.a * t.b;
+        gl_FragColor.b = Color.b;
+        gl_FragColor.a = Color.a * t.b;
     }
     else if (COLOR_MODE_COLOR_AND_TEXTURE == colorMode)
     {
         // Sample the texture.
-        vec4 t = texture2D(textureSampler, Texture);
+        vec4 t;
+        if (imageYUV)
+        {
+            t = yuvFunc(
+                texture2D(textureSampler, Texture).r,
+                texture2D(textureSamplerU, Texture).r,
+                texture2D(textureSamplerV, Texture).r);
+        }
+        else
+        {
+            t = texture2D(textureSampler, Texture);
+        }
         
         // Swizzle the channels for the given image format.
         if (IMAGE_CHANNELS_L == imageChannels)
@@ -232,10 +260,10 @@ void main()
 			t.b = t.a;
 		}
 		
-        gl_FragColor = color * t;
+        gl_FragColor = Color * t;
     }
     else if (COLOR_MODE_SHADOW == colorMode)
     {
-        gl_FragColor = color * Texture.x;
+        gl_FragColor = Color * Texture.x;
     }
 }
@@ -23,11 +23,11 @@ struct Exposure
 };
 
 in vec2 Texture;
+in vec4 Color;
 out vec4 FragColor;
 
 uniform int         imageChannels       = 0;
 uniform int         colorMode           = 0;
-uniform vec4        color;
 uniform int         colorSpace          = 0;
 uniform sampler3D   colorSpaceSampler;
 uniform mat4        colorMatrix;
@@ -40,6 +40,9 @@ uniform bool        exposureEnabled     = false;
 uniform float       softClip            = 0.0;
 uniform int         imageChannelDisplay = 0;
 uniform sampler2D   textureSampler;
+uniform bool        imageYUV            = false;
+uniform sampler2D   textureSamplerU;
+uniform sampler2D   textureSamplerV;
 
 // djv::AV::Image::Channels
 #define IMAGE_CHANNELS_L    1
@@ -77,6 +80,20 @@ vec4 colorMatrixFunc(vec4 value, mat4 color)
     return tmp;
 }
 
+// Convert planar Y'CbCr with BT.709 limited range coefficients to RGB.
+vec4 yuvFunc(float y, float u, float v)
+{
+    y = (y - 16.0 / 255.0) * (255.0 / 219.0);
+    u = (u - 128.0 / 255.0) * (255.0 / 224.0);
+    v = (v - 128.0 / 255.0) * (255.0 / 224.0);
+    vec4 tmp;
+    tmp[0] = y + 1.5748 * v;
+    tmp[1] = y - 0.187324 * u - 0.468124 * v;
+    tmp[2] = y + 1.8556 * u;
+    tmp[3] = 1.0;
+    return clamp(tmp, 0.0, 1.0);
+}
+
 vec4 levelsFunc(vec4 value, Levels data)
 {
     vec4 tmp;
@@ -133,44 +150,55 @@ void main()
 {
     if (COLOR_MODE_SOLID_COLOR == colorMode)
     {
-        FragColor = color;
+        FragColor = Color;
     }
     else if (COLOR_MODE_COLOR_WITH_TEXTURE_ALPHA == colorMode)
     {
         vec4 t = texture(textureSampler, Texture);
-        FragColor.r = color.r;
-        FragColor.g = color.g;
-        FragColor.b = color.b;
-        FragColor.a = color.a * t.r;
+        FragColor.r = Color.r;
+        FragColor.g = Color.g;
+        FragColor.b = Color.b;
+        FragColor.a = Color.a * t.r;
     }
     else if (COLOR_MODE_COLOR_WITH_TEXTURE_ALPHA_R == colorMode)
     {
         vec4 t = texture(textureSampler, Texture);
-        FragColor.r = color.r;
+        FragColor.r = Color.r;
         FragColor.g = 0.0;
         FragColor.b = 0.0;
-        FragColor.a = color.a * t.r;
+        FragColor.a = Color.a * t.r;
     }
     else if (COLOR_MODE_COLOR_WITH_TEXTURE_ALPHA_G == colorMode)
     {
         vec4 t = texture(textureSampler, Texture);
         FragColor.r = 0.0;
-        FragColor.g = color.g;
+        FragColor.g = Color.g;
         FragColor.b = 0.0;
-        FragColor.a = color.a * t.g;
+        FragColor.a = Color.a * t.g;
     }
     else if (COLOR_MODE_COLOR_WITH_TEXTURE_ALPHA_B == colorMode)
     {
         vec4 t = texture(textureSampler, Texture);
         FragColor.r = 0.0;
         FragColor.g = 0.0;
-        FragColor.b = color.b;
-        FragColor.a = color.a * t.b;
+        FragColor.b = Color.b;
+        FragColor.a = Color.a * t.b;
     }
     else if (COLOR_MODE_COLOR_AND_TEXTURE == colorMode)
     {
         // Sample the texture.
-        vec4 t = texture(textureSampler, Texture);
+        vec4 t;
+        if (imageYUV)
+        {
+            t = yuvFunc(
+                texture(textureSampler, Texture).r,
+                texture(textureSamplerU, Texture).r,
+                texture(textureSamplerV, Texture).r);
+        }
+        else
+        {
+            t = texture(textureSampler, Texture);
+        }
 
         // Swizzle the channels for the given image format.
         if (IMAGE_CHANNELS_L == imageChannels)
@@ -238,10 +266,10 @@ void main()
             t.b = t.a;
         }
 
-        FragColor = t * color;
+        FragColor = t * Color;
     }
     else if (COLOR_MODE_SHADOW == colorMode)
     {
-        FragColor = color * Texture.x;
+        FragColor = Color * Texture.x;
     }
 }
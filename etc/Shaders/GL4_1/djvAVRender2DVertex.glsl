@@ -6,8 +6,10 @@
 
 in vec3 aPos;
 in vec2 aTexture;
+in vec4 aColor;
 
 out vec2 Texture;
+out vec4 Color;
 
 uniform struct Transform
 {
@@ -18,4 +20,5 @@ void main()
 {
     gl_Position = transform.mvp * vec4(aPos, 1.0);
     Texture = aTexture;
+    Color = aColor;
 }
@@ -202,11 +202,16 @@ namespace djv
                         const ReadOptions&,
                         const std::shared_ptr<Core::TextSystem>&,
                         const std::shared_ptr<Core::ResourceSystem>&,
-                        const std::shared_ptr<Core::LogSystem>&);
+                        const std::shared_ptr<Core::LogSystem>&,
+                        const std::shared_ptr<ThreadPool>&,
+                        const std::shared_ptr<FrameCache>&);
 
+                    //! Read the image data. Proxies are read by skipping
+                    //! scanlines and pixels.
                     static std::shared_ptr<Image::Image> readImage(
                         const Info&,
-                        const std::shared_ptr<Core::FileSystem::FileIO>&);
+                        const std::shared_ptr<Core::FileSystem::FileIO>&,
+                        size_t proxy = 0);
 
                 protected:
                     Info _readInfo(const std::string&) override;
@@ -35,29 +35,67 @@ namespace djv
                     const ReadOptions& readOptions,
                     const std::shared_ptr<TextSystem>& textSystem,
                     const std::shared_ptr<ResourceSystem>& resourceSystem,
-                    const std::shared_ptr<LogSystem>& logSystem)
+                    const std::shared_ptr<LogSystem>& logSystem,
+                    const std::shared_ptr<ThreadPool>& threadPool,
+                    const std::shared_ptr<FrameCache>& frameCache)
                 {
                     auto out = std::shared_ptr<Read>(new Read);
-                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem);
+                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem, threadPool, frameCache);
                     return out;
                 }
                 
                 std::shared_ptr<Image::Image> Read::readImage(
                     const Info& info,
-                    const std::shared_ptr<FileSystem::FileIO>& io)
+                    const std::shared_ptr<FileSystem::FileIO>& io,
+                    size_t proxy)
                 {
-#if defined(DJV_MMAP)
-                    auto out = Image::Image::create(info.video[0].info, io);
-#else // DJV_MMAP
+                    std::shared_ptr<Image::Image> out;
                     auto infoTmp = info;
                     bool convertEndian = false;
-                    if (infoTmp.video[0].info.layout.endian != Memory::getEndian())
+                    if (proxy > 0)
+                    {
+                        // Read every Nth scanline and pixel.
+                        const auto& imageInfo = info.video[0].info;
+                        const size_t step = static_cast<size_t>(1) << std::min(proxy, static_cast<size_t>(15));
+                        const size_t pixelByteCount = imageInfo.getPixelByteCount();
+                        const size_t scanlineByteCount = imageInfo.getScanlineByteCount();
+                        infoTmp.video[0].info.size = getProxySize(imageInfo.size, proxy);
+                        if (infoTmp.video[0].info.layout.endian != Memory::getEndian())
+                        {
+                            convertEndian = true;
+                            infoTmp.video[0].info.layout.endian = Memory::getEndian();
+                        }
+                        out = Image::Image::create(infoTmp.video[0].info);
+                        const size_t pos = io->getPos();
+                        std::vector<uint8_t> scanline(scanlineByteCount);
+                        for (uint16_t y = 0; y < infoTmp.video[0].info.size.h; ++y)
+                        {
+                            io->setPos(pos + y * step * scanlineByteCount);
+                            io->read(scanline.data(), scanlineByteCount);
+                            const uint8_t* inP = scanline.data();
+                            uint8_t* outP = out->getData(y);
+                            for (uint16_t x = 0; x < infoTmp.video[0].info.size.w; ++x)
+                            {
+                                memcpy(outP, inP, pixelByteCount);
+                                inP += step * pixelByteCount;
+                                outP += pixelByteCount;
+                            }
+                        }
+                    }
+                    else
                     {
-                        convertEndian = true;
-                        infoTmp.video[0].info.layout.endian = Memory::getEndian();
+#if defined(DJV_MMAP)
+                        out = Image::Image::create(info.video[0].info, io);
+#else // DJV_MMAP
+                        if (infoTmp.video[0].info.layout.endian != Memory::getEndian())
+                        {
+                            convertEndian = true;
+                            infoTmp.video[0].info.layout.endian = Memory::getEndian();
+                        }
+                        out = Image::Image::create(infoTmp.video[0].info);
+                        io->read(out->getData(), out->getDataByteCount());
+#endif // DJV_MMAP
                     }
-                    auto out = Image::Image::create(infoTmp.video[0].info);
-                    io->read(out->getData(), out->getDataByteCount());
                     if (convertEndian)
                     {
                         const size_t dataByteCount = out->getDataByteCount();
@@ -72,7 +110,6 @@ namespace djv
                             default: break;                            
                         }
                     }
-#endif // DJV_MMAP
                     out->setTags(infoTmp.tags);
                     return out;
                 }
@@ -87,7 +124,7 @@ namespace djv
                 {
                     auto io = FileSystem::FileIO::create();
                     const auto info = _open(fileName, io);
-                    auto out = readImage(info, io);
+                    auto out = readImage(info, io, _options.proxy);
                     out->setPluginName(pluginName);
                     return out;
                 }
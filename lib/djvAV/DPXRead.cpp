@@ -37,11 +37,13 @@ namespace djv
                     const Options& options,
                     const std::shared_ptr<TextSystem>& textSystem,
                     const std::shared_ptr<ResourceSystem>& resourceSystem,
-                    const std::shared_ptr<LogSystem>& logSystem)
+                    const std::shared_ptr<LogSystem>& logSystem,
+                    const std::shared_ptr<ThreadPool>& threadPool,
+                    const std::shared_ptr<FrameCache>& frameCache)
                 {
                     auto out = std::shared_ptr<Read>(new Read);
                     out->_p->options = options;
-                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem);
+                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem, threadPool, frameCache);
                     return out;
                 }
 
@@ -55,7 +57,7 @@ namespace djv
                 {
                     auto io = FileSystem::FileIO::create();
                     const auto info = _open(fileName, io);
-                    auto out = Cineon::Read::readImage(info, io);
+                    auto out = Cineon::Read::readImage(info, io, _options.proxy);
                     out->setPluginName(pluginName);
                     return out;
                 }
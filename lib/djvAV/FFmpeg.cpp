@@ -42,6 +42,46 @@ namespace djv
                     return out;
                 }
 
+                Image::Type toYUVImageType(AVPixelFormat value)
+                {
+                    Image::Type out = Image::Type::None;
+                    switch (value)
+                    {
+                    case AV_PIX_FMT_YUV420P:   out = Image::Type::YUV_420P_U8; break;
+                    case AV_PIX_FMT_YUV422P:   out = Image::Type::YUV_422P_U8; break;
+                    case AV_PIX_FMT_YUV444P:   out = Image::Type::YUV_444P_U8; break;
+#if !defined(DJV_OPENGL_ES2)
+                    case AV_PIX_FMT_YUV420P10:
+                    case AV_PIX_FMT_YUV420P12:
+                    case AV_PIX_FMT_YUV420P16: out = Image::Type::YUV_420P_U16; break;
+                    case AV_PIX_FMT_YUV422P10:
+                    case AV_PIX_FMT_YUV422P12:
+                    case AV_PIX_FMT_YUV422P16: out = Image::Type::YUV_422P_U16; break;
+                    case AV_PIX_FMT_YUV444P10:
+                    case AV_PIX_FMT_YUV444P12:
+                    case AV_PIX_FMT_YUV444P16: out = Image::Type::YUV_444P_U16; break;
+#endif // DJV_OPENGL_ES2
+                    default: break;
+                    }
+                    return out;
+                }
+
+                AVPixelFormat toYUVPixelFormat(Image::Type value)
+                {
+                    AVPixelFormat out = AV_PIX_FMT_NONE;
+                    switch (value)
+                    {
+                    case Image::Type::YUV_420P_U8:  out = AV_PIX_FMT_YUV420P; break;
+                    case Image::Type::YUV_422P_U8:  out = AV_PIX_FMT_YUV422P; break;
+                    case Image::Type::YUV_444P_U8:  out = AV_PIX_FMT_YUV444P; break;
+                    case Image::Type::YUV_420P_U16: out = AV_PIX_FMT_YUV420P16; break;
+                    case Image::Type::YUV_422P_U16: out = AV_PIX_FMT_YUV422P16; break;
+                    case Image::Type::YUV_444P_U16: out = AV_PIX_FMT_YUV444P16; break;
+                    default: break;
+                    }
+                    return out;
+                }
+
                 std::string toString(AVSampleFormat value)
                 {
                     //! \todo How can we translate this?
@@ -127,10 +167,21 @@ namespace djv
                     fromJSON(value, p.options);
                 }
 
+                bool Plugin::canWrite(const FileSystem::FileInfo& fileInfo, const Info& info) const
+                {
+                    return info.video.size() && IPlugin::canWrite(fileInfo, info);
+                }
+
                 std::shared_ptr<IRead> Plugin::read(const FileSystem::FileInfo& fileInfo, const ReadOptions& options) const
                 {
                     DJV_PRIVATE_PTR();
-                    return Read::create(fileInfo, options, p.options, _textSystem, _resourceSystem, _logSystem);
+                    return Read::create(fileInfo, options, p.options, _textSystem, _resourceSystem, _logSystem, _frameCache);
+                }
+
+                std::shared_ptr<IWrite> Plugin::write(const FileSystem::FileInfo& fileInfo, const Info& info, const WriteOptions& options) const
+                {
+                    DJV_PRIVATE_PTR();
+                    return Write::create(fileInfo, info, options, p.options, _textSystem, _resourceSystem, _logSystem);
                 }
 
             } // namespace FFmpeg
@@ -142,6 +193,8 @@ namespace djv
         rapidjson::Value out(rapidjson::kObjectType);
         {
             out.AddMember("ThreadCount", toJSON(value.threadCount, allocator), allocator);
+            out.AddMember("Codec", toJSON(value.codec, allocator), allocator);
+            out.AddMember("BitRate", toJSON(value.bitRate, allocator), allocator);
         }
         return out;
     }
@@ -156,6 +209,14 @@ namespace djv
                 {
                     fromJSON(i.value, out.threadCount);
                 }
+                else if (0 == strcmp("Codec", i.name.GetString()))
+                {
+                    fromJSON(i.value, out.codec);
+                }
+                else if (0 == strcmp("BitRate", i.name.GetString()))
+                {
+                    fromJSON(i.value, out.bitRate);
+                }
             }
         }
         else
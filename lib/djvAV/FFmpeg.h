@@ -56,12 +56,29 @@ namespace djv
                 Audio::Type toAudioType(AVSampleFormat);
                 std::string toString(AVSampleFormat);
 
+                //! Get the planar YUV image type for a pixel format, or
+                //! Image::Type::None if there isn't one. Pixel formats with
+                //! 10 or 12 bits use the 16-bit image types, except with
+                //! OpenGL ES 2 which has no 16-bit textures.
+                Image::Type toYUVImageType(AVPixelFormat);
+
+                //! Get the pixel format for a planar YUV image type.
+                AVPixelFormat toYUVPixelFormat(Image::Type);
+
                 std::string getErrorString(int);
 
                 //! This struct provides the FFmpeg file I/O optioms.
                 struct Options
                 {
                     size_t threadCount = 4;
+
+                    //! The name of the video encoder used for writing. If this
+                    //! is empty the default encoder for the file format is used.
+                    std::string codec;
+
+                    //! The video bit rate used for writing. If this is zero the
+                    //! encoder default is used.
+                    size_t bitRate = 0;
                 };
 
                 //! This class provides the FFmpeg file reader.
@@ -76,7 +93,8 @@ namespace djv
                         const Options&,
                         const std::shared_ptr<Core::TextSystem>&,
                         const std::shared_ptr<Core::ResourceSystem>&,
-                        const std::shared_ptr<Core::LogSystem>&);
+                        const std::shared_ptr<Core::LogSystem>&,
+                        const std::shared_ptr<FrameCache>&);
                     Read();
 
                 public:
@@ -88,20 +106,39 @@ namespace djv
                         const Options&,
                         const std::shared_ptr<Core::TextSystem>&,
                         const std::shared_ptr<Core::ResourceSystem>&,
-                        const std::shared_ptr<Core::LogSystem>&);
+                        const std::shared_ptr<Core::LogSystem>&,
+                        const std::shared_ptr<FrameCache>&);
 
                     bool isRunning() const override;
 
                     std::future<Info> getInfo() override;
 
                     void seek(int64_t, Direction) override;
+                    bool hasCache() const override;
 
                 private:
+                    //! Get the index of the nearest keyframe at or before the
+                    //! given frame. The keyframe index is built the first time
+                    //! this is called, so that opening the file doesn't wait
+                    //! for the packets to be scanned.
+                    size_t _getKeyFrame(Core::Frame::Index);
+                    void _buildKeyFrameIndex();
+                    void _readPackets(bool read, Core::Frame::Index seek, bool cacheEnabled);
+                    void _readVideoFrame(bool cacheEnabled);
+                    std::shared_ptr<Image::Image> _readVideo(Core::Frame::Index, bool cacheEnabled);
+                    bool _seekVideo(size_t keyFrame, Core::Frame::Index);
+                    std::shared_ptr<Image::Image> _convertVideo();
+                    void _copyYUV(Image::Image&);
+
                     struct DecodeVideo
                     {
                         AVPacket*           packet       = nullptr;
                         Core::Frame::Number seek         = -1;
                         bool                cacheEnabled = false;
+
+                        //! If this is set the decoded images are stored here
+                        //! instead of being added to the queue.
+                        std::map<Core::Frame::Index, std::shared_ptr<Image::Image> >* images = nullptr;
                     };
                     int _decodeVideo(const DecodeVideo&, Core::Frame::Number&);
 
@@ -115,6 +152,59 @@ namespace djv
                     DJV_PRIVATE();
                 };
 
+                //! This class provides the FFmpeg file writer.
+                //!
+                //! Images are converted to the encoder pixel format in horizontal
+                //! slices on multiple threads, and encoded on the writer thread
+                //! with frame threading. Audio is muxed from the audio queue if
+                //! the information has an audio track.
+                class Write : public IWrite
+                {
+                    DJV_NON_COPYABLE(Write);
+
+                protected:
+                    void _init(
+                        const Core::FileSystem::FileInfo&,
+                        const Info&,
+                        const WriteOptions&,
+                        const Options&,
+                        const std::shared_ptr<Core::TextSystem>&,
+                        const std::shared_ptr<Core::ResourceSystem>&,
+                        const std::shared_ptr<Core::LogSystem>&);
+                    Write();
+
+                public:
+                    ~Write() override;
+
+                    //! Throws:
+                    //! - Core::FileSystem::Error
+                    static std::shared_ptr<Write> create(
+                        const Core::FileSystem::FileInfo&,
+                        const Info&,
+                        const WriteOptions&,
+                        const Options&,
+                        const std::shared_ptr<Core::TextSystem>&,
+                        const std::shared_ptr<Core::ResourceSystem>&,
+                        const std::shared_ptr<Core::LogSystem>&);
+
+                    bool isRunning() const override;
+
+                private:
+                    void _openVideo();
+                    void _openAudio();
+                    void _convertVideo(const std::shared_ptr<Image::Image>&);
+                    void _convertSlice(size_t, const uint8_t*, int scanlineByteCount);
+                    void _startSliceThreads();
+                    void _stopSliceThreads();
+                    void _writeVideo(const std::shared_ptr<Image::Image>&);
+                    void _writeAudio(const std::shared_ptr<Audio::Data>&);
+                    void _flushAudio();
+                    void _encode(int stream, AVFrame*);
+                    void _close();
+
+                    DJV_PRIVATE();
+                };
+
                 //! This class provides the FFmpeg file I/O plugin.
                 class Plugin : public IPlugin
                 {
@@ -131,7 +221,10 @@ namespace djv
                     rapidjson::Value getOptions(rapidjson::Document::AllocatorType&) const override;
                     void setOptions(const rapidjson::Value&) override;
 
+                    bool canWrite(const Core::FileSystem::FileInfo&, const Info&) const override;
+
                     std::shared_ptr<IRead> read(const Core::FileSystem::FileInfo&, const ReadOptions&) const override;
+                    std::shared_ptr<IWrite> write(const Core::FileSystem::FileInfo&, const Info&, const WriteOptions&) const override;
 
                 private:
                     DJV_PRIVATE();
@@ -4,8 +4,11 @@
 
 #include <djvAV/FFmpeg.h>
 
+#include <djvAV/IOFrameCache.h>
+
 #include <djvCore/FileSystem.h>
 #include <djvCore/LogSystem.h>
+#include <djvCore/Memory.h>
 #include <djvCore/StringFormat.h>
 #include <djvCore/TextSystem.h>
 #include <djvCore/Timer.h>
@@ -16,10 +19,13 @@ extern "C"
 #include <libavformat/avformat.h>
 #include <libavutil/dict.h>
 #include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
 #include <libswscale/swscale.h>
 
 } // extern "C"
 
+#include <algorithm>
+
 using namespace djv::Core;
 
 namespace djv
@@ -30,10 +36,43 @@ namespace djv
         {
             namespace FFmpeg
             {
+                namespace
+                {
+                    //! \todo Should this be configurable?
+                    const double infoTimeout = 0.5;
+
+                    //! The maximum amount of memory used by the decoded frames
+                    //! that have not been added to the queue yet.
+                    const size_t gopMaxByteCount = 256 * Memory::megabyte;
+
+                    //! The minimum number of decoded frames to keep, so that frames
+                    //! output out of order by the decoder don't evict the frame
+                    //! being read.
+                    const size_t gopMin = 8;
+
+                    //! Get whether the decoded images can be passed through as
+                    //! planar YUV. The image types use the BT.709 limited range
+                    //! coefficients, other color spaces are converted to RGB by
+                    //! the software scaler.
+                    bool isYUVCompatible(const AVCodecParameters* value)
+                    {
+                        bool out = value->color_range != AVCOL_RANGE_JPEG;
+                        switch (value->color_space)
+                        {
+                        case AVCOL_SPC_BT709: break;
+                        case AVCOL_SPC_UNSPECIFIED: out &= value->height > 576; break;
+                        default: out = false; break;
+                        }
+                        return out;
+                    }
+
+                } // namespace
+
                 struct Read::Private
                 {
                     Options options;
                     VideoInfo videoInfo;
+                    Image::Info imageInfo;
                     AudioInfo audioInfo;
                     Time::Speed speed;
                     std::promise<Info> infoPromise;
@@ -42,6 +81,7 @@ namespace djv
                     Direction direction = Direction::Forward;
                     std::thread thread;
                     std::atomic<bool> running;
+                    std::atomic<bool> hasVideo;
 
                     AVFormatContext * avFormatContext = nullptr;
                     int avVideoStream = -1;
@@ -51,6 +91,56 @@ namespace djv
                     AVFrame * avFrame = nullptr;
                     AVFrame * avFrameRgb = nullptr;
                     SwsContext * swsContext = nullptr;
+
+                    //! The number of bits planar YUV samples are shifted up to
+                    //! fill the 16-bit image types.
+                    int yuvShift = 0;
+
+                    //! This struct provides an entry in the keyframe index.
+                    struct KeyFrame
+                    {
+                        Frame::Index frame     = 0;
+                        int64_t      timestamp = 0;
+                    };
+                    std::vector<KeyFrame> keyFrames;
+                    bool keyFramesInit = false;
+                    size_t sequenceSize = 0;
+
+                    //! The next video frame to be read.
+                    Frame::Index frame = 0;
+
+                    //! The next frame that will be output by the video decoder,
+                    //! or invalid if it is not known.
+                    Frame::Index decoderFrame = Frame::invalid;
+
+                    //! Decoded frames that have not been added to the queue yet.
+                    //! The size is limited by getGOPMax().
+                    std::map<Frame::Index, std::shared_ptr<Image::Image> > gop;
+
+                    bool packetRead = false;
+                    std::chrono::steady_clock::time_point infoTimer;
+
+                    //! Get the index of the nearest keyframe at or before the given
+                    //! frame, or the size of the index if it is empty.
+                    size_t getKeyFrame(Frame::Index value) const
+                    {
+                        const auto i = std::upper_bound(
+                            keyFrames.begin(),
+                            keyFrames.end(),
+                            value,
+                            [](Frame::Index a, const KeyFrame& b)
+                            {
+                                return a < b.frame;
+                            });
+                        return i != keyFrames.begin() ? (i - keyFrames.begin() - 1) : 0;
+                    }
+
+                    //! Get the maximum number of decoded frames to keep.
+                    size_t getGOPMax() const
+                    {
+                        const size_t dataByteCount = imageInfo.getDataByteCount();
+                        return std::max(gopMin, dataByteCount ? (gopMaxByteCount / dataByteCount) : 0);
+                    }
                 };
 
                 void Read::_init(
@@ -59,12 +149,15 @@ namespace djv
                     const Options& options,
                     const std::shared_ptr<TextSystem>& textSystem,
                     const std::shared_ptr<ResourceSystem>& resourceSystem,
-                    const std::shared_ptr<LogSystem>& logSystem)
+                    const std::shared_ptr<LogSystem>& logSystem,
+                    const std::shared_ptr<FrameCache>& frameCache)
                 {
                     IRead::_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem);
                     DJV_PRIVATE_PTR();
+                    _cache.setFrameCache(frameCache, fileInfo.getFileName(), readOptions.layer, readOptions.proxy, readOptions.colorSpace);
                     p.options = options;
                     p.running = true;
+                    p.hasVideo = false;
                     p.thread = std::thread(
                         [this]
                     {
@@ -125,7 +218,7 @@ namespace djv
                                 p.avFrame = av_frame_alloc();
                             }
 
-                            size_t sequenceSize = 0;
+                            size_t& sequenceSize = p.sequenceSize;
                             if (p.avVideoStream != -1)
                             {
                                 // Find the codec for the video stream.
@@ -167,24 +260,46 @@ namespace djv
                                 // Initialize the buffers.
                                 p.avFrameRgb = av_frame_alloc();
 
-                                // Initialize the software scaler.
-                                p.swsContext = sws_getContext(
-                                    p.avCodecParameters[p.avVideoStream]->width,
-                                    p.avCodecParameters[p.avVideoStream]->height,
-                                    static_cast<AVPixelFormat>(p.avCodecParameters[p.avVideoStream]->format),
-                                    p.avCodecParameters[p.avVideoStream]->width,
-                                    p.avCodecParameters[p.avVideoStream]->height,
-                                    AV_PIX_FMT_RGBA,
-                                    SWS_BILINEAR,
-                                    0,
-                                    0,
-                                    0);
-
-                                // Get information.
+                                // Get information. Planar YUV images are passed
+                                // through so they can be converted to RGB when
+                                // they are drawn.
+                                const AVPixelFormat avPixelFormat = static_cast<AVPixelFormat>(p.avCodecParameters[p.avVideoStream]->format);
+                                Image::Type imageType = toYUVImageType(avPixelFormat);
+                                if (Image::Type::None == imageType || !isYUVCompatible(p.avCodecParameters[p.avVideoStream]))
+                                {
+                                    imageType = Image::Type::RGBA_U8;
+                                }
                                 const auto pixelDataInfo = Image::Info(
                                     p.avCodecParameters[p.avVideoStream]->width,
                                     p.avCodecParameters[p.avVideoStream]->height,
-                                    Image::Type::RGBA_U8);
+                                    imageType);
+                                p.imageInfo = pixelDataInfo;
+                                p.imageInfo.size = getProxySize(pixelDataInfo.size, _options.proxy);
+                                if (Image::isYUVType(imageType))
+                                {
+                                    if (const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(avPixelFormat))
+                                    {
+                                        p.yuvShift = Image::getBitDepth(imageType) - desc->comp[0].depth;
+                                    }
+                                }
+
+                                // Initialize the software scaler. Proxies are scaled
+                                // down as part of the pixel format conversion. Planar
+                                // YUV images only need the scaler for proxies.
+                                if (!Image::isYUVType(imageType) || _options.proxy > 0)
+                                {
+                                    p.swsContext = sws_getContext(
+                                        p.avCodecParameters[p.avVideoStream]->width,
+                                        p.avCodecParameters[p.avVideoStream]->height,
+                                        avPixelFormat,
+                                        p.imageInfo.size.w,
+                                        p.imageInfo.size.h,
+                                        Image::isYUVType(imageType) ? toYUVPixelFormat(imageType) : AV_PIX_FMT_RGBA,
+                                        _options.proxy > 0 ? SWS_AREA : SWS_BILINEAR,
+                                        0,
+                                        0,
+                                        0);
+                                }
                                 if (avVideoStream->duration != AV_NOPTS_VALUE)
                                 {
                                     AVRational r;
@@ -209,6 +324,7 @@ namespace djv
                                 p.videoInfo = VideoInfo(pixelDataInfo, p.speed, Frame::Sequence(Frame::Range(1, sequenceSize)));
                                 p.videoInfo.codec = std::string(avVideoCodec->long_name);
                                 info.video.push_back(p.videoInfo);
+                                p.hasVideo = true;
                                 /*{
                                     std::stringstream ss;
                                     ss << _fileInfo << ": image size " << pixelDataInfo.size << "\n";
@@ -303,67 +419,54 @@ namespace djv
 
                             p.infoPromise.set_value(info);
 
+                            p.infoTimer = std::chrono::steady_clock::now();
                             while (p.running)
                             {
-                                //! \todo Implement me!
-                                /*bool cacheEnabled = false;
+                                // Update the options.
+                                bool playback = false;
+                                InOutPoints inOutPoints;
+                                bool cacheEnabled = false;
                                 size_t cacheMaxByteCount = 0;
                                 {
                                     std::lock_guard<std::mutex> lock(_mutex);
+                                    playback = _playback;
+                                    inOutPoints = _inOutPoints;
                                     cacheEnabled = _cacheEnabled;
                                     cacheMaxByteCount = _cacheMaxByteCount;
-                                    _cachedFrames = _getCachedFrames(_cache);
                                 }
                                 if (!cacheEnabled)
                                 {
                                     _cache.clear();
                                 }
-                                if (info.video.size() && _options.layer < info.video.size())
+                                if (p.avVideoStream != -1)
                                 {
-                                    const size_t dataByteCount = info.video[_options.layer].info.getDataByteCount();
-                                    _cache.setMax(cacheMaxByteCount / dataByteCount);
+                                    const size_t dataByteCount = p.imageInfo.getDataByteCount();
+                                    const size_t cacheMax = dataByteCount ? (cacheMaxByteCount / dataByteCount) : 0;
+
+                                    // The cache window is one frame larger than the maximum,
+                                    // leave room for it so the window fits in the budget.
+                                    _cache.setMax(cacheMax > 0 ? (cacheMax - 1) : 0);
+                                    _cache.setSequenceSize(sequenceSize);
+                                    _cache.setInOutPoints(inOutPoints);
                                 }
                                 else
                                 {
                                     _cache.setMax(0);
-                                }*/
+                                }
 
                                 bool read = false;
                                 int64_t seek = Frame::invalid;
                                 {
-                                    //const std::vector<Frame::Number> cachedFrames = _cache.getKeys();
                                     std::unique_lock<std::mutex> lock(_mutex);
                                     if (p.queueCV.wait_for(
                                         lock,
                                         Time::getTime(Time::TimerValue::Fast),
-                                        [this, sequenceSize]
-                                        //[this, sequenceSize, cacheEnabled, &cachedFrames]
+                                        [this]
                                     {
                                         DJV_PRIVATE_PTR();
                                         const bool video = p.avVideoStream != -1 && (_videoQueue.isFinished() ? false : (_videoQueue.getCount() < _videoQueue.getMax()));
                                         const bool audio = p.avAudioStream != -1 && (_audioQueue.isFinished() ? false : (_audioQueue.getCount() < _audioQueue.getMax()));
-
-                                        /*bool cache = false;
-                                        if (cacheEnabled && !_videoQueue.isFinished() && !_audioQueue.isFinished())
-                                        {
-                                            const size_t cacheMax = _cache.getMax();
-                                            cache |= _cache.getSize() < cacheMax;
-                                            if (_videoQueue.getFrameCount())
-                                            {
-                                                const auto& frame = _videoQueue.getFrame();
-                                                for (const auto& i : cachedFrames)
-                                                {
-                                                    if (i < frame.frame || i > frame.frame + cacheMax)
-                                                    {
-                                                        cache = true;
-                                                        break;
-                                                    }
-                                                }
-                                            }
-                                        }*/
-                                        
                                         return video || audio || p.seek != Frame::invalid || p.direction != _direction;
-                                        //return video || audio || p.seek != Frame::invalid || p.direction != _direction || cache;
                                     }))
                                     {
                                         read = true;
@@ -386,150 +489,78 @@ namespace djv
                                         }
                                     }
                                 }
-                                AVPacket packet;
-                                try
+
+                                // Keep the cache window around the next frame to be displayed.
                                 {
-                                    if (seek != Frame::invalid)
+                                    Frame::Index frame = p.frame;
                                     {
-                                        int64_t t = 0;
-                                        int stream = -1;
-                                        if (p.avVideoStream != -1)
-                                        {
-                                            stream = p.avVideoStream;
-                                            AVRational r;
-                                            r.num = p.speed.getDen();
-                                            r.den = p.speed.getNum();
-                                            t = av_rescale_q(seek, r, p.avFormatContext->streams[p.avVideoStream]->time_base);
-                                            //t = av_rescale_q(seek, r, av_get_time_base_q());
-                                        }
-                                        else if (p.avAudioStream != -1)
-                                        {
-                                            stream = p.avAudioStream;
-                                            AVRational r;
-                                            r.num = 1;
-                                            r.den = p.audioInfo.info.sampleRate;
-                                            t = av_rescale_q(seek, r, p.avFormatContext->streams[p.avAudioStream]->time_base);
-                                            //t = av_rescale_q(seek, r, av_get_time_base_q());
-                                        }
-                                        if (p.avVideoStream != -1)
-                                        {
-                                            avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
-                                        }
-                                        if (p.avAudioStream != -1)
-                                        {
-                                            avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
-                                        }
-                                        if (av_seek_frame(
-                                            p.avFormatContext,
-                                            stream,
-                                            t,
-                                            AVSEEK_FLAG_BACKWARD) < 0)
-                                        {
-                                            throw std::exception();
-                                        }
-                                        Frame::Number videoFrame = Frame::invalid;
-                                        Frame::Number audioFrame = Frame::invalid;
-                                        while (videoFrame < seek - 1 || audioFrame < seek - 1)
+                                        std::lock_guard<std::mutex> lock(_mutex);
+                                        if (_videoQueue.getCount())
                                         {
-                                            if (av_read_frame(p.avFormatContext, &packet) < 0)
-                                            {
-                                                if (p.avVideoStream != -1)
-                                                {
-                                                    DecodeVideo dv;
-                                                    //dv.cacheEnabled = cacheEnabled;
-                                                    dv.seek         = seek;
-                                                    _decodeVideo(dv, videoFrame);
-                                                    avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
-                                                }
-                                                if (p.avAudioStream != -1)
-                                                {
-                                                    DecodeAudio da;
-                                                    da.seek = seek;
-                                                    _decodeAudio(da, audioFrame);
-                                                    avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
-                                                }
-                                                throw std::exception();
-                                            }
-                                            if (p.avVideoStream == packet.stream_index)
-                                            {
-                                                DecodeVideo dv;
-                                                dv.packet       = &packet;
-                                                dv.seek         = seek;
-                                                //dv.cacheEnabled = cacheEnabled;
-                                                if (_decodeVideo(dv, videoFrame) < 0)
-                                                {
-                                                    throw std::exception();
-                                                }
-                                            }
-                                            else if (p.avAudioStream == packet.stream_index)
-                                            {
-                                                DecodeAudio da;
-                                                da.packet = &packet;
-                                                da.seek   = seek;
-                                                if (_decodeAudio(da, audioFrame) < 0)
-                                                {
-                                                    throw std::exception();
-                                                }
-                                            }
-                                            av_packet_unref(&packet);
+                                            frame = _videoQueue.getFrame().frame;
                                         }
                                     }
+                                    _cache.setDirection(p.direction);
+                                    _cache.setCurrentFrame(frame);
+                                }
+
+                                // Video is read a frame at a time from the cache and
+                                // the keyframe index, except for forward playback with
+                                // audio where the packets are read in order.
+                                if (p.avVideoStream != -1 &&
+                                    (Direction::Reverse == p.direction || !playback || -1 == p.avAudioStream))
+                                {
+                                    if (p.packetRead)
+                                    {
+                                        p.packetRead = false;
+                                        p.decoderFrame = Frame::invalid;
+                                    }
+                                    if (seek != Frame::invalid)
+                                    {
+                                        p.frame = seek;
+                                    }
                                     if (read)
                                     {
-                                        Frame::Number videoFrame = Frame::invalid;
-                                        Frame::Number audioFrame = Frame::invalid;
-                                        int r = av_read_frame(p.avFormatContext, &packet);
-                                        if (r < 0)
-                                        {
-                                            if (p.avVideoStream != -1)
-                                            {
-                                                DecodeVideo dv;
-                                                //dv.cacheEnabled = cacheEnabled;
-                                                _decodeVideo(dv, videoFrame);
-                                                avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
-                                            }
-                                            if (p.avAudioStream != -1)
-                                            {
-                                                DecodeAudio da;
-                                                _decodeAudio(da, audioFrame);
-                                                avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
-                                            }
-                                            throw std::exception();
-                                        }
-                                        if (p.avVideoStream == packet.stream_index)
+                                        if (p.avAudioStream != -1)
                                         {
-                                            DecodeVideo dv;
-                                            dv.packet       = &packet;
-                                            //dv.cacheEnabled = cacheEnabled;
-                                            if (_decodeVideo(dv, videoFrame) < 0)
-                                            {
-                                                throw std::exception();
-                                            }
+                                            std::lock_guard<std::mutex> lock(_mutex);
+                                            _audioQueue.setFinished(true);
                                         }
-                                        else if (p.avAudioStream == packet.stream_index)
+                                        _readVideoFrame(cacheEnabled);
+                                    }
+                                }
+                                else
+                                {
+                                    if (!p.packetRead)
+                                    {
+                                        // Synchronize the decoders with the next frame.
+                                        p.packetRead = true;
+                                        p.gop.clear();
+                                        if (Frame::invalid == seek)
                                         {
-                                            DecodeAudio da;
-                                            da.packet = &packet;
-                                            if (_decodeAudio(da, audioFrame) < 0)
-                                            {
-                                                throw std::exception();
-                                            }
+                                            seek = p.frame;
+                                            std::lock_guard<std::mutex> lock(_mutex);
+                                            _videoQueue.setFinished(false);
+                                            _audioQueue.setFinished(false);
                                         }
-                                        av_packet_unref(&packet);
                                     }
+                                    _readPackets(read, seek, cacheEnabled);
                                 }
-                                catch (const std::exception&)
+
+                                // Update information.
+                                const auto now = std::chrono::steady_clock::now();
+                                std::chrono::duration<double> delta = now - p.infoTimer;
+                                if (delta.count() > infoTimeout)
                                 {
-                                    /*{
-                                        std::stringstream ss;
-                                        ss << _fileInfo << ": finished";
-                                        _logSystem->log("djv::AV::IO::FFmpeg::Read", ss.str());
-                                    }*/
-                                    av_packet_unref(&packet);
+                                    p.infoTimer = now;
+                                    size_t cacheByteCount = _cache.getTotalByteCount();
+                                    auto cacheSequence = _cache.getSequence();
+                                    auto cachedFrames = _cache.getFrames();
                                     {
                                         std::lock_guard<std::mutex> lock(_mutex);
-                                        _videoQueue.setFinished(true);
-                                        _audioQueue.setFinished(true);
+                                        _cacheByteCount = cacheByteCount;
+                                        _cacheSequence = cacheSequence;
+                                        _cachedFrames = std::move(cachedFrames);
                                     }
                                 }
                             }
@@ -588,10 +619,11 @@ namespace djv
                     const Options& options,
                     const std::shared_ptr<TextSystem>& textSystem,
                     const std::shared_ptr<ResourceSystem>& resourceSystem,
-                    const std::shared_ptr<LogSystem>& logSystem)
+                    const std::shared_ptr<LogSystem>& logSystem,
+                    const std::shared_ptr<FrameCache>& frameCache)
                 {
                     auto out = std::shared_ptr<Read>(new Read);
-                    out->_init(fileInfo, readOptions, options, textSystem, resourceSystem, logSystem);
+                    out->_init(fileInfo, readOptions, options, textSystem, resourceSystem, logSystem, frameCache);
                     return out;
                 }
 
@@ -605,7 +637,7 @@ namespace djv
                     return _p->infoPromise.get_future();
                 }
 
-                void Read::seek(Frame::Number value, Direction)
+                void Read::seek(Frame::Number value, Direction direction)
                 {
                     DJV_PRIVATE_PTR();
                     {
@@ -613,10 +645,482 @@ namespace djv
                         _videoQueue.clearFrames();
                         _audioQueue.clearFrames();
                         p.seek = value;
+                        _direction = direction;
                     }
                     p.queueCV.notify_one();
                 }
 
+                bool Read::hasCache() const
+                {
+                    return _p->hasVideo;
+                }
+
+                size_t Read::_getKeyFrame(Frame::Index value)
+                {
+                    DJV_PRIVATE_PTR();
+                    if (!p.keyFramesInit)
+                    {
+                        p.keyFramesInit = true;
+                        _buildKeyFrameIndex();
+                    }
+                    return p.getKeyFrame(value);
+                }
+
+                void Read::_buildKeyFrameIndex()
+                {
+                    DJV_PRIVATE_PTR();
+                    auto avVideoStream = p.avFormatContext->streams[p.avVideoStream];
+                    AVRational r;
+                    r.num = p.speed.getDen();
+                    r.den = p.speed.getNum();
+                    std::vector<Private::KeyFrame> keyFrames;
+
+                    // Use the index from the container if there is one.
+                    for (int i = 0; i < avVideoStream->nb_index_entries; ++i)
+                    {
+                        const auto& entry = avVideoStream->index_entries[i];
+                        if (entry.flags & AVINDEX_KEYFRAME)
+                        {
+                            Private::KeyFrame keyFrame;
+                            keyFrame.frame = av_rescale_q(entry.timestamp, avVideoStream->time_base, r);
+                            keyFrame.timestamp = entry.timestamp;
+                            keyFrames.push_back(keyFrame);
+                        }
+                    }
+
+                    // Otherwise scan the packets for keyframes.
+                    if (keyFrames.empty())
+                    {
+                        AVPacket packet;
+                        while (av_read_frame(p.avFormatContext, &packet) >= 0)
+                        {
+                            if (p.avVideoStream == packet.stream_index && (packet.flags & AV_PKT_FLAG_KEY))
+                            {
+                                const int64_t t = packet.pts != AV_NOPTS_VALUE ? packet.pts : packet.dts;
+                                if (t != AV_NOPTS_VALUE)
+                                {
+                                    Private::KeyFrame keyFrame;
+                                    keyFrame.frame = av_rescale_q(t, avVideoStream->time_base, r);
+                                    keyFrame.timestamp = t;
+                                    keyFrames.push_back(keyFrame);
+                                }
+                            }
+                            av_packet_unref(&packet);
+                        }
+                        av_seek_frame(
+                            p.avFormatContext,
+                            p.avVideoStream,
+                            avVideoStream->start_time != AV_NOPTS_VALUE ? avVideoStream->start_time : 0,
+                            AVSEEK_FLAG_BACKWARD);
+                        p.decoderFrame = Frame::invalid;
+                    }
+
+                    std::sort(
+                        keyFrames.begin(),
+                        keyFrames.end(),
+                        [](const Private::KeyFrame& a, const Private::KeyFrame& b)
+                        {
+                            return a.frame < b.frame;
+                        });
+                    p.keyFrames = std::move(keyFrames);
+                }
+
+                void Read::_readVideoFrame(bool cacheEnabled)
+                {
+                    DJV_PRIVATE_PTR();
+                    std::shared_ptr<Image::Image> image;
+                    if (p.frame >= 0 && (0 == p.sequenceSize || p.frame < static_cast<Frame::Index>(p.sequenceSize)))
+                    {
+                        image = _readVideo(p.frame, cacheEnabled);
+                    }
+                    if (!image)
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _videoQueue.setFinished(true);
+                        return;
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if (Frame::invalid == p.seek)
+                        {
+                            _videoQueue.addFrame(VideoFrame(p.frame, image));
+                        }
+                    }
+
+                    // Discard the decoded frames that are behind the playhead.
+                    switch (p.direction)
+                    {
+                    case Direction::Forward:
+                        p.gop.erase(p.gop.begin(), p.gop.upper_bound(p.frame));
+                        ++p.frame;
+                        break;
+                    case Direction::Reverse:
+                        p.gop.erase(p.gop.lower_bound(p.frame), p.gop.end());
+                        --p.frame;
+                        break;
+                    default: break;
+                    }
+                }
+
+                std::shared_ptr<Image::Image> Read::_readVideo(Frame::Index frame, bool cacheEnabled)
+                {
+                    DJV_PRIVATE_PTR();
+                    std::shared_ptr<Image::Image> out;
+                    if (cacheEnabled && _cache.get(frame, out))
+                    {
+                        return out;
+                    }
+                    auto i = p.gop.find(frame);
+                    if (i != p.gop.end())
+                    {
+                        return i->second;
+                    }
+
+                    // Seek unless the decoder is already positioned in the same
+                    // group of pictures before the frame.
+                    size_t keyFrame = _getKeyFrame(frame);
+                    const Frame::Index keyFrameFrame = keyFrame < p.keyFrames.size() ? p.keyFrames[keyFrame].frame : 0;
+                    const bool sequential =
+                        p.decoderFrame != Frame::invalid &&
+                        p.decoderFrame <= frame &&
+                        p.decoderFrame >= keyFrameFrame;
+                    if (!sequential && !_seekVideo(keyFrame, frame))
+                    {
+                        return nullptr;
+                    }
+                    for (int attempt = 0; attempt < 2; ++attempt)
+                    {
+                        // Decode until the frame is reached or the end of the file.
+                        AVPacket packet;
+                        bool eof = false;
+                        while (p.gop.find(frame) == p.gop.end() && !eof)
+                        {
+                            DecodeVideo dv;
+                            dv.cacheEnabled = cacheEnabled;
+                            dv.images       = &p.gop;
+                            Frame::Number decoded = Frame::invalid;
+                            if (av_read_frame(p.avFormatContext, &packet) < 0)
+                            {
+                                _decodeVideo(dv, decoded);
+                                avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                                eof = true;
+                            }
+                            else
+                            {
+                                if (p.avVideoStream == packet.stream_index)
+                                {
+                                    dv.packet = &packet;
+                                    if (_decodeVideo(dv, decoded) < 0)
+                                    {
+                                        eof = true;
+                                    }
+                                }
+                                av_packet_unref(&packet);
+                            }
+                            if (decoded != Frame::invalid)
+                            {
+                                p.decoderFrame = decoded + 1;
+                            }
+                            if (eof)
+                            {
+                                p.decoderFrame = Frame::invalid;
+                            }
+                        }
+                        i = p.gop.find(frame);
+                        if (i != p.gop.end())
+                        {
+                            out = i->second;
+                            break;
+                        }
+
+                        // The frame may depend on an earlier group of pictures
+                        // (open GOP), try again from the previous keyframe.
+                        if (keyFrame > 0 && keyFrame < p.keyFrames.size())
+                        {
+                            --keyFrame;
+                        }
+                        if (!_seekVideo(keyFrame, frame))
+                        {
+                            break;
+                        }
+                    }
+                    return out;
+                }
+
+                bool Read::_seekVideo(size_t keyFrame, Frame::Index frame)
+                {
+                    DJV_PRIVATE_PTR();
+                    auto avVideoStream = p.avFormatContext->streams[p.avVideoStream];
+                    int64_t t = 0;
+                    if (keyFrame < p.keyFrames.size())
+                    {
+                        t = p.keyFrames[keyFrame].timestamp;
+                    }
+                    else
+                    {
+                        AVRational r;
+                        r.num = p.speed.getDen();
+                        r.den = p.speed.getNum();
+                        t = av_rescale_q(frame, r, avVideoStream->time_base);
+                    }
+                    avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                    if (p.avAudioStream != -1)
+                    {
+                        avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
+                    }
+                    p.gop.clear();
+                    p.decoderFrame = Frame::invalid;
+                    return av_seek_frame(p.avFormatContext, p.avVideoStream, t, AVSEEK_FLAG_BACKWARD) >= 0;
+                }
+
+                std::shared_ptr<Image::Image> Read::_convertVideo()
+                {
+                    DJV_PRIVATE_PTR();
+                    auto info = p.imageInfo;
+                    if (!((0 == p.avFrame->sample_aspect_ratio.num && 1 == p.avFrame->sample_aspect_ratio.den) ||
+                        0 == p.avFrame->sample_aspect_ratio.den))
+                    {
+                        info.pixelAspectRatio = p.avFrame->sample_aspect_ratio.num / static_cast<float>(p.avFrame->sample_aspect_ratio.den);
+                    }
+                    auto out = Image::Image::create(info);
+                    out->setPluginName(pluginName);
+                    if (Image::isYUVType(info.type))
+                    {
+                        _copyYUV(*out);
+                        return out;
+                    }
+                    av_image_fill_arrays(
+                        p.avFrameRgb->data,
+                        p.avFrameRgb->linesize,
+                        out->getData(),
+                        AV_PIX_FMT_RGBA,
+                        out->getWidth(),
+                        out->getHeight(),
+                        1);
+                    sws_scale(
+                        p.swsContext,
+                        (uint8_t const* const*)p.avFrame->data,
+                        p.avFrame->linesize,
+                        0,
+                        p.avCodecParameters[p.avVideoStream]->height,
+                        p.avFrameRgb->data,
+                        p.avFrameRgb->linesize);
+                    return out;
+                }
+
+                void Read::_copyYUV(Image::Image& out)
+                {
+                    DJV_PRIVATE_PTR();
+                    const auto& info = out.getInfo();
+                    if (p.swsContext)
+                    {
+                        uint8_t* data[4] = { nullptr, nullptr, nullptr, nullptr };
+                        int linesize[4] = { 0, 0, 0, 0 };
+                        for (uint8_t i = 0; i < 3; ++i)
+                        {
+                            data[i] = out.getPlaneData(i);
+                            linesize[i] = static_cast<int>(info.getPlaneScanlineByteCount(i));
+                        }
+                        sws_scale(
+                            p.swsContext,
+                            (uint8_t const* const*)p.avFrame->data,
+                            p.avFrame->linesize,
+                            0,
+                            p.avCodecParameters[p.avVideoStream]->height,
+                            data,
+                            linesize);
+                    }
+                    else
+                    {
+                        for (uint8_t i = 0; i < 3; ++i)
+                        {
+                            const auto planeSize = info.getPlaneSize(i);
+                            const size_t byteCount = planeSize.w * Image::getByteCount(info.type);
+                            const size_t scanlineByteCount = info.getPlaneScanlineByteCount(i);
+                            uint8_t* outP = out.getPlaneData(i);
+                            for (uint16_t y = 0; y < planeSize.h; ++y)
+                            {
+                                const uint8_t* inP = p.avFrame->data[i] + y * static_cast<ptrdiff_t>(p.avFrame->linesize[i]);
+                                if (0 == p.yuvShift)
+                                {
+                                    memcpy(outP, inP, byteCount);
+                                }
+                                else
+                                {
+                                    const uint16_t* inP16 = reinterpret_cast<const uint16_t*>(inP);
+                                    uint16_t* outP16 = reinterpret_cast<uint16_t*>(outP);
+                                    for (uint16_t x = 0; x < planeSize.w; ++x)
+                                    {
+                                        outP16[x] = inP16[x] << p.yuvShift;
+                                    }
+                                }
+                                outP += scanlineByteCount;
+                            }
+                        }
+                    }
+                }
+
+                void Read::_readPackets(bool read, Frame::Index seek, bool cacheEnabled)
+                {
+                    DJV_PRIVATE_PTR();
+                    AVPacket packet;
+                    try
+                    {
+                        if (seek != Frame::invalid)
+                        {
+                            int64_t t = 0;
+                            int stream = -1;
+                            if (p.avVideoStream != -1)
+                            {
+                                // Seek to the nearest keyframe so the demuxer doesn't
+                                // need to search for it.
+                                stream = p.avVideoStream;
+                                const size_t keyFrame = _getKeyFrame(seek);
+                                if (keyFrame < p.keyFrames.size())
+                                {
+                                    t = p.keyFrames[keyFrame].timestamp;
+                                }
+                                else
+                                {
+                                    AVRational r;
+                                    r.num = p.speed.getDen();
+                                    r.den = p.speed.getNum();
+                                    t = av_rescale_q(seek, r, p.avFormatContext->streams[p.avVideoStream]->time_base);
+                                }
+                            }
+                            else if (p.avAudioStream != -1)
+                            {
+                                stream = p.avAudioStream;
+                                AVRational r;
+                                r.num = 1;
+                                r.den = p.audioInfo.info.sampleRate;
+                                t = av_rescale_q(seek, r, p.avFormatContext->streams[p.avAudioStream]->time_base);
+                                //t = av_rescale_q(seek, r, av_get_time_base_q());
+                            }
+                            if (p.avVideoStream != -1)
+                            {
+                                avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                            }
+                            if (p.avAudioStream != -1)
+                            {
+                                avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
+                            }
+                            if (av_seek_frame(
+                                p.avFormatContext,
+                                stream,
+                                t,
+                                AVSEEK_FLAG_BACKWARD) < 0)
+                            {
+                                throw std::exception();
+                            }
+                            Frame::Number videoFrame = Frame::invalid;
+                            Frame::Number audioFrame = Frame::invalid;
+                            while ((p.avVideoStream != -1 && videoFrame < seek - 1) ||
+                                (p.avAudioStream != -1 && audioFrame < seek - 1))
+                            {
+                                if (av_read_frame(p.avFormatContext, &packet) < 0)
+                                {
+                                    if (p.avVideoStream != -1)
+                                    {
+                                        DecodeVideo dv;
+                                        dv.cacheEnabled = cacheEnabled;
+                                        dv.seek         = seek;
+                                        _decodeVideo(dv, videoFrame);
+                                        avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                                    }
+                                    if (p.avAudioStream != -1)
+                                    {
+                                        DecodeAudio da;
+                                        da.seek = seek;
+                                        _decodeAudio(da, audioFrame);
+                                        avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
+                                    }
+                                    throw std::exception();
+                                }
+                                if (p.avVideoStream == packet.stream_index)
+                                {
+                                    DecodeVideo dv;
+                                    dv.packet       = &packet;
+                                    dv.seek         = seek;
+                                    dv.cacheEnabled = cacheEnabled;
+                                    if (_decodeVideo(dv, videoFrame) < 0)
+                                    {
+                                        throw std::exception();
+                                    }
+                                }
+                                else if (p.avAudioStream == packet.stream_index)
+                                {
+                                    DecodeAudio da;
+                                    da.packet = &packet;
+                                    da.seek   = seek;
+                                    if (_decodeAudio(da, audioFrame) < 0)
+                                    {
+                                        throw std::exception();
+                                    }
+                                }
+                                av_packet_unref(&packet);
+                            }
+                        }
+                        if (read)
+                        {
+                            Frame::Number videoFrame = Frame::invalid;
+                            Frame::Number audioFrame = Frame::invalid;
+                            int r = av_read_frame(p.avFormatContext, &packet);
+                            if (r < 0)
+                            {
+                                if (p.avVideoStream != -1)
+                                {
+                                    DecodeVideo dv;
+                                    dv.cacheEnabled = cacheEnabled;
+                                    _decodeVideo(dv, videoFrame);
+                                    avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                                }
+                                if (p.avAudioStream != -1)
+                                {
+                                    DecodeAudio da;
+                                    _decodeAudio(da, audioFrame);
+                                    avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
+                                }
+                                throw std::exception();
+                            }
+                            if (p.avVideoStream == packet.stream_index)
+                            {
+                                DecodeVideo dv;
+                                dv.packet       = &packet;
+                                dv.cacheEnabled = cacheEnabled;
+                                if (_decodeVideo(dv, videoFrame) < 0)
+                                {
+                                    throw std::exception();
+                                }
+                            }
+                            else if (p.avAudioStream == packet.stream_index)
+                            {
+                                DecodeAudio da;
+                                da.packet = &packet;
+                                if (_decodeAudio(da, audioFrame) < 0)
+                                {
+                                    throw std::exception();
+                                }
+                            }
+                            av_packet_unref(&packet);
+                        }
+                    }
+                    catch (const std::exception&)
+                    {
+                        /*{
+                            std::stringstream ss;
+                            ss << _fileInfo << ": finished";
+                            _logSystem->log("djv::AV::IO::FFmpeg::Read", ss.str());
+                        }*/
+                        av_packet_unref(&packet);
+                        {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            _videoQueue.setFinished(true);
+                            _audioQueue.setFinished(true);
+                        }
+                    }
+                }
+
                 int Read::_decodeVideo(const DecodeVideo& dv, Frame::Number& frame)
                 {
                     DJV_PRIVATE_PTR();
@@ -643,42 +1147,32 @@ namespace djv
                             r);
                         //std::cout << "decode video = " << frame << std::endl;
 
-                        if (Frame::invalid == dv.seek || frame >= dv.seek)
+                        const bool queue = !dv.images && (Frame::invalid == dv.seek || frame >= dv.seek);
+                        if (queue || dv.images || dv.cacheEnabled)
                         {
                             std::shared_ptr<Image::Image> image;
                             if (dv.cacheEnabled && _cache.get(frame, image))
                             {}
                             else
                             {
-                                auto info = p.videoInfo.info;
-                                if (!((0 == p.avFrame->sample_aspect_ratio.num && 1 == p.avFrame->sample_aspect_ratio.den) ||
-                                    0 == p.avFrame->sample_aspect_ratio.den))
-                                {
-                                    info.pixelAspectRatio = p.avFrame->sample_aspect_ratio.num / static_cast<float>(p.avFrame->sample_aspect_ratio.den);
-                                }
-                                image = Image::Image::create(info);
-                                image->setPluginName(pluginName);
-                                av_image_fill_arrays(
-                                    p.avFrameRgb->data,
-                                    p.avFrameRgb->linesize,
-                                    image->getData(),
-                                    AV_PIX_FMT_RGBA,
-                                    image->getWidth(),
-                                    image->getHeight(),
-                                    1);
-                                sws_scale(
-                                    p.swsContext,
-                                    (uint8_t const* const*)p.avFrame->data,
-                                    p.avFrame->linesize,
-                                    0,
-                                    p.avCodecParameters[p.avVideoStream]->height,
-                                    p.avFrameRgb->data,
-                                    p.avFrameRgb->linesize);
+                                image = _convertVideo();
                                 if (dv.cacheEnabled)
                                 {
                                     _cache.add(frame, image);
                                 }
                             }
+                            if (dv.images)
+                            {
+                                // Evict the earliest frames, they are the furthest
+                                // from the frame being read.
+                                (*dv.images)[frame] = image;
+                                const size_t gopMax = p.getGOPMax();
+                                while (dv.images->size() > gopMax)
+                                {
+                                    dv.images->erase(dv.images->begin());
+                                }
+                            }
+                            else if (queue)
                             {
                                 std::lock_guard<std::mutex> lock(_mutex);
                                 if (Frame::invalid == p.seek)
@@ -687,6 +1181,10 @@ namespace djv
                                 }
                             }
                         }
+                        if (!dv.images)
+                        {
+                            p.frame = frame + 1;
+                        }
                     }
                     return r;
                 }
@@ -0,0 +1,902 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/FFmpeg.h>
+
+#include <djvAV/ImageConvert.h>
+
+#include <djvCore/FileSystem.h>
+#include <djvCore/LogSystem.h>
+#include <djvCore/StringFormat.h>
+#include <djvCore/TextSystem.h>
+#include <djvCore/Timer.h>
+
+extern "C"
+{
+#include <libavformat/avformat.h>
+#include <libavutil/audio_fifo.h>
+#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+#include <libswresample/swresample.h>
+#include <libswscale/swscale.h>
+
+} // extern "C"
+
+#include <algorithm>
+#include <condition_variable>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace FFmpeg
+            {
+                namespace
+                {
+                    //! Get the pixel format for an image type, or AV_PIX_FMT_NONE if
+                    //! the image needs to be converted first.
+                    AVPixelFormat toPixelFormat(Image::Type value)
+                    {
+                        AVPixelFormat out = AV_PIX_FMT_NONE;
+                        switch (value)
+                        {
+                        case Image::Type::L_U8:     out = AV_PIX_FMT_GRAY8; break;
+                        case Image::Type::L_U16:    out = AV_PIX_FMT_GRAY16; break;
+                        case Image::Type::RGB_U8:   out = AV_PIX_FMT_RGB24; break;
+                        case Image::Type::RGB_U16:  out = AV_PIX_FMT_RGB48; break;
+                        case Image::Type::RGBA_U8:  out = AV_PIX_FMT_RGBA; break;
+                        case Image::Type::RGBA_U16: out = AV_PIX_FMT_RGBA64; break;
+                        default: break;
+                        }
+                        return out;
+                    }
+
+                    //! Get the image type used for images that can't be passed
+                    //! directly to the software scaler.
+                    Image::Type getConvertType(Image::Type value)
+                    {
+                        Image::Type out = value;
+                        if (Image::isYUVType(value))
+                        {
+                            out = Image::getRGBType(value);
+                        }
+                        else if (AV_PIX_FMT_NONE == toPixelFormat(value))
+                        {
+                            switch (Image::getChannels(value))
+                            {
+                            case Image::Channels::L:   out = Image::Type::L_U16; break;
+                            case Image::Channels::RGB: out = Image::Type::RGB_U16; break;
+                            default: out = Image::Type::RGBA_U16; break;
+                            }
+                        }
+                        return out;
+                    }
+
+                    AVSampleFormat toSampleFormat(Audio::Type value)
+                    {
+                        AVSampleFormat out = AV_SAMPLE_FMT_NONE;
+                        switch (value)
+                        {
+                        case Audio::Type::S16: out = AV_SAMPLE_FMT_S16; break;
+                        case Audio::Type::S32: out = AV_SAMPLE_FMT_S32; break;
+                        case Audio::Type::F32: out = AV_SAMPLE_FMT_FLT; break;
+                        case Audio::Type::F64: out = AV_SAMPLE_FMT_DBL; break;
+                        default: break;
+                        }
+                        return out;
+                    }
+
+                    //! This struct provides a horizontal slice of the pixel format
+                    //! conversion.
+                    struct Slice
+                    {
+                        SwsContext* swsContext = nullptr;
+                        int         y          = 0;
+                        int         h          = 0;
+                    };
+
+                } // namespace
+
+                struct Write::Private
+                {
+                    Options options;
+                    AVFormatContext* avFormatContext = nullptr;
+                    int avVideoStream = -1;
+                    int avAudioStream = -1;
+                    std::map<int, AVCodecContext*> avCodecContext;
+                    AVPacket* avPacket = nullptr;
+                    bool headerWritten = false;
+
+                    AVFrame* avVideoFrame = nullptr;
+                    AVPixelFormat avPixelFormat = AV_PIX_FMT_NONE;
+                    int planeShift[4] = { 0, 0, 0, 0 };
+                    std::vector<Slice> slices;
+
+                    //! The first slice is converted by the writer thread, the
+                    //! others by a thread each that waits for the next image.
+                    std::vector<std::thread> sliceThreads;
+                    std::mutex sliceMutex;
+                    std::condition_variable sliceCV;
+                    std::condition_variable sliceDoneCV;
+                    size_t sliceGeneration = 0;
+                    size_t slicesPending = 0;
+                    bool slicesExit = false;
+                    const uint8_t* sliceData = nullptr;
+                    int sliceScanlineByteCount = 0;
+
+                    std::shared_ptr<Image::Convert> convert;
+                    int64_t videoPts = 0;
+
+                    AVFrame* avAudioFrame = nullptr;
+                    SwrContext* swrContext = nullptr;
+                    AVAudioFifo* avAudioFifo = nullptr;
+                    Audio::Type audioType = Audio::Type::None;
+                    int64_t audioPts = 0;
+
+                    std::thread thread;
+                    std::atomic<bool> running;
+                };
+
+                void Write::_init(
+                    const FileSystem::FileInfo& fileInfo,
+                    const Info& info,
+                    const WriteOptions& writeOptions,
+                    const Options& options,
+                    const std::shared_ptr<TextSystem>& textSystem,
+                    const std::shared_ptr<ResourceSystem>& resourceSystem,
+                    const std::shared_ptr<LogSystem>& logSystem)
+                {
+                    IWrite::_init(fileInfo, info, writeOptions, textSystem, resourceSystem, logSystem);
+                    DJV_PRIVATE_PTR();
+                    p.options = options;
+                    p.running = false;
+
+                    // Open the file.
+                    const std::string fileName = _fileInfo.getFileName();
+                    int r = avformat_alloc_output_context2(&p.avFormatContext, nullptr, nullptr, fileName.c_str());
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                    p.avPacket = av_packet_alloc();
+                    _openVideo();
+                    _openAudio();
+                    for (const auto& i : _info.tags.getTags())
+                    {
+                        av_dict_set(&p.avFormatContext->metadata, i.first.c_str(), i.second.c_str(), 0);
+                    }
+                    if (!(p.avFormatContext->oformat->flags & AVFMT_NOFILE))
+                    {
+                        r = avio_open(&p.avFormatContext->pb, fileName.c_str(), AVIO_FLAG_WRITE);
+                        if (r < 0)
+                        {
+                            throw FileSystem::Error(String::Format("{0}: {1}").
+                                arg(fileName).
+                                arg(FFmpeg::getErrorString(r)));
+                        }
+                    }
+                    r = avformat_write_header(p.avFormatContext, nullptr);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                    p.headerWritten = true;
+
+                    p.running = true;
+                    p.thread = std::thread(
+                        [this]
+                    {
+                        DJV_PRIVATE_PTR();
+                        try
+                        {
+                            const auto timeout = Time::getTime(Time::TimerValue::VeryFast);
+                            while (p.running)
+                            {
+                                std::shared_ptr<Image::Image> image;
+                                std::vector<std::shared_ptr<Audio::Data> > audio;
+                                bool finished = false;
+                                {
+                                    // The video queue is notified when frames are
+                                    // added, audio is picked up by the timeout.
+                                    std::unique_lock<std::mutex> lock(_mutex);
+                                    _videoQueue.getCV().wait_for(
+                                        lock,
+                                        timeout,
+                                        [this]
+                                        {
+                                            return !_videoQueue.isEmpty() || _videoQueue.isFinished() || !_audioQueue.isEmpty() || !_p->running;
+                                        });
+                                    if (!_videoQueue.isEmpty())
+                                    {
+                                        image = _videoQueue.popFrame().image;
+                                    }
+                                    while (!_audioQueue.isEmpty())
+                                    {
+                                        audio.push_back(_audioQueue.popFrame().audio);
+                                    }
+                                    finished = _videoQueue.isEmpty() && _videoQueue.isFinished();
+                                }
+                                if (p.avAudioStream != -1)
+                                {
+                                    for (const auto& i : audio)
+                                    {
+                                        if (i)
+                                        {
+                                            _writeAudio(i);
+                                        }
+                                    }
+                                }
+                                if (image)
+                                {
+                                    _writeVideo(image);
+                                }
+                                else if (finished)
+                                {
+                                    break;
+                                }
+                            }
+                        }
+                        catch (const std::exception& e)
+                        {
+                            _logSystem->log("djv::AV::IO::FFmpeg::Write", e.what(), LogLevel::Error);
+                        }
+
+                        // Finish the file here so that it is complete when the
+                        // writer stops running.
+                        _close();
+                        p.running = false;
+                    });
+                }
+
+                Write::Write() :
+                    _p(new Private)
+                {}
+
+                Write::~Write()
+                {
+                    DJV_PRIVATE_PTR();
+                    p.running = false;
+                    _videoQueue.getCV().notify_all();
+                    if (p.thread.joinable())
+                    {
+                        //! \todo How do we safely detach the thread here so we don't block?
+                        p.thread.join();
+                    }
+                    _close();
+                }
+
+                std::shared_ptr<Write> Write::create(
+                    const FileSystem::FileInfo& fileInfo,
+                    const Info& info,
+                    const WriteOptions& writeOptions,
+                    const Options& options,
+                    const std::shared_ptr<TextSystem>& textSystem,
+                    const std::shared_ptr<ResourceSystem>& resourceSystem,
+                    const std::shared_ptr<LogSystem>& logSystem)
+                {
+                    auto out = std::shared_ptr<Write>(new Write);
+                    out->_init(fileInfo, info, writeOptions, options, textSystem, resourceSystem, logSystem);
+                    return out;
+                }
+
+                bool Write::isRunning() const
+                {
+                    return _p->running;
+                }
+
+                void Write::_openVideo()
+                {
+                    DJV_PRIVATE_PTR();
+                    if (_info.video.empty())
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(_textSystem->getText(DJV_TEXT("error_no_streams"))));
+                    }
+                    const auto& videoInfo = _info.video[0];
+
+                    // Find the encoder.
+                    AVCodec* avCodec = nullptr;
+                    if (!p.options.codec.empty())
+                    {
+                        avCodec = avcodec_find_encoder_by_name(p.options.codec.c_str());
+                    }
+                    else if (p.avFormatContext->oformat->video_codec != AV_CODEC_ID_NONE)
+                    {
+                        avCodec = avcodec_find_encoder(p.avFormatContext->oformat->video_codec);
+                    }
+                    if (!avCodec)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(_textSystem->getText(DJV_TEXT("error_no_video_codecs"))));
+                    }
+                    auto avStream = avformat_new_stream(p.avFormatContext, nullptr);
+                    p.avVideoStream = avStream->index;
+                    auto avCodecContext = avcodec_alloc_context3(avCodec);
+                    p.avCodecContext[p.avVideoStream] = avCodecContext;
+
+                    // Choose the pixel format that is closest to the images.
+                    const AVPixelFormat avPixelFormat = toPixelFormat(getConvertType(videoInfo.info.type));
+                    avCodecContext->pix_fmt = avCodec->pix_fmts ?
+                        avcodec_find_best_pix_fmt_of_list(avCodec->pix_fmts, avPixelFormat, 0, nullptr) :
+                        AV_PIX_FMT_YUV420P;
+                    const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(avCodecContext->pix_fmt);
+                    if (desc && !(desc->flags & AV_PIX_FMT_FLAG_RGB))
+                    {
+                        avCodecContext->color_primaries = AVCOL_PRI_BT709;
+                        avCodecContext->color_trc       = AVCOL_TRC_BT709;
+                        avCodecContext->colorspace      = AVCOL_SPC_BT709;
+                        avCodecContext->color_range     = AVCOL_RANGE_MPEG;
+                    }
+
+                    avCodecContext->width = videoInfo.info.size.w;
+                    avCodecContext->height = videoInfo.info.size.h;
+                    avCodecContext->sample_aspect_ratio = av_d2q(videoInfo.info.pixelAspectRatio, 255);
+                    avCodecContext->time_base.num = videoInfo.speed.getDen();
+                    avCodecContext->time_base.den = videoInfo.speed.getNum();
+                    avCodecContext->framerate.num = videoInfo.speed.getNum();
+                    avCodecContext->framerate.den = videoInfo.speed.getDen();
+                    if (p.options.bitRate > 0)
+                    {
+                        avCodecContext->bit_rate = p.options.bitRate;
+                    }
+                    avCodecContext->thread_count = p.options.threadCount;
+                    avCodecContext->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+                    if (p.avFormatContext->oformat->flags & AVFMT_GLOBALHEADER)
+                    {
+                        avCodecContext->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+                    }
+                    int r = avcodec_open2(avCodecContext, avCodec, nullptr);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                    r = avcodec_parameters_from_context(avStream->codecpar, avCodecContext);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                    avStream->time_base = avCodecContext->time_base;
+                    avStream->avg_frame_rate = avCodecContext->framerate;
+                    avStream->sample_aspect_ratio = avCodecContext->sample_aspect_ratio;
+
+                    // Initialize the buffers.
+                    p.avVideoFrame = av_frame_alloc();
+                    p.avVideoFrame->format = avCodecContext->pix_fmt;
+                    p.avVideoFrame->width = avCodecContext->width;
+                    p.avVideoFrame->height = avCodecContext->height;
+                    r = av_frame_get_buffer(p.avVideoFrame, 0);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                }
+
+                void Write::_openAudio()
+                {
+                    DJV_PRIVATE_PTR();
+                    if (_info.audio.empty() || AV_CODEC_ID_NONE == p.avFormatContext->oformat->audio_codec)
+                        return;
+                    const auto& audioInfo = _info.audio[0].info;
+                    if (!audioInfo.isValid())
+                        return;
+
+                    // Find the encoder.
+                    AVCodec* avCodec = avcodec_find_encoder(p.avFormatContext->oformat->audio_codec);
+                    if (!avCodec)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(_textSystem->getText(DJV_TEXT("error_no_audio_codecs"))));
+                    }
+                    auto avStream = avformat_new_stream(p.avFormatContext, nullptr);
+                    p.avAudioStream = avStream->index;
+                    auto avCodecContext = avcodec_alloc_context3(avCodec);
+                    p.avCodecContext[p.avAudioStream] = avCodecContext;
+                    avCodecContext->sample_fmt = avCodec->sample_fmts ? avCodec->sample_fmts[0] : AV_SAMPLE_FMT_FLTP;
+                    avCodecContext->sample_rate = audioInfo.sampleRate;
+                    avCodecContext->channels = audioInfo.channelCount;
+                    avCodecContext->channel_layout = av_get_default_channel_layout(audioInfo.channelCount);
+                    avCodecContext->time_base.num = 1;
+                    avCodecContext->time_base.den = audioInfo.sampleRate;
+                    if (p.avFormatContext->oformat->flags & AVFMT_GLOBALHEADER)
+                    {
+                        avCodecContext->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+                    }
+                    int r = avcodec_open2(avCodecContext, avCodec, nullptr);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                    r = avcodec_parameters_from_context(avStream->codecpar, avCodecContext);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                    avStream->time_base = avCodecContext->time_base;
+
+                    // Initialize the buffers. Encoders with a fixed frame size
+                    // are fed from a FIFO.
+                    const int frameSize =
+                        (avCodec->capabilities & AV_CODEC_CAP_VARIABLE_FRAME_SIZE) || 0 == avCodecContext->frame_size ?
+                        1024 :
+                        avCodecContext->frame_size;
+                    p.avAudioFrame = av_frame_alloc();
+                    p.avAudioFrame->nb_samples = frameSize;
+                    p.avAudioFrame->format = avCodecContext->sample_fmt;
+                    p.avAudioFrame->channel_layout = avCodecContext->channel_layout;
+                    p.avAudioFrame->channels = avCodecContext->channels;
+                    p.avAudioFrame->sample_rate = avCodecContext->sample_rate;
+                    r = av_frame_get_buffer(p.avAudioFrame, 0);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                    p.avAudioFifo = av_audio_fifo_alloc(avCodecContext->sample_fmt, avCodecContext->channels, frameSize);
+
+                    // Initialize the resampler. Signed 8-bit audio is converted
+                    // to 16-bit first since FFmpeg only has unsigned 8-bit samples.
+                    p.audioType = Audio::Type::S8 == audioInfo.type ? Audio::Type::S16 : audioInfo.type;
+                    p.swrContext = swr_alloc_set_opts(
+                        nullptr,
+                        avCodecContext->channel_layout,
+                        avCodecContext->sample_fmt,
+                        avCodecContext->sample_rate,
+                        avCodecContext->channel_layout,
+                        toSampleFormat(p.audioType),
+                        audioInfo.sampleRate,
+                        0,
+                        nullptr);
+                    if (!p.swrContext || swr_init(p.swrContext) < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(_textSystem->getText(DJV_TEXT("error_unsupported_audio_format"))));
+                    }
+                }
+
+                void Write::_convertVideo(const std::shared_ptr<Image::Image>& image)
+                {
+                    DJV_PRIVATE_PTR();
+                    const AVPixelFormat avPixelFormat = toPixelFormat(image->getType());
+                    if (avPixelFormat != p.avPixelFormat)
+                    {
+                        // Split the image into a slice per thread. The slices are
+                        // aligned to the vertical chroma subsampling so each one
+                        // can be converted independently.
+                        p.avPixelFormat = avPixelFormat;
+                        _stopSliceThreads();
+                        for (const auto& i : p.slices)
+                        {
+                            sws_freeContext(i.swsContext);
+                        }
+                        p.slices.clear();
+                        const int w = p.avVideoFrame->width;
+                        const int h = p.avVideoFrame->height;
+                        const AVPixelFormat avOutputFormat = static_cast<AVPixelFormat>(p.avVideoFrame->format);
+                        const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(avOutputFormat);
+                        const bool yuv = desc && !(desc->flags & AV_PIX_FMT_FLAG_RGB);
+                        for (int i = 0; i < 4; ++i)
+                        {
+                            p.planeShift[i] = 0;
+                        }
+                        int step = 1;
+                        if (yuv && desc->nb_components >= 3)
+                        {
+                            p.planeShift[desc->comp[1].plane] = desc->comp[1].plane ? desc->log2_chroma_h : 0;
+                            p.planeShift[desc->comp[2].plane] = desc->comp[2].plane ? desc->log2_chroma_h : 0;
+                            step = 1 << desc->log2_chroma_h;
+                        }
+                        const int rows = h / step;
+                        size_t count = std::max(static_cast<size_t>(1), std::min(p.options.threadCount, static_cast<size_t>(rows)));
+                        if (desc && (desc->flags & AV_PIX_FMT_FLAG_PAL))
+                        {
+                            count = 1;
+                        }
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            Slice slice;
+                            slice.y = static_cast<int>(rows * i / count) * step;
+                            const int y1 = i < count - 1 ? (static_cast<int>(rows * (i + 1) / count) * step) : h;
+                            slice.h = y1 - slice.y;
+                            slice.swsContext = sws_getContext(
+                                w,
+                                slice.h,
+                                avPixelFormat,
+                                w,
+                                slice.h,
+                                avOutputFormat,
+                                SWS_BICUBIC,
+                                0,
+                                0,
+                                0);
+                            if (!slice.swsContext)
+                            {
+                                throw FileSystem::Error(String::Format("{0}: {1}").
+                                    arg(_fileInfo.getFileName()).
+                                    arg(_textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
+                            }
+                            if (yuv)
+                            {
+                                const int* coefficients = sws_getCoefficients(SWS_CS_ITU709);
+                                sws_setColorspaceDetails(slice.swsContext, coefficients, 1, coefficients, 0, 0, 1 << 16, 1 << 16);
+                            }
+                            p.slices.push_back(slice);
+                        }
+                        _startSliceThreads();
+                    }
+
+                    // The encoder may still be using the previous frame.
+                    const int r = av_frame_make_writable(p.avVideoFrame);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+
+                    // Hand the image to the slice threads and convert the
+                    // first slice on this thread.
+                    const uint8_t* data = image->getData();
+                    const int scanlineByteCount = static_cast<int>(image->getScanlineByteCount());
+                    {
+                        std::lock_guard<std::mutex> lock(p.sliceMutex);
+                        p.sliceData = data;
+                        p.sliceScanlineByteCount = scanlineByteCount;
+                        p.slicesPending = p.sliceThreads.size();
+                        ++p.sliceGeneration;
+                    }
+                    p.sliceCV.notify_all();
+                    if (p.slices.size())
+                    {
+                        _convertSlice(0, data, scanlineByteCount);
+                    }
+                    std::unique_lock<std::mutex> lock(p.sliceMutex);
+                    p.sliceDoneCV.wait(
+                        lock,
+                        [this]
+                        {
+                            return 0 == _p->slicesPending;
+                        });
+                }
+
+                void Write::_convertSlice(size_t index, const uint8_t* data, int scanlineByteCount)
+                {
+                    DJV_PRIVATE_PTR();
+                    const auto& slice = p.slices[index];
+                    const uint8_t* src[4] = { data + slice.y * scanlineByteCount, nullptr, nullptr, nullptr };
+                    const int srcStride[4] = { scanlineByteCount, 0, 0, 0 };
+                    uint8_t* dst[4] = { nullptr, nullptr, nullptr, nullptr };
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        if (p.avVideoFrame->data[i])
+                        {
+                            dst[i] = p.avVideoFrame->data[i] + (slice.y >> p.planeShift[i]) * p.avVideoFrame->linesize[i];
+                        }
+                    }
+                    sws_scale(
+                        slice.swsContext,
+                        src,
+                        srcStride,
+                        0,
+                        slice.h,
+                        dst,
+                        p.avVideoFrame->linesize);
+                }
+
+                void Write::_startSliceThreads()
+                {
+                    DJV_PRIVATE_PTR();
+                    std::lock_guard<std::mutex> lock(p.sliceMutex);
+                    p.slicesExit = false;
+                    for (size_t i = 1; i < p.slices.size(); ++i)
+                    {
+                        p.sliceThreads.push_back(std::thread(
+                            [this, i](size_t generation)
+                            {
+                                DJV_PRIVATE_PTR();
+                                while (true)
+                                {
+                                    const uint8_t* data = nullptr;
+                                    int scanlineByteCount = 0;
+                                    {
+                                        std::unique_lock<std::mutex> lock(p.sliceMutex);
+                                        p.sliceCV.wait(
+                                            lock,
+                                            [this, generation]
+                                            {
+                                                return _p->slicesExit || _p->sliceGeneration != generation;
+                                            });
+                                        if (p.slicesExit)
+                                        {
+                                            break;
+                                        }
+                                        generation = p.sliceGeneration;
+                                        data = p.sliceData;
+                                        scanlineByteCount = p.sliceScanlineByteCount;
+                                    }
+                                    _convertSlice(i, data, scanlineByteCount);
+                                    {
+                                        std::lock_guard<std::mutex> lock(p.sliceMutex);
+                                        --p.slicesPending;
+                                    }
+                                    p.sliceDoneCV.notify_one();
+                                }
+                            },
+                            p.sliceGeneration));
+                    }
+                }
+
+                void Write::_stopSliceThreads()
+                {
+                    DJV_PRIVATE_PTR();
+                    {
+                        std::lock_guard<std::mutex> lock(p.sliceMutex);
+                        p.slicesExit = true;
+                    }
+                    p.sliceCV.notify_all();
+                    for (auto& i : p.sliceThreads)
+                    {
+                        if (i.joinable())
+                        {
+                            i.join();
+                        }
+                    }
+                    p.sliceThreads.clear();
+                }
+
+                void Write::_writeVideo(const std::shared_ptr<Image::Image>& image)
+                {
+                    DJV_PRIVATE_PTR();
+
+                    // Convert the image if the software scaler can't use it directly.
+                    auto tmp = image;
+                    const Image::Size size(p.avVideoFrame->width, p.avVideoFrame->height);
+                    const Image::Type type = getConvertType(image->getType());
+                    if (type != image->getType() || image->getLayout() != Image::Layout() || image->getSize() != size)
+                    {
+                        const Image::Info info(size, type);
+                        tmp = Image::Image::create(info);
+                        if (!p.convert)
+                        {
+                            p.convert = Image::Convert::create(Image::ConvertBackend::CPU, _resourceSystem);
+                        }
+                        p.convert->process(*image, info, *tmp);
+                    }
+
+                    _convertVideo(tmp);
+                    p.avVideoFrame->pts = p.videoPts++;
+                    _encode(p.avVideoStream, p.avVideoFrame);
+                }
+
+                void Write::_writeAudio(const std::shared_ptr<Audio::Data>& data)
+                {
+                    DJV_PRIVATE_PTR();
+                    auto in = data;
+                    if (in->getType() != p.audioType)
+                    {
+                        in = Audio::Data::convert(in, p.audioType);
+                    }
+
+                    // Resample into the FIFO.
+                    AVCodecContext* avCodecContext = p.avCodecContext[p.avAudioStream];
+                    const int sampleCount = static_cast<int>(in->getSampleCount());
+                    const int outSampleCount = swr_get_out_samples(p.swrContext, sampleCount);
+                    uint8_t** out = nullptr;
+                    int r = av_samples_alloc_array_and_samples(
+                        &out,
+                        nullptr,
+                        avCodecContext->channels,
+                        outSampleCount,
+                        avCodecContext->sample_fmt,
+                        0);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                    const uint8_t* inData[1] = { in->getData() };
+                    r = swr_convert(p.swrContext, out, outSampleCount, inData, sampleCount);
+                    if (r > 0)
+                    {
+                        av_audio_fifo_write(p.avAudioFifo, reinterpret_cast<void**>(out), r);
+                    }
+                    av_freep(&out[0]);
+                    av_freep(&out);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+
+                    // Encode the full frames.
+                    const int frameSize = p.avAudioFrame->nb_samples;
+                    while (av_audio_fifo_size(p.avAudioFifo) >= frameSize)
+                    {
+                        r = av_frame_make_writable(p.avAudioFrame);
+                        if (r < 0)
+                        {
+                            throw FileSystem::Error(String::Format("{0}: {1}").
+                                arg(_fileInfo.getFileName()).
+                                arg(FFmpeg::getErrorString(r)));
+                        }
+                        av_audio_fifo_read(p.avAudioFifo, reinterpret_cast<void**>(p.avAudioFrame->data), frameSize);
+                        p.avAudioFrame->pts = p.audioPts;
+                        p.audioPts += frameSize;
+                        _encode(p.avAudioStream, p.avAudioFrame);
+                    }
+                }
+
+                void Write::_flushAudio()
+                {
+                    DJV_PRIVATE_PTR();
+                    const int sampleCount = av_audio_fifo_size(p.avAudioFifo);
+                    if (sampleCount > 0)
+                    {
+                        // Pad the last frame with silence.
+                        const int r = av_frame_make_writable(p.avAudioFrame);
+                        if (r < 0)
+                        {
+                            throw FileSystem::Error(String::Format("{0}: {1}").
+                                arg(_fileInfo.getFileName()).
+                                arg(FFmpeg::getErrorString(r)));
+                        }
+                        const int frameSize = p.avAudioFrame->nb_samples;
+                        av_samples_set_silence(
+                            p.avAudioFrame->data,
+                            0,
+                            frameSize,
+                            p.avAudioFrame->channels,
+                            static_cast<AVSampleFormat>(p.avAudioFrame->format));
+                        av_audio_fifo_read(p.avAudioFifo, reinterpret_cast<void**>(p.avAudioFrame->data), sampleCount);
+                        p.avAudioFrame->pts = p.audioPts;
+                        p.audioPts += frameSize;
+                        _encode(p.avAudioStream, p.avAudioFrame);
+                    }
+                }
+
+                void Write::_encode(int stream, AVFrame* avFrame)
+                {
+                    DJV_PRIVATE_PTR();
+                    AVCodecContext* avCodecContext = p.avCodecContext[stream];
+                    int r = avcodec_send_frame(avCodecContext, avFrame);
+                    if (r < 0)
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(_fileInfo.getFileName()).
+                            arg(FFmpeg::getErrorString(r)));
+                    }
+                    while (r >= 0)
+                    {
+                        r = avcodec_receive_packet(avCodecContext, p.avPacket);
+                        if (AVERROR(EAGAIN) == r || AVERROR_EOF == r)
+                        {
+                            break;
+                        }
+                        else if (r < 0)
+                        {
+                            throw FileSystem::Error(String::Format("{0}: {1}").
+                                arg(_fileInfo.getFileName()).
+                                arg(FFmpeg::getErrorString(r)));
+                        }
+                        av_packet_rescale_ts(p.avPacket, avCodecContext->time_base, p.avFormatContext->streams[stream]->time_base);
+                        p.avPacket->stream_index = stream;
+                        r = av_interleaved_write_frame(p.avFormatContext, p.avPacket);
+                        if (r < 0)
+                        {
+                            throw FileSystem::Error(String::Format("{0}: {1}").
+                                arg(_fileInfo.getFileName()).
+                                arg(FFmpeg::getErrorString(r)));
+                        }
+                    }
+                }
+
+                void Write::_close()
+                {
+                    DJV_PRIVATE_PTR();
+
+                    // Flush the encoders and write the trailer, even if writing
+                    // stopped early, so that the file can be read.
+                    if (p.headerWritten)
+                    {
+                        p.headerWritten = false;
+                        try
+                        {
+                            if (p.avAudioStream != -1)
+                            {
+                                _flushAudio();
+                                _encode(p.avAudioStream, nullptr);
+                            }
+                            if (p.avVideoStream != -1)
+                            {
+                                _encode(p.avVideoStream, nullptr);
+                            }
+                        }
+                        catch (const std::exception& e)
+                        {
+                            _logSystem->log("djv::AV::IO::FFmpeg::Write", e.what(), LogLevel::Error);
+                        }
+                        const int r = av_write_trailer(p.avFormatContext);
+                        if (r < 0)
+                        {
+                            _logSystem->log(
+                                "djv::AV::IO::FFmpeg::Write",
+                                String::Format("{0}: {1}").
+                                    arg(_fileInfo.getFileName()).
+                                    arg(FFmpeg::getErrorString(r)),
+                                LogLevel::Error);
+                        }
+                    }
+
+                    _stopSliceThreads();
+                    for (const auto& i : p.slices)
+                    {
+                        sws_freeContext(i.swsContext);
+                    }
+                    p.slices.clear();
+                    if (p.swrContext)
+                    {
+                        swr_free(&p.swrContext);
+                    }
+                    if (p.avAudioFifo)
+                    {
+                        av_audio_fifo_free(p.avAudioFifo);
+                        p.avAudioFifo = nullptr;
+                    }
+                    if (p.avAudioFrame)
+                    {
+                        av_frame_free(&p.avAudioFrame);
+                    }
+                    if (p.avVideoFrame)
+                    {
+                        av_frame_free(&p.avVideoFrame);
+                    }
+                    if (p.avPacket)
+                    {
+                        av_packet_free(&p.avPacket);
+                    }
+                    for (auto i : p.avCodecContext)
+                    {
+                        avcodec_free_context(&i.second);
+                    }
+                    p.avCodecContext.clear();
+                    if (p.avFormatContext)
+                    {
+                        if (!(p.avFormatContext->oformat->flags & AVFMT_NOFILE))
+                        {
+                            avio_closep(&p.avFormatContext->pb);
+                        }
+                        avformat_free_context(p.avFormatContext);
+                        p.avFormatContext = nullptr;
+                    }
+                }
+
+            } // namespace FFmpeg
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
+
@@ -192,4 +192,20 @@ namespace djv
     } // namespace AV
 } // namespace djv
 
+namespace std
+{
+    template<>
+    struct hash<djv::AV::Font::FontInfo>
+    {
+        std::size_t operator() (const djv::AV::Font::FontInfo&) const noexcept;
+    };
+
+    template<>
+    struct hash<djv::AV::Font::GlyphInfo>
+    {
+        std::size_t operator() (const djv::AV::Font::GlyphInfo&) const noexcept;
+    };
+
+} // namespace std
+
 #include <djvAV/FontSystemInline.h>
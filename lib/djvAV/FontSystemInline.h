@@ -93,3 +93,24 @@ namespace djv
         } // namespace Font
     } // namespace AV
 } // namespace djv
+
+namespace std
+{
+    inline std::size_t hash<djv::AV::Font::FontInfo>::operator() (const djv::AV::Font::FontInfo& value) const noexcept
+    {
+        size_t hash = 0;
+        djv::Core::Memory::hashCombine(hash, value.getFamily());
+        djv::Core::Memory::hashCombine(hash, value.getFace());
+        djv::Core::Memory::hashCombine(hash, value.getSize());
+        djv::Core::Memory::hashCombine(hash, value.getDPI());
+        return hash;
+    }
+
+    inline std::size_t hash<djv::AV::Font::GlyphInfo>::operator() (const djv::AV::Font::GlyphInfo& value) const noexcept
+    {
+        size_t hash = std::hash<djv::AV::Font::FontInfo>()(value.fontInfo);
+        djv::Core::Memory::hashCombine(hash, value.code);
+        return hash;
+    }
+
+} // namespace std
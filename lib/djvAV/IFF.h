@@ -43,7 +43,9 @@ namespace djv
                         const ReadOptions&,
                         const std::shared_ptr<Core::TextSystem>&,
                         const std::shared_ptr<Core::ResourceSystem>&,
-                        const std::shared_ptr<Core::LogSystem>&);
+                        const std::shared_ptr<Core::LogSystem>&,
+                        const std::shared_ptr<ThreadPool>&,
+                        const std::shared_ptr<FrameCache>&);
 
                 protected:
                     Info _readInfo(const std::string& fileName) override;
@@ -8,6 +8,8 @@
 #include <djvAV/DPX.h>
 #include <djvAV/GLFWSystem.h>
 #include <djvAV/IFF.h>
+#include <djvAV/IOFrameCache.h>
+#include <djvAV/IOThreadPool.h>
 #include <djvAV/PPM.h>
 #include <djvAV/RLA.h>
 #include <djvAV/SGI.h>
@@ -32,6 +34,7 @@
 #include <djvCore/Context.h>
 #include <djvCore/FileSystem.h>
 #include <djvCore/LogSystem.h>
+#include <djvCore/OS.h>
 #include <djvCore/Path.h>
 #include <djvCore/ResourceSystem.h>
 #include <djvCore/String.h>
@@ -46,6 +49,12 @@ namespace djv
     {
         namespace IO
         {
+            namespace
+            {
+                const size_t frameCacheRAMDivisor = 4;
+
+            } // namespace
+
             void VideoQueue::setMax(size_t value)
             {
                 _max = value;
@@ -54,6 +63,7 @@ namespace djv
             void VideoQueue::addFrame(const VideoFrame& value)
             {
                 _queue.push(value);
+                _cv.notify_all();
             }
 
             VideoFrame VideoQueue::popFrame()
@@ -78,6 +88,7 @@ namespace djv
             void VideoQueue::setFinished(bool value)
             {
                 _finished = value;
+                _cv.notify_all();
             }
 
             void AudioQueue::setMax(size_t value)
@@ -138,8 +149,77 @@ namespace djv
                 _threadCount = value;
             }
 
+            Image::Size getProxySize(const Image::Size& value, size_t proxy)
+            {
+                const size_t scale = static_cast<size_t>(1) << std::min(proxy, static_cast<size_t>(15));
+                return Image::Size(
+                    static_cast<uint16_t>((value.w + scale - 1) / scale),
+                    static_cast<uint16_t>((value.h + scale - 1) / scale));
+            }
+
+            Cache::Cache()
+            {}
+
+            Cache::~Cache()
+            {
+                if (_frameCache)
+                {
+                    _frameCache->removeReader(_frameCacheReader);
+                }
+            }
+
+            void Cache::setFrameCache(
+                const std::shared_ptr<FrameCache>&  value,
+                const std::string&                  fileName,
+                size_t                              layer,
+                size_t                              proxy,
+                const std::string&                  colorSpace)
+            {
+                if (_frameCache)
+                {
+                    _frameCache->removeReader(_frameCacheReader);
+                    _frameCacheReader = 0;
+                }
+                _frameCache = value;
+                _cache.clear();
+                if (_frameCache)
+                {
+                    _frameCacheReader = _frameCache->addReader(fileName, layer, proxy, colorSpace);
+                }
+                _cacheUpdate();
+            }
+
+            size_t Cache::getCount() const
+            {
+                return _frameCache ? _frameCache->getCount(_frameCacheReader) : _cache.size();
+            }
+
+            size_t Cache::getTotalByteCount() const
+            {
+                size_t out = 0;
+                if (_frameCache)
+                {
+                    out = _frameCache->getByteCount(_frameCacheReader);
+                }
+                else
+                {
+                    for (const auto& i : _cache)
+                    {
+                        if (i.second)
+                        {
+                            out += i.second->getDataByteCount();
+                        }
+                    }
+                }
+                return out;
+            }
+
             Frame::Sequence Cache::getFrames() const
             {
+                if (_frameCache)
+                {
+                    return _frameCache->getFrames(_frameCacheReader);
+                }
                 Frame::Sequence out;
                 std::vector<Frame::Index> frames;
                 for (const auto& i : _cache)
@@ -213,10 +293,56 @@ namespace djv
                 _cacheUpdate();
             }
 
+            bool Cache::contains(Frame::Index value) const
+            {
+                return _frameCache ?
+                    _frameCache->contains(_frameCacheReader, value) :
+                    (_cache.find(value) != _cache.end());
+            }
+
+            bool Cache::get(Frame::Index index, std::shared_ptr<AV::Image::Image>& out) const
+            {
+                if (_frameCache)
+                {
+                    return _frameCache->get(_frameCacheReader, index, out);
+                }
+                const auto i = _cache.find(index);
+                const bool found = i != _cache.end();
+                if (found)
+                {
+                    out = i->second;
+                }
+                return found;
+            }
+
             void Cache::add(Frame::Index index, const std::shared_ptr<AV::Image::Image>& image)
             {
-                _cache[index] = image;
-                _cacheUpdate();
+                // Images that failed to read are not cached. Memory-mapped
+                // images are cached as-is, they reference the page cache
+                // rather than a copy of it.
+                if (!image)
+                    return;
+                if (_frameCache)
+                {
+                    _frameCache->add(_frameCacheReader, index, image);
+                }
+                else
+                {
+                    _cache[index] = image;
+                    _cacheUpdate();
+                }
+            }
+
+            void Cache::clear()
+            {
+                if (_frameCache)
+                {
+                    _frameCache->clear(_frameCacheReader);
+                }
+                else
+                {
+                    _cache.clear();
+                }
             }
 
             void Cache::_cacheUpdate()
@@ -296,6 +422,13 @@ namespace djv
                 }
                 default: break;
                 }
+                if (_frameCache)
+                {
+                    // The shared frame cache keeps frames outside of the
+                    // window until it runs out of memory.
+                    _frameCache->setReaderWindow(_frameCacheReader, _sequence, _currentFrame, _direction, range);
+                    return;
+                }
                 auto i = _cache.begin();
                 while (i != _cache.end())
                 {
@@ -463,6 +596,8 @@ namespace djv
             {
                 std::shared_ptr<TextSystem> textSystem;
                 std::shared_ptr<ValueSubject<bool> > optionsChanged;
+                std::shared_ptr<FrameCache> frameCache;
+                std::shared_ptr<ThreadPool> threadPool;
                 std::map<std::string, std::shared_ptr<IPlugin> > plugins;
                 std::set<std::string> sequenceExtensions;
                 std::set<std::string> nonSequenceExtensions;
@@ -480,6 +615,19 @@ namespace djv
 
                 p.optionsChanged = ValueSubject<bool>::create();
 
+                // The frame cache uses a quarter of the system memory by
+                // default, applications can change this with their settings.
+                p.frameCache = FrameCache::create();
+                p.frameCache->setMaxByteCount(OS::getRAMSize() / frameCacheRAMDivisor);
+
+                const int threadCount = OS::getIntEnv("DJV_IO_THREAD_COUNT");
+                p.threadPool = ThreadPool::create(threadCount > 0 ? static_cast<size_t>(threadCount) : 0);
+                {
+                    std::stringstream ss;
+                    ss << "I/O thread count: " << p.threadPool->getThreadCount();
+                    _log(ss.str());
+                }
+
                 p.plugins[Cineon::pluginName] = Cineon::Plugin::create(context);
                 p.plugins[DPX::pluginName] = DPX::Plugin::create(context);
                 p.plugins[IFF::pluginName] = IFF::Plugin::create(context);
@@ -505,6 +653,9 @@ namespace djv
 
                 for (const auto& i : p.plugins)
                 {
+                    i.second->_frameCache = p.frameCache;
+                    i.second->_threadPool = p.threadPool;
+
                     if (i.second->canSequence())
                     {
                         const auto& fileExtensions = i.second->getFileExtensions();
@@ -588,6 +739,16 @@ namespace djv
                 return _p->optionsChanged;
             }
 
+            const std::shared_ptr<FrameCache>& System::getFrameCache() const
+            {
+                return _p->frameCache;
+            }
+
+            const std::shared_ptr<ThreadPool>& System::getThreadPool() const
+            {
+                return _p->threadPool;
+            }
+
             const std::set<std::string>& System::getSequenceExtensions() const
             {
                 return _p->sequenceExtensions;
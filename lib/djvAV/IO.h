@@ -8,14 +8,17 @@
 #include <djvAV/Image.h>
 #include <djvAV/Tags.h>
 
+#include <djvCore/BBox.h>
 #include <djvCore/Error.h>
 #include <djvCore/FileInfo.h>
 #include <djvCore/ISystem.h>
 #include <djvCore/RapidJSON.h>
 #include <djvCore/Speed.h>
 #include <djvCore/Time.h>
+#include <djvCore/UID.h>
 #include <djvCore/ValueObserver.h>
 
+#include <condition_variable>
 #include <future>
 #include <queue>
 #include <mutex>
@@ -36,6 +39,9 @@ namespace djv
         //! This namespace provides I/O functionality.
         namespace IO
         {
+            class FrameCache;
+            class ThreadPool;
+
             //! This class provides video I/O information.
             class VideoInfo
             {
@@ -119,10 +125,16 @@ namespace djv
                 bool isFinished() const;
                 void setFinished(bool);
 
+                //! Get the condition variable that is notified when a frame is
+                //! added or the queue is finished. Wait on it with the I/O
+                //! mutex locked.
+                std::condition_variable& getCV();
+
             private:
                 size_t _max = 0;
                 std::queue<VideoFrame> _queue;
                 bool _finished = false;
+                std::condition_variable _cv;
             };
 
             //! This class provides an audio frame.
@@ -212,8 +224,22 @@ namespace djv
             {
                 size_t layer = 0;
                 std::string colorSpace;
+
+                //! Read the images at a reduced resolution, divided by two to
+                //! the power of this value. Readers without native support
+                //! fall back to resizing the images after they are read. The
+                //! information still describes the full resolution images.
+                size_t proxy = 0;
+
+                //! Read only this region of the images, in pixel coordinates
+                //! of the full resolution image. The region is ignored when it
+                //! is not valid, and by readers without native support.
+                Core::BBox2i region;
             };
 
+            //! Get the size of an image read at the given proxy level.
+            Image::Size getProxySize(const Image::Size&, size_t proxy);
+
             //! This class provides playback in/out points.
             class InOutPoints
             {
@@ -243,11 +269,25 @@ namespace djv
             };
 
             //! This class provides a frame cache.
+            //!
+            //! The frames are stored locally unless a shared frame cache is
+            //! set, in which case the cache window is used to prioritize the
+            //! frames and the shared cache decides when they are evicted.
             class Cache
             {
+                DJV_NON_COPYABLE(Cache);
+
             public:
                 Cache();
-                
+                ~Cache();
+
+                void setFrameCache(
+                    const std::shared_ptr<FrameCache>&,
+                    const std::string& fileName,
+                    size_t layer,
+                    size_t proxy = 0,
+                    const std::string& colorSpace = std::string());
+
                 size_t getMax() const;
                 size_t getCount() const;
                 size_t getTotalByteCount() const;
@@ -268,6 +308,8 @@ namespace djv
             private:
                 void _cacheUpdate();
 
+                std::shared_ptr<FrameCache> _frameCache;
+                Core::UID _frameCacheReader = 0;
                 size_t _max = 0;
                 size_t _sequenceSize = 0;
                 InOutPoints _inOutPoints;
@@ -392,9 +434,13 @@ namespace djv
                 std::shared_ptr<Core::LogSystem> _logSystem;
                 std::shared_ptr<Core::ResourceSystem> _resourceSystem;
                 std::shared_ptr<Core::TextSystem> _textSystem;
+                std::shared_ptr<FrameCache> _frameCache;
+                std::shared_ptr<ThreadPool> _threadPool;
                 std::string _pluginName;
                 std::string _pluginInfo;
                 std::set<std::string> _fileExtensions;
+
+                friend class System;
             };
 
             //! This class provides an I/O system.
@@ -422,6 +468,15 @@ namespace djv
 
                 std::shared_ptr<Core::IValueSubject<bool> > observeOptionsChanged() const;
 
+                //! Get the frame cache that is shared by the readers. The
+                //! default budget is a quarter of the system memory.
+                const std::shared_ptr<FrameCache>& getFrameCache() const;
+
+                //! Get the thread pool that is shared by the readers. The
+                //! number of threads can be set with the environment variable
+                //! DJV_IO_THREAD_COUNT, it defaults to the hardware concurrency.
+                const std::shared_ptr<ThreadPool>& getThreadPool() const;
+
                 const std::set<std::string>& getSequenceExtensions() const;
                 const std::set<std::string>& getNonSequenceExtensions() const;
                 bool canSequence(const Core::FileSystem::FileInfo&) const;
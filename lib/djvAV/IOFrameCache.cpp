@@ -0,0 +1,386 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/IOFrameCache.h>
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <map>
+#include <tuple>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace
+            {
+                struct Key
+                {
+                    std::string fileName;
+                    size_t layer = 0;
+                    size_t proxy = 0;
+                    std::string colorSpace;
+                    Frame::Index frame = 0;
+
+                    bool operator < (const Key& other) const
+                    {
+                        return
+                            std::tie(fileName, layer, proxy, colorSpace, frame) <
+                            std::tie(other.fileName, other.layer, other.proxy, other.colorSpace, other.frame);
+                    }
+                };
+
+                struct Entry
+                {
+                    std::shared_ptr<Image::Image> image;
+                    size_t byteCount = 0;
+                    std::list<Key>::iterator lru;
+                };
+
+                struct Reader
+                {
+                    std::string fileName;
+                    size_t layer = 0;
+                    size_t proxy = 0;
+                    std::string colorSpace;
+                    Frame::Sequence window;
+                    Frame::Index currentFrame = 0;
+                    Direction direction = Direction::Forward;
+                    Range::Range<Frame::Index> range;
+                };
+
+                //! Get the distance from the playhead in the playback direction.
+                size_t getDistance(const Reader& reader, Frame::Index frame)
+                {
+                    const Frame::Index min = reader.range.getMin();
+                    const Frame::Index max = reader.range.getMax();
+                    if (frame < min || frame > max)
+                    {
+                        return std::numeric_limits<size_t>::max();
+                    }
+                    Frame::Index out = Direction::Forward == reader.direction ?
+                        (frame - reader.currentFrame) :
+                        (reader.currentFrame - frame);
+                    if (out < 0)
+                    {
+                        out += max - min + 1;
+                    }
+                    return static_cast<size_t>(out);
+                }
+
+            } // namespace
+
+            struct FrameCache::Private
+            {
+                mutable std::mutex mutex;
+                size_t maxByteCount = 0;
+                size_t byteCount = 0;
+                std::map<Key, Entry> entries;
+
+                //! The least recently used entries are at the front.
+                std::list<Key> lru;
+
+                std::map<UID, Reader> readers;
+
+                void erase(std::map<Key, Entry>::iterator i)
+                {
+                    byteCount -= i->second.byteCount;
+                    lru.erase(i->second.lru);
+                    entries.erase(i);
+                }
+
+                //! Get the range of entries that belong to a reader.
+                std::pair<std::map<Key, Entry>::const_iterator, std::map<Key, Entry>::const_iterator> getEntries(UID uid) const
+                {
+                    const auto i = readers.find(uid);
+                    if (i == readers.end())
+                    {
+                        return std::make_pair(entries.end(), entries.end());
+                    }
+                    Key min;
+                    min.fileName = i->second.fileName;
+                    min.layer = i->second.layer;
+                    min.proxy = i->second.proxy;
+                    min.colorSpace = i->second.colorSpace;
+                    min.frame = std::numeric_limits<Frame::Index>::min();
+                    Key max = min;
+                    max.frame = std::numeric_limits<Frame::Index>::max();
+                    return std::make_pair(entries.lower_bound(min), entries.upper_bound(max));
+                }
+
+                bool getKey(UID uid, Frame::Index frame, Key& out) const
+                {
+                    const auto i = readers.find(uid);
+                    const bool found = i != readers.end();
+                    if (found)
+                    {
+                        out.fileName = i->second.fileName;
+                        out.layer = i->second.layer;
+                        out.proxy = i->second.proxy;
+                        out.colorSpace = i->second.colorSpace;
+                        out.frame = frame;
+                    }
+                    return found;
+                }
+            };
+
+            FrameCache::FrameCache() :
+                _p(new Private)
+            {}
+
+            FrameCache::~FrameCache()
+            {}
+
+            std::shared_ptr<FrameCache> FrameCache::create()
+            {
+                return std::shared_ptr<FrameCache>(new FrameCache);
+            }
+
+            size_t FrameCache::getMaxByteCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.maxByteCount;
+            }
+
+            size_t FrameCache::getByteCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.byteCount;
+            }
+
+            size_t FrameCache::getCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.entries.size();
+            }
+
+            void FrameCache::setMaxByteCount(size_t value)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                if (value == p.maxByteCount)
+                    return;
+                p.maxByteCount = value;
+                _evict();
+            }
+
+            UID FrameCache::addReader(const std::string& fileName, size_t layer, size_t proxy, const std::string& colorSpace)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const UID out = createUID();
+                Reader reader;
+                reader.fileName = fileName;
+                reader.layer = layer;
+                reader.proxy = proxy;
+                reader.colorSpace = colorSpace;
+                p.readers[out] = reader;
+                return out;
+            }
+
+            void FrameCache::removeReader(UID uid)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.readers.find(uid);
+                if (i != p.readers.end())
+                {
+                    p.readers.erase(i);
+                }
+            }
+
+            void FrameCache::setReaderWindow(
+                UID uid,
+                const Frame::Sequence& window,
+                Frame::Index currentFrame,
+                Direction direction,
+                const Range::Range<Frame::Index>& range)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.readers.find(uid);
+                if (i != p.readers.end())
+                {
+                    i->second.window = window;
+                    i->second.currentFrame = currentFrame;
+                    i->second.direction = direction;
+                    i->second.range = range;
+                }
+            }
+
+            size_t FrameCache::getByteCount(UID uid) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                size_t out = 0;
+                const auto range = p.getEntries(uid);
+                for (auto i = range.first; i != range.second; ++i)
+                {
+                    out += i->second.byteCount;
+                }
+                return out;
+            }
+
+            size_t FrameCache::getCount(UID uid) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto range = p.getEntries(uid);
+                return std::distance(range.first, range.second);
+            }
+
+            Frame::Sequence FrameCache::getFrames(UID uid) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                std::vector<Frame::Number> frames;
+                const auto range = p.getEntries(uid);
+                for (auto i = range.first; i != range.second; ++i)
+                {
+                    frames.push_back(i->first.frame);
+                }
+                return Frame::fromFrames(frames);
+            }
+
+            bool FrameCache::contains(UID uid, Frame::Index frame) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                Key key;
+                return p.getKey(uid, frame, key) && p.entries.find(key) != p.entries.end();
+            }
+
+            bool FrameCache::get(UID uid, Frame::Index frame, std::shared_ptr<Image::Image>& out)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                bool found = false;
+                Key key;
+                if (p.getKey(uid, frame, key))
+                {
+                    const auto i = p.entries.find(key);
+                    found = i != p.entries.end();
+                    if (found)
+                    {
+                        p.lru.splice(p.lru.end(), p.lru, i->second.lru);
+                        out = i->second.image;
+                    }
+                }
+                return found;
+            }
+
+            void FrameCache::add(UID uid, Frame::Index frame, const std::shared_ptr<Image::Image>& image)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                Key key;
+                if (p.getKey(uid, frame, key))
+                {
+                    auto i = p.entries.find(key);
+                    if (i != p.entries.end())
+                    {
+                        p.byteCount -= i->second.byteCount;
+                        p.lru.splice(p.lru.end(), p.lru, i->second.lru);
+                    }
+                    else
+                    {
+                        i = p.entries.insert(std::make_pair(key, Entry())).first;
+                        i->second.lru = p.lru.insert(p.lru.end(), key);
+                    }
+                    i->second.image = image;
+                    i->second.byteCount = image ? image->getDataByteCount() : 0;
+                    p.byteCount += i->second.byteCount;
+                    _evict();
+                }
+            }
+
+            void FrameCache::clear(UID uid)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto range = p.getEntries(uid);
+                for (auto i = range.first; i != range.second; ++i)
+                {
+                    p.byteCount -= i->second.byteCount;
+                    p.lru.erase(i->second.lru);
+                }
+                p.entries.erase(range.first, range.second);
+            }
+
+            void FrameCache::clear()
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.entries.clear();
+                p.lru.clear();
+                p.byteCount = 0;
+            }
+
+            void FrameCache::_evict()
+            {
+                DJV_PRIVATE_PTR();
+                if (p.byteCount <= p.maxByteCount)
+                    return;
+
+                // Find the readers for each file, layer, proxy level, and
+                // color space.
+                typedef std::tuple<std::string, size_t, size_t, std::string> ReaderKey;
+                std::map<ReaderKey, const Reader*> readers;
+                for (const auto& i : p.readers)
+                {
+                    readers[std::make_tuple(i.second.fileName, i.second.layer, i.second.proxy, i.second.colorSpace)] = &i.second;
+                }
+                auto getReader = [&readers](const Key& key) -> const Reader*
+                {
+                    const auto i = readers.find(std::make_tuple(key.fileName, key.layer, key.proxy, key.colorSpace));
+                    return i != readers.end() ? i->second : nullptr;
+                };
+
+                // Evict the least recently used entries that no longer belong
+                // to a reader, then the ones outside of their reader's window.
+                for (size_t pass = 0; pass < 2 && p.byteCount > p.maxByteCount; ++pass)
+                {
+                    auto i = p.lru.begin();
+                    while (i != p.lru.end() && p.byteCount > p.maxByteCount)
+                    {
+                        const Key& key = *i;
+                        ++i;
+                        const Reader* reader = getReader(key);
+                        if (0 == pass ? !reader : !reader->window.contains(key.frame))
+                        {
+                            p.erase(p.entries.find(key));
+                        }
+                    }
+                }
+
+                // Evict the entries inside of the windows, furthest from the
+                // playhead first.
+                while (p.byteCount > p.maxByteCount && p.entries.size())
+                {
+                    auto entry = p.entries.begin();
+                    size_t distance = 0;
+                    for (auto i = p.entries.begin(); i != p.entries.end(); ++i)
+                    {
+                        const size_t d = getDistance(*getReader(i->first), i->first.frame);
+                        if (d >= distance)
+                        {
+                            entry = i;
+                            distance = d;
+                        }
+                    }
+                    p.erase(entry);
+                }
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAV/IO.h>
+
+#include <djvCore/UID.h>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            //! This class provides a frame cache that is shared by all of the
+            //! readers with a single memory budget.
+            //!
+            //! Frames are keyed by file name, layer, proxy level, color space,
+            //! and frame index so they can be found again when a file is
+            //! re-opened. When the budget is exceeded frames are evicted in
+            //! this order:
+            //! - Frames that no longer belong to a reader, least recently used
+            //!   first
+            //! - Frames outside of their reader's cache window, least recently
+            //!   used first
+            //! - Frames inside of a cache window, furthest from the playhead
+            //!   in the playback direction first
+            class FrameCache
+            {
+                DJV_NON_COPYABLE(FrameCache);
+
+            protected:
+                FrameCache();
+
+            public:
+                ~FrameCache();
+
+                static std::shared_ptr<FrameCache> create();
+
+                size_t getMaxByteCount() const;
+                size_t getByteCount() const;
+                size_t getCount() const;
+                void setMaxByteCount(size_t);
+
+                //! \name Readers
+                ///@{
+
+                Core::UID addReader(
+                    const std::string& fileName,
+                    size_t layer,
+                    size_t proxy = 0,
+                    const std::string& colorSpace = std::string());
+                void removeReader(Core::UID);
+
+                //! Set the frames the reader wants to keep and the current
+                //! playback state used to prioritize them.
+                void setReaderWindow(
+                    Core::UID,
+                    const Core::Frame::Sequence& window,
+                    Core::Frame::Index currentFrame,
+                    Direction,
+                    const Core::Range::Range<Core::Frame::Index>&);
+
+                ///@}
+
+                //! \name Frames
+                ///@{
+
+                size_t getByteCount(Core::UID) const;
+                size_t getCount(Core::UID) const;
+                Core::Frame::Sequence getFrames(Core::UID) const;
+
+                bool contains(Core::UID, Core::Frame::Index) const;
+                bool get(Core::UID, Core::Frame::Index, std::shared_ptr<Image::Image>&);
+                void add(Core::UID, Core::Frame::Index, const std::shared_ptr<Image::Image>&);
+                void clear(Core::UID);
+                void clear();
+
+                ///@}
+
+            private:
+                void _evict();
+
+                DJV_PRIVATE();
+            };
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -112,6 +112,11 @@ namespace djv
                 return _finished;
             }
 
+            inline std::condition_variable& VideoQueue::getCV()
+            {
+                return _cv;
+            }
+
             inline AudioFrame::AudioFrame()
             {}
 
@@ -221,31 +226,10 @@ namespace djv
                     _out == other._out;
             }
 
-            inline Cache::Cache()
-            {}
-            
             inline size_t Cache::getMax() const
             {
                 return _max;
             }
-            
-            inline size_t Cache::getCount() const
-            {
-                return _cache.size();
-            }
-
-            inline size_t Cache::getTotalByteCount() const
-            {
-                size_t out = 0;
-                for (const auto& i : _cache)
-                {
-                    if (i.second)
-                    {
-                        out += i.second->getDataByteCount();
-                    }
-                }
-                return out;
-            }
 
             inline const std::string& IPlugin::getPluginName() const
             {
@@ -272,27 +256,6 @@ namespace djv
                 return _sequence;
             }
 
-            inline bool Cache::contains(Core::Frame::Index value) const
-            {
-                return _cache.find(value) != _cache.end();
-            }
-
-            inline bool Cache::get(Core::Frame::Index index, std::shared_ptr<AV::Image::Image>& out) const
-            {
-                const auto i = _cache.find(index);
-                const bool found = i != _cache.end();
-                if (found)
-                {
-                    out = i->second;
-                }
-                return found;
-            }
-
-            inline void Cache::clear()
-            {
-                _cache.clear();
-            }
-
         } // namespace IO
     } // namespace AV
 } // namespace djv
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/IOReadAhead.h>
+
+#include <djvAV/IOThreadPool.h>
+
+#include <djvCore/FileIO.h>
+
+#include <deque>
+#include <list>
+#include <mutex>
+#include <set>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace
+            {
+                //! The number of files that are remembered as being read. Older
+                //! files may have been evicted from the page cache so they are
+                //! allowed to be read again.
+                const size_t readMax = 64;
+
+                //! This struct provides the state shared with the thread pool
+                //! tasks, which may still be running when the read-ahead is
+                //! destroyed.
+                struct State
+                {
+                    std::mutex mutex;
+                    std::deque<std::string> pending;
+                    std::set<std::string> active;
+                    std::list<std::string> readList;
+                    std::set<std::string> readSet;
+                };
+
+            } // namespace
+
+            struct ReadAhead::Private
+            {
+                std::shared_ptr<ThreadPool> threadPool;
+                std::shared_ptr<State> state;
+            };
+
+            void ReadAhead::_init(const std::shared_ptr<ThreadPool>& threadPool)
+            {
+                DJV_PRIVATE_PTR();
+                p.threadPool = threadPool;
+                p.state = std::make_shared<State>();
+            }
+
+            ReadAhead::ReadAhead() :
+                _p(new Private)
+            {}
+
+            ReadAhead::~ReadAhead()
+            {
+                DJV_PRIVATE_PTR();
+                p.threadPool->cancel(this);
+            }
+
+            std::shared_ptr<ReadAhead> ReadAhead::create(const std::shared_ptr<ThreadPool>& threadPool)
+            {
+                auto out = std::shared_ptr<ReadAhead>(new ReadAhead);
+                out->_init(threadPool);
+                return out;
+            }
+
+            void ReadAhead::setFileNames(const std::vector<std::string>& value)
+            {
+                DJV_PRIVATE_PTR();
+                p.threadPool->cancel(this);
+                size_t count = 0;
+                {
+                    std::lock_guard<std::mutex> lock(p.state->mutex);
+                    p.state->pending.clear();
+                    for (const auto& i : value)
+                    {
+                        if (p.state->active.find(i) == p.state->active.end() &&
+                            p.state->readSet.find(i) == p.state->readSet.end())
+                        {
+                            p.state->pending.push_back(i);
+                        }
+                    }
+                    count = p.state->pending.size();
+                }
+
+                // Each task reads the next pending file, so the files are read
+                // in order of priority.
+                auto state = p.state;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    p.threadPool->addTask(
+                        TaskPriority::Cache,
+                        [state]
+                        {
+                            std::string fileName;
+                            {
+                                std::lock_guard<std::mutex> lock(state->mutex);
+                                if (state->pending.empty())
+                                {
+                                    return;
+                                }
+                                fileName = state->pending.front();
+                                state->pending.pop_front();
+                                state->active.insert(fileName);
+                            }
+                            FileSystem::FileIO::prefetch(fileName);
+                            {
+                                std::lock_guard<std::mutex> lock(state->mutex);
+                                state->active.erase(fileName);
+                                if (state->readSet.insert(fileName).second)
+                                {
+                                    state->readList.push_back(fileName);
+                                }
+                                while (state->readList.size() > readMax)
+                                {
+                                    state->readSet.erase(state->readList.front());
+                                    state->readList.pop_front();
+                                }
+                            }
+                        },
+                        this);
+                }
+            }
+
+            size_t ReadAhead::getPendingCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.state->mutex);
+                return p.state->pending.size() + p.state->active.size();
+            }
+
+            bool ReadAhead::isRead(const std::string& value) const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.state->mutex);
+                return p.state->readSet.find(value) != p.state->readSet.end();
+            }
+
+            void ReadAhead::clear()
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.state->mutex);
+                p.state->readList.clear();
+                p.state->readSet.clear();
+            }
+
+            std::vector<Frame::Index> ReadAhead::getFrames(
+                Frame::Index frame,
+                Direction direction,
+                const Range::Range<Frame::Index>& range,
+                bool loop,
+                size_t count)
+            {
+                std::vector<Frame::Index> out;
+                const size_t rangeSize = static_cast<size_t>(range.getMax() - range.getMin() + 1);
+                for (size_t i = 0; i < rangeSize && out.size() < count; ++i)
+                {
+                    if (frame < range.getMin() || frame > range.getMax())
+                    {
+                        if (!loop)
+                        {
+                            break;
+                        }
+                        frame = Direction::Forward == direction ? range.getMin() : range.getMax();
+                    }
+                    out.push_back(frame);
+                    frame += Direction::Forward == direction ? 1 : -1;
+                }
+                return out;
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAV/IO.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            class ThreadPool;
+
+            //! This class asks the operating system to read files into the page
+            //! cache ahead of the decoders (see Core::FileSystem::FileIO::prefetch()).
+            //! The requests are run as cache tasks on the shared thread pool, so
+            //! several files are in flight at once without adding threads.
+            class ReadAhead
+            {
+                DJV_NON_COPYABLE(ReadAhead);
+
+            protected:
+                void _init(const std::shared_ptr<ThreadPool>&);
+                ReadAhead();
+
+            public:
+                ~ReadAhead();
+
+                //! Create a new read-ahead.
+                static std::shared_ptr<ReadAhead> create(const std::shared_ptr<ThreadPool>&);
+
+                //! Set the files to read, in order of priority. Files that were
+                //! previously set and have not been started are dropped.
+                void setFileNames(const std::vector<std::string>&);
+
+                //! Get the number of files waiting to be read.
+                size_t getPendingCount() const;
+
+                //! Get whether a file has been read.
+                bool isRead(const std::string&) const;
+
+                //! Forget the files that have been read.
+                void clear();
+
+                //! Get the frames to read ahead of the given frame, in order of
+                //! playback. The frames are limited to the range and wrap
+                //! around when looping.
+                static std::vector<Core::Frame::Index> getFrames(
+                    Core::Frame::Index,
+                    Direction,
+                    const Core::Range::Range<Core::Frame::Index>&,
+                    bool loop,
+                    size_t count);
+
+            private:
+                DJV_PRIVATE();
+            };
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
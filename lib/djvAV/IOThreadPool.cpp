@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/IOThreadPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace
+            {
+                struct Task
+                {
+                    std::function<void(void)> function;
+                    const void* owner = nullptr;
+                };
+
+                //! Each worker owns a queue of tasks for every priority. Idle
+                //! workers steal from the other workers' queues.
+                struct Worker
+                {
+                    std::mutex mutex;
+                    std::deque<Task> tasks[static_cast<size_t>(TaskPriority::Count)];
+                };
+
+            } // namespace
+
+            struct ThreadPool::Private
+            {
+                std::vector<std::unique_ptr<Worker> > workers;
+                std::vector<std::thread> threads;
+                std::atomic<size_t> nextWorker;
+                mutable std::mutex mutex;
+                std::condition_variable cv;
+                size_t pendingCount = 0;
+                std::atomic<bool> running;
+            };
+
+            void ThreadPool::_init(size_t threadCount)
+            {
+                DJV_PRIVATE_PTR();
+                if (!threadCount)
+                {
+                    threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+                }
+                p.nextWorker = 0;
+                p.running = true;
+                for (size_t i = 0; i < threadCount; ++i)
+                {
+                    p.workers.push_back(std::unique_ptr<Worker>(new Worker));
+                }
+                for (size_t i = 0; i < threadCount; ++i)
+                {
+                    p.threads.push_back(std::thread(
+                        [this, i]
+                        {
+                            DJV_PRIVATE_PTR();
+                            while (p.running)
+                            {
+                                // Claim one of the pending tasks while the
+                                // lock is held so that idle workers sleep
+                                // instead of racing for the same task.
+                                {
+                                    std::unique_lock<std::mutex> lock(p.mutex);
+                                    p.cv.wait(
+                                        lock,
+                                        [this]
+                                        {
+                                            return _p->pendingCount > 0 || !_p->running;
+                                        });
+                                    if (!p.running)
+                                    {
+                                        break;
+                                    }
+                                    --p.pendingCount;
+                                }
+                                std::function<void(void)> task;
+                                if (_getTask(i, task))
+                                {
+                                    task();
+                                }
+                            }
+                        }));
+                }
+            }
+
+            ThreadPool::ThreadPool() :
+                _p(new Private)
+            {}
+
+            ThreadPool::~ThreadPool()
+            {
+                DJV_PRIVATE_PTR();
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    p.running = false;
+                }
+                p.cv.notify_all();
+                for (auto& i : p.threads)
+                {
+                    if (i.joinable())
+                    {
+                        i.join();
+                    }
+                }
+            }
+
+            std::shared_ptr<ThreadPool> ThreadPool::create(size_t threadCount)
+            {
+                auto out = std::shared_ptr<ThreadPool>(new ThreadPool);
+                out->_init(threadCount);
+                return out;
+            }
+
+            size_t ThreadPool::getThreadCount() const
+            {
+                return _p->threads.size();
+            }
+
+            size_t ThreadPool::getPendingCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.pendingCount;
+            }
+
+            void ThreadPool::addTask(TaskPriority priority, const std::function<void(void)>& value, const void* owner)
+            {
+                DJV_PRIVATE_PTR();
+                auto& worker = p.workers[p.nextWorker++ % p.workers.size()];
+                {
+                    std::lock_guard<std::mutex> lock(worker->mutex);
+                    Task task;
+                    task.function = value;
+                    task.owner = owner;
+                    worker->tasks[static_cast<size_t>(priority)].push_back(std::move(task));
+                }
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    ++p.pendingCount;
+                }
+                p.cv.notify_one();
+            }
+
+            size_t ThreadPool::cancel(const void* owner)
+            {
+                DJV_PRIVATE_PTR();
+                size_t out = 0;
+                std::lock_guard<std::mutex> lock(p.mutex);
+                for (auto& worker : p.workers)
+                {
+                    std::lock_guard<std::mutex> workerLock(worker->mutex);
+                    for (auto& tasks : worker->tasks)
+                    {
+                        auto i = tasks.begin();
+                        while (i != tasks.end())
+                        {
+                            if (owner == i->owner)
+                            {
+                                i = tasks.erase(i);
+                                ++out;
+                            }
+                            else
+                            {
+                                ++i;
+                            }
+                        }
+                    }
+                }
+
+                // Workers that have already claimed a removed task will not
+                // find it and go back to waiting.
+                p.pendingCount -= std::min(p.pendingCount, out);
+                return out;
+            }
+
+            bool ThreadPool::_getTask(size_t index, std::function<void(void)>& out)
+            {
+                DJV_PRIVATE_PTR();
+                const size_t workerCount = p.workers.size();
+                for (size_t priority = 0; priority < static_cast<size_t>(TaskPriority::Count); ++priority)
+                {
+                    // Take the oldest task from our own queue first.
+                    {
+                        auto& worker = p.workers[index];
+                        std::lock_guard<std::mutex> lock(worker->mutex);
+                        auto& tasks = worker->tasks[priority];
+                        if (tasks.size())
+                        {
+                            out = std::move(tasks.front().function);
+                            tasks.pop_front();
+                            return true;
+                        }
+                    }
+
+                    // Steal from another worker, also taking the oldest task
+                    // so that frames are decoded in playback order.
+                    for (size_t i = 1; i < workerCount; ++i)
+                    {
+                        auto& worker = p.workers[(index + i) % workerCount];
+                        std::lock_guard<std::mutex> lock(worker->mutex);
+                        auto& tasks = worker->tasks[priority];
+                        if (tasks.size())
+                        {
+                            out = std::move(tasks.front().function);
+                            tasks.pop_front();
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
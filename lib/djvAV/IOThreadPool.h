@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <functional>
+#include <future>
+#include <memory>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            //! This enumeration provides thread pool task priorities. Tasks
+            //! for the playback queue are always run before cache tasks.
+            enum class TaskPriority
+            {
+                Queue,
+                Cache,
+
+                Count,
+                First = Queue
+            };
+
+            //! This class provides a work-stealing thread pool that is shared
+            //! by all of the readers.
+            class ThreadPool
+            {
+                DJV_NON_COPYABLE(ThreadPool);
+
+            protected:
+                void _init(size_t threadCount);
+                ThreadPool();
+
+            public:
+                ~ThreadPool();
+
+                //! Create a new thread pool. If the thread count is zero the
+                //! hardware concurrency is used.
+                static std::shared_ptr<ThreadPool> create(size_t threadCount = 0);
+
+                //! Get the number of threads.
+                size_t getThreadCount() const;
+
+                //! Get the number of tasks waiting to be run.
+                size_t getPendingCount() const;
+
+                //! Add a task to the pool. The owner can be used to cancel the
+                //! task before it is started.
+                void addTask(TaskPriority, const std::function<void(void)>&, const void* owner = nullptr);
+
+                //! Add a task to the pool that returns a value. If the task is
+                //! cancelled the future throws std::future_error.
+                template<typename T>
+                std::future<T> run(TaskPriority, const std::function<T(void)>&, const void* owner = nullptr);
+
+                //! Remove the tasks with the given owner that have not been
+                //! started yet. Returns the number of tasks removed.
+                size_t cancel(const void* owner);
+
+            private:
+                bool _getTask(size_t worker, std::function<void(void)>&);
+
+                DJV_PRIVATE();
+            };
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
+
+#include <djvAV/IOThreadPoolInline.h>
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            template<typename T>
+            inline std::future<T> ThreadPool::run(TaskPriority priority, const std::function<T(void)>& value, const void* owner)
+            {
+                // Note that std::function requires a copyable callable so the
+                // packaged task is held by a shared pointer.
+                auto task = std::make_shared<std::packaged_task<T(void)> >(value);
+                auto out = task->get_future();
+                addTask(
+                    priority,
+                    [task]
+                    {
+                        (*task)();
+                    },
+                    owner);
+                return out;
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -12,7 +12,7 @@ namespace djv
         {
             void Image::_init(const Info& value, const std::shared_ptr<Core::FileSystem::FileIO>& io)
             {
-                Data::_init(value, io);
+                Data::_init(value, io, nullptr);
             }
 
             Image::Image()
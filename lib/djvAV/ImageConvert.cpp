@@ -4,6 +4,7 @@
 
 #include <djvAV/ImageConvert.h>
 
+#include <djvAV/ImageUtil.h>
 #include <djvAV/OpenGLMesh.h>
 #include <djvAV/OpenGLOffscreenBuffer.h>
 #include <djvAV/OpenGLShader.h>
@@ -15,8 +16,17 @@
 #include <djvCore/Context.h>
 #include <djvCore/ResourceSystem.h>
 
+#include <GLFW/glfw3.h>
+
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
 using namespace djv::Core;
 
 namespace djv
@@ -25,8 +35,275 @@ namespace djv
     {
         namespace Image
         {
+            namespace
+            {
+                //! The minimum number of scanlines for each CPU thread.
+                const size_t cpuScanlinesPerThread = 64;
+
+                //! Get the word size used to swap the endian of a pixel type.
+                size_t getEndianWordSize(Type type)
+                {
+                    return Type::RGB_U10 == type ?
+                        getByteCount(type) :
+                        getByteCount(getDataType(type));
+                }
+
+                //! Get an input scanline in the native endian and without
+                //! mirroring, using the temporary buffer if necessary.
+                const uint8_t* getScanline(const Data& data, uint16_t y, std::vector<uint8_t>& tmp)
+                {
+                    const Info& info = data.getInfo();
+                    const uint8_t* out = data.getData(info.layout.mirror.y ? (info.size.h - 1 - y) : y);
+                    const size_t pixelByteCount = data.getPixelByteCount();
+                    const size_t byteCount = info.size.w * pixelByteCount;
+                    const size_t wordSize = getEndianWordSize(info.type);
+                    const bool swap = info.layout.endian != Memory::getEndian() && wordSize > 1;
+                    if (info.layout.mirror.x)
+                    {
+                        tmp.resize(byteCount);
+                        uint8_t* tmpP = tmp.data() + byteCount - pixelByteCount;
+                        for (uint16_t x = 0; x < info.size.w; ++x, out += pixelByteCount, tmpP -= pixelByteCount)
+                        {
+                            memcpy(tmpP, out, pixelByteCount);
+                        }
+                        if (swap)
+                        {
+                            Memory::endian(tmp.data(), byteCount / wordSize, wordSize);
+                        }
+                        out = tmp.data();
+                    }
+                    else if (swap)
+                    {
+                        tmp.resize(byteCount);
+                        Memory::endian(out, tmp.data(), byteCount / wordSize, wordSize);
+                        out = tmp.data();
+                    }
+                    return out;
+                }
+
+                //! Convert an input scanline to floating point.
+                void getScanlineF32(const Data& data, uint16_t y, std::vector<uint8_t>& tmp, std::vector<float>& out)
+                {
+                    const Info& info = data.getInfo();
+                    const uint8_t channelCount = getChannelCount(info.type);
+                    out.resize(info.size.w * channelCount);
+                    convert(
+                        getScanline(data, y, tmp),
+                        info.type,
+                        out.data(),
+                        getFloatType(channelCount, 32),
+                        info.size.w);
+                }
+
+                //! This struct provides the input samples for a bilinear
+                //! filter.
+                struct Bilinear
+                {
+                    uint16_t i0 = 0;
+                    uint16_t i1 = 0;
+                    float    t  = 0.F;
+                };
+
+                //! This struct provides the input samples for a box filter.
+                struct Box
+                {
+                    uint16_t min = 0;
+                    uint16_t max = 0;
+                };
+
+                //! Get the bilinear samples, using the same texel centers as
+                //! OpenGL with clamp to edge.
+                std::vector<Bilinear> getBilinear(uint16_t in, uint16_t out)
+                {
+                    std::vector<Bilinear> samples(out);
+                    const float scale = in / static_cast<float>(out);
+                    for (uint16_t i = 0; i < out; ++i)
+                    {
+                        const float s = std::max((i + .5F) * scale - .5F, 0.F);
+                        Bilinear& sample = samples[i];
+                        sample.i0 = std::min(static_cast<uint16_t>(s), static_cast<uint16_t>(in - 1));
+                        sample.i1 = std::min(static_cast<uint16_t>(sample.i0 + 1), static_cast<uint16_t>(in - 1));
+                        sample.t = s - sample.i0;
+                    }
+                    return samples;
+                }
+
+                //! Get the box samples.
+                std::vector<Box> getBox(uint16_t in, uint16_t out)
+                {
+                    std::vector<Box> samples(out);
+                    const float scale = in / static_cast<float>(out);
+                    for (uint16_t i = 0; i < out; ++i)
+                    {
+                        Box& sample = samples[i];
+                        sample.min = std::min(static_cast<uint16_t>(i * scale), static_cast<uint16_t>(in - 1));
+                        sample.max = std::max(
+                            std::min(static_cast<uint16_t>(std::ceil((i + 1) * scale)), in),
+                            static_cast<uint16_t>(sample.min + 1));
+                    }
+                    return samples;
+                }
+
+                //! Resample a floating point scanline horizontally.
+                void resampleScanline(
+                    const float*                 in,
+                    uint16_t                     inWidth,
+                    float*                       out,
+                    uint16_t                     outWidth,
+                    uint8_t                      channelCount,
+                    const std::vector<Bilinear>& bilinear,
+                    const std::vector<Box>&      box)
+                {
+                    if (inWidth == outWidth)
+                    {
+                        memcpy(out, in, outWidth * channelCount * sizeof(float));
+                    }
+                    else if (outWidth > inWidth)
+                    {
+                        for (uint16_t x = 0; x < outWidth; ++x, out += channelCount)
+                        {
+                            const Bilinear& sample = bilinear[x];
+                            const float* p0 = in + sample.i0 * channelCount;
+                            const float* p1 = in + sample.i1 * channelCount;
+                            for (uint8_t c = 0; c < channelCount; ++c)
+                            {
+                                out[c] = p0[c] + (p1[c] - p0[c]) * sample.t;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (uint16_t x = 0; x < outWidth; ++x, out += channelCount)
+                        {
+                            const Box& sample = box[x];
+                            for (uint8_t c = 0; c < channelCount; ++c)
+                            {
+                                out[c] = 0.F;
+                            }
+                            const float* p = in + sample.min * channelCount;
+                            for (uint16_t i = sample.min; i < sample.max; ++i, p += channelCount)
+                            {
+                                for (uint8_t c = 0; c < channelCount; ++c)
+                                {
+                                    out[c] += p[c];
+                                }
+                            }
+                            const float weight = 1.F / (sample.max - sample.min);
+                            for (uint8_t c = 0; c < channelCount; ++c)
+                            {
+                                out[c] *= weight;
+                            }
+                        }
+                    }
+                }
+
+                //! Convert a range of output scanlines.
+                void processCPU(const Data& data, const Info& info, uint8_t* out, uint16_t yMin, uint16_t yMax)
+                {
+                    const Info& inInfo = data.getInfo();
+                    const size_t outScanlineByteCount = info.getScanlineByteCount();
+                    const size_t outWordSize = getEndianWordSize(info.type);
+                    const bool outSwap = info.layout.endian != Memory::getEndian() && outWordSize > 1;
+                    const size_t outWordCount = info.size.w * getByteCount(info.type) / outWordSize;
+                    std::vector<uint8_t> tmp;
+                    if (inInfo.size == info.size)
+                    {
+                        for (uint16_t y = yMin; y < yMax; ++y)
+                        {
+                            uint8_t* outP = out + y * outScanlineByteCount;
+                            convert(getScanline(data, y, tmp), inInfo.type, outP, info.type, info.size.w);
+                            if (outSwap)
+                            {
+                                Memory::endian(outP, outWordCount, outWordSize);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        const uint8_t channelCount = getChannelCount(inInfo.type);
+                        const Type floatType = getFloatType(channelCount, 32);
+                        const auto bilinearX = getBilinear(inInfo.size.w, info.size.w);
+                        const auto boxX = getBox(inInfo.size.w, info.size.w);
+                        const auto bilinearY = getBilinear(inInfo.size.h, info.size.h);
+                        const auto boxY = getBox(inInfo.size.h, info.size.h);
+                        const size_t outChannelCount = info.size.w * channelCount;
+                        std::vector<float> scanline;
+                        std::vector<float> scanline0(outChannelCount);
+                        std::vector<float> scanline1(outChannelCount);
+                        int scanline0Y = -1;
+                        int scanline1Y = -1;
+                        std::vector<float> result(outChannelCount);
+                        for (uint16_t y = yMin; y < yMax; ++y)
+                        {
+                            if (info.size.h > inInfo.size.h)
+                            {
+                                const Bilinear& sample = bilinearY[y];
+                                if (scanline0Y != sample.i0)
+                                {
+                                    if (scanline1Y == sample.i0)
+                                    {
+                                        std::swap(scanline0, scanline1);
+                                        std::swap(scanline0Y, scanline1Y);
+                                    }
+                                    else
+                                    {
+                                        getScanlineF32(data, sample.i0, tmp, scanline);
+                                        resampleScanline(scanline.data(), inInfo.size.w, scanline0.data(), info.size.w, channelCount, bilinearX, boxX);
+                                        scanline0Y = sample.i0;
+                                    }
+                                }
+                                if (scanline1Y != sample.i1)
+                                {
+                                    getScanlineF32(data, sample.i1, tmp, scanline);
+                                    resampleScanline(scanline.data(), inInfo.size.w, scanline1.data(), info.size.w, channelCount, bilinearX, boxX);
+                                    scanline1Y = sample.i1;
+                                }
+                                const float* p0 = scanline0.data();
+                                const float* p1 = scanline1.data();
+                                float* resultP = result.data();
+                                const float t = sample.t;
+                                for (size_t i = 0; i < outChannelCount; ++i)
+                                {
+                                    resultP[i] = p0[i] + (p1[i] - p0[i]) * t;
+                                }
+                            }
+                            else
+                            {
+                                const Box& sample = boxY[y];
+                                std::fill(result.begin(), result.end(), 0.F);
+                                float* resultP = result.data();
+                                for (uint16_t i = sample.min; i < sample.max; ++i)
+                                {
+                                    getScanlineF32(data, i, tmp, scanline);
+                                    resampleScanline(scanline.data(), inInfo.size.w, scanline0.data(), info.size.w, channelCount, bilinearX, boxX);
+                                    const float* p = scanline0.data();
+                                    for (size_t j = 0; j < outChannelCount; ++j)
+                                    {
+                                        resultP[j] += p[j];
+                                    }
+                                }
+                                const float weight = 1.F / (sample.max - sample.min);
+                                for (size_t j = 0; j < outChannelCount; ++j)
+                                {
+                                    resultP[j] *= weight;
+                                }
+                            }
+                            uint8_t* outP = out + y * outScanlineByteCount;
+                            convert(result.data(), floatType, outP, info.type, info.size.w);
+                            if (outSwap)
+                            {
+                                Memory::endian(outP, outWordCount, outWordSize);
+                            }
+                        }
+                    }
+                }
+
+            } // namespace
+
             struct Convert::Private
             {
+                ConvertBackend backend = ConvertBackend::First;
+                size_t threadCount = 1;
                 Size size;
                 Mirror mirror;
                 std::shared_ptr<OpenGL::OffscreenBuffer> offscreenBuffer;
@@ -37,9 +314,13 @@ namespace djv
                 glm::mat4x4 mvp = glm::mat4x4(1.F);
             };
 
-            void Convert::_init(const std::shared_ptr<ResourceSystem>& resourceSystem)
+            void Convert::_init(ConvertBackend backend, const std::shared_ptr<ResourceSystem>& resourceSystem)
             {
                 DJV_PRIVATE_PTR();
+                p.backend = backend;
+                p.threadCount = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1));
+                if (ConvertBackend::CPU == backend)
+                    return;
                 const FileSystem::Path shaderPath = resourceSystem->getPath(Core::FileSystem::ResourcePath::Shaders);
                 p.shader = AV::OpenGL::Shader::create(Render::Shader::create(
                     FileSystem::Path(shaderPath, "djvAVImageConvertVertex.glsl"),
@@ -54,15 +335,80 @@ namespace djv
             {}
 
             std::shared_ptr<Convert> Convert::create(const std::shared_ptr<ResourceSystem>& resourceSystem)
+            {
+                return create(glfwGetCurrentContext() ? ConvertBackend::OpenGL : ConvertBackend::CPU, resourceSystem);
+            }
+
+            std::shared_ptr<Convert> Convert::create(ConvertBackend backend, const std::shared_ptr<ResourceSystem>& resourceSystem)
             {
                 auto out = std::shared_ptr<Convert>(new Convert);
-                out->_init(resourceSystem);
+                out->_init(backend, resourceSystem);
                 return out;
             }
 
+            ConvertBackend Convert::getBackend() const
+            {
+                return _p->backend;
+            }
+
+            size_t Convert::getThreadCount() const
+            {
+                return _p->threadCount;
+            }
+
+            void Convert::setThreadCount(size_t value)
+            {
+                _p->threadCount = std::max(value, static_cast<size_t>(1));
+            }
+
             void Convert::process(const Data& data, const Info& info, Data& out)
             {
                 DJV_PRIVATE_PTR();
+                if (isYUVType(info.type))
+                {
+                    //! \todo How can we translate this?
+                    throw std::invalid_argument(DJV_TEXT("error_unsupported_image_type"));
+                }
+                if (isYUVType(data.getType()))
+                {
+                    auto rgb = Data::create(Info(data.getSize(), getRGBType(data.getType()), data.getLayout()));
+                    convertYUV(data, *rgb);
+                    process(*rgb, info, out);
+                    return;
+                }
+                if (ConvertBackend::CPU == p.backend)
+                {
+                    if (!info.isValid() || !data.isValid())
+                        return;
+
+                    // Split the output scanlines between threads, based on the
+                    // number of input scanlines that need to be read.
+                    uint8_t* outP = out.getData();
+                    const size_t scanlines = std::max(info.size.h, data.getHeight());
+                    const size_t threadCount = std::max(std::min(std::min(
+                        p.threadCount,
+                        scanlines / cpuScanlinesPerThread),
+                        static_cast<size_t>(info.size.h)), static_cast<size_t>(1));
+                    std::vector<std::future<void> > futures;
+                    for (size_t i = 1; i < threadCount; ++i)
+                    {
+                        const uint16_t yMin = static_cast<uint16_t>(info.size.h * i / threadCount);
+                        const uint16_t yMax = static_cast<uint16_t>(info.size.h * (i + 1) / threadCount);
+                        futures.push_back(std::async(
+                            std::launch::async,
+                            [&data, &info, outP, yMin, yMax]
+                            {
+                                processCPU(data, info, outP, yMin, yMax);
+                            }));
+                    }
+                    processCPU(data, info, outP, 0, static_cast<uint16_t>(info.size.h / threadCount));
+                    for (auto& i : futures)
+                    {
+                        i.get();
+                    }
+                    return;
+                }
+
                 bool create = !p.offscreenBuffer;
                 create |= p.offscreenBuffer && info.size != p.offscreenBuffer->getSize();
                 create |= p.offscreenBuffer && info.type != p.offscreenBuffer->getColorType();
@@ -93,9 +439,9 @@ namespace djv
                     glm::mat4x4 projectionMatrix(1);
                     projectionMatrix = glm::ortho(
                         0.F,
-                        static_cast<float>(info.size.w) - 1.F,
+                        static_cast<float>(info.size.w),
                         0.F,
-                        static_cast<float>(info.size.h) - 1.F,
+                        static_cast<float>(info.size.h),
                         -1.F,
                         1.F);
                     p.mvp = projectionMatrix * viewMatrix * modelMatrix;
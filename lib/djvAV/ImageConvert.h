@@ -18,26 +18,66 @@ namespace djv
     {
         namespace Image
         {
+            //! This enumeration provides the image conversion backends.
+            enum class ConvertBackend
+            {
+                OpenGL,
+                CPU,
+
+                Count,
+                First = OpenGL
+            };
+
             //! This class provides image data conversion.
+            //!
+            //! The CPU backend converts the pixels with multiple threads and
+            //! resamples with a bilinear filter when magnifying and a box
+            //! filter when minifying. Converters that are used from thread
+            //! pool tasks or worker threads should be limited to one thread.
             class Convert
             {
                 DJV_NON_COPYABLE(Convert);
 
             protected:
-                void _init(const std::shared_ptr<Core::ResourceSystem>&);
+                void _init(ConvertBackend, const std::shared_ptr<Core::ResourceSystem>&);
                 Convert();
 
             public:
                 ~Convert();
 
-                //! Note that this function requires an OpenGL context.
+                //! Create a new converter. The OpenGL backend is used if there
+                //! is a current OpenGL context, otherwise the CPU backend.
                 //! Throws:
                 //! - OpenGL::ShaderError
                 //! - Render::ShaderError
                 static std::shared_ptr<Convert> create(const std::shared_ptr<Core::ResourceSystem>&);
 
-                //! Note that this function requires an OpenGL context.
+                //! Create a new converter with the given backend. Note that
+                //! the OpenGL backend requires an OpenGL context.
+                //! Throws:
+                //! - OpenGL::ShaderError
+                //! - Render::ShaderError
+                static std::shared_ptr<Convert> create(ConvertBackend, const std::shared_ptr<Core::ResourceSystem>&);
+
+                ConvertBackend getBackend() const;
+
+                //! \name Threads
+                ///@{
+
+                //! Get the maximum number of threads used by the CPU backend.
+                //! The default is the number of hardware threads.
+                size_t getThreadCount() const;
+
+                void setThreadCount(size_t);
+
+                ///@}
+
+                //! Planar YUV input is converted to RGB on the CPU first, planar
+                //! YUV output is not supported.
+                //!
+                //! Note that the OpenGL backend requires an OpenGL context.
                 //! Throws:
+                //! - std::invalid_argument if the output is planar YUV
                 //! - OpenGL::OffscreenBufferError
                 void process(const Data&, const Info&, Data&);
 
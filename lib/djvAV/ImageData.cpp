@@ -4,6 +4,8 @@
 
 #include <djvAV/ImageData.h>
 
+#include <djvAV/ImageDataPool.h>
+
 #include <djvCore/FileIO.h>
 
 namespace djv
@@ -12,28 +14,47 @@ namespace djv
     {
         namespace Image
         {
-            void Data::_init(const Info& info, const std::shared_ptr<Core::FileSystem::FileIO>& fileIO)
+            void Data::_init(
+                const Info& info,
+                const std::shared_ptr<Core::FileSystem::FileIO>& fileIO,
+                const std::shared_ptr<DataPool>& pool)
             {
                 _uid = Core::createUID();
                 _info = info;
+                _pool = pool ? pool : DataPool::getGlobal();
                 _pixelByteCount = info.getPixelByteCount();
                 _scanlineByteCount = info.getScanlineByteCount();
                 _dataByteCount = info.getDataByteCount();
 #if defined(DJV_MMAP)
-                _fileIO = fileIO;
-                if (_fileIO)
+                if (fileIO && fileIO->getSize() - fileIO->getPos() >= _dataByteCount)
                 {
+                    // Reference the memory-map directly and ask for the pixel
+                    // data to be read in ahead of the upload.
+                    _fileIO = fileIO;
                     _p = _fileIO->mmapP();
+                    _fileIO->mmapAdvise(
+                        Core::FileSystem::FileIO::MmapAdvice::WillNeed,
+                        _fileIO->getPos(),
+                        _dataByteCount);
+                }
+                else if (fileIO && _dataByteCount)
+                {
+                    // The file is truncated, copy what is available.
+                    _data = _pool->allocate(_dataByteCount);
+                    const size_t size = fileIO->getSize() - fileIO->getPos();
+                    memcpy(_data, fileIO->mmapP(), size);
+                    memset(_data + size, 0, _dataByteCount - size);
+                    _p = _data;
                 }
                 else if (_dataByteCount)
                 {
-                    _data = new uint8_t[_dataByteCount];
+                    _data = _pool->allocate(_dataByteCount);
                     _p = _data;
                 }
 #else // DJV_MMAP
                 if (_dataByteCount)
                 {
-                    _data = new uint8_t[_dataByteCount];
+                    _data = _pool->allocate(_dataByteCount);
                     _p = _data;
                 }
 #endif // DJV_MMAP
@@ -41,32 +62,35 @@ namespace djv
 
             Data::~Data()
             {
-                delete[] _data;
+                _pool->release(_data, _dataByteCount);
             }
 
 #if defined(DJV_MMAP)
             std::shared_ptr<Data> Data::create(const Info& info, const std::shared_ptr<Core::FileSystem::FileIO>& fileIO)
             {
                 auto out = std::shared_ptr<Data>(new Data);
-                out->_init(info, fileIO);
+                out->_init(info, fileIO, nullptr);
                 return out;
             }
 #else // DJV_MMAP
             std::shared_ptr<Data> Data::create(const Info& info)
             {
                 auto out = std::shared_ptr<Data>(new Data);
-                out->_init(info, nullptr);
+                out->_init(info, nullptr, nullptr);
                 return out;
             }
 #endif // DJV_MMAP
 
+            std::shared_ptr<Data> Data::create(const Info& info, const std::shared_ptr<DataPool>& pool)
+            {
+                auto out = std::shared_ptr<Data>(new Data);
+                out->_init(info, nullptr, pool);
+                return out;
+            }
+
             size_t Data::getDataByteCount() const
             {
-#if defined(DJV_MMAP)
-                return _fileIO ? (_fileIO->getSize() - _fileIO->getPos()) : _dataByteCount;
-#else
                 return _dataByteCount;
-#endif // DJV_MMAP
             }
 
             void Data::zero()
@@ -82,8 +106,8 @@ namespace djv
             {
                 if (_fileIO)
                 {
-                    _data = new uint8_t[_dataByteCount];
-                    memcpy(_data, _fileIO->mmapP(), std::min(_fileIO->getSize() - _fileIO->getPos(), _dataByteCount));
+                    _data = _pool->allocate(_dataByteCount);
+                    memcpy(_data, _p, _dataByteCount);
                     _p = _data;
                     _fileIO.reset();
                 }
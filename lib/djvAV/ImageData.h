@@ -27,6 +27,8 @@ namespace djv
     {
         namespace Image
         {
+            class DataPool;
+
             //! This class provides information about mirroring the image.
             class Mirror
             {
@@ -97,6 +99,19 @@ namespace djv
                 size_t getScanlineByteCount() const;
                 size_t getDataByteCount() const;
 
+                //! \name Planes
+                //! Planar YUV images have three planes, all other images have
+                //! one. The scanlines of each plane use the layout alignment.
+                ///@{
+
+                uint8_t getPlaneCount() const;
+                Size getPlaneSize(uint8_t) const;
+                size_t getPlaneScanlineByteCount(uint8_t) const;
+                size_t getPlaneByteCount(uint8_t) const;
+                size_t getPlaneOffset(uint8_t) const;
+
+                ///@}
+
                 bool operator == (const Info&) const;
                 bool operator != (const Info&) const;
             };
@@ -107,18 +122,28 @@ namespace djv
                 DJV_NON_COPYABLE(Data);
 
             protected:
-                void _init(const Info&, const std::shared_ptr<Core::FileSystem::FileIO>&);
+                void _init(
+                    const Info&,
+                    const std::shared_ptr<Core::FileSystem::FileIO>&,
+                    const std::shared_ptr<DataPool>&);
                 Data();
 
             public:
                 ~Data();
 
 #if defined(DJV_MMAP)
+                //! Create new image data. If a memory-mapped file is given the
+                //! data references the file directly, starting at the current
+                //! file position.
                 static std::shared_ptr<Data> create(const Info&, const std::shared_ptr<Core::FileSystem::FileIO>& = nullptr);
 #else // DJV_MMAP
                 static std::shared_ptr<Data> create(const Info&);
 #endif // DJV_MMAP
 
+                //! Create new image data with memory from the given pool
+                //! instead of the global pool.
+                static std::shared_ptr<Data> create(const Info&, const std::shared_ptr<DataPool>&);
+
                 Core::UID getUID() const;
 
                 const Info& getInfo() const;
@@ -144,9 +169,17 @@ namespace djv
                 uint8_t* getData(uint16_t y);
                 uint8_t* getData(uint16_t x, uint16_t y);
 
+                const uint8_t* getPlaneData(uint8_t) const;
+                uint8_t* getPlaneData(uint8_t);
+
                 void zero();
 
 #if defined(DJV_MMAP)
+                //! Get whether the data references a memory-mapped file.
+                bool isMapped() const;
+
+                //! Copy memory-mapped data into memory owned by the image. This is
+                //! called automatically by the non-const data accessors.
                 void detach();
 #endif // DJV_MMAP
 
@@ -161,6 +194,7 @@ namespace djv
                 size_t _dataByteCount = 0;
                 uint8_t* _data = nullptr;
                 const uint8_t* _p = nullptr;
+                std::shared_ptr<DataPool> _pool;
 #if defined(DJV_MMAP)
                 std::shared_ptr<Core::FileSystem::FileIO> _fileIO;
 #endif // DJV_MMAP
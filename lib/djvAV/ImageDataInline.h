@@ -120,7 +120,62 @@ namespace djv
 
             inline size_t Info::getDataByteCount() const
             {
-                return size.h * getScanlineByteCount();
+                size_t out = 0;
+                const uint8_t planeCount = getPlaneCount();
+                if (1 == planeCount)
+                {
+                    out = size.h * getScanlineByteCount();
+                }
+                else
+                {
+                    for (uint8_t i = 0; i < planeCount; ++i)
+                    {
+                        out += getPlaneByteCount(i);
+                    }
+                }
+                return out;
+            }
+
+            inline uint8_t Info::getPlaneCount() const
+            {
+                return AV::Image::getPlaneCount(type);
+            }
+
+            inline Size Info::getPlaneSize(uint8_t plane) const
+            {
+                Size out = size;
+                if (plane > 0)
+                {
+                    uint8_t x = 0;
+                    uint8_t y = 0;
+                    getChromaShift(type, x, y);
+                    out.w = (size.w + (1 << x) - 1) >> x;
+                    out.h = (size.h + (1 << y) - 1) >> y;
+                }
+                return out;
+            }
+
+            inline size_t Info::getPlaneScanlineByteCount(uint8_t plane) const
+            {
+                const size_t byteCount = static_cast<size_t>(getPlaneSize(plane).w) * AV::Image::getByteCount(type);
+                const size_t q = byteCount / layout.alignment * layout.alignment;
+                const size_t r = byteCount - q;
+                return q + (r ? layout.alignment : 0);
+            }
+
+            inline size_t Info::getPlaneByteCount(uint8_t plane) const
+            {
+                return getPlaneSize(plane).h * getPlaneScanlineByteCount(plane);
+            }
+
+            inline size_t Info::getPlaneOffset(uint8_t plane) const
+            {
+                size_t out = 0;
+                for (uint8_t i = 0; i < plane; ++i)
+                {
+                    out += getPlaneByteCount(i);
+                }
+                return out;
             }
 
             inline bool Info::operator == (const Info& other) const
@@ -220,6 +275,13 @@ namespace djv
                 return _p + y * _scanlineByteCount + x * static_cast<size_t>(_pixelByteCount);
             }
 
+#if defined(DJV_MMAP)
+            inline bool Data::isMapped() const
+            {
+                return _fileIO != nullptr;
+            }
+#endif // DJV_MMAP
+
             inline uint8_t* Data::getData()
             {
 #if defined(DJV_MMAP)
@@ -244,6 +306,19 @@ namespace djv
                 return _data + y * _scanlineByteCount + x * static_cast<size_t>(_pixelByteCount);
             }
 
+            inline const uint8_t* Data::getPlaneData(uint8_t plane) const
+            {
+                return _p + _info.getPlaneOffset(plane);
+            }
+
+            inline uint8_t* Data::getPlaneData(uint8_t plane)
+            {
+#if defined(DJV_MMAP)
+                detach();
+#endif // DJV_MMAP
+                return _data + _info.getPlaneOffset(plane);
+            }
+
         } // namespace Image
     } // namespace AV
 } // namespace djv
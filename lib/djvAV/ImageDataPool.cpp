@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/ImageDataPool.h>
+
+#include <djvCore/Memory.h>
+
+#if defined(DJV_PLATFORM_WINDOWS)
+#include <malloc.h>
+#else // DJV_PLATFORM_WINDOWS
+#include <stdlib.h>
+#include <sys/mman.h>
+#endif // DJV_PLATFORM_WINDOWS
+
+#include <map>
+#include <mutex>
+#include <new>
+#include <vector>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            namespace
+            {
+                //! The buffer alignments, and the default for the number of
+                //! bytes held by buffers waiting to be reused. The maximum
+                //! can be changed with DataPool::setMaxByteCount().
+                const size_t pageSize            = 4 * Memory::kilobyte;
+                const size_t hugePageSize        = 2 * Memory::megabyte;
+                const size_t maxByteCountDefault = 512 * Memory::megabyte;
+
+                uint8_t* alignedAlloc(size_t size)
+                {
+                    const size_t alignment = size >= hugePageSize ? hugePageSize : pageSize;
+#if defined(DJV_PLATFORM_WINDOWS)
+                    void* out = _aligned_malloc(size, alignment);
+#else // DJV_PLATFORM_WINDOWS
+                    void* out = nullptr;
+                    if (posix_memalign(&out, alignment, size) != 0)
+                    {
+                        out = nullptr;
+                    }
+#if defined(MADV_HUGEPAGE)
+                    if (out && alignment == hugePageSize)
+                    {
+                        madvise(out, size, MADV_HUGEPAGE);
+                    }
+#endif // MADV_HUGEPAGE
+#endif // DJV_PLATFORM_WINDOWS
+                    if (!out)
+                    {
+                        throw std::bad_alloc();
+                    }
+                    return static_cast<uint8_t*>(out);
+                }
+
+                void alignedFree(uint8_t* value)
+                {
+#if defined(DJV_PLATFORM_WINDOWS)
+                    _aligned_free(value);
+#else // DJV_PLATFORM_WINDOWS
+                    free(value);
+#endif // DJV_PLATFORM_WINDOWS
+                }
+
+            } // namespace
+
+            struct DataPool::Private
+            {
+                size_t maxByteCount = maxByteCountDefault;
+                mutable std::mutex mutex;
+                std::map<size_t, std::vector<uint8_t*> > buffers;
+                DataPoolStats stats;
+
+                //! Free buffers from the other size classes, largest first,
+                //! until the given number of bytes fits.
+                void trim(size_t byteCount, size_t sizeClass);
+            };
+
+            DataPool::DataPool() :
+                _p(new Private)
+            {}
+
+            DataPool::~DataPool()
+            {
+                clear();
+            }
+
+            std::shared_ptr<DataPool> DataPool::create()
+            {
+                return std::shared_ptr<DataPool>(new DataPool);
+            }
+
+            const std::shared_ptr<DataPool>& DataPool::getGlobal()
+            {
+                static const std::shared_ptr<DataPool> pool = create();
+                return pool;
+            }
+
+            size_t DataPool::getMaxByteCount() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.maxByteCount;
+            }
+
+            void DataPool::setMaxByteCount(size_t value)
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.maxByteCount = value;
+                p.trim(0, 0);
+            }
+
+            size_t DataPool::getSizeClass(size_t value)
+            {
+                size_t out = (value + pageSize - 1) / pageSize * pageSize;
+                if (out > pageSize * 8)
+                {
+                    size_t high = pageSize * 8;
+                    while (high * 2 <= out)
+                    {
+                        high *= 2;
+                    }
+                    const size_t step = high / 8;
+                    out = (out + step - 1) / step * step;
+                }
+                return out;
+            }
+
+            uint8_t* DataPool::allocate(size_t value)
+            {
+                DJV_PRIVATE_PTR();
+                const size_t sizeClass = getSizeClass(value);
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    p.stats.usedByteCount += sizeClass;
+                    const auto i = p.buffers.find(sizeClass);
+                    if (i != p.buffers.end() && i->second.size())
+                    {
+                        uint8_t* out = i->second.back();
+                        i->second.pop_back();
+                        p.stats.byteCount -= sizeClass;
+                        ++p.stats.hits;
+                        return out;
+                    }
+                    ++p.stats.misses;
+                }
+                try
+                {
+                    return alignedAlloc(sizeClass);
+                }
+                catch (const std::bad_alloc&)
+                {
+                    // Free the pooled buffers and try again.
+                    {
+                        std::lock_guard<std::mutex> lock(p.mutex);
+                        p.stats.usedByteCount -= sizeClass;
+                    }
+                    clear();
+                    uint8_t* out = alignedAlloc(sizeClass);
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    p.stats.usedByteCount += sizeClass;
+                    return out;
+                }
+            }
+
+            void DataPool::release(uint8_t* value, size_t size)
+            {
+                DJV_PRIVATE_PTR();
+                if (!value)
+                    return;
+                const size_t sizeClass = getSizeClass(size);
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    p.stats.usedByteCount -= sizeClass;
+                    if (sizeClass <= p.maxByteCount)
+                    {
+                        p.trim(sizeClass, sizeClass);
+                    }
+                    if (p.stats.byteCount + sizeClass <= p.maxByteCount)
+                    {
+                        p.buffers[sizeClass].push_back(value);
+                        p.stats.byteCount += sizeClass;
+                        return;
+                    }
+                }
+                alignedFree(value);
+            }
+
+            DataPoolStats DataPool::getStats() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                return p.stats;
+            }
+
+            void DataPool::clear()
+            {
+                DJV_PRIVATE_PTR();
+                std::map<size_t, std::vector<uint8_t*> > buffers;
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    buffers = std::move(p.buffers);
+                    p.buffers.clear();
+                    p.stats.byteCount = 0;
+                }
+                for (const auto& i : buffers)
+                {
+                    for (auto j : i.second)
+                    {
+                        alignedFree(j);
+                    }
+                }
+            }
+
+            void DataPool::Private::trim(size_t byteCount, size_t sizeClass)
+            {
+                auto i = buffers.rbegin();
+                while (stats.byteCount + byteCount > maxByteCount && i != buffers.rend())
+                {
+                    if (i->first != sizeClass)
+                    {
+                        while (i->second.size() && stats.byteCount + byteCount > maxByteCount)
+                        {
+                            alignedFree(i->second.back());
+                            i->second.pop_back();
+                            stats.byteCount -= i->first;
+                        }
+                    }
+                    ++i;
+                }
+            }
+
+        } // namespace Image
+    } // namespace AV
+} // namespace djv
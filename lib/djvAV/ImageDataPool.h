@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <memory>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            //! This struct provides image data pool statistics.
+            struct DataPoolStats
+            {
+                size_t hits          = 0; //!< Allocations that reused a buffer
+                size_t misses        = 0; //!< Allocations that needed a new buffer
+                size_t byteCount     = 0; //!< Bytes held by buffers waiting to be reused
+                size_t usedByteCount = 0; //!< Bytes held by buffers in use
+            };
+
+            //! This class provides a pool of buffers for image data.
+            //!
+            //! Buffers are grouped into size classes so that frames with the
+            //! same image information reuse each other's memory. Buffers are
+            //! page aligned, and buffers larger than a huge page are aligned
+            //! to the huge page size so the kernel can back them with huge
+            //! pages. The pool never touches the memory itself, so pages are
+            //! placed on the NUMA node of the thread that first writes to
+            //! them (normally the decoder) and stay there as they are reused.
+            class DataPool
+            {
+                DJV_NON_COPYABLE(DataPool);
+
+            protected:
+                DataPool();
+
+            public:
+                ~DataPool();
+
+                static std::shared_ptr<DataPool> create();
+
+                //! Get the pool that is used by Image::Data.
+                static const std::shared_ptr<DataPool>& getGlobal();
+
+                //! Get the maximum number of bytes held by buffers that are
+                //! waiting to be reused.
+                size_t getMaxByteCount() const;
+
+                void setMaxByteCount(size_t);
+
+                //! Get the size that a buffer is rounded up to. Small buffers
+                //! are rounded up to the page size, larger buffers are rounded
+                //! up to an eighth of their power of two.
+                static size_t getSizeClass(size_t);
+
+                //! Throws:
+                //! - std::bad_alloc
+                uint8_t* allocate(size_t);
+
+                //! Return a buffer to the pool. The size must be the same as
+                //! the size that was allocated.
+                void release(uint8_t*, size_t);
+
+                DataPoolStats getStats() const;
+
+                //! Free the buffers that are waiting to be reused.
+                void clear();
+
+            private:
+                DJV_PRIVATE();
+            };
+
+        } // namespace Image
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/ImageHistogram.h>
+
+#include <djvAV/ImageData.h>
+#include <djvAV/ImageUtil.h>
+
+#include <djvCore/Memory.h>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            namespace
+            {
+                //! The minimum number of scanlines in a tile.
+                const size_t tileHeightMin = 16;
+
+                //! The number of counter lanes. Neighbouring pixels often fall
+                //! in the same bin, giving each pixel in a group of four its own
+                //! counters avoids stalling on the previous increment.
+                const size_t laneCount = 4;
+
+                const size_t channelCount = static_cast<size_t>(HistogramChannel::Count);
+
+                struct Counters
+                {
+                    uint32_t bins[channelCount][laneCount][histogramBinCount];
+                };
+
+                //! Rec. 709 luminance weights, scaled so they sum to 256.
+                inline uint8_t getLuminance(uint8_t r, uint8_t g, uint8_t b)
+                {
+                    return (54 * r + 183 * g + 19 * b) >> 8;
+                }
+
+                void binScanline(const uint8_t* p, size_t width, uint8_t channels, Counters& counters)
+                {
+                    auto& r = counters.bins[static_cast<size_t>(HistogramChannel::Red)];
+                    auto& g = counters.bins[static_cast<size_t>(HistogramChannel::Green)];
+                    auto& b = counters.bins[static_cast<size_t>(HistogramChannel::Blue)];
+                    auto& a = counters.bins[static_cast<size_t>(HistogramChannel::Alpha)];
+                    auto& l = counters.bins[static_cast<size_t>(HistogramChannel::Luminance)];
+                    switch (channels)
+                    {
+                    case 1:
+                        for (size_t x = 0; x < width; ++x, ++p)
+                        {
+                            ++l[x & (laneCount - 1)][p[0]];
+                        }
+                        break;
+                    case 2:
+                        for (size_t x = 0; x < width; ++x, p += 2)
+                        {
+                            const size_t lane = x & (laneCount - 1);
+                            ++l[lane][p[0]];
+                            ++a[lane][p[1]];
+                        }
+                        break;
+                    case 3:
+                        for (size_t x = 0; x < width; ++x, p += 3)
+                        {
+                            const size_t lane = x & (laneCount - 1);
+                            ++r[lane][p[0]];
+                            ++g[lane][p[1]];
+                            ++b[lane][p[2]];
+                            ++l[lane][getLuminance(p[0], p[1], p[2])];
+                        }
+                        break;
+                    case 4:
+                        for (size_t x = 0; x < width; ++x, p += 4)
+                        {
+                            const size_t lane = x & (laneCount - 1);
+                            ++r[lane][p[0]];
+                            ++g[lane][p[1]];
+                            ++b[lane][p[2]];
+                            ++a[lane][p[3]];
+                            ++l[lane][getLuminance(p[0], p[1], p[2])];
+                        }
+                        break;
+                    default: break;
+                    }
+                }
+
+                void binTile(const Data& data, uint16_t y0, uint16_t y1, Counters& counters)
+                {
+                    const auto& info = data.getInfo();
+                    const uint16_t w = info.size.w;
+                    const uint8_t channels = getChannelCount(info.type);
+                    const Type u8Type = getIntType(channels, 8);
+                    const DataType dataType = getDataType(info.type);
+                    const size_t wordSize = DataType::U10 == dataType ? 4 : getByteCount(dataType);
+                    const bool swap = info.layout.endian != Memory::getEndian() && wordSize > 1;
+                    const size_t scanlineByteCount = static_cast<size_t>(w) * getByteCount(info.type);
+                    std::vector<uint8_t> swapped(swap ? scanlineByteCount : 0);
+                    std::vector<uint8_t> u8(u8Type != info.type ? static_cast<size_t>(w) * channels : 0);
+                    for (uint16_t y = y0; y < y1; ++y)
+                    {
+                        const uint8_t* p = data.getData(y);
+                        if (swap)
+                        {
+                            Memory::endian(p, swapped.data(), scanlineByteCount / wordSize, wordSize);
+                            p = swapped.data();
+                        }
+
+                        // Quantize to eight bits with the SIMD conversion
+                        // kernels, the values are then the bin indices.
+                        if (u8.size())
+                        {
+                            convert(p, info.type, u8.data(), u8Type, w);
+                            p = u8.data();
+                        }
+
+                        binScanline(p, w, channels, counters);
+                    }
+                }
+
+            } // namespace
+
+            Histogram::Histogram()
+            {}
+
+            size_t Histogram::getMax(HistogramChannel value) const
+            {
+                const auto& bins = _bins[static_cast<size_t>(value)];
+                return bins.size() ? *std::max_element(bins.begin(), bins.end()) : 0;
+            }
+
+            void Histogram::add(const Histogram& value)
+            {
+                if (!value.isValid())
+                    return;
+                if (!isValid())
+                {
+                    *this = value;
+                    return;
+                }
+                _channelCount = std::max(_channelCount, value._channelCount);
+                _pixelCount += value._pixelCount;
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    auto& bins = _bins[c];
+                    const auto& otherBins = value._bins[c];
+                    if (bins.empty())
+                    {
+                        bins = otherBins;
+                    }
+                    else if (otherBins.size() == bins.size())
+                    {
+                        for (size_t i = 0; i < bins.size(); ++i)
+                        {
+                            bins[i] += otherBins[i];
+                        }
+                    }
+                }
+            }
+
+            bool Histogram::operator == (const Histogram& other) const
+            {
+                if (_channelCount != other._channelCount || _pixelCount != other._pixelCount)
+                {
+                    return false;
+                }
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    if (_bins[c] != other._bins[c])
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            Histogram getHistogram(const Data& data, size_t threadCount)
+            {
+                Histogram out;
+                if (!data.isValid())
+                {
+                    return out;
+                }
+                if (isYUVType(data.getType()))
+                {
+                    const auto rgb = Data::create(Info(data.getSize(), getRGBType(data.getType())));
+                    convertYUV(data, *rgb);
+                    return getHistogram(*rgb, threadCount);
+                }
+
+                // Split the scanlines into tiles.
+                const uint16_t h = data.getHeight();
+                const size_t tileCount = std::max(
+                    static_cast<size_t>(1),
+                    std::min(threadCount, static_cast<size_t>(h / tileHeightMin)));
+                std::vector<std::unique_ptr<Counters> > counters;
+                for (size_t i = 0; i < tileCount; ++i)
+                {
+                    counters.push_back(std::unique_ptr<Counters>(new Counters));
+                    memset(counters.back().get(), 0, sizeof(Counters));
+                }
+                auto tile = [&data, &counters, h, tileCount](size_t i)
+                {
+                    const uint16_t y0 = static_cast<uint16_t>(h * i / tileCount);
+                    const uint16_t y1 = static_cast<uint16_t>(h * (i + 1) / tileCount);
+                    binTile(data, y0, y1, *counters[i]);
+                };
+                std::vector<std::thread> threads;
+                for (size_t i = 1; i < tileCount; ++i)
+                {
+                    threads.push_back(std::thread(tile, i));
+                }
+                tile(0);
+                for (auto& i : threads)
+                {
+                    i.join();
+                }
+
+                // Sum the tiles and lanes.
+                const uint8_t channels = getChannelCount(data.getType());
+                out._channelCount = channels;
+                out._pixelCount = static_cast<size_t>(data.getWidth()) * h;
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    const auto channel = static_cast<HistogramChannel>(c);
+                    const bool rgb = HistogramChannel::Red == channel ||
+                        HistogramChannel::Green == channel ||
+                        HistogramChannel::Blue == channel;
+                    const bool alpha = HistogramChannel::Alpha == channel;
+                    if ((rgb && channels < 3) || (alpha && 2 != channels && 4 != channels))
+                    {
+                        continue;
+                    }
+                    auto& bins = out._bins[c];
+                    bins.resize(histogramBinCount, 0);
+                    for (const auto& i : counters)
+                    {
+                        for (size_t lane = 0; lane < laneCount; ++lane)
+                        {
+                            for (size_t bin = 0; bin < histogramBinCount; ++bin)
+                            {
+                                bins[bin] += i->bins[c][lane][bin];
+                            }
+                        }
+                    }
+                }
+                return out;
+            }
+
+        } // namespace Image
+    } // namespace AV
+} // namespace djv
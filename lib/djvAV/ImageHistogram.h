@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAV/AV.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            class Data;
+
+            //! This enumeration provides the histogram channels.
+            enum class HistogramChannel
+            {
+                Red,
+                Green,
+                Blue,
+                Alpha,
+                Luminance,
+
+                Count,
+                First = Red
+            };
+
+            //! The number of histogram bins.
+            const size_t histogramBinCount = 256;
+
+            //! This class provides an image histogram. Integer values are
+            //! scaled to the bins, floating point values are clamped to the
+            //! range [0, 1] so values below the range (and NaN) go in the
+            //! first bin and values above the range go in the last bin.
+            class Histogram
+            {
+            public:
+                Histogram();
+
+                bool isValid() const;
+
+                //! Get the number of channels in the image. Images with one or
+                //! two channels only have luminance and alpha bins.
+                uint8_t getChannelCount() const;
+
+                size_t getPixelCount() const;
+
+                const std::vector<size_t>& getBins(HistogramChannel) const;
+
+                //! Get the largest bin.
+                size_t getMax(HistogramChannel) const;
+
+                //! Add the bins from another histogram.
+                void add(const Histogram&);
+
+                bool operator == (const Histogram&) const;
+                bool operator != (const Histogram&) const;
+
+            private:
+                uint8_t _channelCount = 0;
+                size_t _pixelCount = 0;
+                std::vector<size_t> _bins[static_cast<size_t>(HistogramChannel::Count)];
+
+                friend Histogram getHistogram(const Data&, size_t);
+            };
+
+            //! Compute the histogram of image data. The scanlines are split
+            //! into tiles that are binned in parallel, the thread count is the
+            //! maximum number of threads including the calling thread. Callers
+            //! running in a thread pool should use one thread.
+            Histogram getHistogram(const Data&, size_t threadCount = 1);
+
+        } // namespace Image
+    } // namespace AV
+} // namespace djv
+
+#include <djvAV/ImageHistogramInline.h>
@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            inline bool Histogram::isValid() const
+            {
+                return _pixelCount > 0;
+            }
+
+            inline uint8_t Histogram::getChannelCount() const
+            {
+                return _channelCount;
+            }
+
+            inline size_t Histogram::getPixelCount() const
+            {
+                return _pixelCount;
+            }
+
+            inline const std::vector<size_t>& Histogram::getBins(HistogramChannel value) const
+            {
+                return _bins[static_cast<size_t>(value)];
+            }
+
+            inline bool Histogram::operator != (const Histogram& other) const
+            {
+                return !(*this == other);
+            }
+
+        } // namespace Image
+    } // namespace AV
+} // namespace djv
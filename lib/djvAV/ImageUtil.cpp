@@ -7,6 +7,12 @@
 #include <djvAV/Color.h>
 #include <djvAV/ImageData.h>
 
+#include <djvCore/Math.h>
+#include <djvCore/Memory.h>
+
+#include <algorithm>
+#include <cstring>
+
 using namespace djv::Core;
 
 namespace djv
@@ -59,12 +65,78 @@ namespace djv
                     outP->b = average[2] / static_cast<float>(width * height);
                 }
 
+                // Convert every xStep'th pixel and yStep'th scanline of the area.
+                template<typename T>
+                void convertYUV(const Data& in, const BBox2i& area, uint16_t xStep, uint16_t yStep, Data& out)
+                {
+                    const auto& info = in.getInfo();
+                    uint8_t sx = 0;
+                    uint8_t sy = 0;
+                    getChromaShift(info.type, sx, sy);
+                    const float max = static_cast<float>(std::numeric_limits<T>::max());
+                    const float m = (max + 1.F) / 256.F;
+                    const float yOffset = 16.F * m;
+                    const float yScale = 1.F / (219.F * m);
+                    const float cOffset = 128.F * m;
+                    const float cScale = 1.F / (224.F * m);
+                    const uint8_t* planes[] = { in.getPlaneData(0), in.getPlaneData(1), in.getPlaneData(2) };
+                    const size_t scanlines[] =
+                    {
+                        info.getPlaneScanlineByteCount(0),
+                        info.getPlaneScanlineByteCount(1),
+                        info.getPlaneScanlineByteCount(2)
+                    };
+                    const int w = (area.w() + xStep - 1) / xStep;
+                    const int h = (area.h() + yStep - 1) / yStep;
+                    for (int y = 0; y < h; ++y)
+                    {
+                        const int inY = area.min.y + y * yStep;
+                        const T* yP = reinterpret_cast<const T*>(planes[0] + inY * scanlines[0]);
+                        const T* uP = reinterpret_cast<const T*>(planes[1] + (inY >> sy) * scanlines[1]);
+                        const T* vP = reinterpret_cast<const T*>(planes[2] + (inY >> sy) * scanlines[2]);
+                        T* outP = reinterpret_cast<T*>(out.getData(static_cast<uint16_t>(y)));
+                        for (int x = 0; x < w; ++x, outP += 3)
+                        {
+                            const int inX = area.min.x + x * xStep;
+                            const float yf = (yP[inX] - yOffset) * yScale;
+                            const float uf = (uP[inX >> sx] - cOffset) * cScale;
+                            const float vf = (vP[inX >> sx] - cOffset) * cScale;
+                            const float rgb[] =
+                            {
+                                yf + 1.5748F * vf,
+                                yf - .187324F * uf - .468124F * vf,
+                                yf + 1.8556F * uf
+                            };
+                            for (size_t c = 0; c < 3; ++c)
+                            {
+                                outP[c] = static_cast<T>(Math::clamp(rgb[c], 0.F, 1.F) * max + .5F);
+                            }
+                        }
+                    }
+                }
+
+                void convertYUV(const Data& in, const BBox2i& area, uint16_t xStep, uint16_t yStep, Data& out)
+                {
+                    switch (getDataType(in.getType()))
+                    {
+                    case DataType::U8:  convertYUV<U8_T>(in, area, xStep, yStep, out); break;
+                    case DataType::U16: convertYUV<U16_T>(in, area, xStep, yStep, out); break;
+                    default: break;
+                    }
+                }
+
             } // namespace
 
             Color getAverageColor(const std::shared_ptr<Data>& data)
             {
                 Color out;
-                if (data && data->isValid())
+                if (data && data->isValid() && isYUVType(data->getType()))
+                {
+                    auto rgb = Data::create(Info(data->getSize(), getRGBType(data->getType())));
+                    convertYUV(*data, *rgb);
+                    out = getAverageColor(rgb);
+                }
+                else if (data && data->isValid())
                 {
                     const uint16_t w = data->getWidth();
                     const uint16_t h = data->getHeight();
@@ -86,6 +158,71 @@ namespace djv
                 return out;
             }
 
+            void convertYUV(const Data& in, Data& out)
+            {
+                convertYUV(in, BBox2i(0, 0, in.getWidth(), in.getHeight()), out);
+            }
+
+            void convertYUV(const Data& in, const BBox2i& area, Data& out)
+            {
+                convertYUV(in, area, 1, 1, out);
+            }
+
+            std::shared_ptr<Data> convertToFloat(const Data& data, const BBox2i& area, uint16_t xStep, uint16_t yStep)
+            {
+                std::shared_ptr<Data> out;
+                if (!data.isValid())
+                    return out;
+                const auto& info = data.getInfo();
+                const int x0 = std::max(area.min.x, 0);
+                const int y0 = std::max(area.min.y, 0);
+                const int x1 = std::min(area.max.x, static_cast<int>(info.size.w) - 1);
+                const int y1 = std::min(area.max.y, static_cast<int>(info.size.h) - 1);
+                if (x1 < x0 || y1 < y0)
+                    return out;
+                const BBox2i clamped(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+                xStep = std::max(xStep, static_cast<uint16_t>(1));
+                yStep = std::max(yStep, static_cast<uint16_t>(1));
+                const uint16_t w = static_cast<uint16_t>((clamped.w() + xStep - 1) / xStep);
+                const uint16_t h = static_cast<uint16_t>((clamped.h() + yStep - 1) / yStep);
+                if (isYUVType(info.type))
+                {
+                    auto rgb = Data::create(Info(w, h, getRGBType(info.type)));
+                    convertYUV(data, clamped, xStep, yStep, *rgb);
+                    return convertToFloat(*rgb, BBox2i(0, 0, w, h));
+                }
+
+                // Gather the sampled pixels of each scanline and normalize them
+                // with the conversion kernels.
+                out = Data::create(Info(w, h, getFloatType(getChannelCount(info.type), 32)));
+                const DataType dataType = getDataType(info.type);
+                const size_t wordSize = DataType::U10 == dataType ? 4 : getByteCount(dataType);
+                const bool swap = info.layout.endian != Memory::getEndian() && wordSize > 1;
+                const size_t pixelByteCount = getByteCount(info.type);
+                const size_t byteCount = w * pixelByteCount;
+                std::vector<uint8_t> gathered(xStep > 1 ? byteCount : 0);
+                std::vector<uint8_t> swapped(swap ? byteCount : 0);
+                for (uint16_t y = 0; y < h; ++y)
+                {
+                    const uint8_t* in = data.getData(x0, static_cast<uint16_t>(y0 + y * yStep));
+                    if (xStep > 1)
+                    {
+                        for (uint16_t x = 0; x < w; ++x)
+                        {
+                            memcpy(gathered.data() + x * pixelByteCount, in + x * xStep * pixelByteCount, pixelByteCount);
+                        }
+                        in = gathered.data();
+                    }
+                    if (swap)
+                    {
+                        Memory::endian(in, swapped.data(), byteCount / wordSize, wordSize);
+                        in = swapped.data();
+                    }
+                    convert(in, info.type, out->getData(y), out->getType(), w);
+                }
+                return out;
+            }
+
         } // namespace Image
     } // namespace AV
 } // namespace djv
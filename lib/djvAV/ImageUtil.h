@@ -6,6 +6,8 @@
 
 #include <djvAV/AV.h>
 
+#include <djvCore/BBox.h>
+
 #include <memory>
 
 namespace djv
@@ -17,8 +19,31 @@ namespace djv
             class Color;
             class Data;
 
+            //! Planar YUV images are converted to RGB first.
             Color getAverageColor(const std::shared_ptr<Data>&);
 
+            //! Convert a planar YUV image to RGB with the BT.709 limited range
+            //! coefficients. The output should have the same size as the input
+            //! and the type given by getRGBType().
+            void convertYUV(const Data& in, Data& out);
+
+            //! Convert an area of a planar YUV image to RGB. The area should be
+            //! inside the input, and the output should have the same size as
+            //! the area.
+            void convertYUV(const Data& in, const Core::BBox2i& area, Data& out);
+
+            //! Copy an area of an image and normalize it to the floating point
+            //! type with the same number of channels. The area is clamped to
+            //! the image, and a null pointer is returned if it is empty. Only
+            //! every xStep'th pixel and yStep'th scanline of the area is copied,
+            //! so large areas can be subsampled without converting them. Planar
+            //! YUV images are converted to RGB, only for the copied pixels.
+            std::shared_ptr<Data> convertToFloat(
+                const Data&,
+                const Core::BBox2i&,
+                uint16_t xStep = 1,
+                uint16_t yStep = 1);
+
         } // namespace Image
     } // namespace AV
 } // namespace djv
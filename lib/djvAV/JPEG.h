@@ -62,7 +62,9 @@ namespace djv
                         const ReadOptions&,
                         const std::shared_ptr<Core::TextSystem>&,
                         const std::shared_ptr<Core::ResourceSystem>&,
-                        const std::shared_ptr<Core::LogSystem>&);
+                        const std::shared_ptr<Core::LogSystem>&,
+                        const std::shared_ptr<ThreadPool>&,
+                        const std::shared_ptr<FrameCache>&);
 
                 protected:
                     Info _readInfo(const std::string& fileName) override;
@@ -70,7 +72,7 @@ namespace djv
 
                 private:
                     class File;
-                    Info _open(const std::string&, const std::shared_ptr<File>&);
+                    Info _open(const std::string&, const std::shared_ptr<File>&, size_t proxy);
                 };
                 
                 //! This class provides the JPEG file writer.
@@ -68,17 +68,19 @@ namespace djv
                     const ReadOptions& readOptions,
                     const std::shared_ptr<TextSystem>& textSystem,
                     const std::shared_ptr<ResourceSystem>& resourceSystem,
-                    const std::shared_ptr<LogSystem>& logSystem)
+                    const std::shared_ptr<LogSystem>& logSystem,
+                    const std::shared_ptr<ThreadPool>& threadPool,
+                    const std::shared_ptr<FrameCache>& frameCache)
                 {
                     auto out = std::shared_ptr<Read>(new Read);
-                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem);
+                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem, threadPool, frameCache);
                     return out;
                 }
 
                 Info Read::_readInfo(const std::string& fileName)
                 {
                     auto f = File::create();
-                    return _open(fileName, f);
+                    return _open(fileName, f, 0);
                 }
 
                 namespace
@@ -116,9 +118,10 @@ namespace djv
 
                 std::shared_ptr<Image::Image> Read::_readImage(const std::string& fileName)
                 {
-                    // Open the file.
+                    // Open the file, using the DCT scaling of the library to
+                    // read proxies.
                     auto f = File::create();
-                    const auto info = _open(fileName, f);
+                    const auto info = _open(fileName, f, _options.proxy);
 
                     // Read the file.
                     auto out = Image::Image::create(info.video[0].info);
@@ -180,6 +183,7 @@ namespace djv
                     bool jpegOpen(
                         FILE*                   f,
                         jpeg_decompress_struct* jpeg,
+                        unsigned int            scale,
                         JPEGErrorStruct*        error)
                     {
                         if (::setjmp(error->jump))
@@ -192,6 +196,8 @@ namespace djv
                         {
                             return false;
                         }
+                        jpeg->scale_num = 1;
+                        jpeg->scale_denom = scale;
                         if (!jpeg_start_decompress(jpeg))
                         {
                             return false;
@@ -201,7 +207,7 @@ namespace djv
 
                 } // namespace
 
-                Info Read::_open(const std::string& fileName, const std::shared_ptr<File>& f)
+                Info Read::_open(const std::string& fileName, const std::shared_ptr<File>& f, size_t proxy)
                 {
                     f->jpeg.err = jpeg_std_error(&f->jpegError.pub);
                     f->jpegError.pub.error_exit = djvJPEGError;
@@ -226,7 +232,10 @@ namespace djv
                             arg(fileName).
                             arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
                     }
-                    if (!jpegOpen(f->f, &f->jpeg, &f->jpegError))
+                    // The library can scale by 1/2, 1/4, or 1/8, any further
+                    // reduction is done after the image is read.
+                    const unsigned int scale = 1 << std::min(proxy, static_cast<size_t>(3));
+                    if (!jpegOpen(f->f, &f->jpeg, scale, &f->jpegError))
                     {
                         std::vector<std::string> messages;
                         messages.push_back(String::Format("{0}: {1}").
@@ -57,6 +57,7 @@ namespace djv
                 std::shared_ptr<ListSubject<std::string> > colorSpacesSubject;
                 std::shared_ptr<ListSubject<Display> > displaysSubject;
                 std::shared_ptr<ListSubject<std::string> > viewsSubject;
+                std::map<Convert, _OCIO::ConstProcessorRcPtr> processors;
             };
 
             void System::_init(const std::shared_ptr<Core::Context>& context)
@@ -240,6 +241,27 @@ namespace djv
                 return std::string();
             }
 
+            void System::applyRGBA(const Convert& convert, float* data, size_t count)
+            {
+                DJV_PRIVATE_PTR();
+                if (!convert.isValid() || !count)
+                    return;
+                _OCIO::ConstProcessorRcPtr processor;
+                const auto i = p.processors.find(convert);
+                if (i != p.processors.end())
+                {
+                    processor = i->second;
+                }
+                else
+                {
+                    auto config = _OCIO::GetCurrentConfig();
+                    processor = config->getProcessor(convert.input.c_str(), convert.output.c_str());
+                    p.processors[convert] = processor;
+                }
+                _OCIO::PackedImageDesc imageDesc(data, static_cast<long>(count), 1, 4);
+                processor->apply(imageDesc);
+            }
+
             int System::_addConfig(const Config& config, bool init)
             {
                 DJV_PRIVATE_PTR();
@@ -351,6 +373,7 @@ namespace djv
                         ocioConfig = _OCIO::Config::Create();
                     }
                     _OCIO::SetCurrentConfig(ocioConfig);
+                    p.processors.clear();
 
                     colorSpaces.push_back(std::string());
                     for (int j = 0; j < ocioConfig->getNumColorSpaces(); ++j)
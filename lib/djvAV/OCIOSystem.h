@@ -81,6 +81,13 @@ namespace djv
                 //! Get the color space for the given display and view.
                 std::string getColorSpace(const std::string& display, const std::string& view) const;
 
+                //! Apply a color space conversion to RGBA pixels on the CPU
+                //! with the current configuration. The processors are cached
+                //! until the configuration changes.
+                //! Throws:
+                //! - std::exception
+                void applyRGBA(const Convert&, float*, size_t count = 1);
+
                 ///@}
                 
             private:
@@ -1003,6 +1003,25 @@ namespace djv
                         glm::ivec2(channel.xSampling, channel.ySampling));
                 }
 
+                Imf::Compression toImf(Compression value)
+                {
+                    Imf::Compression out = Imf::NO_COMPRESSION;
+                    switch (value)
+                    {
+                    case Compression::RLE:   out = Imf::RLE_COMPRESSION;   break;
+                    case Compression::ZIPS:  out = Imf::ZIPS_COMPRESSION;  break;
+                    case Compression::ZIP:   out = Imf::ZIP_COMPRESSION;   break;
+                    case Compression::PIZ:   out = Imf::PIZ_COMPRESSION;   break;
+                    case Compression::PXR24: out = Imf::PXR24_COMPRESSION; break;
+                    case Compression::B44:   out = Imf::B44_COMPRESSION;   break;
+                    case Compression::B44A:  out = Imf::B44A_COMPRESSION;  break;
+                    case Compression::DWAA:  out = Imf::DWAA_COMPRESSION;  break;
+                    case Compression::DWAB:  out = Imf::DWAB_COMPRESSION;  break;
+                    default: break;
+                    }
+                    return out;
+                }
+
                 struct Plugin::Private
                 {
                     Options options;
@@ -1038,7 +1057,7 @@ namespace djv
 
                 std::shared_ptr<IRead> Plugin::read(const FileSystem::FileInfo& fileInfo, const ReadOptions& options) const
                 {
-                    return Read::create(fileInfo, options, _p->options, _textSystem, _resourceSystem, _logSystem);
+                    return Read::create(fileInfo, options, _p->options, _textSystem, _resourceSystem, _logSystem, _threadPool, _frameCache);
                 }
 
                 std::shared_ptr<IWrite> Plugin::write(const FileSystem::FileInfo& fileInfo, const Info& info, const WriteOptions& options) const
@@ -1089,6 +1108,8 @@ namespace djv
                 out.AddMember("Compression", rapidjson::Value(s.c_str(), s.size(), allocator), allocator);
             }
             out.AddMember("DWACompressionLevel", toJSON(value.dwaCompressionLevel, allocator), allocator);
+            out.AddMember("Tiled", toJSON(value.tiled, allocator), allocator);
+            out.AddMember("TileSize", toJSON(value.tileSize, allocator), allocator);
         }
         return out;
     }
@@ -1117,6 +1138,14 @@ namespace djv
                 {
                     fromJSON(i.value, out.dwaCompressionLevel);
                 }
+                else if (0 == strcmp("Tiled", i.name.GetString()))
+                {
+                    fromJSON(i.value, out.tiled);
+                }
+                else if (0 == strcmp("TileSize", i.name.GetString()))
+                {
+                    fromJSON(i.value, out.tileSize);
+                }
             }
         }
         else
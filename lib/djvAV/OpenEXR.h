@@ -26,7 +26,7 @@ namespace djv
             //! - http://www.openexr.com
             //!
             //! \todo Add support for writing luminance/chroma images.
-            //! \todo Add better support for tiled images.
+            //! \todo Add support for deep images.
             namespace OpenEXR
             {
                 static const std::string pluginName = "OpenEXR";
@@ -121,13 +121,20 @@ namespace djv
                 //! Convert from an Imf channel.
                 Channel fromImf(const std::string& name, const Imf::Channel&);
 
-                //! This struct provides the OpenEXR file I/O optioms.
+                //! Convert to an Imf compression type.
+                Imf::Compression toImf(Compression);
+
+                //! This struct provides the OpenEXR file I/O optioms. Tiled files
+                //! are written with mipmap levels, which are used for proxies
+                //! when reading.
                 struct Options
                 {
                     size_t      threadCount         = 4;
                     Channels    channels            = Channels::Known;
                     Compression compression         = Compression::None;
                     float       dwaCompressionLevel = 45.F;
+                    bool        tiled               = false;
+                    size_t      tileSize            = 64;
                 };
 
                 //! This class provides a memory-mapped input stream.
@@ -166,7 +173,9 @@ namespace djv
                         const Options&,
                         const std::shared_ptr<Core::TextSystem>&,
                         const std::shared_ptr<Core::ResourceSystem>&,
-                        const std::shared_ptr<Core::LogSystem>&);
+                        const std::shared_ptr<Core::LogSystem>&,
+                        const std::shared_ptr<ThreadPool>&,
+                        const std::shared_ptr<FrameCache>&);
 
                 protected:
                     Info _readInfo(const std::string& fileName) override;
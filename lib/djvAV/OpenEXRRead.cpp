@@ -11,8 +11,10 @@
 
 #include <ImfChannelList.h>
 #include <ImfHeader.h>
-#include <ImfInputFile.h>
-#include <ImfRgbaYca.h>
+#include <ImfInputPart.h>
+#include <ImfMultiPartInputFile.h>
+#include <ImfPartType.h>
+#include <ImfTiledInputPart.h>
 
 using namespace djv::Core;
 
@@ -27,7 +29,7 @@ namespace djv
 #if defined(DJV_MMAP)
                 struct MemoryMappedIStream::Private
                 {
-                    FileSystem::FileIO  f;
+                    std::shared_ptr<FileSystem::FileIO> f;
                     uint64_t            size    = 0;
                     uint64_t            pos     = 0;
                     char*               p       = nullptr;
@@ -38,9 +40,11 @@ namespace djv
                     _p(new Private)
                 {
                     DJV_PRIVATE_PTR();
-                    p.f.open(fileName, FileSystem::FileIO::Mode::Read);
-                    p.size = p.f.getSize();
-                    p.p = (char*)(p.f.mmapP());
+                    p.f = FileSystem::FileIO::create();
+                    p.f->open(fileName, FileSystem::FileIO::Mode::Read);
+                    p.size = p.f->getSize();
+                    p.p = (char*)(p.f->mmapP());
+                    p.f->mmapAdvise(FileSystem::FileIO::MmapAdvice::Random);
                 }
 
                 MemoryMappedIStream::~MemoryMappedIStream()
@@ -86,19 +90,96 @@ namespace djv
                 }
 #endif // DJV_MMAP
 
-                struct Read::File
+                namespace
                 {
-                    ~File()
+                    //! Integer division that rounds towards negative infinity.
+                    int floorDiv(int value, int divisor)
+                    {
+                        return value >= 0 ? (value / divisor) : -((-value + divisor - 1) / divisor);
+                    }
+
+                    //! Copy pixels from a buffer to an image. The buffer covers the
+                    //! given window, and each image pixel is sampled from the
+                    //! region every step pixels.
+                    void copyPixels(
+                        const std::vector<char>&             buf,
+                        const BBox2i&                        bufWindow,
+                        const BBox2i&                        region,
+                        int                                  step,
+                        size_t                               cb,
+                        const std::shared_ptr<Image::Image>& out)
+                    {
+                        const size_t bufScb = bufWindow.w() * cb;
+                        const uint16_t w = out->getWidth();
+                        const uint16_t h = out->getHeight();
+                        for (uint16_t y = 0; y < h; ++y)
+                        {
+                            const int bufY = region.min.y + y * step;
+                            if (bufY < bufWindow.min.y || bufY > bufWindow.max.y)
+                                continue;
+                            const char* bufP = buf.data() + (bufY - bufWindow.min.y) * bufScb;
+                            uint8_t* p = out->getData(y);
+                            if (1 == step)
+                            {
+                                const int x0 = std::max(region.min.x, bufWindow.min.x);
+                                const int x1 = std::min(region.min.x + w - 1, bufWindow.max.x);
+                                if (x0 <= x1)
+                                {
+                                    memcpy(
+                                        p + (x0 - region.min.x) * cb,
+                                        bufP + (x0 - bufWindow.min.x) * cb,
+                                        (x1 - x0 + 1) * cb);
+                                }
+                            }
+                            else
+                            {
+                                for (uint16_t x = 0; x < w; ++x, p += cb)
+                                {
+                                    const int bufX = region.min.x + x * step;
+                                    if (bufX >= bufWindow.min.x && bufX <= bufWindow.max.x)
+                                    {
+                                        memcpy(p, bufP + (bufX - bufWindow.min.x) * cb, cb);
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    //! Create a frame buffer for a layer.
+                    Imf::FrameBuffer getFrameBuffer(
+                        const Layer&    layer,
+                        Image::DataType dataType,
+                        char*           base,
+                        size_t          cb,
+                        size_t          scb)
                     {
+                        Imf::FrameBuffer out;
+                        const size_t channelByteCount = Image::getByteCount(dataType);
+                        for (size_t c = 0; c < layer.channels.size(); ++c)
+                        {
+                            const auto& channel = layer.channels[c];
+                            out.insert(
+                                channel.name.c_str(),
+                                Imf::Slice(
+                                    toImf(dataType),
+                                    base + c * channelByteCount,
+                                    cb,
+                                    scb,
+                                    channel.sampling.x,
+                                    channel.sampling.y,
+                                    0.F));
+                        }
+                        return out;
                     }
 
-                    std::unique_ptr<MemoryMappedIStream> s;
-                    std::unique_ptr<Imf::InputFile>      f;
-                    BBox2i                               displayWindow;
-                    BBox2i                               dataWindow;
-                    BBox2i                               intersectedWindow;
-                    std::vector<OpenEXR::Layer>          layers;
-                    bool                                 fast              = false;
+                } // namespace
+
+                struct Read::File
+                {
+                    std::unique_ptr<MemoryMappedIStream>     s;
+                    std::unique_ptr<Imf::MultiPartInputFile> f;
+                    std::vector<OpenEXR::Layer>              layers;
+                    std::vector<int>                         layerParts;
                 };
 
                 struct Read::Private
@@ -121,11 +202,13 @@ namespace djv
                     const Options& options,
                     const std::shared_ptr<TextSystem>& textSystem,
                     const std::shared_ptr<ResourceSystem>& resourceSystem,
-                    const std::shared_ptr<LogSystem>& logSystem)
+                    const std::shared_ptr<LogSystem>& logSystem,
+                    const std::shared_ptr<ThreadPool>& threadPool,
+                    const std::shared_ptr<FrameCache>& frameCache)
                 {
                     auto out = std::shared_ptr<Read>(new Read);
                     out->_p->options = options;
-                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem);
+                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem, threadPool, frameCache);
                     return out;
                 }
 
@@ -139,75 +222,164 @@ namespace djv
                 {
                     File f;
                     Info info = _open(fileName, f);
-                    Image::Info imageInfo = info.video[std::min(_options.layer, info.video.size() - 1)].info;
-                    std::shared_ptr<Image::Image> out = Image::Image::create(imageInfo);
-                    out->setPluginName(pluginName);
-                    out->setTags(info.tags);
-                    const size_t channels = Image::getChannelCount(imageInfo.type);
-                    const size_t channelByteCount = Image::getByteCount(getDataType(imageInfo.type));
-                    const size_t cb = channels * channelByteCount;
-                    const size_t scb = imageInfo.size.w * channels * channelByteCount;
-                    if (f.fast)
+                    const size_t layerIndex = std::min(_options.layer, info.video.size() - 1);
+                    const auto& layer = f.layers[layerIndex];
+                    const int part = f.layerParts[layerIndex];
+                    const Imf::Header& header = f.f->header(part);
+                    const BBox2i displayWindow = fromImath(header.displayWindow());
+                    const BBox2i dataWindow = fromImath(header.dataWindow());
+                    Image::Info imageInfo = info.video[layerIndex].info;
+                    const Image::DataType dataType = Image::getDataType(imageInfo.type);
+                    const size_t cb = Image::getChannelCount(imageInfo.type) * Image::getByteCount(dataType);
+
+                    // Get the region to read.
+                    BBox2i region = displayWindow;
+                    if (_options.region.isValid())
                     {
-                        Imf::FrameBuffer frameBuffer;
-                        for (size_t c = 0; c < channels; ++c)
+                        region = BBox2i(
+                            displayWindow.min + _options.region.min,
+                            displayWindow.min + _options.region.max).intersect(displayWindow);
+                        if (!region.isValid())
                         {
-                            const std::string& name = f.layers[_options.layer].channels[c].name;
-                            const glm::ivec2& sampling = f.layers[_options.layer].channels[c].sampling;
-                            frameBuffer.insert(
-                                name.c_str(),
-                                Imf::Slice(
-                                    toImf(Image::getDataType(imageInfo.type)),
-                                    (char*)out->getData() + (c * channelByteCount),
-                                    cb,
-                                    scb,
-                                    sampling.x,
-                                    sampling.y,
-                                    0.F));
+                            region = displayWindow;
+                        }
+                    }
+
+                    std::shared_ptr<Image::Image> out;
+                    if (header.hasTileDescription())
+                    {
+                        Imf::TiledInputPart tiled(*f.f, part);
+
+                        // Use the mipmap or ripmap levels for proxies, and
+                        // sample the remainder.
+                        int level = 0;
+                        if (_options.proxy > 0)
+                        {
+                            int levels = 1;
+                            switch (tiled.levelMode())
+                            {
+                            case Imf::MIPMAP_LEVELS: levels = tiled.numLevels(); break;
+                            case Imf::RIPMAP_LEVELS: levels = std::min(tiled.numXLevels(), tiled.numYLevels()); break;
+                            default: break;
+                            }
+                            level = static_cast<int>(std::min(_options.proxy, static_cast<size_t>(levels - 1)));
+                        }
+                        const int step = 1 << std::min(_options.proxy - level, static_cast<size_t>(15));
+                        const int scale = 1 << level;
+                        const BBox2i levelWindow = fromImath(tiled.dataWindowForLevel(level, level));
+                        // Round the size of the region the same way as the
+                        // level sizes, so that the region does not extend
+                        // past the level. Rounding up also makes the proxy
+                        // size match scanline files.
+                        const bool roundUp = Imf::ROUND_UP == tiled.levelRoundingMode();
+                        const glm::ivec2 levelRegionMin(
+                            dataWindow.min.x + floorDiv(region.min.x - dataWindow.min.x, scale),
+                            dataWindow.min.y + floorDiv(region.min.y - dataWindow.min.y, scale));
+                        const BBox2i levelRegion(
+                            levelRegionMin.x,
+                            levelRegionMin.y,
+                            roundUp ? ((region.w() + scale - 1) / scale) : std::max(region.w() / scale, 1),
+                            roundUp ? ((region.h() + scale - 1) / scale) : std::max(region.h() / scale, 1));
+                        imageInfo.size.w = (levelRegion.w() + step - 1) / step;
+                        imageInfo.size.h = (levelRegion.h() + step - 1) / step;
+                        out = Image::Image::create(imageInfo);
+                        out->zero();
+
+                        // Read the tiles that intersect the region.
+                        if (levelRegion.intersects(levelWindow))
+                        {
+                            const BBox2i readWindow = levelRegion.intersect(levelWindow);
+                            const int tileW = static_cast<int>(tiled.tileXSize());
+                            const int tileH = static_cast<int>(tiled.tileYSize());
+                            const int tx0 = (readWindow.min.x - levelWindow.min.x) / tileW;
+                            const int tx1 = (readWindow.max.x - levelWindow.min.x) / tileW;
+                            const int ty0 = (readWindow.min.y - levelWindow.min.y) / tileH;
+                            const int ty1 = (readWindow.max.y - levelWindow.min.y) / tileH;
+                            const BBox2i bufWindow(
+                                fromImath(tiled.dataWindowForTile(tx0, ty0, level, level)).min,
+                                fromImath(tiled.dataWindowForTile(tx1, ty1, level, level)).max);
+                            const size_t bufScb = bufWindow.w() * cb;
+                            std::vector<char> buf(bufScb * bufWindow.h());
+                            tiled.setFrameBuffer(getFrameBuffer(
+                                layer,
+                                dataType,
+                                buf.data() - bufWindow.min.x * cb - bufWindow.min.y * bufScb,
+                                cb,
+                                bufScb));
+                            tiled.readTiles(tx0, tx1, ty0, ty1, level, level);
+                            copyPixels(buf, bufWindow, levelRegion, step, cb, out);
                         }
-                        f.f->setFrameBuffer(frameBuffer);
-                        f.f->readPixels(f.displayWindow.min.y, f.displayWindow.max.y);
                     }
                     else
                     {
-                        Imf::FrameBuffer frameBuffer;
-                        std::vector<char> buf(f.dataWindow.w() * cb);
-                        for (int c = 0; c < channels; ++c)
+                        Imf::InputPart scanline(*f.f, part);
+                        const int step = 1 << std::min(_options.proxy, static_cast<size_t>(15));
+                        imageInfo.size.w = (region.w() + step - 1) / step;
+                        imageInfo.size.h = (region.h() + step - 1) / step;
+                        out = Image::Image::create(imageInfo);
+                        const size_t scb = imageInfo.size.w * cb;
+                        if (1 == step && region == dataWindow)
                         {
-                            const std::string& name = f.layers[_options.layer].channels[c].name;
-                            const glm::ivec2& sampling = f.layers[_options.layer].channels[c].sampling;
-                            frameBuffer.insert(
-                                name.c_str(),
-                                Imf::Slice(
-                                    toImf(Image::getDataType(imageInfo.type)),
-                                    buf.data() - (f.dataWindow.min.x * cb) + (c * channelByteCount),
-                                    cb,
-                                    0,
-                                    sampling.x,
-                                    sampling.y,
-                                    0.F));
+                            // Read directly into the image.
+                            scanline.setFrameBuffer(getFrameBuffer(
+                                layer,
+                                dataType,
+                                reinterpret_cast<char*>(out->getData()) - region.min.x * cb - region.min.y * scb,
+                                cb,
+                                scb));
+                            scanline.readPixels(region.min.y, region.max.y);
                         }
-                        f.f->setFrameBuffer(frameBuffer);
-                        for (int y = f.displayWindow.min.y; y <= f.displayWindow.max.y; ++y)
+                        else
                         {
-                            uint8_t* p = out->getData() + ((y - f.displayWindow.min.y) * scb);
-                            uint8_t* end = p + scb;
-                            if (y >= f.intersectedWindow.min.y && y <= f.intersectedWindow.max.y)
+                            out->zero();
+                            if (region.intersects(dataWindow))
                             {
-                                size_t size = (f.intersectedWindow.min.x - f.displayWindow.min.x) * cb;
-                                memset(p, 0, size);
-                                p += size;
-                                size = f.intersectedWindow.w() * cb;
-                                f.f->readPixels(y, y);
-                                memcpy(
-                                    p,
-                                    buf.data() + std::max(f.displayWindow.min.x - f.dataWindow.min.x, 0) * cb,
-                                    size);
-                                p += size;
+                                const BBox2i readWindow = region.intersect(dataWindow);
+                                const size_t bufScb = dataWindow.w() * cb;
+                                if (1 == step)
+                                {
+                                    // Read all of the scanlines with a single call.
+                                    const BBox2i bufWindow(
+                                        glm::ivec2(dataWindow.min.x, readWindow.min.y),
+                                        glm::ivec2(dataWindow.max.x, readWindow.max.y));
+                                    std::vector<char> buf(bufScb * bufWindow.h());
+                                    scanline.setFrameBuffer(getFrameBuffer(
+                                        layer,
+                                        dataType,
+                                        buf.data() - bufWindow.min.x * cb - bufWindow.min.y * bufScb,
+                                        cb,
+                                        bufScb));
+                                    scanline.readPixels(bufWindow.min.y, bufWindow.max.y);
+                                    copyPixels(buf, bufWindow, region, step, cb, out);
+                                }
+                                else
+                                {
+                                    // Read every Nth scanline.
+                                    std::vector<char> buf(bufScb);
+                                    scanline.setFrameBuffer(getFrameBuffer(
+                                        layer,
+                                        dataType,
+                                        buf.data() - dataWindow.min.x * cb,
+                                        cb,
+                                        0));
+                                    for (uint16_t y = 0; y < imageInfo.size.h; ++y)
+                                    {
+                                        const int fileY = region.min.y + y * step;
+                                        if (fileY >= readWindow.min.y && fileY <= readWindow.max.y)
+                                        {
+                                            scanline.readPixels(fileY, fileY);
+                                            const BBox2i bufWindow(
+                                                glm::ivec2(dataWindow.min.x, fileY),
+                                                glm::ivec2(dataWindow.max.x, fileY));
+                                            copyPixels(buf, bufWindow, region, step, cb, out);
+                                        }
+                                    }
+                                }
                             }
-                            memset(p, 0, end - p);
                         }
                     }
+                    out->setPluginName(pluginName);
+                    out->setTags(info.tags);
                     return out;
                 }
 
@@ -218,37 +390,53 @@ namespace djv
                     Info out;
 
                     // Open the file.
+                    const int threadCount = static_cast<int>(p.options.threadCount);
 #if defined(DJV_MMAP)
                     f.s.reset(new MemoryMappedIStream(fileName.c_str()));
-                    f.f.reset(new Imf::InputFile(*f.s.get()));
+                    f.f.reset(new Imf::MultiPartInputFile(*f.s.get(), threadCount));
 #else // DJV_MMAP
-                    f.f.reset(new Imf::InputFile(fileName.c_str()));
+                    f.f.reset(new Imf::MultiPartInputFile(fileName.c_str(), threadCount));
 #endif // DJV_MMAP
 
-                    // Get the display and data windows.
-                    f.displayWindow = fromImath(f.f->header().displayWindow());
-                    f.dataWindow = fromImath(f.f->header().dataWindow());
-                    f.intersectedWindow = f.displayWindow.intersect(f.dataWindow);
-                    f.fast = f.displayWindow == f.dataWindow;
-
                     // Get the tags.
-                    readTags(f.f->header(), out.tags, _speed);
+                    readTags(f.f->header(0), out.tags, _speed);
+
+                    // Get the layers from each part.
+                    const int parts = f.f->parts();
+                    for (int part = 0; part < parts; ++part)
+                    {
+                        const Imf::Header& header = f.f->header(part);
+                        if (header.hasType() && Imf::isDeepData(header.type()))
+                            continue;
+                        for (auto layer : getLayers(header.channels(), p.options.channels))
+                        {
+                            if (parts > 1 && header.hasName())
+                            {
+                                layer.name = layer.name.empty() ? header.name() : (header.name() + "." + layer.name);
+                            }
+                            f.layers.push_back(layer);
+                            f.layerParts.push_back(part);
+                        }
+                    }
+                    if (f.layers.empty())
+                    {
+                        throw FileSystem::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(_textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
+                    }
 
-                    // Get the layers.
-                    f.layers = getLayers(f.f->header().channels(), p.options.channels);
                     out.fileName = fileName;
                     out.video.resize(f.layers.size());
                     for (size_t i = 0; i < f.layers.size(); ++i)
                     {
                         const auto& layer = f.layers[i];
-                        const glm::ivec2 sampling(layer.channels[0].sampling.x, layer.channels[0].sampling.y);
-                        if (sampling.x != 1 || sampling.y != 1)
-                            f.fast = false;
+                        const Imf::Header& header = f.f->header(f.layerParts[i]);
+                        const BBox2i displayWindow = fromImath(header.displayWindow());
                         auto& info = out.video[i].info;
                         info.name = layer.name;
-                        info.size.w = f.displayWindow.w();
-                        info.size.h = f.displayWindow.h();
-                        info.pixelAspectRatio = f.f->header().pixelAspectRatio();
+                        info.size.w = displayWindow.w();
+                        info.size.h = displayWindow.h();
+                        info.pixelAspectRatio = header.pixelAspectRatio();
                         switch (layer.channels[0].type)
                         {
                         case Image::DataType::F16:
@@ -277,4 +465,3 @@ namespace djv
         } // namespace IO
     } // namespace AV
 } // namespace djv
-
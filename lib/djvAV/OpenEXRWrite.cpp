@@ -4,6 +4,10 @@
 
 #include <djvAV/OpenEXR.h>
 
+#include <ImfOutputFile.h>
+#include <ImfStandardAttributes.h>
+#include <ImfTiledOutputFile.h>
+
 using namespace djv::Core;
 
 namespace djv
@@ -45,13 +49,88 @@ namespace djv
 
                 namespace
                 {
-                    struct File
+                    //! Get the channel names for an image type.
+                    std::vector<std::string> getChannelNames(Image::Type type)
                     {
-                        ~File()
+                        std::vector<std::string> out;
+                        switch (Image::getChannelCount(type))
                         {
+                        case 1: out = { "Y" }; break;
+                        case 2: out = { "Y", "A" }; break;
+                        case 3: out = { "R", "G", "B" }; break;
+                        case 4: out = { "R", "G", "B", "A" }; break;
+                        default: break;
                         }
-                    };
-                }
+                        return out;
+                    }
+
+                    //! Create a frame buffer for an image.
+                    Imf::FrameBuffer getFrameBuffer(const std::shared_ptr<Image::Image>& image)
+                    {
+                        Imf::FrameBuffer out;
+                        const auto& info = image->getInfo();
+                        const Image::DataType dataType = Image::getDataType(info.type);
+                        const size_t channelByteCount = Image::getByteCount(dataType);
+                        const size_t cb = info.getPixelByteCount();
+                        const size_t scb = info.getScanlineByteCount();
+                        const auto channelNames = getChannelNames(info.type);
+                        char* base = reinterpret_cast<char*>(image->getData());
+                        for (size_t c = 0; c < channelNames.size(); ++c)
+                        {
+                            out.insert(
+                                channelNames[c].c_str(),
+                                Imf::Slice(toImf(dataType), base + c * channelByteCount, cb, scb));
+                        }
+                        return out;
+                    }
+
+                    //! Average each 2x2 block of pixels into a mipmap level.
+                    template<typename T>
+                    void downsample(const Image::Image& in, Image::Image& out)
+                    {
+                        const auto& inSize = in.getSize();
+                        const auto& outSize = out.getSize();
+                        const size_t channelCount = Image::getChannelCount(in.getType());
+                        for (uint16_t y = 0; y < outSize.h; ++y)
+                        {
+                            const uint16_t y0 = std::min(y * 2, inSize.h - 1);
+                            const uint16_t y1 = std::min(y * 2 + 1, inSize.h - 1);
+                            T* outP = reinterpret_cast<T*>(out.getData(y));
+                            for (uint16_t x = 0; x < outSize.w; ++x)
+                            {
+                                const uint16_t x0 = std::min(x * 2, inSize.w - 1);
+                                const uint16_t x1 = std::min(x * 2 + 1, inSize.w - 1);
+                                const T* p00 = reinterpret_cast<const T*>(in.getData(x0, y0));
+                                const T* p10 = reinterpret_cast<const T*>(in.getData(x1, y0));
+                                const T* p01 = reinterpret_cast<const T*>(in.getData(x0, y1));
+                                const T* p11 = reinterpret_cast<const T*>(in.getData(x1, y1));
+                                for (size_t c = 0; c < channelCount; ++c, ++outP)
+                                {
+                                    const double sum =
+                                        static_cast<double>(p00[c]) +
+                                        static_cast<double>(p10[c]) +
+                                        static_cast<double>(p01[c]) +
+                                        static_cast<double>(p11[c]);
+                                    *outP = static_cast<T>(sum / 4.0);
+                                }
+                            }
+                        }
+                    }
+
+                    std::shared_ptr<Image::Image> downsample(const std::shared_ptr<Image::Image>& image, const Image::Size& size)
+                    {
+                        auto out = Image::Image::create(Image::Info(size, image->getType(), image->getLayout()));
+                        switch (Image::getDataType(image->getType()))
+                        {
+                        case Image::DataType::U32: downsample<Image::U32_T>(*image, *out); break;
+                        case Image::DataType::F16: downsample<Image::F16_T>(*image, *out); break;
+                        case Image::DataType::F32: downsample<Image::F32_T>(*image, *out); break;
+                        default: break;
+                        }
+                        return out;
+                    }
+
+                } // namespace
 
                 Image::Type Write::_getImageType(Image::Type value) const
                 {
@@ -63,17 +142,20 @@ namespace djv
                     case Image::Type::L_F16:
                     case Image::Type::L_U32:
                     case Image::Type::L_F32:    out = value; break;
-                    case Image::Type::LA_U8:    out = Image::Type::LA_F16; break;
-                    case Image::Type::LA_U16:
+                    case Image::Type::LA_U8:
+                    case Image::Type::LA_U16:   out = Image::Type::LA_F16; break;
+                    case Image::Type::LA_F16:
                     case Image::Type::LA_U32:
                     case Image::Type::LA_F32:   out = value; break;
                     case Image::Type::RGB_U8:
                     case Image::Type::RGB_U10:
                     case Image::Type::RGB_U16:  out = Image::Type::RGB_F16; break;
+                    case Image::Type::RGB_F16:
                     case Image::Type::RGB_U32:
                     case Image::Type::RGB_F32:  out = value; break;
                     case Image::Type::RGBA_U8:
                     case Image::Type::RGBA_U16: out = Image::Type::RGBA_F16; break;
+                    case Image::Type::RGBA_F16:
                     case Image::Type::RGBA_U32:
                     case Image::Type::RGBA_F32: out = value; break;
                     default: break;
@@ -89,9 +171,62 @@ namespace djv
 
                 void Write::_write(const std::string& fileName, const std::shared_ptr<Image::Image>& image)
                 {
+                    DJV_PRIVATE_PTR();
+                    const auto& info = image->getInfo();
+                    Imf::Header header(
+                        info.size.w,
+                        info.size.h,
+                        info.pixelAspectRatio,
+                        Imath::V2f(0.F, 0.F),
+                        1.F,
+                        Imf::INCREASING_Y,
+                        toImf(p.options.compression));
+                    if (Compression::DWAA == p.options.compression ||
+                        Compression::DWAB == p.options.compression)
+                    {
+                        addDwaCompressionLevel(header, p.options.dwaCompressionLevel);
+                    }
+                    writeTags(
+                        _info.tags,
+                        _info.video.size() ? _info.video[0].speed : Time::Speed(),
+                        header);
+                    const Imf::PixelType pixelType = toImf(Image::getDataType(info.type));
+                    for (const auto& i : getChannelNames(info.type))
+                    {
+                        header.channels().insert(i.c_str(), Imf::Channel(pixelType));
+                    }
+                    const int threadCount = static_cast<int>(p.options.threadCount);
+
+                    if (p.options.tiled)
+                    {
+                        // Write the mipmap levels, each one averaged down
+                        // from the previous. The level sizes are rounded up
+                        // to match the proxy sizes used by the reader, so odd
+                        // sized images keep their last row and column.
+                        const unsigned int tileSize = static_cast<unsigned int>(std::max(p.options.tileSize, static_cast<size_t>(1)));
+                        header.setTileDescription(Imf::TileDescription(tileSize, tileSize, Imf::MIPMAP_LEVELS, Imf::ROUND_UP));
+                        Imf::TiledOutputFile f(fileName.c_str(), header, threadCount);
+                        auto levelImage = image;
+                        for (int level = 0; level < f.numLevels(); ++level)
+                        {
+                            const Image::Size levelSize(f.levelWidth(level), f.levelHeight(level));
+                            if (levelSize != levelImage->getSize())
+                            {
+                                levelImage = downsample(levelImage, levelSize);
+                            }
+                            f.setFrameBuffer(getFrameBuffer(levelImage));
+                            f.writeTiles(0, f.numXTiles(level) - 1, 0, f.numYTiles(level) - 1, level);
+                        }
+                    }
+                    else
+                    {
+                        Imf::OutputFile f(fileName.c_str(), header, threadCount);
+                        f.setFrameBuffer(getFrameBuffer(image));
+                        f.writePixels(info.size.h);
+                    }
                 }
 
-            } // namespace TIFF
+            } // namespace OpenEXR
         } // namespace IO
     } // namespace AV
 } // namespace djv
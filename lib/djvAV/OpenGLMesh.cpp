@@ -298,6 +298,14 @@ namespace djv
                     glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_TRUE, static_cast<GLsizei>(vertexByteCount), (GLvoid*)8);
                     glEnableVertexAttribArray(1);
                     break;
+                case VBOType::Pos2_F32_UV_U16_Color_U8:
+                    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(vertexByteCount), (GLvoid*)0);
+                    glEnableVertexAttribArray(0);
+                    glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_TRUE, static_cast<GLsizei>(vertexByteCount), (GLvoid*)8);
+                    glEnableVertexAttribArray(1);
+                    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, static_cast<GLsizei>(vertexByteCount), (GLvoid*)12);
+                    glEnableVertexAttribArray(2);
+                    break;
                 case VBOType::Pos3_F32:
                     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(vertexByteCount), (GLvoid*)0);
                     glEnableVertexAttribArray(0);
@@ -390,6 +398,7 @@ namespace djv
         AV::OpenGL,
         VBOType,
         DJV_TEXT("vbo_type_pos2_f32_uv_u16"),
+        DJV_TEXT("vbo_type_pos2_f32_uv_u16_color_u8"),
         DJV_TEXT("vbo_type_pos3_f32"),
         DJV_TEXT("vbo_type_pos3_f32_uv_u16"),
         DJV_TEXT("vbo_type_pos3_f32_uv_u16_normal_u10"),
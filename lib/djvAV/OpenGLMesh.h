@@ -23,6 +23,7 @@ namespace djv
             enum class VBOType
             {
                 Pos2_F32_UV_U16,
+                Pos2_F32_UV_U16_Color_U8,
                 Pos3_F32,
                 Pos3_F32_UV_U16,
                 Pos3_F32_UV_U16_Normal_U10,
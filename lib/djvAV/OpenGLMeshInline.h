@@ -13,6 +13,7 @@ namespace djv
                 const size_t data[] =
                 {
                     12, // 2 * sizeof(float) + 2 * sizeof(uint16_t)
+                    16, // 2 * sizeof(float) + 2 * sizeof(uint16_t) + sizeof(PackedColor)
                     12, // 3 * sizeof(float)
                     16, // 3 * sizeof(float) + 2 * sizeof(uint16_t)
                     20, // 3 * sizeof(float) + 2 * sizeof(uint16_t) + sizeof(PackedNormal)
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/OpenGLPixelBufferRing.h>
+
+#include <djvAV/ImageData.h>
+#include <djvAV/OpenGLTexture.h>
+
+#include <cstring>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace OpenGL
+        {
+#if !defined(DJV_OPENGL_ES2)
+            namespace
+            {
+                //! \todo Should this be configurable?
+                const GLuint64 fenceTimeout = 1000000000;
+
+            } // namespace
+
+            void PixelBufferRing::_init(size_t count)
+            {
+                _buffers.resize(std::max(count, static_cast<size_t>(1)));
+                for (auto& i : _buffers)
+                {
+                    glGenBuffers(1, &i.id);
+                }
+            }
+
+            PixelBufferRing::PixelBufferRing()
+            {}
+
+            PixelBufferRing::~PixelBufferRing()
+            {
+                for (auto& i : _buffers)
+                {
+                    if (i.fence)
+                    {
+                        glDeleteSync(i.fence);
+                        i.fence = nullptr;
+                    }
+                    if (i.id)
+                    {
+                        glDeleteBuffers(1, &i.id);
+                        i.id = 0;
+                    }
+                }
+            }
+
+            std::shared_ptr<PixelBufferRing> PixelBufferRing::create(size_t count)
+            {
+                auto out = std::shared_ptr<PixelBufferRing>(new PixelBufferRing);
+                out->_init(count);
+                return out;
+            }
+
+            size_t PixelBufferRing::getCount() const
+            {
+                return _buffers.size();
+            }
+
+            void PixelBufferRing::copy(const Image::Data& data, Texture& texture)
+            {
+                auto& buffer = _buffers[_index];
+                _index = (_index + 1) % _buffers.size();
+
+                // Wait for the previous transfer from this buffer to finish.
+                if (buffer.fence)
+                {
+                    const auto start = std::chrono::steady_clock::now();
+                    GLenum result = glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, fenceTimeout);
+                    while (GL_TIMEOUT_EXPIRED == result)
+                    {
+                        result = glClientWaitSync(buffer.fence, 0, fenceTimeout);
+                    }
+                    _waitTime += std::chrono::duration_cast<Time::Duration>(std::chrono::steady_clock::now() - start);
+                    glDeleteSync(buffer.fence);
+                    buffer.fence = nullptr;
+                }
+
+                const auto& info = data.getInfo();
+                const size_t size = info.getDataByteCount();
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+                if (size > buffer.size)
+                {
+                    glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+                    buffer.size = size;
+                }
+                void* p = glMapBufferRange(
+                    GL_PIXEL_UNPACK_BUFFER,
+                    0,
+                    static_cast<GLsizeiptr>(size),
+                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+                if (p)
+                {
+                    memcpy(p, data.getData(), size);
+                    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+                    texture.copyFromPixelBuffer(info);
+                    buffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                }
+                else
+                {
+                    // Fall back to a synchronous upload.
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                    texture.copy(data);
+                }
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            }
+
+            const Time::Duration& PixelBufferRing::getWaitTime() const
+            {
+                return _waitTime;
+            }
+
+            void PixelBufferRing::resetWaitTime()
+            {
+                _waitTime = Time::Duration::zero();
+            }
+#endif // DJV_OPENGL_ES2
+
+        } // namespace OpenGL
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAV/OpenGL.h>
+
+#include <djvCore/Time.h>
+
+#include <memory>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace Image
+        {
+            class Data;
+
+        } // namespace Image
+
+        namespace OpenGL
+        {
+            class Texture;
+
+#if !defined(DJV_OPENGL_ES2)
+            //! This class provides a ring of pixel buffer objects for texture
+            //! uploads. The image data is copied into the next buffer in the ring
+            //! and the texture is updated from the buffer, so the driver can
+            //! schedule the transfer instead of copying from client memory
+            //! before the call returns. A fence marks when a buffer can be
+            //! re-used.
+            //!
+            //! The copy into the buffer still happens on the render thread, and
+            //! the texture is usually drawn in the same frame, so the transfer
+            //! does not overlap with drawing the previous frame.
+            class PixelBufferRing
+            {
+                DJV_NON_COPYABLE(PixelBufferRing);
+                void _init(size_t count);
+                PixelBufferRing();
+
+            public:
+                ~PixelBufferRing();
+
+                static std::shared_ptr<PixelBufferRing> create(size_t count = 2);
+
+                size_t getCount() const;
+
+                //! Copy image data to a texture.
+                void copy(const Image::Data&, Texture&);
+
+                //! Get the time spent waiting for buffers to become available
+                //! since the last reset.
+                const Core::Time::Duration& getWaitTime() const;
+
+                void resetWaitTime();
+
+            private:
+                struct Buffer
+                {
+                    GLuint id    = 0;
+                    size_t size  = 0;
+                    GLsync fence = nullptr;
+                };
+                std::vector<Buffer>  _buffers;
+                size_t               _index    = 0;
+                Core::Time::Duration _waitTime = Core::Time::Duration::zero();
+            };
+#endif // DJV_OPENGL_ES2
+
+        } // namespace OpenGL
+    } // namespace AV
+} // namespace djv
@@ -68,6 +68,9 @@ namespace djv
                 _program = glCreateProgram();
                 glAttachShader(_program, _vertex);
                 glAttachShader(_program, _fragment);
+#if !defined(DJV_OPENGL_ES2)
+                glProgramParameteri(_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif // DJV_OPENGL_ES2
                 glLinkProgram(_program);
                 glGetProgramiv(_program, GL_LINK_STATUS, &success);
                 if (!success)
@@ -79,6 +82,26 @@ namespace djv
                 }
             }
 
+#if !defined(DJV_OPENGL_ES2)
+            void Shader::_init(const std::shared_ptr<Render::Shader>& shader, GLenum binaryFormat, const std::vector<uint8_t>& binary)
+            {
+                _shader = shader;
+
+                _program = glCreateProgram();
+                glProgramBinary(_program, binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+                int success = 0;
+                glGetProgramiv(_program, GL_LINK_STATUS, &success);
+                if (!success)
+                {
+                    char infoLog[String::cStringLength];
+                    glGetProgramInfoLog(_program, String::cStringLength, NULL, infoLog);
+                    throw ShaderError(String::Format("{0}: {1}").
+                        arg(_shader->getVertexName()).
+                        arg(infoLog));
+                }
+            }
+#endif // DJV_OPENGL_ES2
+
             Shader::Shader()
             {}
 
@@ -113,6 +136,28 @@ namespace djv
                 return _program;
             }
 
+#if !defined(DJV_OPENGL_ES2)
+            std::shared_ptr<Shader> Shader::create(
+                const std::shared_ptr<Render::Shader>& shader,
+                GLenum binaryFormat,
+                const std::vector<uint8_t>& binary)
+            {
+                auto out = std::shared_ptr<Shader>(new Shader);
+                out->_init(shader, binaryFormat, binary);
+                return out;
+            }
+
+            void Shader::getProgramBinary(GLenum& binaryFormat, std::vector<uint8_t>& binary) const
+            {
+                GLint size = 0;
+                glGetProgramiv(_program, GL_PROGRAM_BINARY_LENGTH, &size);
+                binary.resize(size);
+                GLsizei length = 0;
+                glGetProgramBinary(_program, size, &length, &binaryFormat, binary.data());
+                binary.resize(length);
+            }
+#endif // DJV_OPENGL_ES2
+
             void Shader::setUniform(GLint location, int value)
             {
                 glUniform1i(location, value);
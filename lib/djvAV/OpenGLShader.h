@@ -51,6 +51,9 @@ namespace djv
             {
                 DJV_NON_COPYABLE(Shader);
                 void _init(const std::shared_ptr<Render::Shader>&);
+#if !defined(DJV_OPENGL_ES2)
+                void _init(const std::shared_ptr<Render::Shader>&, GLenum binaryFormat, const std::vector<uint8_t>& binary);
+#endif // DJV_OPENGL_ES2
                 Shader();
 
             public:
@@ -60,8 +63,26 @@ namespace djv
                 //! - ShaderError
                 static std::shared_ptr<Shader> create(const std::shared_ptr<Render::Shader>&);
 
+#if !defined(DJV_OPENGL_ES2)
+                //! Create a shader from a program binary returned by
+                //! getProgramBinary(). The binary may be rejected by the
+                //! driver if it has changed since the binary was created.
+                //!
+                //! Throws:
+                //! - ShaderError
+                static std::shared_ptr<Shader> create(
+                    const std::shared_ptr<Render::Shader>&,
+                    GLenum binaryFormat,
+                    const std::vector<uint8_t>& binary);
+#endif // DJV_OPENGL_ES2
+
                 GLuint getProgram() const;
 
+#if !defined(DJV_OPENGL_ES2)
+                //! Get the linked program binary.
+                void getProgramBinary(GLenum& binaryFormat, std::vector<uint8_t>& binary) const;
+#endif // DJV_OPENGL_ES2
+
                 void setUniform(GLint, int);
                 void setUniform(GLint, float);
                 void setUniform(GLint, const glm::vec2&);
@@ -21,49 +21,13 @@ namespace djv
                 _filterMag = filterMag;
                 if (_info.isValid())
                 {
-#if defined(DJV_OPENGL_PBO)
-                    glGenBuffers(1, &_pbo);
-                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pbo);
-                    glBufferData(
-                        GL_PIXEL_UNPACK_BUFFER,
-                        info.getDataByteCount(),
-                        0,
-                        GL_STREAM_DRAW);
-#endif // DJV_OPENGL_PBO
-
-                    glGenTextures(1, &_id);
-                    glBindTexture(GL_TEXTURE_2D, _id);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, _filterMin);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, _filterMag);
-                    glTexImage2D(
-                        GL_TEXTURE_2D,
-                        0,
-                        getInternalFormat(_info.type),
-                        _info.size.w,
-                        _info.size.h,
-                        0,
-                        _info.getGLFormat(),
-                        _info.getGLType(),
-                        0);
+                    _create();
                 }
             }
 
             Texture::~Texture()
             {
-                if (_id)
-                {
-                    glDeleteTextures(1, &_id);
-                    _id = 0;
-                }
-#if defined(DJV_OPENGL_PBO)
-                if (_pbo)
-                {
-                    glDeleteBuffers(1, &_pbo);
-                    _pbo = 0;
-                }
-#endif // DJV_OPENGL_PBO
+                _delete();
             }
 
             std::shared_ptr<Texture> Texture::create(const Image::Info& info, GLenum filterMin, GLenum filterMag)
@@ -80,40 +44,8 @@ namespace djv
                 _info = info;
                 if (_info.isValid())
                 {
-                    if (_id)
-                    {
-                        glDeleteTextures(1, &_id);
-                    }
-#if defined(DJV_OPENGL_PBO)
-                    if (_pbo)
-                    {
-                        glDeleteBuffers(1, &_pbo);
-                    }
-                    glGenBuffers(1, &_pbo);
-                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pbo);
-                    glBufferData(
-                        GL_PIXEL_UNPACK_BUFFER,
-                        _info.getDataByteCount(),
-                        0,
-                        GL_STREAM_DRAW);
-#endif // DJV_OPENGL_PBO
-
-                    glGenTextures(1, &_id);
-                    glBindTexture(GL_TEXTURE_2D, _id);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, _filterMin);
-                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, _filterMag);
-                    glTexImage2D(
-                        GL_TEXTURE_2D,
-                        0,
-                        getInternalFormat(_info.type),
-                        _info.size.w,
-                        _info.size.h,
-                        0,
-                        _info.getGLFormat(),
-                        _info.getGLType(),
-                        0);
+                    _delete();
+                    _create();
                 }
             }
 
@@ -121,50 +53,25 @@ namespace djv
             {
                 const auto & info = data.getInfo();
 #if defined(DJV_OPENGL_ES2)
-                glBindTexture(GL_TEXTURE_2D, _id);
+                const uint8_t planeCount = info.getPlaneCount();
                 glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
-                glTexSubImage2D(
-                    GL_TEXTURE_2D,
-                    0,
-                    0,
-                    0,
-                    info.size.w,
-                    info.size.h,
-                    info.getGLFormat(),
-                    info.getGLType(),
-                    data.getData());
+                for (uint8_t i = 0; i < planeCount; ++i)
+                {
+                    const auto planeSize = info.getPlaneSize(i);
+                    glBindTexture(GL_TEXTURE_2D, getPlaneID(i));
+                    glTexSubImage2D(
+                        GL_TEXTURE_2D,
+                        0,
+                        0,
+                        0,
+                        planeSize.w,
+                        planeSize.h,
+                        info.getGLFormat(),
+                        info.getGLType(),
+                        data.getPlaneData(i));
+                }
 #else // DJV_OPENGL_ES2
-
-#if defined(DJV_OPENGL_PBO)
-                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pbo);
-                glBufferSubData(
-                    GL_PIXEL_UNPACK_BUFFER,
-                    0,
-                    info.getDataByteCount(),
-                    data.getData());
-#endif // DJV_OPENGL_PBO
-
-                glBindTexture(GL_TEXTURE_2D, _id);
-                glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
-                glPixelStorei(GL_UNPACK_SWAP_BYTES, info.layout.endian != Memory::getEndian());
-                glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
-                glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
-                glTexSubImage2D(
-                    GL_TEXTURE_2D,
-                    0,
-                    0,
-                    0,
-                    info.size.w,
-                    info.size.h,
-                    info.getGLFormat(),
-                    info.getGLType(),
-#if defined(DJV_OPENGL_PBO)
-                    0
-#else // DJV_OPENGL_PBO
-                    data.getData()
-#endif // DJV_OPENGL_PBO
-                    );
-                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                _copyPlanes(info, data.getData());
 #endif // DJV_OPENGL_ES2
             }
 
@@ -186,16 +93,6 @@ namespace djv
                     info.getGLType(),
                     data.getData());
 #else // DJV_OPENGL_ES2
-
-#if defined(DJV_OPENGL_PBO)
-                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pbo);
-                glBufferSubData(
-                    GL_PIXEL_UNPACK_BUFFER,
-                    0,
-                    info.getDataByteCount(),
-                    data.getData());
-#endif // DJV_OPENGL_PBO
-
                 glBindTexture(GL_TEXTURE_2D, _id);
                 glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
                 glPixelStorei(GL_UNPACK_SWAP_BYTES, info.layout.endian != Memory::getEndian());
@@ -210,21 +107,93 @@ namespace djv
                     info.size.h,
                     info.getGLFormat(),
                     info.getGLType(),
-#if defined(DJV_OPENGL_PBO)
-                    0
-#else // DJV_OPENGL_PBO
-                    data.getData()
-#endif // DJV_OPENGL_PBO
-                    );
-                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                    data.getData());
 #endif // DJV_OPENGL_ES2
             }
 
+#if !defined(DJV_OPENGL_ES2)
+            void Texture::copyFromPixelBuffer(const Image::Info& info)
+            {
+                _copyPlanes(info, nullptr);
+            }
+
+            void Texture::_copyPlanes(const Image::Info& info, const uint8_t* data)
+            {
+                // When a pixel unpack buffer is bound the data pointer is null
+                // and the plane offsets are offsets into the buffer.
+                glPixelStorei(GL_UNPACK_ALIGNMENT, info.layout.alignment);
+                glPixelStorei(GL_UNPACK_SWAP_BYTES, info.layout.endian != Memory::getEndian());
+                glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+                glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+                const uint8_t planeCount = info.getPlaneCount();
+                for (uint8_t i = 0; i < planeCount; ++i)
+                {
+                    const auto planeSize = info.getPlaneSize(i);
+                    glBindTexture(GL_TEXTURE_2D, getPlaneID(i));
+                    glTexSubImage2D(
+                        GL_TEXTURE_2D,
+                        0,
+                        0,
+                        0,
+                        planeSize.w,
+                        planeSize.h,
+                        info.getGLFormat(),
+                        info.getGLType(),
+                        data ?
+                            data + info.getPlaneOffset(i) :
+                            reinterpret_cast<const void*>(info.getPlaneOffset(i)));
+                }
+            }
+#endif // DJV_OPENGL_ES2
+
             void Texture::bind()
             {
                 glBindTexture(GL_TEXTURE_2D, _id);
             }
 
+            void Texture::_create()
+            {
+                const uint8_t planeCount = _info.getPlaneCount();
+                for (uint8_t i = 0; i < planeCount; ++i)
+                {
+                    GLuint& id = 0 == i ? _id : _planeIDs[i - 1];
+                    glGenTextures(1, &id);
+                    glBindTexture(GL_TEXTURE_2D, id);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, _filterMin);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, _filterMag);
+                    const auto planeSize = _info.getPlaneSize(i);
+                    glTexImage2D(
+                        GL_TEXTURE_2D,
+                        0,
+                        getInternalFormat(_info.type),
+                        planeSize.w,
+                        planeSize.h,
+                        0,
+                        _info.getGLFormat(),
+                        _info.getGLType(),
+                        0);
+                }
+            }
+
+            void Texture::_delete()
+            {
+                if (_id)
+                {
+                    glDeleteTextures(1, &_id);
+                    _id = 0;
+                }
+                for (auto& i : _planeIDs)
+                {
+                    if (i)
+                    {
+                        glDeleteTextures(1, &i);
+                        i = 0;
+                    }
+                }
+            }
+
             GLenum Texture::getInternalFormat(Image::Type type)
             {
                 const GLenum data[] =
@@ -254,6 +223,13 @@ namespace djv
                     GL_NONE,
                     GL_NONE,
                     GL_NONE,
+                    GL_NONE,
+
+                    GL_LUMINANCE,
+                    GL_LUMINANCE,
+                    GL_LUMINANCE,
+                    GL_NONE,
+                    GL_NONE,
                     GL_NONE
 #else // DJV_OPENGL_ES2
                     GL_R8,
@@ -279,7 +255,14 @@ namespace djv
                     GL_RGBA16,
                     GL_RGBA32I,
                     GL_RGBA16F,
-                    GL_RGBA32F
+                    GL_RGBA32F,
+
+                    GL_R8,
+                    GL_R8,
+                    GL_R8,
+                    GL_R16,
+                    GL_R16,
+                    GL_R16
 #endif // DJV_OPENGL_ES2
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Image::Type::Count));
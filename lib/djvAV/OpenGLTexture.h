@@ -34,22 +34,34 @@ namespace djv
                 const Image::Info& getInfo() const;
                 GLuint getID() const;
 
+                //! Planar YUV images use a separate texture for each plane,
+                //! plane zero is the same as getID().
+                GLuint getPlaneID(uint8_t) const;
+
                 void set(const Image::Info&);
                 void copy(const Image::Data&);
                 void copy(const Image::Data&, uint16_t x, uint16_t y);
+#if !defined(DJV_OPENGL_ES2)
+                //! Copy from the pixel unpack buffer that is currently bound.
+                void copyFromPixelBuffer(const Image::Info&);
+#endif // DJV_OPENGL_ES2
 
                 void bind();
 
                 static GLenum getInternalFormat(Image::Type);
 
             private:
+                void _create();
+                void _delete();
+#if !defined(DJV_OPENGL_ES2)
+                void _copyPlanes(const Image::Info&, const uint8_t*);
+#endif // DJV_OPENGL_ES2
+
                 Image::Info _info;
                 GLenum _filterMin = GL_LINEAR;
                 GLenum _filterMag = GL_LINEAR;
                 GLuint _id = 0;
-#if defined(DJV_OPENGL_PBO)
-                GLuint _pbo = 0;
-#endif // DJV_OPENGL_PBO
+                GLuint _planeIDs[2] = { 0, 0 };
             };
 
             //! This class provides a 1D OpenGL texture.
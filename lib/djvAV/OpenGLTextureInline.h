@@ -21,6 +21,11 @@ namespace djv
                 return _id;
             }
 
+            inline GLuint Texture::getPlaneID(uint8_t plane) const
+            {
+                return 0 == plane ? _id : _planeIDs[plane - 1];
+            }
+
             /*inline Texture1D::Texture1D()
             {}
 
@@ -5,9 +5,23 @@
 #include <djvAV/Pixel.h>
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <map>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define DJV_PIXEL_SIMD
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define DJV_TARGET_SSE4_1
+#define DJV_TARGET_AVX2
+#else // _MSC_VER
+#define DJV_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+#define DJV_TARGET_AVX2 __attribute__((target("avx2,f16c")))
+#endif // _MSC_VER
+#endif // __x86_64__ || _M_X64
+
 #define CONVERT_L_L(A, B) \
     void convert_L_##A##_L_##B(const void * in, void * out, size_t size) \
     { \
@@ -300,7 +314,7 @@
     { \
         const U10_S * inP = reinterpret_cast<const U10_S *>(in); \
         B##_T * outP = reinterpret_cast<B##_T *>(out); \
-        for (size_t i = 0; i < size; ++i, ++inP, outP += 3) \
+        for (size_t i = 0; i < size; ++i, ++inP, outP += 4) \
         { \
             convert_U10_##B(inP->r, outP[0]); \
             convert_U10_##B(inP->g, outP[1]); \
@@ -496,44 +510,425 @@ namespace djv
 
             } // namespace
 
-            void convert(const void * in, Type inType, void * out, Type outType, size_t size)
+#if defined(DJV_PIXEL_SIMD)
+            namespace
+            {
+                //! \name SSE4.1 Kernels
+                ///@{
+
+                DJV_TARGET_SSE4_1 void convert_U16_U8_SSE4_1(const void * in, void * out, size_t size)
+                {
+                    const U16_T * inP = reinterpret_cast<const U16_T *>(in);
+                    U8_T * outP = reinterpret_cast<U8_T *>(out);
+                    size_t i = 0;
+                    const __m128i c128 = _mm_set1_epi32(128);
+                    for (; i + 8 <= size; i += 8, inP += 8, outP += 8)
+                    {
+                        // Round with: ((x + 128) - ((x + 128) >> 8)) >> 8
+                        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inP));
+                        __m128i lo = _mm_add_epi32(_mm_cvtepu16_epi32(v), c128);
+                        __m128i hi = _mm_add_epi32(_mm_cvtepu16_epi32(_mm_srli_si128(v, 8)), c128);
+                        lo = _mm_srli_epi32(_mm_sub_epi32(lo, _mm_srli_epi32(lo, 8)), 8);
+                        hi = _mm_srli_epi32(_mm_sub_epi32(hi, _mm_srli_epi32(hi, 8)), 8);
+                        const __m128i u16 = _mm_packus_epi32(lo, hi);
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP), _mm_packus_epi16(u16, u16));
+                    }
+                    for (; i < size; ++i, ++inP, ++outP)
+                    {
+                        convert_U16_U8(*inP, *outP);
+                    }
+                }
+
+                DJV_TARGET_SSE4_1 void convert_F32_U8_SSE4_1(const void * in, void * out, size_t size)
+                {
+                    const F32_T * inP = reinterpret_cast<const F32_T *>(in);
+                    U8_T * outP = reinterpret_cast<U8_T *>(out);
+                    size_t i = 0;
+                    const __m128 zero = _mm_setzero_ps();
+                    const __m128 one = _mm_set1_ps(1.F);
+                    const __m128 max = _mm_set1_ps(static_cast<float>(U8Range.getMax()));
+                    for (; i + 8 <= size; i += 8, inP += 8, outP += 8)
+                    {
+                        // Note that _mm_max_ps() returns the second operand
+                        // for NaN values, matching clampUnit().
+                        const __m128 a = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(inP), zero), one);
+                        const __m128 b = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(inP + 4), zero), one);
+                        const __m128i lo = _mm_cvttps_epi32(_mm_mul_ps(a, max));
+                        const __m128i hi = _mm_cvttps_epi32(_mm_mul_ps(b, max));
+                        const __m128i u16 = _mm_packs_epi32(lo, hi);
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP), _mm_packus_epi16(u16, u16));
+                    }
+                    for (; i < size; ++i, ++inP, ++outP)
+                    {
+                        convert_F32_U8(*inP, *outP);
+                    }
+                }
+
+                //! Unpack four 10-bit pixels into 32-bit RGB vectors.
+                DJV_TARGET_SSE4_1 inline void unpack_U10_SSE4_1(const U10_S * in, __m128i out[4])
+                {
+                    const __m128i mask = _mm_set1_epi32(U10Range.getMax());
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+                    const __m128i r = _mm_and_si128(_mm_srli_epi32(v, 22), mask);
+                    const __m128i g = _mm_and_si128(_mm_srli_epi32(v, 12), mask);
+                    const __m128i b = _mm_and_si128(_mm_srli_epi32(v, 2), mask);
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128i rg0 = _mm_unpacklo_epi32(r, g);
+                    const __m128i rg1 = _mm_unpackhi_epi32(r, g);
+                    const __m128i b0 = _mm_unpacklo_epi32(b, zero);
+                    const __m128i b1 = _mm_unpackhi_epi32(b, zero);
+                    out[0] = _mm_unpacklo_epi64(rg0, b0);
+                    out[1] = _mm_unpackhi_epi64(rg0, b0);
+                    out[2] = _mm_unpacklo_epi64(rg1, b1);
+                    out[3] = _mm_unpackhi_epi64(rg1, b1);
+                }
+
+                // Note that the 10-bit kernels write four channels for each
+                // pixel and overlap the next pixel, so the last block of
+                // pixels is handled by the scalar code.
+
+                DJV_TARGET_SSE4_1 void convert_RGB_U10_RGB_U8_SSE4_1(const void * in, void * out, size_t size)
+                {
+                    const U10_S * inP = reinterpret_cast<const U10_S *>(in);
+                    U8_T * outP = reinterpret_cast<U8_T *>(out);
+                    size_t i = 0;
+                    __m128i pixels[4];
+                    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+                    for (; i + 6 <= size; i += 4, inP += 4, outP += 12)
+                    {
+                        unpack_U10_SSE4_1(inP, pixels);
+                        const __m128i u16a = _mm_packus_epi32(_mm_srli_epi32(pixels[0], 2), _mm_srli_epi32(pixels[1], 2));
+                        const __m128i u16b = _mm_packus_epi32(_mm_srli_epi32(pixels[2], 2), _mm_srli_epi32(pixels[3], 2));
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i *>(outP),
+                            _mm_shuffle_epi8(_mm_packus_epi16(u16a, u16b), shuffle));
+                    }
+                    for (; i < size; ++i, ++inP, outP += 3)
+                    {
+                        convert_U10_U8(inP->r, outP[0]);
+                        convert_U10_U8(inP->g, outP[1]);
+                        convert_U10_U8(inP->b, outP[2]);
+                    }
+                }
+
+                DJV_TARGET_SSE4_1 void convert_RGB_U10_RGB_U16_SSE4_1(const void * in, void * out, size_t size)
+                {
+                    const U10_S * inP = reinterpret_cast<const U10_S *>(in);
+                    U16_T * outP = reinterpret_cast<U16_T *>(out);
+                    size_t i = 0;
+                    __m128i pixels[4];
+                    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1);
+                    for (; i + 6 <= size; i += 4, inP += 4, outP += 12)
+                    {
+                        unpack_U10_SSE4_1(inP, pixels);
+                        const __m128i u16a = _mm_packus_epi32(_mm_slli_epi32(pixels[0], 6), _mm_slli_epi32(pixels[1], 6));
+                        const __m128i u16b = _mm_packus_epi32(_mm_slli_epi32(pixels[2], 6), _mm_slli_epi32(pixels[3], 6));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(outP), _mm_shuffle_epi8(u16a, shuffle));
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(outP + 6), _mm_shuffle_epi8(u16b, shuffle));
+                    }
+                    for (; i < size; ++i, ++inP, outP += 3)
+                    {
+                        convert_U10_U16(inP->r, outP[0]);
+                        convert_U10_U16(inP->g, outP[1]);
+                        convert_U10_U16(inP->b, outP[2]);
+                    }
+                }
+
+                DJV_TARGET_SSE4_1 void convert_RGB_U10_RGB_F32_SSE4_1(const void * in, void * out, size_t size)
+                {
+                    const U10_S * inP = reinterpret_cast<const U10_S *>(in);
+                    F32_T * outP = reinterpret_cast<F32_T *>(out);
+                    size_t i = 0;
+                    __m128i pixels[4];
+                    const __m128 max = _mm_set1_ps(static_cast<float>(U10Range.getMax()));
+                    for (; i + 5 <= size; i += 4, inP += 4)
+                    {
+                        unpack_U10_SSE4_1(inP, pixels);
+                        for (size_t j = 0; j < 4; ++j, outP += 3)
+                        {
+                            _mm_storeu_ps(outP, _mm_div_ps(_mm_cvtepi32_ps(pixels[j]), max));
+                        }
+                    }
+                    for (; i < size; ++i, ++inP, outP += 3)
+                    {
+                        convert_U10_F32(inP->r, outP[0]);
+                        convert_U10_F32(inP->g, outP[1]);
+                        convert_U10_F32(inP->b, outP[2]);
+                    }
+                }
+
+                ///@}
+
+                //! \name AVX2 and F16C Kernels
+                ///@{
+
+                DJV_TARGET_AVX2 void convert_F16_F32_AVX2(const void * in, void * out, size_t size)
+                {
+                    const F16_T * inP = reinterpret_cast<const F16_T *>(in);
+                    F32_T * outP = reinterpret_cast<F32_T *>(out);
+                    size_t i = 0;
+                    for (; i + 8 <= size; i += 8, inP += 8, outP += 8)
+                    {
+                        _mm256_storeu_ps(outP, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(inP))));
+                    }
+                    for (; i < size; ++i, ++inP, ++outP)
+                    {
+                        convert_F16_F32(*inP, *outP);
+                    }
+                }
+
+                DJV_TARGET_AVX2 void convert_F32_F16_AVX2(const void * in, void * out, size_t size)
+                {
+                    const F32_T * inP = reinterpret_cast<const F32_T *>(in);
+                    F16_T * outP = reinterpret_cast<F16_T *>(out);
+                    size_t i = 0;
+                    for (; i + 8 <= size; i += 8, inP += 8, outP += 8)
+                    {
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i *>(outP),
+                            _mm256_cvtps_ph(_mm256_loadu_ps(inP), _MM_FROUND_TO_NEAREST_INT));
+                    }
+                    for (; i < size; ++i, ++inP, ++outP)
+                    {
+                        convert_F32_F16(*inP, *outP);
+                    }
+                }
+
+                DJV_TARGET_AVX2 void convert_F16_U8_AVX2(const void * in, void * out, size_t size)
+                {
+                    const F16_T * inP = reinterpret_cast<const F16_T *>(in);
+                    U8_T * outP = reinterpret_cast<U8_T *>(out);
+                    size_t i = 0;
+                    const __m256 zero = _mm256_setzero_ps();
+                    const __m256 one = _mm256_set1_ps(1.F);
+                    const __m256 max = _mm256_set1_ps(static_cast<float>(U8Range.getMax()));
+                    for (; i + 8 <= size; i += 8, inP += 8, outP += 8)
+                    {
+                        const __m256 f32 = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(inP)));
+                        const __m256 clamped = _mm256_min_ps(_mm256_max_ps(f32, zero), one);
+                        const __m256i i32 = _mm256_cvttps_epi32(_mm256_mul_ps(clamped, max));
+                        const __m128i u16 = _mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP), _mm_packus_epi16(u16, u16));
+                    }
+                    for (; i < size; ++i, ++inP, ++outP)
+                    {
+                        convert_F16_U8(*inP, *outP);
+                    }
+                }
+
+                DJV_TARGET_AVX2 void convert_F32_U8_AVX2(const void * in, void * out, size_t size)
+                {
+                    const F32_T * inP = reinterpret_cast<const F32_T *>(in);
+                    U8_T * outP = reinterpret_cast<U8_T *>(out);
+                    size_t i = 0;
+                    const __m256 zero = _mm256_setzero_ps();
+                    const __m256 one = _mm256_set1_ps(1.F);
+                    const __m256 max = _mm256_set1_ps(static_cast<float>(U8Range.getMax()));
+                    for (; i + 8 <= size; i += 8, inP += 8, outP += 8)
+                    {
+                        const __m256 clamped = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(inP), zero), one);
+                        const __m256i i32 = _mm256_cvttps_epi32(_mm256_mul_ps(clamped, max));
+                        const __m128i u16 = _mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP), _mm_packus_epi16(u16, u16));
+                    }
+                    for (; i < size; ++i, ++inP, ++outP)
+                    {
+                        convert_F32_U8(*inP, *outP);
+                    }
+                }
+
+                DJV_TARGET_AVX2 void convert_U16_U8_AVX2(const void * in, void * out, size_t size)
+                {
+                    const U16_T * inP = reinterpret_cast<const U16_T *>(in);
+                    U8_T * outP = reinterpret_cast<U8_T *>(out);
+                    size_t i = 0;
+                    const __m256i c128 = _mm256_set1_epi32(128);
+                    for (; i + 8 <= size; i += 8, inP += 8, outP += 8)
+                    {
+                        __m256i v = _mm256_add_epi32(
+                            _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(inP))),
+                            c128);
+                        v = _mm256_srli_epi32(_mm256_sub_epi32(v, _mm256_srli_epi32(v, 8)), 8);
+                        const __m128i u16 = _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+                        _mm_storel_epi64(reinterpret_cast<__m128i *>(outP), _mm_packus_epi16(u16, u16));
+                    }
+                    for (; i < size; ++i, ++inP, ++outP)
+                    {
+                        convert_U16_U8(*inP, *outP);
+                    }
+                }
+
+                ///@}
+
+                //! Apply a kernel that converts channels to all of the
+                //! channels in a pixel.
+                template<size_t C, void (*F)(const void *, void *, size_t)>
+                void convertChannels(const void * in, void * out, size_t size)
+                {
+                    F(in, out, size * C);
+                }
+
+                bool hasSSE4_1()
+                {
+#if defined(_MSC_VER)
+                    int info[4];
+                    __cpuid(info, 1);
+                    return (info[2] & (1 << 19)) != 0;
+#else // _MSC_VER
+                    return __builtin_cpu_supports("sse4.1");
+#endif // _MSC_VER
+                }
+
+                bool hasAVX2()
+                {
+#if defined(_MSC_VER)
+                    int info[4];
+                    __cpuid(info, 1);
+                    const bool f16c = (info[2] & (1 << 29)) != 0;
+                    const bool osxsave = (info[2] & (1 << 27)) != 0;
+                    __cpuidex(info, 7, 0);
+                    const bool avx2 = (info[1] & (1 << 5)) != 0;
+                    return f16c && avx2 && osxsave && (_xgetbv(0) & 6) == 6;
+#else // _MSC_VER
+                    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c");
+#endif // _MSC_VER
+                }
+
+            } // namespace
+#endif // DJV_PIXEL_SIMD
+
+            namespace
             {
-                typedef std::function<void(const void *, void *, size_t)> Function;
-                static const std::map<Type, std::map<Type, Function> > functions =
+                typedef void (*ConvertFunction)(const void *, void *, size_t);
+
+                //! This struct provides a table of conversion functions.
+                struct ConvertFunctions
                 {
-                    CONVERT_MAP(L_U8),
-                    CONVERT_MAP(L_U16),
-                    CONVERT_MAP(L_U32),
-                    CONVERT_MAP(L_F16),
-                    CONVERT_MAP(L_F32),
-                    CONVERT_MAP(LA_U8),
-                    CONVERT_MAP(LA_U16),
-                    CONVERT_MAP(LA_U32),
-                    CONVERT_MAP(LA_F16),
-                    CONVERT_MAP(LA_F32),
-                    CONVERT_MAP(RGB_U8),
-                    CONVERT_MAP(RGB_U10),
-                    CONVERT_MAP(RGB_U16),
-                    CONVERT_MAP(RGB_U32),
-                    CONVERT_MAP(RGB_F16),
-                    CONVERT_MAP(RGB_F32),
-                    CONVERT_MAP(RGBA_U8),
-                    CONVERT_MAP(RGBA_U16),
-                    CONVERT_MAP(RGBA_U32),
-                    CONVERT_MAP(RGBA_F16),
-                    CONVERT_MAP(RGBA_F32)
+                    ConvertFunction functions[static_cast<size_t>(Type::Count)][static_cast<size_t>(Type::Count)];
+
+                    void set(Type inType, Type outType, ConvertFunction function)
+                    {
+                        functions[static_cast<size_t>(inType)][static_cast<size_t>(outType)] = function;
+                    }
                 };
-                Function function;
-                const auto i = functions.find(inType);
-                if (i != functions.end())
+
+                ConvertFunctions getScalarFunctions()
                 {
-                    const auto j = i->second.find(outType);
-                    if (j != i->second.end())
+                    static const std::map<Type, std::map<Type, ConvertFunction> > functions =
+                    {
+                        CONVERT_MAP(L_U8),
+                        CONVERT_MAP(L_U16),
+                        CONVERT_MAP(L_U32),
+                        CONVERT_MAP(L_F16),
+                        CONVERT_MAP(L_F32),
+                        CONVERT_MAP(LA_U8),
+                        CONVERT_MAP(LA_U16),
+                        CONVERT_MAP(LA_U32),
+                        CONVERT_MAP(LA_F16),
+                        CONVERT_MAP(LA_F32),
+                        CONVERT_MAP(RGB_U8),
+                        CONVERT_MAP(RGB_U10),
+                        CONVERT_MAP(RGB_U16),
+                        CONVERT_MAP(RGB_U32),
+                        CONVERT_MAP(RGB_F16),
+                        CONVERT_MAP(RGB_F32),
+                        CONVERT_MAP(RGBA_U8),
+                        CONVERT_MAP(RGBA_U16),
+                        CONVERT_MAP(RGBA_U32),
+                        CONVERT_MAP(RGBA_F16),
+                        CONVERT_MAP(RGBA_F32)
+                    };
+                    ConvertFunctions out;
+                    memset(&out, 0, sizeof(ConvertFunctions));
+                    for (const auto& i : functions)
                     {
-                        function = j->second;
+                        for (const auto& j : i.second)
+                        {
+                            out.set(i.first, j.first, j.second);
+                        }
                     }
+                    return out;
                 }
-                if (function)
+
+#if defined(DJV_PIXEL_SIMD)
+#define CONVERT_CHANNELS(A, B, F) \
+    out.set(Type::L_##A, Type::L_##B, convertChannels<1, F>); \
+    out.set(Type::LA_##A, Type::LA_##B, convertChannels<2, F>); \
+    out.set(Type::RGB_##A, Type::RGB_##B, convertChannels<3, F>); \
+    out.set(Type::RGBA_##A, Type::RGBA_##B, convertChannels<4, F>)
+
+                ConvertFunctions getSSE4_1Functions()
+                {
+                    ConvertFunctions out = getScalarFunctions();
+                    CONVERT_CHANNELS(U16, U8, convert_U16_U8_SSE4_1);
+                    CONVERT_CHANNELS(F32, U8, convert_F32_U8_SSE4_1);
+                    out.set(Type::RGB_U10, Type::RGB_U8, convert_RGB_U10_RGB_U8_SSE4_1);
+                    out.set(Type::RGB_U10, Type::RGB_U16, convert_RGB_U10_RGB_U16_SSE4_1);
+                    out.set(Type::RGB_U10, Type::RGB_F32, convert_RGB_U10_RGB_F32_SSE4_1);
+                    return out;
+                }
+
+                ConvertFunctions getAVX2Functions()
+                {
+                    ConvertFunctions out = getSSE4_1Functions();
+                    CONVERT_CHANNELS(U16, U8, convert_U16_U8_AVX2);
+                    CONVERT_CHANNELS(F16, F32, convert_F16_F32_AVX2);
+                    CONVERT_CHANNELS(F32, F16, convert_F32_F16_AVX2);
+                    CONVERT_CHANNELS(F16, U8, convert_F16_U8_AVX2);
+                    CONVERT_CHANNELS(F32, U8, convert_F32_U8_AVX2);
+                    return out;
+                }
+#endif // DJV_PIXEL_SIMD
+
+                const ConvertFunctions& getConvertFunctions(ConvertSIMD value)
+                {
+                    static const ConvertFunctions scalar = getScalarFunctions();
+#if defined(DJV_PIXEL_SIMD)
+                    static const ConvertFunctions sse4_1 = getSSE4_1Functions();
+                    static const ConvertFunctions avx2 = getAVX2Functions();
+                    switch (std::min(value, getConvertSIMD()))
+                    {
+                    case ConvertSIMD::SSE4_1: return sse4_1;
+                    case ConvertSIMD::AVX2: return avx2;
+                    default: break;
+                    }
+#endif // DJV_PIXEL_SIMD
+                    return scalar;
+                }
+
+            } // namespace
+
+            ConvertSIMD getConvertSIMD()
+            {
+                ConvertSIMD out = ConvertSIMD::None;
+#if defined(DJV_PIXEL_SIMD)
+                static const bool sse4_1 = hasSSE4_1();
+                static const bool avx2 = hasAVX2();
+                if (sse4_1)
+                {
+                    out = ConvertSIMD::SSE4_1;
+                    if (avx2)
+                    {
+                        out = ConvertSIMD::AVX2;
+                    }
+                }
+#endif // DJV_PIXEL_SIMD
+                return out;
+            }
+
+            void convert(const void * in, Type inType, void * out, Type outType, size_t size)
+            {
+                static const ConvertFunctions& functions = getConvertFunctions(getConvertSIMD());
+                if (auto function = functions.functions[static_cast<size_t>(inType)][static_cast<size_t>(outType)])
+                {
+                    function(in, out, size);
+                }
+            }
+
+            void convert(const void * in, Type inType, void * out, Type outType, size_t size, ConvertSIMD simd)
+            {
+                const ConvertFunctions& functions = getConvertFunctions(simd);
+                if (auto function = functions.functions[static_cast<size_t>(inType)][static_cast<size_t>(outType)])
                 {
                     function(in, out, size);
                 }
@@ -566,7 +961,13 @@ namespace djv
         DJV_TEXT("av_image_type_rgba_u16"),
         DJV_TEXT("av_image_type_rgba_u32"),
         DJV_TEXT("av_image_type_rgba_f16"),
-        DJV_TEXT("av_image_type_rgba_f32"));
+        DJV_TEXT("av_image_type_rgba_f32"),
+        DJV_TEXT("av_image_type_yuv_420p_u8"),
+        DJV_TEXT("av_image_type_yuv_422p_u8"),
+        DJV_TEXT("av_image_type_yuv_444p_u8"),
+        DJV_TEXT("av_image_type_yuv_420p_u16"),
+        DJV_TEXT("av_image_type_yuv_422p_u16"),
+        DJV_TEXT("av_image_type_yuv_444p_u16"));
 
     DJV_ENUM_SERIALIZE_HELPERS_IMPLEMENTATION(
         AV::Image,
@@ -51,6 +51,16 @@ namespace djv
                 RGBA_F16,
                 RGBA_F32,
 
+                //! Planar Y'CbCr with BT.709 limited range coefficients. The
+                //! planes are stored one after another, and the scanlines of
+                //! each plane are padded to the layout alignment.
+                YUV_420P_U8,
+                YUV_422P_U8,
+                YUV_444P_U8,
+                YUV_420P_U16,
+                YUV_422P_U16,
+                YUV_444P_U16,
+
                 Count,
                 First = None
             };
@@ -158,6 +168,23 @@ namespace djv
             Type getIntType(uint8_t channelCount, uint8_t bitDepth);
             Type getFloatType(uint8_t channelCount, uint8_t bitDepth);
 
+            //! \name Planar YUV
+            ///@{
+
+            bool isYUVType(Type);
+
+            //! Get the RGB type that a planar YUV type is converted to. Other
+            //! types are returned unchanged.
+            Type getRGBType(Type);
+
+            uint8_t getPlaneCount(Type);
+
+            //! Get the horizontal and vertical chroma subsampling as a power
+            //! of two.
+            void getChromaShift(Type, uint8_t& x, uint8_t& y);
+
+            ///@}
+
             GLenum getGLFormat(Type);
             GLenum getGLType(Type);
 
@@ -189,6 +216,10 @@ namespace djv
             void convert_U32_F16(U32_T, F16_T&);
             void convert_U32_F32(U32_T, F32_T&);
 
+            //! Clamp a floating point value to the range [0, 1] before it is
+            //! converted to an integer type. NaN values are clamped to zero.
+            float clampUnit(float);
+
             void convert_F16_U8(F16_T, U8_T&);
             void convert_F16_U10(F16_T, U10_T&);
             void convert_F16_U16(F16_T, U16_T&);
@@ -203,8 +234,28 @@ namespace djv
             void convert_F32_F16(F32_T, F16_T&);
             void convert_F32_F32(F32_T, F32_T&);
 
+            //! This enumeration provides the SIMD instruction sets used to
+            //! convert pixels.
+            enum class ConvertSIMD
+            {
+                None,
+                SSE4_1,
+                AVX2,
+
+                Count,
+                First = None
+            };
+
+            //! Get the best SIMD instruction set supported by this machine.
+            ConvertSIMD getConvertSIMD();
+
+            //! Convert pixels using the best SIMD instruction set.
             void convert(const void *, Type, void *, Type, size_t);
 
+            //! Convert pixels using the given SIMD instruction set, or the
+            //! best supported one if it is not available.
+            void convert(const void *, Type, void *, Type, size_t, ConvertSIMD);
+
         } // namespace Image
     } // namespace AV
 
@@ -66,7 +66,14 @@ namespace djv
                     Channels::RGBA,
                     Channels::RGBA,
                     Channels::RGBA,
-                    Channels::RGBA
+                    Channels::RGBA,
+
+                    Channels::RGB,
+                    Channels::RGB,
+                    Channels::RGB,
+                    Channels::RGB,
+                    Channels::RGB,
+                    Channels::RGB
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
                 return data[static_cast<size_t>(value)];
@@ -80,7 +87,8 @@ namespace djv
                     1, 1, 1, 1, 1,
                     2, 2, 2, 2, 2,
                     3, 3, 3, 3, 3, 3,
-                    4, 4, 4, 4, 4
+                    4, 4, 4, 4, 4,
+                    3, 3, 3, 3, 3, 3
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
                 return data[static_cast<size_t>(value)];
@@ -115,7 +123,14 @@ namespace djv
                     DataType::U16,
                     DataType::U32,
                     DataType::F16,
-                    DataType::F32
+                    DataType::F32,
+
+                    DataType::U8,
+                    DataType::U8,
+                    DataType::U8,
+                    DataType::U16,
+                    DataType::U16,
+                    DataType::U16
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
                 return data[static_cast<size_t>(value)];
@@ -129,7 +144,8 @@ namespace djv
                     8, 16, 32, 16, 32,
                     8, 16, 32, 16, 32,
                     8, 10, 16, 32, 16, 32,
-                    8, 16, 32, 16, 32
+                    8, 16, 32, 16, 32,
+                    8, 8, 8, 16, 16, 16
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
                 return data[static_cast<size_t>(value)];
@@ -159,7 +175,8 @@ namespace djv
                     1, 2, 4, 2, 4,
                     2, 4, 8, 4, 8,
                     3, 4, 6, 12, 6, 12,
-                    4, 8, 16, 8, 16
+                    4, 8, 16, 8, 16,
+                    1, 1, 1, 2, 2, 2
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
                 return data[static_cast<size_t>(value)];
@@ -190,6 +207,7 @@ namespace djv
                     true, true, true, false, false,
                     true, true, true, true, false, false,
                     true, true, true, false, false,
+                    true, true, true, true, true, true
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
                 return data[static_cast<size_t>(value)];
@@ -203,7 +221,8 @@ namespace djv
                     false, false, false, true, true,
                     false, false, false, true, true,
                     false, false, false, false, true, true,
-                    false, false, false, true, true
+                    false, false, false, true, true,
+                    false, false, false, false, false, false
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
                 return data[static_cast<size_t>(value)];
@@ -240,6 +259,13 @@ namespace djv
                     IntRange(U32Range.getMin(), U32Range.getMax()),
                     IntRange(0, 0),
                     IntRange(0, 0),
+
+                    IntRange(U8Range.getMin(), U8Range.getMax()),
+                    IntRange(U8Range.getMin(), U8Range.getMax()),
+                    IntRange(U8Range.getMin(), U8Range.getMax()),
+                    IntRange(U16Range.getMin(), U16Range.getMax()),
+                    IntRange(U16Range.getMin(), U16Range.getMax()),
+                    IntRange(U16Range.getMin(), U16Range.getMax())
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
                 return data[static_cast<size_t>(value)];
@@ -276,6 +302,13 @@ namespace djv
                     FloatRange(0.F, 0.F),
                     FloatRange(F16Range.getMin(), F16Range.getMax()),
                     FloatRange(F32Range.getMin(), F32Range.getMax()),
+
+                    FloatRange(0.F, 0.F),
+                    FloatRange(0.F, 0.F),
+                    FloatRange(0.F, 0.F),
+                    FloatRange(0.F, 0.F),
+                    FloatRange(0.F, 0.F),
+                    FloatRange(0.F, 0.F)
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
                 return data[static_cast<size_t>(value)];
@@ -368,6 +401,57 @@ namespace djv
                 return Type::None;
             }
 
+            inline bool isYUVType(Type value)
+            {
+                bool out = false;
+                switch (value)
+                {
+                case Type::YUV_420P_U8:
+                case Type::YUV_422P_U8:
+                case Type::YUV_444P_U8:
+                case Type::YUV_420P_U16:
+                case Type::YUV_422P_U16:
+                case Type::YUV_444P_U16: out = true; break;
+                default: break;
+                }
+                return out;
+            }
+
+            inline Type getRGBType(Type value)
+            {
+                Type out = value;
+                switch (value)
+                {
+                case Type::YUV_420P_U8:
+                case Type::YUV_422P_U8:
+                case Type::YUV_444P_U8: out = Type::RGB_U8; break;
+                case Type::YUV_420P_U16:
+                case Type::YUV_422P_U16:
+                case Type::YUV_444P_U16: out = Type::RGB_U16; break;
+                default: break;
+                }
+                return out;
+            }
+
+            inline uint8_t getPlaneCount(Type value)
+            {
+                return isYUVType(value) ? 3 : 1;
+            }
+
+            inline void getChromaShift(Type value, uint8_t& x, uint8_t& y)
+            {
+                x = 0;
+                y = 0;
+                switch (value)
+                {
+                case Type::YUV_420P_U8:
+                case Type::YUV_420P_U16: x = 1; y = 1; break;
+                case Type::YUV_422P_U8:
+                case Type::YUV_422P_U16: x = 1; break;
+                default: break;
+                }
+            }
+
             inline GLenum getGLFormat(Type value)
             {
                 const GLenum data[] =
@@ -398,6 +482,13 @@ namespace djv
                     GL_NONE,
                     GL_NONE,
                     GL_NONE,
+                    GL_NONE,
+
+                    GL_LUMINANCE,
+                    GL_LUMINANCE,
+                    GL_LUMINANCE,
+                    GL_NONE,
+                    GL_NONE,
                     GL_NONE
 #else // DJV_OPENGL_ES2
                     GL_RED,
@@ -423,7 +514,14 @@ namespace djv
                     GL_RGBA,
                     GL_RGBA,
                     GL_RGBA,
-                    GL_RGBA
+                    GL_RGBA,
+
+                    GL_RED,
+                    GL_RED,
+                    GL_RED,
+                    GL_RED,
+                    GL_RED,
+                    GL_RED
 #endif // DJV_OPENGL_ES2
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
@@ -461,6 +559,13 @@ namespace djv
                     GL_NONE,
                     GL_NONE,
                     GL_NONE,
+
+                    GL_UNSIGNED_BYTE,
+                    GL_UNSIGNED_BYTE,
+                    GL_UNSIGNED_BYTE,
+                    GL_NONE,
+                    GL_NONE,
+                    GL_NONE
 #else // DJV_OPENGL_ES2
                     GL_UNSIGNED_BYTE,
                     GL_UNSIGNED_SHORT,
@@ -485,7 +590,14 @@ namespace djv
                     GL_UNSIGNED_SHORT,
                     GL_UNSIGNED_INT,
                     GL_HALF_FLOAT,
-                    GL_FLOAT
+                    GL_FLOAT,
+
+                    GL_UNSIGNED_BYTE,
+                    GL_UNSIGNED_BYTE,
+                    GL_UNSIGNED_BYTE,
+                    GL_UNSIGNED_SHORT,
+                    GL_UNSIGNED_SHORT,
+                    GL_UNSIGNED_SHORT
 #endif // DJV_OPENGL_ES2
                 };
                 DJV_ASSERT(sizeof(data) / sizeof(data[0]) == static_cast<size_t>(Type::Count));
@@ -554,7 +666,9 @@ namespace djv
 
             inline void convert_U16_U8(U16_T in, U8_T& out)
             {
-                out = in >> 8;
+                // Round to the nearest value.
+                const uint32_t tmp = in + 128;
+                out = static_cast<U8_T>((tmp - (tmp >> 8)) >> 8);
             }
 
             inline void convert_U16_U10(U16_T in, U10_T& out)
@@ -612,10 +726,15 @@ namespace djv
                 out = in / static_cast<float>(U32Range.getMax());
             }
 
+            inline float clampUnit(float value)
+            {
+                return value > 0.F ? (value < 1.F ? value : 1.F) : 0.F;
+            }
+
             inline void convert_F16_U8(F16_T in, U8_T& out)
             {
                 out = static_cast<U8_T>(Core::Math::clamp(
-                    static_cast<uint16_t>(in * U8Range.getMax()),
+                    static_cast<uint16_t>(clampUnit(in) * U8Range.getMax()),
                     static_cast<uint16_t>(U8Range.getMin()),
                     static_cast<uint16_t>(U8Range.getMax())));
             }
@@ -623,7 +742,7 @@ namespace djv
             inline void convert_F16_U10(F16_T in, U10_T& out)
             {
                 out = static_cast<U10_T>(Core::Math::clamp(
-                    static_cast<uint16_t>(in * U10Range.getMax()),
+                    static_cast<uint16_t>(clampUnit(in) * U10Range.getMax()),
                     static_cast<uint16_t>(U10Range.getMin()),
                     static_cast<uint16_t>(U10Range.getMax())));
             }
@@ -631,7 +750,7 @@ namespace djv
             inline void convert_F16_U16(F16_T in, U16_T& out)
             {
                 out = static_cast<U16_T>(Core::Math::clamp(
-                    static_cast<uint32_t>(in * U16Range.getMax()),
+                    static_cast<uint32_t>(clampUnit(in) * U16Range.getMax()),
                     static_cast<uint32_t>(U16Range.getMin()),
                     static_cast<uint32_t>(U16Range.getMax())));
             }
@@ -639,7 +758,7 @@ namespace djv
             inline void convert_F16_U32(F16_T in, U32_T& out)
             {
                 out = static_cast<U32_T>(Core::Math::clamp(
-                    static_cast<uint64_t>(static_cast<double>(in) * static_cast<uint64_t>(U32Range.getMax())),
+                    static_cast<uint64_t>(static_cast<double>(clampUnit(in)) * static_cast<uint64_t>(U32Range.getMax())),
                     static_cast<uint64_t>(U32Range.getMin()),
                     static_cast<uint64_t>(U32Range.getMax())));
             }
@@ -657,7 +776,7 @@ namespace djv
             inline void convert_F32_U8(F32_T in, U8_T& out)
             {
                 out = static_cast<U8_T>(Core::Math::clamp(
-                    static_cast<uint16_t>(in * U8Range.getMax()),
+                    static_cast<uint16_t>(clampUnit(in) * U8Range.getMax()),
                     static_cast<uint16_t>(U8Range.getMin()),
                     static_cast<uint16_t>(U8Range.getMax())));
             }
@@ -665,7 +784,7 @@ namespace djv
             inline void convert_F32_U10(F32_T in, U10_T& out)
             {
                 out = static_cast<U10_T>(Core::Math::clamp(
-                    static_cast<uint16_t>(in * U10Range.getMax()),
+                    static_cast<uint16_t>(clampUnit(in) * U10Range.getMax()),
                     static_cast<uint16_t>(U10Range.getMin()),
                     static_cast<uint16_t>(U10Range.getMax())));
             }
@@ -673,7 +792,7 @@ namespace djv
             inline void convert_F32_U16(F32_T in, U16_T& out)
             {
                 out = static_cast<U16_T>(Core::Math::clamp(
-                    static_cast<uint32_t>(in * U16Range.getMax()),
+                    static_cast<uint32_t>(clampUnit(in) * U16Range.getMax()),
                     static_cast<uint32_t>(U16Range.getMin()),
                     static_cast<uint32_t>(U16Range.getMax())));
             }
@@ -681,7 +800,7 @@ namespace djv
             inline void convert_F32_U32(F32_T in, U32_T& out)
             {
                 out = static_cast<U32_T>(Core::Math::clamp(
-                    static_cast<uint64_t>(static_cast<double>(in) * static_cast<uint64_t>(U32Range.getMax())),
+                    static_cast<uint64_t>(static_cast<double>(clampUnit(in)) * static_cast<uint64_t>(U32Range.getMax())),
                     static_cast<uint64_t>(U32Range.getMin()),
                     static_cast<uint64_t>(U32Range.getMax())));
             }
@@ -6,7 +6,9 @@
 
 #include <djvAV/Color.h>
 #include <djvAV/GLFWSystem.h>
+#include <djvAV/OCIOSystem.h>
 #include <djvAV/OpenGLMesh.h>
+#include <djvAV/OpenGLPixelBufferRing.h>
 #include <djvAV/OpenGLShader.h>
 #include <djvAV/OpenGLTexture.h>
 #include <djvAV/OpenGLTextureAtlas.h>
@@ -17,6 +19,7 @@
 #include <djvCore/Cache.h>
 #include <djvCore/Context.h>
 #include <djvCore/FileIO.h>
+#include <djvCore/FileInfo.h>
 #include <djvCore/LogSystem.h>
 #include <djvCore/Range.h>
 #include <djvCore/ResourceSystem.h>
@@ -28,6 +31,10 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/perpendicular.hpp>
 
+#include <future>
+#include <iomanip>
+#include <set>
+
 #if defined(GetObject)
 #undef GetObject
 #endif // GetObject
@@ -48,23 +55,29 @@ namespace djv
                 const uint16_t textureAtlasSize       = 8192;
                 const size_t   dynamicTextureCount    = 16;
                 const size_t   dynamicTextureCacheMax = 16;
+                const size_t   primitiveArenaBlockSize = 65536;
+                const size_t   shaderCacheMax         = 8;
 #if !defined(DJV_OPENGL_ES2)
                 const size_t   lut3DSize              = 32;
                 const size_t   colorSpaceCacheMax     = 32;
+                const size_t   shaderCacheFileMax     = 64;
+                const char*    shaderCacheExtension   = ".bin";
+                const char*    shaderCacheTempExtension = ".tmp";
+                const size_t   pixelBufferCount       = 2;
 #endif // DJV_OPENGL_ES2
 
                 // This enumeration provides how the color is used to draw the render primitive.
                 enum class ColorMode
                 {
-                    SolidColor,             // Use the uniform variable "color"
-                    ColorWithTextureAlpha,  // Use the uniform variable "color" with the alpha multiplied
+                    SolidColor,             // Use the vertex color
+                    ColorWithTextureAlpha,  // Use the vertex color with the alpha multiplied
                                             // by the red channel from the texture (e.g., used for
                                             // drawing text)
                     ColorWithTextureAlphaR, // Used for drawing text with LCD sub-sampling
                     ColorWithTextureAlphaG,
                     ColorWithTextureAlphaB,
-                    ColorAndTexture,        // Use the uniform variable "color" multiplied by the texture     
-                    Shadow                  // Use the uniform variable "color" multiplied by the "U" texture coordinate
+                    ColorAndTexture,        // Use the vertex color multiplied by the texture     
+                    Shadow                  // Use the vertex color multiplied by the "U" texture coordinate
                 };
 
                 //! This struct provides data used to draw the render primitive.
@@ -76,7 +89,6 @@ namespace djv
                     // Shader uniform variable locations.
                     GLint imageChannelsLoc          = 0;
                     GLint colorModeLoc              = 0;
-                    GLint colorLoc                  = 0;
 #if !defined(DJV_OPENGL_ES2)
                     GLint colorSpaceLoc             = 0;
                     GLint colorSpaceSamplerLoc      = 0;
@@ -98,6 +110,9 @@ namespace djv
                     GLint softClipLoc               = 0;
                     GLint imageChannelDisplayLoc    = 0;
                     GLint textureSamplerLoc         = 0;
+                    GLint imageYUVLoc               = 0;
+                    GLint textureSamplerULoc        = 0;
+                    GLint textureSamplerVLoc        = 0;
                 };
 
                 //! This class provides the base functionality for render primitives.
@@ -107,17 +122,37 @@ namespace djv
                     virtual ~Primitive() {}
                     
                     BBox2f      clipRect;
-                    float       color[4]         = { 0.F, 0.F, 0.F, 0.F };
+                    ColorMode   colorMode        = ColorMode::SolidColor;
+                    uint8_t     atlasIndex       = 0;
                     GLenum      type             = GL_TRIANGLES;
                     size_t      vaoOffset        = 0;
                     size_t      vaoSize          = 0;
                     AlphaBlend  alphaBlend       = AlphaBlend::Straight;
                     bool        textLCDRendering = false;
 
+                    //! Primitives that only use the shared state (clipping
+                    //! rectangle, blending, color mode, and texture atlas) can
+                    //! be merged with their neighbors into a single draw.
+                    virtual bool isBatchable() const
+                    {
+                        return GL_TRIANGLES == type;
+                    }
+
+                    bool isBatchable(const Primitive& other) const
+                    {
+                        return
+                            isBatchable() &&
+                            other.isBatchable() &&
+                            clipRect == other.clipRect &&
+                            colorMode == other.colorMode &&
+                            atlasIndex == other.atlasIndex &&
+                            alphaBlend == other.alphaBlend &&
+                            textLCDRendering == other.textLCDRendering;
+                    }
+
                     virtual void bind(const PrimitiveData& data, const std::shared_ptr<OpenGL::Shader>& shader)
                     {
-                        shader->setUniform(data.colorModeLoc, static_cast<int>(ColorMode::SolidColor));
-                        shader->setUniform(data.colorLoc, reinterpret_cast<const GLfloat*>(color));
+                        shader->setUniform(data.colorModeLoc, static_cast<int>(colorMode));
                     }
                 };
 
@@ -125,15 +160,17 @@ namespace djv
                 class TextPrimitive : public Primitive
                 {
                 public:
-                    uint8_t atlasIndex = 0;
+                    TextPrimitive()
+                    {
+                        colorMode = ColorMode::ColorWithTextureAlpha;
+                    }
 
                     void bind(const PrimitiveData& data, const std::shared_ptr<OpenGL::Shader>& shader) override
                     {
                         if (!textLCDRendering)
                         {
-                            shader->setUniform(data.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlpha));
+                            shader->setUniform(data.colorModeLoc, static_cast<int>(colorMode));
                         }
-                        shader->setUniform(data.colorLoc, reinterpret_cast<const GLfloat*>(color));
                         shader->setUniform(data.textureSamplerLoc, static_cast<int>(atlasIndex));
                     }
                 };
@@ -142,7 +179,11 @@ namespace djv
                 class ImagePrimitive : public Primitive
                 {
                 public:
-                    ColorMode           colorMode           = ColorMode::ColorAndTexture;
+                    ImagePrimitive()
+                    {
+                        colorMode = ColorMode::ColorAndTexture;
+                    }
+
                     Image::Channels     imageChannels       = Image::Channels::RGBA;
 #if !defined(DJV_OPENGL_ES2)
                     uint8_t             colorSpace          = 0;
@@ -161,13 +202,19 @@ namespace djv
                     float               softClip            = 0.F;
                     ImageChannelDisplay imageChannelDisplay = ImageChannelDisplay::Color;
                     ImageCache          imageCache          = ImageCache::Atlas;
-                    uint8_t             atlasIndex          = 0;
                     GLuint              textureID           = 0;
+                    bool                imageYUV            = false;
+                    GLuint              textureIDU          = 0;
+                    GLuint              textureIDV          = 0;
+
+                    bool isBatchable() const override
+                    {
+                        return false;
+                    }
 
                     void bind(const PrimitiveData& data, const std::shared_ptr<OpenGL::Shader>& shader) override
                     {
                         shader->setUniform(data.colorModeLoc, static_cast<int>(colorMode));
-                        shader->setUniform(data.colorLoc, reinterpret_cast<const GLfloat*>(color));
                         shader->setUniform(data.imageChannelsLoc, static_cast<int>(imageChannels));
                         if (colorMatrixEnabled)
                         {
@@ -212,34 +259,42 @@ namespace djv
                             glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + data.textureAtlasCount));
                             glBindTexture(GL_TEXTURE_2D, textureID);
                             shader->setUniform(data.textureSamplerLoc, static_cast<int>(data.textureAtlasCount));
+                            if (imageYUV)
+                            {
+                                glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + data.textureAtlasCount + 2));
+                                glBindTexture(GL_TEXTURE_2D, textureIDU);
+                                shader->setUniform(data.textureSamplerULoc, static_cast<int>(data.textureAtlasCount + 2));
+                                glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + data.textureAtlasCount + 3));
+                                glBindTexture(GL_TEXTURE_2D, textureIDV);
+                                shader->setUniform(data.textureSamplerVLoc, static_cast<int>(data.textureAtlasCount + 3));
+                            }
                             break;
                         default: break;
                         }
+                        shader->setUniform(data.imageYUVLoc, imageYUV);
                     }
                 };
 
-                //! This class provides a shadow render primitive.
-                class ShadowPrimitive : public Primitive
+                //! This class provides a texture render primitive.
+                class TexturePrimitive : public Primitive
                 {
                 public:
-                    void bind(const PrimitiveData& data, const std::shared_ptr<OpenGL::Shader>& shader) override
+                    TexturePrimitive()
                     {
-                        shader->setUniform(data.colorModeLoc, static_cast<int>(ColorMode::Shadow));
-                        shader->setUniform(data.colorLoc, reinterpret_cast<const GLfloat*>(color));
+                        colorMode = ColorMode::ColorAndTexture;
                     }
-                };
 
-                //! This class provides a texture render primitive.
-                class TexturePrimitive : public Primitive
-                {
-                public:
                     GLuint textureID = 0;
                     GLenum target    = GL_TEXTURE_2D;
 
+                    bool isBatchable() const override
+                    {
+                        return false;
+                    }
+
                     void bind(const PrimitiveData& data, const std::shared_ptr<OpenGL::Shader>& shader) override
                     {
-                        shader->setUniform(data.colorModeLoc, static_cast<int>(ColorMode::ColorAndTexture));
-                        shader->setUniform(data.colorLoc, reinterpret_cast<const GLfloat*>(color));
+                        shader->setUniform(data.colorModeLoc, static_cast<int>(colorMode));
                         glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + data.textureAtlasCount));
                         glBindTexture(target, textureID);
                         shader->setUniform(data.textureSamplerLoc, static_cast<int>(data.textureAtlasCount));
@@ -253,8 +308,96 @@ namespace djv
                     float    vy;
                     uint16_t tx;
                     uint16_t ty;
+                    uint8_t  r;
+                    uint8_t  g;
+                    uint8_t  b;
+                    uint8_t  a;
                 };
 
+                //! This constant provides the VBO vertex type.
+                const OpenGL::VBOType vboType = OpenGL::VBOType::Pos2_F32_UV_U16_Color_U8;
+
+                //! This class provides a per-frame arena for render primitives. The
+                //! memory blocks are kept between frames so that after the first few
+                //! frames drawing does not allocate.
+                class PrimitiveArena
+                {
+                    DJV_NON_COPYABLE(PrimitiveArena);
+
+                public:
+                    PrimitiveArena()
+                    {}
+
+                    template<typename T>
+                    T* create()
+                    {
+                        static_assert(alignof(T) <= alignof(std::max_align_t), "Unsupported alignment");
+                        static_assert(sizeof(T) <= primitiveArenaBlockSize, "Unsupported size");
+                        if (_blocks.empty())
+                        {
+                            _blocks.emplace_back(new uint8_t[primitiveArenaBlockSize]);
+                        }
+                        size_t offset = (_offset + alignof(T) - 1) / alignof(T) * alignof(T);
+                        if (offset + sizeof(T) > primitiveArenaBlockSize)
+                        {
+                            ++_block;
+                            if (_block >= _blocks.size())
+                            {
+                                _blocks.emplace_back(new uint8_t[primitiveArenaBlockSize]);
+                            }
+                            offset = 0;
+                        }
+                        T* out = new (_blocks[_block].get() + offset) T;
+                        _offset = offset + sizeof(T);
+                        return out;
+                    }
+
+                    //! Release the memory for re-use. The primitives must already
+                    //! be destroyed.
+                    void clear()
+                    {
+                        _block = 0;
+                        _offset = 0;
+                    }
+
+                    size_t getByteCount() const
+                    {
+                        return _blocks.size() * primitiveArenaBlockSize;
+                    }
+
+                private:
+                    std::vector<std::unique_ptr<uint8_t[]> > _blocks;
+                    size_t _block = 0;
+                    size_t _offset = 0;
+                };
+
+                //! This struct provides a run of primitives that are drawn together.
+                struct PrimitiveBatch
+                {
+                    Primitive* primitive = nullptr;
+                    size_t     vaoSize   = 0;
+                };
+
+                //! Hash with FNV-1a so the values do not change between builds.
+                const uint64_t fnvOffset = 14695981039346656037ULL;
+
+                uint64_t hash(uint64_t value, const std::string& data)
+                {
+                    for (const auto i : data)
+                    {
+                        value ^= static_cast<uint8_t>(i);
+                        value *= 1099511628211ULL;
+                    }
+                    return value;
+                }
+
+                std::string getHashString(uint64_t value)
+                {
+                    std::stringstream ss;
+                    ss << std::hex << std::setfill('0') << std::setw(16) << value;
+                    return ss.str();
+                }
+
 #if !defined(DJV_OPENGL_ES2)
 
                 //! This class provides a 3D lookup table for color space conversions.
@@ -264,9 +407,7 @@ namespace djv
 
                 public:
                     explicit LUT3D(size_t edgeLen = lut3DSize) :
-                        _edgeLen(edgeLen),
-                        _size(3 * edgeLen * edgeLen * edgeLen),
-                        _data(new float[_size])
+                        _edgeLen(edgeLen)
                     {
                         glGenTextures(1, &_id);
                         glBindTexture(GL_TEXTURE_3D, _id);
@@ -296,16 +437,12 @@ namespace djv
                             glDeleteTextures(1, &_id);
                             _id = 0;
                         }
-                        delete[] _data;
                     }
 
                     size_t getEdgeLen() const { return _edgeLen; }
-                    size_t getSize() const { return _size; }
-                    float* getData() { return _data; }
-                    const float* getData() const { return _data; }
                     GLuint getID() const { return _id; }
 
-                    void copy()
+                    void copy(const std::vector<float>& data)
                     {
                         glBindTexture(GL_TEXTURE_3D, _id);
                         glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
@@ -324,7 +461,7 @@ namespace djv
                             _edgeLen,
                             GL_RGB,
                             GL_FLOAT,
-                            _data);
+                            data.data());
                     }
 
                     void bind()
@@ -334,22 +471,47 @@ namespace djv
 
                 private:
                     size_t _edgeLen = 0;
-                    size_t _size = 0;
-                    float* _data = nullptr;
                     GLuint _id = 0;
                 };
 
-                //! This variable provides color space conversion ids.
-                size_t colorSpaceID = 1;
-
                 //! This struct provides data for color space conversions.
                 struct ColorSpaceData
                 {
-                    size_t                  id;
+                    uint8_t                 id          = 0;
+                    std::string             functionName;
                     std::string             shaderSource;
+                    std::vector<float>      lut3DData;
                     std::shared_ptr<LUT3D>  lut3D;
+                    size_t                  frame       = 0;
                 };
 
+                //! Create the shader source and the 3D lookup table for a color
+                //! space conversion. This function does not use OpenGL so it can
+                //! be run on a background thread.
+                ColorSpaceData getColorSpaceData(const OCIO::Convert& convert)
+                {
+                    ColorSpaceData out;
+                    uint64_t value = fnvOffset;
+                    value = hash(value, convert.input);
+                    value = hash(value, convert.output);
+                    out.functionName = "colorSpace_" + getHashString(value);
+                    auto config = _OCIO::GetCurrentConfig();
+                    auto processor = config->getProcessor(convert.input.c_str(), convert.output.c_str());
+                    _OCIO::GpuShaderDesc shaderDesc;
+                    shaderDesc.setLanguage(_OCIO::GPU_LANGUAGE_GLSL_1_3);
+                    shaderDesc.setFunctionName(out.functionName.c_str());
+                    shaderDesc.setLut3DEdgeLen(lut3DSize);
+                    out.shaderSource = processor->getGpuShaderText(shaderDesc);
+                    size_t index = out.shaderSource.find("texture3D");
+                    if (index != std::string::npos)
+                    {
+                        out.shaderSource.replace(index, std::string("texture3D").size(), "texture");
+                    }
+                    out.lut3DData.resize(3 * lut3DSize * lut3DSize * lut3DSize);
+                    processor->getGpuLut3D(out.lut3DData.data(), shaderDesc);
+                    return out;
+                }
+
 #endif // DJV_OPENGL_ES2
 
                 // Utility function to flip the y-coordinate.
@@ -446,6 +608,67 @@ namespace djv
                     saturationMatrix(in.saturation, in.saturation, in.saturation);
             }
 
+            glm::vec4 applyImageOptions(const glm::vec4& value, const ImageOptions& options)
+            {
+                glm::vec4 out = value;
+                if (options.colorEnabled && options.color != ImageColor())
+                {
+                    const float a = out[3];
+                    out[3] = 1.F;
+                    out = out * colorMatrix(options.color);
+                    out[3] = a;
+                }
+                if (options.colorEnabled && options.color.invert)
+                {
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        out[i] = 1.F - out[i];
+                    }
+                }
+                if (options.levelsEnabled && options.levels != ImageLevels())
+                {
+                    const auto& levels = options.levels;
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        float tmp = (out[i] - levels.inLow) / levels.inHigh;
+                        if (tmp >= 0.F)
+                        {
+                            tmp = powf(tmp, 1.F / levels.gamma);
+                        }
+                        out[i] = tmp * levels.outHigh + levels.outLow;
+                    }
+                }
+                if (options.exposureEnabled)
+                {
+                    const auto& exposure = options.exposure;
+                    const float v = powf(2.F, exposure.exposure + 2.47393F);
+                    const float d = exposure.defog;
+                    const float k = powf(2.F, exposure.kneeLow);
+                    const float f = knee2(powf(2.F, exposure.kneeHigh) - k, powf(2.F, 3.5F) - k);
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        out[i] = std::max(0.F, out[i] - d) * v;
+                        if (out[i] > k)
+                        {
+                            out[i] = k + knee(out[i] - k, f);
+                        }
+                        out[i] *= .332F;
+                    }
+                }
+                if (options.softClipEnabled && options.softClip > 0.F)
+                {
+                    const float tmp = 1.F - options.softClip;
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        if (out[i] > tmp)
+                        {
+                            out[i] = tmp + (1.F - expf(-(out[i] - tmp) / options.softClip)) * options.softClip;
+                        }
+                    }
+                }
+                return out;
+            }
+
             GLenum toGL(ImageFilter value)
             {
                 GLenum out = GL_NONE;
@@ -464,9 +687,15 @@ namespace djv
 
                 ImageFilterOptions                      imageFilterOptions  = ImageFilterOptions(ImageFilter::Linear, ImageFilter::Nearest);
                 bool                                    textLCDRendering    = true;
+                bool                                    primitiveBatching   = true;
 
                 BBox2f                                              viewport;
+                std::vector<BBox2f>                                 regions;
+                PrimitiveArena                                      primitiveArena;
                 std::vector<Primitive*>                             primitives;
+                std::vector<PrimitiveBatch>                         batches;
+                size_t                                              primitiveCount      = 0;
+                size_t                                              drawCount           = 0;
                 PrimitiveData                                       primitiveData;
                 std::shared_ptr<OpenGL::TextureAtlas>               textureAtlas;
                 std::map<UID, uint64_t>                             textureIDs;
@@ -475,7 +704,17 @@ namespace djv
                 std::map<UID, std::shared_ptr<OpenGL::Texture> >    dynamicTextureCache;
 #if !defined(DJV_OPENGL_ES2)
                 std::map<OCIO::Convert, ColorSpaceData>             colorSpaceCache;
+                std::map<OCIO::Convert, std::future<ColorSpaceData> > colorSpaceFutures;
+                std::vector<std::future<ColorSpaceData> >           colorSpaceFuturesStale;
+                std::set<OCIO::Convert>                             colorSpaceErrors;
+                std::map<UID, OCIO::Convert>                        colorSpaceImages;
+                std::map<UID, OCIO::Convert>                        colorSpaceImagesPrevious;
+                std::shared_ptr<ValueObserver<OCIO::Config> >       ocioConfigObserver;
+                std::shared_ptr<OpenGL::PixelBufferRing>            pixelBufferRing;
 #endif // DJV_OPENGL_ES2
+                std::shared_ptr<ValueSubject<bool> >                colorSpacesChanged;
+                size_t                                              frame               = 0;
+                Time::Duration                                      uploadWaitTime      = Time::Duration::zero();
                 std::vector<uint8_t>                                vboData;
                 size_t                                              vboDataSize         = 0;
                 std::shared_ptr<OpenGL::VBO>                        vbo;
@@ -485,11 +724,15 @@ namespace djv
                 std::string                                         fragmentFileName;
                 std::string                                         fragmentSource;
                 std::shared_ptr<OpenGL::Shader>                     shader;
+                Memory::Cache<uint64_t, std::shared_ptr<OpenGL::Shader> > shaderCache;
+                std::string                                         shaderCacheKey;
+                std::string                                         shaderCachePath;
+                size_t                                              shaderCacheTempCount = 0;
                 GLint                                               mvpLoc              = 0;
 
                 std::shared_ptr<Time::Timer>                        statsTimer;
 
-                void updateVBODataSize(size_t);
+                VBOVertex* addVertices(size_t, const float color[4]);
 
                 void drawImage(
                     const std::shared_ptr<Image::Image>&,
@@ -500,7 +743,19 @@ namespace djv
                     const BBox2f& currentClipRect,
                     const float finalColor[4]);
 
+#if !defined(DJV_OPENGL_ES2)
+                void colorSpaceCacheUpdate();
+                void colorSpaceConfigUpdate();
+#endif // DJV_OPENGL_ES2
+
                 std::string getFragmentSource() const;
+                std::shared_ptr<OpenGL::Shader> getShader();
+#if !defined(DJV_OPENGL_ES2)
+                void readShaderBinary(uint64_t, const std::shared_ptr<AV::Render::Shader>&, std::shared_ptr<OpenGL::Shader>&);
+                void writeShaderBinary(uint64_t, const std::shared_ptr<OpenGL::Shader>&);
+                void writeShaderFile(uint64_t, GLenum, const std::vector<uint8_t>&);
+                void trimShaderFiles(bool temp);
+#endif // DJV_OPENGL_ES2
             };
 
             void Render::_init(const std::shared_ptr<Core::Context>& context)
@@ -510,6 +765,7 @@ namespace djv
                 p.system = this;
 
                 addDependency(context->getSystemT<AV::GLFW::System>());
+                addDependency(context->getSystemT<AV::OCIO::System>());
 
                 GLint maxTextureUnits = 0;
                 GLint maxTextureSize = 0;
@@ -538,6 +794,9 @@ namespace djv
                     GL_NEAREST,
                     0));
                 p.primitiveData.textureAtlasCount = _textureAtlasCount;
+#if !defined(DJV_OPENGL_ES2)
+                p.pixelBufferRing = OpenGL::PixelBufferRing::create(pixelBufferCount);
+#endif // DJV_OPENGL_ES2
 
                 _updateImageFilter();
 
@@ -559,6 +818,52 @@ namespace djv
                     logSystem->log("djv::AV::Render::Render2D", e.what(), LogLevel::Error);
                 }
 
+                p.colorSpacesChanged = ValueSubject<bool>::create();
+
+                // The linked shader programs are cached in memory and on disk.
+                // The disk cache key includes the driver information since
+                // program binaries are not portable between drivers.
+                p.shaderCache.setMax(shaderCacheMax);
+                for (const auto i : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+                {
+                    if (const GLubyte* value = glGetString(i))
+                    {
+                        p.shaderCacheKey += reinterpret_cast<const char*>(value);
+                    }
+                }
+#if !defined(DJV_OPENGL_ES2)
+                try
+                {
+                    const FileSystem::Path path(resourceSystem->getPath(FileSystem::ResourcePath::Documents), "ShaderCache");
+                    if (!FileSystem::FileInfo(path).doesExist())
+                    {
+                        FileSystem::Path::mkdir(path);
+                    }
+                    p.shaderCachePath = path.get();
+                    p.trimShaderFiles(true);
+                }
+                catch (const std::exception& e)
+                {
+                    auto logSystem = context->getSystemT<LogSystem>();
+                    logSystem->log("djv::AV::Render::Render2D", e.what(), LogLevel::Warning);
+                }
+#endif // DJV_OPENGL_ES2
+
+#if !defined(DJV_OPENGL_ES2)
+                // The color space conversions depend on the OCIO configuration
+                // so they are created again when it changes.
+                auto weak = std::weak_ptr<Render>(std::dynamic_pointer_cast<Render>(shared_from_this()));
+                p.ocioConfigObserver = ValueObserver<OCIO::Config>::create(
+                    context->getSystemT<AV::OCIO::System>()->observeCurrentConfig(),
+                    [weak](const OCIO::Config&)
+                    {
+                        if (auto system = weak.lock())
+                        {
+                            system->_p->colorSpaceConfigUpdate();
+                        }
+                    });
+#endif // DJV_OPENGL_ES2
+
                 p.statsTimer = Time::Timer::create(context);
                 p.statsTimer->setRepeating(true);
                 p.statsTimer->start(
@@ -574,8 +879,14 @@ namespace djv
                         ss << "Dynamic texture cache: " << p.dynamicTextureCache.size() << "\n";
 #if !defined(DJV_OPENGL_ES2)
                         ss << "Color space cache: " << p.colorSpaceCache.size() << "\n";
+                        ss << "Color space futures: " << p.colorSpaceFutures.size() << "\n";
 #endif // DJV_OPENGL_ES2
-                        ss << "VBO size: " << (p.vbo ? p.vbo->getSize() : 0);
+                        ss << "Shader cache: " << p.shaderCache.getSize() << "\n";
+                        ss << "VBO size: " << (p.vbo ? p.vbo->getSize() : 0) << "\n";
+                        ss << "Primitive arena: " << p.primitiveArena.getByteCount() << "\n";
+                        ss << "Primitives: " << p.primitiveCount << "\n";
+                        ss << "Draws: " << p.drawCount << "\n";
+                        ss << "Upload wait: " << p.uploadWaitTime.count() << "us";
                         _log(ss.str());
                     });
             }
@@ -594,12 +905,73 @@ namespace djv
                 return out;
             }
 
+            void Render::tick()
+            {
+#if !defined(DJV_OPENGL_ES2)
+                DJV_PRIVATE_PTR();
+                auto j = p.colorSpaceFuturesStale.begin();
+                while (j != p.colorSpaceFuturesStale.end())
+                {
+                    if (!j->valid() ||
+                        j->wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                    {
+                        j = p.colorSpaceFuturesStale.erase(j);
+                    }
+                    else
+                    {
+                        ++j;
+                    }
+                }
+                bool changed = false;
+                auto i = p.colorSpaceFutures.begin();
+                while (i != p.colorSpaceFutures.end())
+                {
+                    if (i->second.valid() &&
+                        i->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                    {
+                        try
+                        {
+                            auto data = i->second.get();
+                            data.lut3D.reset(new LUT3D);
+                            data.lut3D->copy(data.lut3DData);
+                            data.lut3DData = std::vector<float>();
+                            data.frame = p.frame;
+                            p.colorSpaceCache[i->first] = data;
+                            changed = true;
+                        }
+                        catch (const std::exception& e)
+                        {
+                            p.colorSpaceErrors.insert(i->first);
+                            _log(e.what(), LogLevel::Error);
+                        }
+                        i = p.colorSpaceFutures.erase(i);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+                if (changed)
+                {
+                    p.colorSpaceCacheUpdate();
+                    p.colorSpacesChanged->setAlways(true);
+                }
+#endif // DJV_OPENGL_ES2
+            }
+
             void Render::beginFrame(const Image::Size& size)
+            {
+                const BBox2f viewport(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
+                beginFrame(size, { viewport });
+            }
+
+            void Render::beginFrame(const Image::Size& size, const std::vector<BBox2f>& regions)
             {
                 DJV_PRIVATE_PTR();
                 _size = size;
                 _currentClipRect = BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
                 p.viewport = BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
+                p.regions = regions;
             }
 
             void Render::endFrame()
@@ -607,15 +979,11 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (!p.shader)
                 {
-                    auto shader = AV::Render::Shader::create(p.vertexSource, p.getFragmentSource());
-                    shader->setVertexName(p.vertexFileName);
-                    shader->setFragmentName(p.fragmentFileName);
-                    p.shader = OpenGL::Shader::create(shader);
+                    p.shader = p.getShader();
                     const auto program = p.shader->getProgram();
                     p.mvpLoc = glGetUniformLocation(program, "transform.mvp");
                     p.primitiveData.imageChannelsLoc = glGetUniformLocation(program, "imageChannels");
                     p.primitiveData.colorModeLoc = glGetUniformLocation(program, "colorMode");
-                    p.primitiveData.colorLoc = glGetUniformLocation(program, "color");
 #if !defined(DJV_OPENGL_ES2)
                     p.primitiveData.colorSpaceLoc = glGetUniformLocation(program, "colorSpace");
                     p.primitiveData.colorSpaceSamplerLoc = glGetUniformLocation(program, "colorSpaceSampler");
@@ -637,6 +1005,9 @@ namespace djv
                     p.primitiveData.exposureEnabledLoc = glGetUniformLocation(program, "exposureEnabled");
                     p.primitiveData.softClipLoc = glGetUniformLocation(program, "softClip");
                     p.primitiveData.textureSamplerLoc = glGetUniformLocation(program, "textureSampler");
+                    p.primitiveData.imageYUVLoc = glGetUniformLocation(program, "imageYUV");
+                    p.primitiveData.textureSamplerULoc = glGetUniformLocation(program, "textureSamplerU");
+                    p.primitiveData.textureSamplerVLoc = glGetUniformLocation(program, "textureSamplerV");
                 }
                 p.shader->bind();
 
@@ -652,13 +1023,17 @@ namespace djv
                     static_cast<GLint>(p.viewport.min.y),
                     static_cast<GLsizei>(p.viewport.w()),
                     static_cast<GLsizei>(p.viewport.h()));
-                glScissor(
-                    static_cast<GLint>(p.viewport.min.x),
-                    static_cast<GLint>(p.viewport.min.y),
-                    static_cast<GLsizei>(p.viewport.w()),
-                    static_cast<GLsizei>(p.viewport.h()));
                 glClearColor(0.F, 0.F, 0.F, 0.F);
-                glClear(GL_COLOR_BUFFER_BIT);
+                for (const auto& i : p.regions)
+                {
+                    const BBox2f region = flip(i, _size);
+                    glScissor(
+                        static_cast<GLint>(region.min.x),
+                        static_cast<GLint>(region.min.y),
+                        static_cast<GLsizei>(region.w()),
+                        static_cast<GLsizei>(region.h()));
+                    glClear(GL_COLOR_BUFFER_BIT);
+                }
 
                 const auto viewMatrix = glm::ortho(
                     p.viewport.min.x,
@@ -675,22 +1050,50 @@ namespace djv
                     glBindTexture(GL_TEXTURE_2D, atlasTextures[i]);
                 }
 
-                const size_t vertexByteCount = AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                const size_t vertexByteCount = AV::OpenGL::getVertexByteCount(vboType);
                 if (!p.vbo || p.vboDataSize / vertexByteCount > p.vbo->getSize())
                 {
-                    p.vbo = OpenGL::VBO::create(p.vboDataSize / vertexByteCount, OpenGL::VBOType::Pos2_F32_UV_U16);
+                    p.vbo = OpenGL::VBO::create(p.vboDataSize / vertexByteCount, vboType);
                     p.vao = OpenGL::VAO::create(p.vbo->getType(), p.vbo->getID());
                 }
                 p.vbo->copy(p.vboData, 0, p.vboDataSize);
                 p.vao->bind();
 
+                // Merge consecutive primitives that share the same state and
+                // vertex range into batches.
+                p.batches.clear();
+                for (const auto& primitive : p.primitives)
+                {
+                    if (!primitive->vaoSize)
+                    {
+                        continue;
+                    }
+                    if (p.primitiveBatching && !p.batches.empty())
+                    {
+                        auto& batch = p.batches.back();
+                        if (batch.primitive->isBatchable(*primitive) &&
+                            batch.primitive->vaoOffset + batch.vaoSize == primitive->vaoOffset)
+                        {
+                            batch.vaoSize += primitive->vaoSize;
+                            continue;
+                        }
+                    }
+                    PrimitiveBatch batch;
+                    batch.primitive = primitive;
+                    batch.vaoSize = primitive->vaoSize;
+                    p.batches.push_back(batch);
+                }
+
                 BBox2f currentClipRect(0.F, 0.F, 0.F, 0.F);
                 AlphaBlend currentAlphaBlend = AlphaBlend::Straight;
                 bool currentTextLCDRendering = false;
                 glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
                 glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-                for (const auto& primitive : p.primitives)
+                p.primitiveCount = p.primitives.size();
+                p.drawCount = 0;
+                for (const auto& batch : p.batches)
                 {
+                    const auto primitive = batch.primitive;
                     const BBox2f clipRect = flip(primitive->clipRect, _size);
                     if (clipRect != currentClipRect)
                     {
@@ -731,28 +1134,35 @@ namespace djv
                     {
                         p.shader->setUniform(p.primitiveData.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlphaR));
                         glColorMask(GL_TRUE, GL_FALSE, GL_FALSE, GL_TRUE);
-                        p.vao->draw(primitive->type, primitive->vaoOffset, primitive->vaoSize);
+                        p.vao->draw(primitive->type, primitive->vaoOffset, batch.vaoSize);
                         p.shader->setUniform(p.primitiveData.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlphaG));
                         glColorMask(GL_FALSE, GL_TRUE, GL_FALSE, GL_FALSE);
-                        p.vao->draw(primitive->type, primitive->vaoOffset, primitive->vaoSize);
+                        p.vao->draw(primitive->type, primitive->vaoOffset, batch.vaoSize);
                         p.shader->setUniform(p.primitiveData.colorModeLoc, static_cast<int>(ColorMode::ColorWithTextureAlphaB));
                         glColorMask(GL_FALSE, GL_FALSE, GL_TRUE, GL_FALSE);
-                        p.vao->draw(primitive->type, primitive->vaoOffset, primitive->vaoSize);
+                        p.vao->draw(primitive->type, primitive->vaoOffset, batch.vaoSize);
+                        p.drawCount += 3;
                     }
                     else
                     {
-                        p.vao->draw(primitive->type, primitive->vaoOffset, primitive->vaoSize);
+                        p.vao->draw(primitive->type, primitive->vaoOffset, batch.vaoSize);
+                        ++p.drawCount;
                     }
                 }
                 glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
                 _clipRects.clear();
-                for (size_t i = 0; i < p.primitives.size(); ++i)
+                for (const auto& primitive : p.primitives)
                 {
-                    delete p.primitives[i];
+                    primitive->~Primitive();
                 }
                 p.primitives.clear();
+                p.primitiveArena.clear();
                 p.vboDataSize = 0;
+#if !defined(DJV_OPENGL_ES2)
+                p.uploadWaitTime = p.pixelBufferRing->getWaitTime();
+                p.pixelBufferRing->resetWaitTime();
+#endif // DJV_OPENGL_ES2
                 while (p.dynamicTextureCache.size() > dynamicTextureCacheMax)
                 {
                     auto texture = p.dynamicTextureCache.begin();
@@ -764,14 +1174,34 @@ namespace djv
                     p.dynamicTextures.pop_back();
                 }
 #if !defined(DJV_OPENGL_ES2)
-                while (p.colorSpaceCache.size() > colorSpaceCacheMax)
+                if (p.colorSpaceCache.size() > colorSpaceCacheMax)
                 {
-                    p.colorSpaceCache.erase(p.colorSpaceCache.begin());
-                    p.shader.reset();
+                    // Remove the least recently used conversions.
+                    while (p.colorSpaceCache.size() > colorSpaceCacheMax)
+                    {
+                        auto oldest = p.colorSpaceCache.begin();
+                        for (auto i = p.colorSpaceCache.begin(); i != p.colorSpaceCache.end(); ++i)
+                        {
+                            if (i->second.frame < oldest->second.frame)
+                            {
+                                oldest = i;
+                            }
+                        }
+                        p.colorSpaceCache.erase(oldest);
+                    }
+                    p.colorSpaceCacheUpdate();
                 }
+                p.colorSpaceImagesPrevious.clear();
+                p.colorSpaceImagesPrevious.swap(p.colorSpaceImages);
 #endif // DJV_OPENGL_ES2
+                ++p.frame;
             }
             
+            void Render::setPrimitiveBatching(bool value)
+            {
+                _p->primitiveBatching = value;
+            }
+
             void Render::drawPolyline(const std::vector<glm::vec2>& value)
             {
                 DJV_PRIVATE_PTR();
@@ -804,21 +1234,15 @@ namespace djv
                     }
                     if (bbox.intersects(_currentClipRect))
                     {
-                        auto primitive = new Primitive;
+                        auto primitive = p.primitiveArena.create<Primitive>();
                         primitive->clipRect = _currentClipRect;
-                        primitive->color[0] = _finalColor[0];
-                        primitive->color[1] = _finalColor[1];
-                        primitive->color[2] = _finalColor[2];
-                        primitive->color[3] = _finalColor[3];
                         primitive->type = GL_TRIANGLE_STRIP;
-                        primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                        primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(vboType);
                         primitive->vaoSize = ptsSize;
                         p.primitives.push_back(primitive);
 
-                        const size_t vboDataOffset = p.vboDataSize;
-                        p.updateVBODataSize(ptsSize);
                         const glm::vec2* pPts = pts.data();
-                        VBOVertex* pData = reinterpret_cast<VBOVertex*>(&p.vboData[vboDataOffset]);
+                        VBOVertex* pData = p.addVertices(ptsSize, _finalColor);
                         for (size_t i = 0; i < size; ++i, pPts += 2)
                         {
                             pData->vx = pPts[0].x;
@@ -840,13 +1264,9 @@ namespace djv
             void Render::drawRects(const std::vector<BBox2f>& value)
             {
                 DJV_PRIVATE_PTR();
-                auto primitive = new Primitive;
+                auto primitive = p.primitiveArena.create<Primitive>();
                 primitive->clipRect = _currentClipRect;
-                primitive->color[0] = _finalColor[0];
-                primitive->color[1] = _finalColor[1];
-                primitive->color[2] = _finalColor[2];
-                primitive->color[3] = _finalColor[3];
-                primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(vboType);
                 primitive->vaoSize = 0;
                 p.primitives.push_back(primitive);
 
@@ -856,9 +1276,7 @@ namespace djv
                     {
                         primitive->vaoSize += 6;
 
-                        const size_t vboDataOffset = p.vboDataSize;
-                        p.updateVBODataSize(6);
-                        VBOVertex* pData = reinterpret_cast<VBOVertex*>(&p.vboData[vboDataOffset]);
+                        VBOVertex* pData = p.addVertices(6, _finalColor);
                         pData->vx = i.min.x;
                         pData->vy = i.min.y;
                         ++pData;
@@ -886,21 +1304,15 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (rect.intersects(_currentClipRect))
                 {
-                    auto primitive = new Primitive;
+                    auto primitive = p.primitiveArena.create<Primitive>();
                     primitive->clipRect = _currentClipRect;
-                    primitive->color[0] = _finalColor[0];
-                    primitive->color[1] = _finalColor[1];
-                    primitive->color[2] = _finalColor[2];
-                    primitive->color[3] = _finalColor[3];
-                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(vboType);
                     primitive->vaoSize = 3 * 2 + facets * 2 * 3;
                     p.primitives.push_back(primitive);
 
-                    const size_t vboDataOffset = p.vboDataSize;
-                    p.updateVBODataSize(primitive->vaoSize);
                     const float h = rect.h();
                     const float radius = h / 2.F;
-                    VBOVertex* pData = reinterpret_cast<VBOVertex*>(&p.vboData[vboDataOffset]);
+                    VBOVertex* pData = p.addVertices(primitive->vaoSize, _finalColor);
                     pData->vx = rect.min.x + radius;
                     pData->vy = rect.min.y;
                     ++pData;
@@ -962,21 +1374,15 @@ namespace djv
                 const BBox2f rect(pos.x - radius, pos.y - radius, radius * 2.F, radius * 2.F);
                 if (rect.intersects(_currentClipRect))
                 {
-                    auto primitive = new Primitive;
+                    auto primitive = p.primitiveArena.create<Primitive>();
                     primitive->clipRect = _currentClipRect;
-                    primitive->color[0] = _finalColor[0];
-                    primitive->color[1] = _finalColor[1];
-                    primitive->color[2] = _finalColor[2];
-                    primitive->color[3] = _finalColor[3];
                     //! \todo Implement me!
                     //primitive->type = GL_TRIANGLE_FAN;
-                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(vboType);
                     primitive->vaoSize = 3 * facets;
                     p.primitives.push_back(primitive);
 
-                    const size_t vboDataOffset = p.vboDataSize;
-                    p.updateVBODataSize(3 * facets);
-                    VBOVertex* pData = reinterpret_cast<VBOVertex*>(&p.vboData[vboDataOffset]);
+                    VBOVertex* pData = p.addVertices(3 * facets, _finalColor);
                     for (size_t i = 0; i < facets * 3; i += 3)
                     {
                         pData->vx = pos.x;
@@ -1026,6 +1432,11 @@ namespace djv
                 p.drawImage(image, pos, options, ColorMode::ColorWithTextureAlpha, _getCurrentTransform(), _currentClipRect, _finalColor);
             }
 
+            std::shared_ptr<Core::IValueSubject<bool> > Render::observeColorSpacesChanged() const
+            {
+                return _p->colorSpacesChanged;
+            }
+
             void Render::setTextLCDRendering(bool value)
             {
                 _p->textLCDRendering = value;
@@ -1077,14 +1488,10 @@ namespace djv
 
                                 if (!primitive || item.textureIndex != textureIndex)
                                 {
-                                    primitive = new TextPrimitive;
+                                    primitive = p.primitiveArena.create<TextPrimitive>();
                                     primitive->clipRect = _currentClipRect;
-                                    primitive->color[0] = _finalColor[0];
-                                    primitive->color[1] = _finalColor[1];
-                                    primitive->color[2] = _finalColor[2];
-                                    primitive->color[3] = _finalColor[3];
                                     primitive->atlasIndex = item.textureIndex;
-                                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(vboType);
                                     primitive->vaoSize = 0;
                                     primitive->textLCDRendering = p.textLCDRendering;
                                     p.primitives.push_back(primitive);
@@ -1092,9 +1499,7 @@ namespace djv
                                 }
 
                                 primitive->vaoSize += 6;
-                                const size_t vboDataOffset = p.vboDataSize;
-                                p.updateVBODataSize(6);
-                                VBOVertex* pData = reinterpret_cast<VBOVertex*>(&p.vboData[vboDataOffset]);
+                                VBOVertex* pData = p.addVertices(6, _finalColor);
                                 pData->vx = bbox.min.x;
                                 pData->vy = bbox.min.y;
                                 pData->tx = static_cast<uint16_t>(item.textureU.getMin() * 65535.F);
@@ -1137,15 +1542,11 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (value.intersects(_currentClipRect))
                 {
-                    auto primitive = new ShadowPrimitive;
+                    auto primitive = p.primitiveArena.create<Primitive>();
                     primitive->clipRect = _currentClipRect;
-                    primitive->color[0] = _finalColor[0];
-                    primitive->color[1] = _finalColor[1];
-                    primitive->color[2] = _finalColor[2];
-                    primitive->color[3] = _finalColor[3];
-                    primitive->type = GL_TRIANGLE_STRIP;
-                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
-                    primitive->vaoSize = 4;
+                    primitive->colorMode = ColorMode::Shadow;
+                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(vboType);
+                    primitive->vaoSize = 6;
                     p.primitives.push_back(primitive);
 
                     static const uint16_t u[][4] =
@@ -1157,9 +1558,7 @@ namespace djv
                         { 65535, 65535,     0,     0 }
                     };
 
-                    const size_t vboDataOffset = p.vboDataSize;
-                    p.updateVBODataSize(4);
-                    VBOVertex* pData = reinterpret_cast<VBOVertex*>(&p.vboData[vboDataOffset]);
+                    VBOVertex* pData = p.addVertices(6, _finalColor);
                     pData->vx = value.min.x;
                     pData->vy = value.min.y;
                     pData->tx = u[static_cast<size_t>(side)][0];
@@ -1172,6 +1571,14 @@ namespace djv
                     pData->vy = value.max.y;
                     pData->tx = u[static_cast<size_t>(side)][2];
                     ++pData;
+                    pData->vx = value.min.x;
+                    pData->vy = value.max.y;
+                    pData->tx = u[static_cast<size_t>(side)][2];
+                    ++pData;
+                    pData->vx = value.max.x;
+                    pData->vy = value.min.y;
+                    pData->tx = u[static_cast<size_t>(side)][1];
+                    ++pData;
                     pData->vx = value.max.x;
                     pData->vy = value.max.y;
                     pData->tx = u[static_cast<size_t>(side)][3];
@@ -1183,19 +1590,14 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (value.intersects(_currentClipRect))
                 {
-                    auto primitive = new ShadowPrimitive;
+                    auto primitive = p.primitiveArena.create<Primitive>();
                     primitive->clipRect = _currentClipRect;
-                    primitive->color[0] = _finalColor[0];
-                    primitive->color[1] = _finalColor[1];
-                    primitive->color[2] = _finalColor[2];
-                    primitive->color[3] = _finalColor[3];
-                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                    primitive->colorMode = ColorMode::Shadow;
+                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(vboType);
                     primitive->vaoSize = 5 * 2 * 3 + 4 * facets * 3;
                     p.primitives.push_back(primitive);
 
-                    const size_t vboDataOffset = p.vboDataSize;
-                    p.updateVBODataSize(primitive->vaoSize);
-                    VBOVertex* pData = reinterpret_cast<VBOVertex*>(&p.vboData[vboDataOffset]);
+                    VBOVertex* pData = p.addVertices(primitive->vaoSize, _finalColor);
 
                     // Center.
                     pData->vx = value.min.x + radius;
@@ -1418,22 +1820,16 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (value.intersects(_currentClipRect))
                 {
-                    auto primitive = new TexturePrimitive;
+                    auto primitive = p.primitiveArena.create<TexturePrimitive>();
                     p.primitives.push_back(primitive);
                     primitive->clipRect = _currentClipRect;
-                    primitive->color[0] = _finalColor[0];
-                    primitive->color[1] = _finalColor[1];
-                    primitive->color[2] = _finalColor[2];
-                    primitive->color[3] = _finalColor[3];
                     primitive->type = GL_TRIANGLE_STRIP;
-                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                    primitive->vaoOffset = p.vboDataSize / AV::OpenGL::getVertexByteCount(vboType);
                     primitive->vaoSize = 4;
                     primitive->textureID = textureID;
                     primitive->target = target;
 
-                    const size_t vboDataOffset = p.vboDataSize;
-                    p.updateVBODataSize(4);
-                    VBOVertex* pData = reinterpret_cast<VBOVertex*>(&p.vboData[vboDataOffset]);
+                    VBOVertex* pData = p.addVertices(4, _finalColor);
                     pData->vx = value.min.x;
                     pData->vy = value.min.y;
                     pData->tx = 0;
@@ -1471,6 +1867,21 @@ namespace djv
                 return _p->vbo ? _p->vbo->getSize() : 0;
             }
 
+            size_t Render::getPrimitiveCount() const
+            {
+                return _p->primitiveCount;
+            }
+
+            size_t Render::getDrawCount() const
+            {
+                return _p->drawCount;
+            }
+
+            const Time::Duration& Render::getUploadWaitTime() const
+            {
+                return _p->uploadWaitTime;
+            }
+
             void Render::_updateImageFilter()
             {
                 DJV_PRIVATE_PTR();
@@ -1486,14 +1897,31 @@ namespace djv
                 }
             }
 
-            void Render::Private::updateVBODataSize(size_t value)
+            VBOVertex* Render::Private::addVertices(size_t value, const float color[4])
             {
-                const size_t vertexByteCount = AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                const size_t vertexByteCount = AV::OpenGL::getVertexByteCount(vboType);
+                const size_t offset = vboDataSize;
                 vboDataSize += value * vertexByteCount;
                 if (vboDataSize > vboData.size())
                 {
                     vboData.resize(vboDataSize);
                 }
+                const uint8_t r = static_cast<uint8_t>(Math::clamp(color[0], 0.F, 1.F) * 255.F + .5F);
+                const uint8_t g = static_cast<uint8_t>(Math::clamp(color[1], 0.F, 1.F) * 255.F + .5F);
+                const uint8_t b = static_cast<uint8_t>(Math::clamp(color[2], 0.F, 1.F) * 255.F + .5F);
+                const uint8_t a = static_cast<uint8_t>(Math::clamp(color[3], 0.F, 1.F) * 255.F + .5F);
+                VBOVertex* out = reinterpret_cast<VBOVertex*>(&vboData[offset]);
+                VBOVertex* pData = out;
+                for (size_t i = 0; i < value; ++i, ++pData)
+                {
+                    pData->tx = 0;
+                    pData->ty = 0;
+                    pData->r = r;
+                    pData->g = g;
+                    pData->b = b;
+                    pData->a = a;
+                }
+                return out;
             }
 
             void Render::Private::drawImage(
@@ -1538,15 +1966,11 @@ namespace djv
 
                 if (bbox.intersects(currentClipRect))
                 {
-                    auto primitive = new ImagePrimitive;
+                    auto primitive = primitiveArena.create<ImagePrimitive>();
                     primitives.push_back(primitive);
                     primitive->clipRect = currentClipRect;
                     primitive->imageChannels = Image::getChannels(info.type);
                     primitive->colorMode = colorMode;
-                    primitive->color[0] = finalColor[0];
-                    primitive->color[1] = finalColor[1];
-                    primitive->color[2] = finalColor[2];
-                    primitive->color[3] = finalColor[3];
                     primitive->imageChannelDisplay = options.channelDisplay;
                     primitive->alphaBlend = options.alphaBlend;
                     primitive->colorMatrixEnabled = options.colorEnabled && options.color != ImageColor();
@@ -1573,11 +1997,15 @@ namespace djv
                             powf(2.F, 3.5F) - primitive->exposureK);
                     }
                     primitive->softClip = options.softClipEnabled ? options.softClip : 0.F;
-                    primitive->imageCache = options.cache;
+                    // Planar YUV images are converted to RGB in the shader. The
+                    // planes are stored in separate textures so they can't be
+                    // added to the texture atlas.
+                    primitive->imageYUV = Image::isYUVType(info.type);
+                    primitive->imageCache = primitive->imageYUV ? ImageCache::Dynamic : options.cache;
                     float textureU[2] = { 0.F, 0.F };
                     float textureV[2] = { 0.F, 0.F };
                     const UID uid = image->getUID();
-                    switch (options.cache)
+                    switch (primitive->imageCache)
                     {
                     case ImageCache::Atlas:
                     {
@@ -1618,13 +2046,13 @@ namespace djv
                     case ImageCache::Dynamic:
                     {
                         const auto i = dynamicTextureCache.find(uid);
+                        std::shared_ptr<OpenGL::Texture> texture;
                         if (i != dynamicTextureCache.end())
                         {
-                            primitive->textureID = i->second->getID();
+                            texture = i->second;
                         }
                         else
                         {
-                            std::shared_ptr<OpenGL::Texture> texture;
                             if (dynamicTextures.size())
                             {
                                 texture = dynamicTextures.back();
@@ -1635,9 +2063,18 @@ namespace djv
                             {
                                 texture = OpenGL::Texture::create(image->getInfo(), GL_LINEAR, GL_NEAREST);
                             }
+#if defined(DJV_OPENGL_ES2)
                             texture->copy(*image);
+#else // DJV_OPENGL_ES2
+                            pixelBufferRing->copy(*image, *texture);
+#endif // DJV_OPENGL_ES2
                             dynamicTextureCache[uid] = texture;
-                            primitive->textureID = texture->getID();
+                        }
+                        primitive->textureID = texture->getPlaneID(0);
+                        if (primitive->imageYUV)
+                        {
+                            primitive->textureIDU = texture->getPlaneID(1);
+                            primitive->textureIDV = texture->getPlaneID(2);
                         }
                         if (info.layout.mirror.x)
                         {
@@ -1676,54 +2113,43 @@ namespace djv
 #if !defined(DJV_OPENGL_ES2)
                     if (options.colorSpace.isValid())
                     {
-                        ColorSpaceData colorSpaceData;
-                        const auto i = colorSpaceCache.find(options.colorSpace);
-                        if (i != colorSpaceCache.end())
+                        auto i = colorSpaceCache.find(options.colorSpace);
+                        if (i == colorSpaceCache.end())
                         {
-                            colorSpaceData = i->second;
-                        }
-                        else
-                        {
-                            try
+                            // Create the conversion on a background thread and
+                            // use the conversion this image was last drawn with
+                            // until it is ready.
+                            if (colorSpaceFutures.find(options.colorSpace) == colorSpaceFutures.end() &&
+                                colorSpaceErrors.find(options.colorSpace) == colorSpaceErrors.end())
                             {
-                                colorSpaceData.id = colorSpaceID++;
-                                colorSpaceData.lut3D.reset(new LUT3D);
-                                auto config = _OCIO::GetCurrentConfig();
-                                auto processor = config->getProcessor(options.colorSpace.input.c_str(), options.colorSpace.output.c_str());
-                                _OCIO::GpuShaderDesc shaderDesc;
-                                shaderDesc.setLanguage(_OCIO::GPU_LANGUAGE_GLSL_1_3);
-                                std::stringstream ss;
-                                ss << "colorSpace" << colorSpaceData.id;
-                                shaderDesc.setFunctionName(ss.str().c_str());
-                                shaderDesc.setLut3DEdgeLen(colorSpaceData.lut3D->getEdgeLen());
-                                colorSpaceData.shaderSource = processor->getGpuShaderText(shaderDesc);
-                                size_t index = colorSpaceData.shaderSource.find("texture3D");
-                                if (index != std::string::npos)
-                                {
-                                    colorSpaceData.shaderSource.replace(index, std::string("texture3D").size(), "texture");
-                                }
-                                auto data = colorSpaceData.lut3D->getData();
-                                processor->getGpuLut3D(data, shaderDesc);
-                                colorSpaceData.lut3D->copy();
-                                colorSpaceCache[options.colorSpace] = colorSpaceData;
-                                shader.reset();
+                                const OCIO::Convert convert = options.colorSpace;
+                                colorSpaceFutures[convert] = std::async(
+                                    std::launch::async,
+                                    [convert]
+                                    {
+                                        return getColorSpaceData(convert);
+                                    });
                             }
-                            catch (const std::exception& e)
+                            const auto j = colorSpaceImagesPrevious.find(uid);
+                            if (j != colorSpaceImagesPrevious.end())
                             {
-                                system->_log(e.what());
+                                i = colorSpaceCache.find(j->second);
                             }
                         }
-                        primitive->colorSpace = colorSpaceData.id;
-                        primitive->colorSpaceTextureID = colorSpaceData.lut3D ? colorSpaceData.lut3D->getID() : 0;
+                        if (i != colorSpaceCache.end())
+                        {
+                            colorSpaceImages[uid] = i->first;
+                            i->second.frame = frame;
+                            primitive->colorSpace = i->second.id;
+                            primitive->colorSpaceTextureID = i->second.lut3D->getID();
+                        }
                     }
 #endif // DJV_OPENGL_ES2
                     primitive->type = GL_TRIANGLE_STRIP;
-                    primitive->vaoOffset = vboDataSize / AV::OpenGL::getVertexByteCount(OpenGL::VBOType::Pos2_F32_UV_U16);
+                    primitive->vaoOffset = vboDataSize / AV::OpenGL::getVertexByteCount(vboType);
                     primitive->vaoSize = 4;
 
-                    const size_t vboDataOffset = vboDataSize;
-                    updateVBODataSize(4);
-                    VBOVertex* pData = reinterpret_cast<VBOVertex*>(&vboData[vboDataOffset]);
+                    VBOVertex* pData = addVertices(4, finalColor);
                     pData->vx = pts[0].x;
                     pData->vy = pts[0].y;
                     pData->tx = static_cast<uint16_t>(textureU[0] * 65535.F);
@@ -1746,6 +2172,41 @@ namespace djv
                 }
             }
 
+#if !defined(DJV_OPENGL_ES2)
+            void Render::Private::colorSpaceCacheUpdate()
+            {
+                // The conversions are numbered in the order of the cache so
+                // the shader source only depends on which conversions are
+                // cached.
+                uint8_t id = 1;
+                for (auto& i : colorSpaceCache)
+                {
+                    i.second.id = id++;
+                }
+                shader.reset();
+            }
+
+            void Render::Private::colorSpaceConfigUpdate()
+            {
+                // Conversions that are still being created may use the
+                // previous configuration, so their results are discarded.
+                for (auto& i : colorSpaceFutures)
+                {
+                    colorSpaceFuturesStale.push_back(std::move(i.second));
+                }
+                colorSpaceFutures.clear();
+                colorSpaceErrors.clear();
+                colorSpaceImages.clear();
+                colorSpaceImagesPrevious.clear();
+                if (!colorSpaceCache.empty())
+                {
+                    colorSpaceCache.clear();
+                    colorSpaceCacheUpdate();
+                    colorSpacesChanged->setAlways(true);
+                }
+            }
+#endif // DJV_OPENGL_ES2
+
             std::string Render::Private::getFragmentSource() const
             {
                 std::string out = fragmentSource;
@@ -1761,14 +2222,14 @@ namespace djv
                         std::stringstream ss;
                         if (0 == i)
                         {
-                            ss << "    if (" << j.second.id << " == colorSpace)\n";
+                            ss << "    if (" << static_cast<int>(j.second.id) << " == colorSpace)\n";
                         }
                         else
                         {
-                            ss << "    else if (" << j.second.id << " == colorSpace)\n";
+                            ss << "    else if (" << static_cast<int>(j.second.id) << " == colorSpace)\n";
                         }
                         ss << "    {\n";
-                        ss << "        t = colorSpace" << j.second.id << "(t, colorSpaceSampler);\n";
+                        ss << "        t = " << j.second.functionName << "(t, colorSpaceSampler);\n";
                         ss << "    }\n";
                         body += ss.str();
                     }
@@ -1792,6 +2253,148 @@ namespace djv
                 return out;
             }
 
+            std::shared_ptr<OpenGL::Shader> Render::Private::getShader()
+            {
+                const std::string source = getFragmentSource();
+                uint64_t key = fnvOffset;
+                key = hash(key, shaderCacheKey);
+                key = hash(key, vertexSource);
+                key = hash(key, source);
+                std::shared_ptr<OpenGL::Shader> out;
+                if (!shaderCache.get(key, out))
+                {
+                    auto shader = AV::Render::Shader::create(vertexSource, source);
+                    shader->setVertexName(vertexFileName);
+                    shader->setFragmentName(fragmentFileName);
+#if !defined(DJV_OPENGL_ES2)
+                    readShaderBinary(key, shader, out);
+#endif // DJV_OPENGL_ES2
+                    if (!out)
+                    {
+                        out = OpenGL::Shader::create(shader);
+#if !defined(DJV_OPENGL_ES2)
+                        writeShaderBinary(key, out);
+#endif // DJV_OPENGL_ES2
+                    }
+                    shaderCache.add(key, out);
+                }
+                return out;
+            }
+
+#if !defined(DJV_OPENGL_ES2)
+            void Render::Private::readShaderBinary(
+                uint64_t key,
+                const std::shared_ptr<AV::Render::Shader>& shader,
+                std::shared_ptr<OpenGL::Shader>& out)
+            {
+                if (shaderCachePath.empty())
+                    return;
+                const std::string fileName = FileSystem::Path(shaderCachePath, getHashString(key) + shaderCacheExtension).get();
+                if (!FileSystem::FileInfo(fileName).doesExist())
+                    return;
+                try
+                {
+                    auto io = FileSystem::FileIO::create();
+                    io->open(fileName, FileSystem::FileIO::Mode::Read);
+                    uint32_t format = 0;
+                    io->readU32(&format);
+                    std::vector<uint8_t> binary(io->getSize() - io->getPos());
+                    io->read(binary.data(), binary.size());
+                    io->close();
+                    out = OpenGL::Shader::create(shader, static_cast<GLenum>(format), binary);
+
+                    // Write the file again so the modification time records
+                    // when it was last used.
+                    writeShaderFile(key, static_cast<GLenum>(format), binary);
+                }
+                catch (const std::exception& e)
+                {
+                    // The shader is compiled from source instead.
+                    system->_log(e.what(), LogLevel::Warning);
+                }
+            }
+
+            void Render::Private::writeShaderBinary(uint64_t key, const std::shared_ptr<OpenGL::Shader>& shader)
+            {
+                if (shaderCachePath.empty())
+                    return;
+                try
+                {
+                    GLenum format = 0;
+                    std::vector<uint8_t> binary;
+                    shader->getProgramBinary(format, binary);
+                    if (!binary.empty())
+                    {
+                        writeShaderFile(key, format, binary);
+                        trimShaderFiles(false);
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    system->_log(e.what(), LogLevel::Warning);
+                }
+            }
+
+            void Render::Private::writeShaderFile(uint64_t key, GLenum format, const std::vector<uint8_t>& binary)
+            {
+                // The file is written to a temporary path first so that an
+                // interrupted write does not leave a partial program binary.
+                const std::string fileName = getHashString(key);
+                std::stringstream ss;
+                ss << fileName << "." << shaderCacheTempCount++ << shaderCacheTempExtension;
+                const FileSystem::Path tempPath(shaderCachePath, ss.str());
+                try
+                {
+                    auto io = FileSystem::FileIO::create();
+                    io->open(tempPath.get(), FileSystem::FileIO::Mode::Write);
+                    io->writeU32(static_cast<uint32_t>(format));
+                    io->write(binary.data(), binary.size());
+                    io->close();
+                    FileSystem::Path::rename(tempPath, FileSystem::Path(shaderCachePath, fileName + shaderCacheExtension));
+                }
+                catch (const std::exception& e)
+                {
+                    try
+                    {
+                        FileSystem::Path::rm(tempPath);
+                    }
+                    catch (const std::exception&)
+                    {}
+                    system->_log(e.what(), LogLevel::Warning);
+                }
+            }
+
+            void Render::Private::trimShaderFiles(bool temp)
+            {
+                // Remove the least recently used program binaries, and the
+                // temporary files left behind by an interrupted write.
+                FileSystem::DirectoryListOptions options;
+                options.fileExtensions = { shaderCacheExtension };
+                if (temp)
+                {
+                    options.fileExtensions.insert(shaderCacheTempExtension);
+                }
+                options.sort = FileSystem::DirectoryListSort::Time;
+                options.reverseSort = true;
+                size_t count = 0;
+                for (const auto& i : FileSystem::FileInfo::directoryList(FileSystem::Path(shaderCachePath), options))
+                {
+                    const bool isTemp = i.getPath().getExtension() == shaderCacheTempExtension;
+                    if (isTemp || ++count > shaderCacheFileMax)
+                    {
+                        try
+                        {
+                            FileSystem::Path::rm(i.getPath());
+                        }
+                        catch (const std::exception& e)
+                        {
+                            system->_log(e.what(), LogLevel::Warning);
+                        }
+                    }
+                }
+            }
+#endif // DJV_OPENGL_ES2
+
         } // namespace Render2D
     } // namespace AV
     
@@ -13,6 +13,8 @@
 #include <djvCore/ISystem.h>
 #include <djvCore/RapidJSON.h>
 #include <djvCore/Range.h>
+#include <djvCore/Time.h>
+#include <djvCore/ValueObserver.h>
 
 #include <list>
 
@@ -136,6 +138,12 @@ namespace djv
                 bool operator != (const ImageOptions&) const;
             };
 
+            //! Apply the image color, levels, exposure, and soft clip options
+            //! to an RGBA color. This matches the image shader so colors can
+            //! be computed without rendering. The color space conversion is
+            //! not applied, see OCIO::System::applyRGBA().
+            glm::vec4 applyImageOptions(const glm::vec4&, const ImageOptions&);
+
             //! This eumeration provides the image filtering options.
             enum class ImageFilter
             {
@@ -176,12 +184,24 @@ namespace djv
 
                 static std::shared_ptr<Render> create(const std::shared_ptr<Core::Context>&);
 
+                void tick() override;
+
                 //! \name Begin and End
                 ///@{
 
                 void beginFrame(const Image::Size&);
+
+                //! Begin a frame that only updates the given regions. The rest
+                //! of the frame buffer keeps its previous contents, so nothing
+                //! should be drawn outside of the regions.
+                void beginFrame(const Image::Size&, const std::vector<Core::BBox2f>& regions);
+
                 void endFrame();
 
+                //! Set whether consecutive primitives that share the same state
+                //! are merged into a single draw.
+                void setPrimitiveBatching(bool);
+
                 ///@}
 
                 //! \name Transform
@@ -245,6 +265,12 @@ namespace djv
                     const glm::vec2& pos,
                     const ImageOptions& = ImageOptions());
 
+                //! Color space conversions are created on a background thread.
+                //! Until a conversion is ready images are drawn with the
+                //! previous conversion, this observable is signaled when new
+                //! conversions are ready so the images can be redrawn.
+                std::shared_ptr<Core::IValueSubject<bool> > observeColorSpacesChanged() const;
+
                 ///@}
 
                 //! \name Text
@@ -278,6 +304,16 @@ namespace djv
                 size_t getDynamicTextureCount() const;
                 size_t getVBOSize() const;
 
+                //! Get the number of primitives in the last frame.
+                size_t getPrimitiveCount() const;
+
+                //! Get the number of draw calls in the last frame.
+                size_t getDrawCount() const;
+
+                //! Get the time spent waiting for texture uploads in the last
+                //! frame.
+                const Core::Time::Duration& getUploadWaitTime() const;
+
                 ///@}
 
             private:
@@ -32,10 +32,12 @@ namespace djv
                     const ReadOptions& readOptions,
                     const std::shared_ptr<TextSystem>& textSystem,
                     const std::shared_ptr<ResourceSystem>& resourceSystem,
-                    const std::shared_ptr<LogSystem>& logSystem)
+                    const std::shared_ptr<LogSystem>& logSystem,
+                    const std::shared_ptr<ThreadPool>& threadPool,
+                    const std::shared_ptr<FrameCache>& frameCache)
                 {
                     auto out = std::shared_ptr<Read>(new Read);
-                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem);
+                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem, threadPool, frameCache);
                     return out;
                 }
 
@@ -192,6 +194,15 @@ namespace djv
                     std::shared_ptr<Image::Image> out;
                     auto io = FileSystem::FileIO::create();
                     const auto info = _open(fileName, io);
+#if defined(DJV_MMAP)
+                    if (!_compression && 1 == Image::getChannelCount(info.video[0].info.type))
+                    {
+                        // Single channel images don't need to be interleaved.
+                        out = Image::Image::create(info.video[0].info, io);
+                        out->setPluginName(pluginName);
+                        return out;
+                    }
+#endif // DJV_MMAP
                     out = Image::Image::create(info.video[0].info);
                     out->setPluginName(pluginName);
 
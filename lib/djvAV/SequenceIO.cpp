@@ -4,6 +4,8 @@
 
 #include <djvAV/SequenceIO.h>
 
+#include <djvAV/IOFrameCache.h>
+#include <djvAV/IOReadAhead.h>
 #include <djvAV/ImageConvert.h>
 
 #include <djvCore/Context.h>
@@ -35,6 +37,9 @@ namespace djv
                 //! \todo Should this be configurable?
                 const double infoTimeout = 0.5;
 
+                //! The default number of frames to read ahead.
+                const size_t readAheadFrameCount = 16;
+
             } // namespace
 
             struct ISequenceRead::Future
@@ -45,6 +50,11 @@ namespace djv
 
             struct ISequenceRead::Private
             {
+                std::shared_ptr<ThreadPool> threadPool;
+                std::shared_ptr<FrameCache> frameCache;
+                std::shared_ptr<Image::Convert> proxyConvert;
+                std::shared_ptr<ReadAhead> readAhead;
+                Image::Size proxySize;
                 Frame::Number frame = Frame::invalid;
                 std::promise<Info> infoPromise;
                 std::vector<std::future<Future> > cacheFutures;
@@ -61,10 +71,26 @@ namespace djv
                 const ReadOptions& options,
                 const std::shared_ptr<TextSystem>& textSystem,
                 const std::shared_ptr<ResourceSystem>& resourceSystem,
-                const std::shared_ptr<LogSystem>& logSystem)
+                const std::shared_ptr<LogSystem>& logSystem,
+                const std::shared_ptr<ThreadPool>& threadPool,
+                const std::shared_ptr<FrameCache>& frameCache)
             {
                 IRead::_init(fileInfo, options, textSystem, resourceSystem, logSystem);
                 _speed = Time::Speed();
+                // The shared frame cache doesn't know about regions.
+                if (!options.region.isValid())
+                {
+                    _cache.setFrameCache(frameCache, fileInfo.getFileName(), options.layer, options.proxy, options.colorSpace);
+                    _p->frameCache = frameCache;
+                }
+                if (options.proxy > 0)
+                {
+                    // The proxies are converted in thread pool tasks.
+                    _p->proxyConvert = Image::Convert::create(Image::ConvertBackend::CPU, resourceSystem);
+                    _p->proxyConvert->setThreadCount(1);
+                }
+                _p->threadPool = threadPool;
+                _p->readAhead = ReadAhead::create(threadPool);
                 _p->running = true;
                 _p->thread = std::thread(
                     [this]
@@ -96,6 +122,12 @@ namespace djv
                     {
                         info = _readInfo(fileName);
                         info.fileName = _fileInfo.getFileName();
+                        if (info.video.size())
+                        {
+                            p.proxySize = getProxySize(
+                                info.video[std::min(_options.layer, info.video.size() - 1)].info.size,
+                                _options.proxy);
+                        }
                         p.infoPromise.set_value(info);
                     }
                     catch (const std::exception&)
@@ -143,8 +175,18 @@ namespace djv
                         }
                         if (info.video.size() && _options.layer < info.video.size())
                         {
-                            const size_t dataByteCount = info.video[_options.layer].info.getDataByteCount();
-                            _cache.setMax(dataByteCount ? (cacheMaxByteCount / dataByteCount) : 0);
+                            if (p.frameCache)
+                            {
+                                cacheMaxByteCount = std::min(cacheMaxByteCount, p.frameCache->getMaxByteCount());
+                            }
+                            auto imageInfo = info.video[_options.layer].info;
+                            imageInfo.size = getProxySize(imageInfo.size, _options.proxy);
+                            const size_t dataByteCount = imageInfo.getDataByteCount();
+                            const size_t cacheMax = dataByteCount ? (cacheMaxByteCount / dataByteCount) : 0;
+
+                            // The cache window is one frame larger than the maximum,
+                            // leave room for it so the window fits in the budget.
+                            _cache.setMax(cacheMax > 0 ? (cacheMax - 1) : 0);
                             _cache.setSequenceSize(info.video[_options.layer].sequence.getFrameCount());
                             _cache.setInOutPoints(inOutPoints);
                         }
@@ -192,6 +234,12 @@ namespace djv
                             }*/
                         }
 
+                        // Start reading the files ahead of the decoders.
+                        if ((playback || cacheEnabled) && sequenceFrameCount > 1)
+                        {
+                            _readAhead(loop, cacheEnabled, inOutPoints);
+                        }
+
                         // Fill the queue.
                         size_t read = 0;
                         if (queueCount > 0)
@@ -269,6 +317,20 @@ namespace djv
                     //! \todo How do we safely detach the thread here so we don't block?
                     p.thread.join();
                 }
+
+                // Remove the tasks that have not been started yet from the
+                // thread pool, only the tasks that are already running need
+                // to be waited on. Waiting for the queued tasks could block
+                // for a long time since cache tasks are run last.
+                p.threadPool->cancel(this);
+                for (auto& i : p.cacheFutures)
+                {
+                    if (i.valid())
+                    {
+                        i.wait();
+                    }
+                }
+                p.cacheFutures.clear();
             }
 
             bool ISequenceRead::_hasWork() const
@@ -285,17 +347,39 @@ namespace djv
                 return std::min(queueMax, threadCount);
             }
 
-            std::future<ISequenceRead::Future> ISequenceRead::_getFuture(Frame::Number i, std::string fileName)
+            std::future<ISequenceRead::Future> ISequenceRead::_getFuture(
+                Frame::Number i,
+                std::string fileName,
+                TaskPriority priority)
             {
-                return std::async(
-                    std::launch::async,
+                return _p->threadPool->run<Future>(
+                    priority,
                     [this, i, fileName]
                     {
                         Future out;
                         out.frame = i;
+                        if (!_p->running)
+                        {
+                            return out;
+                        }
                         try
                         {
                             out.image = _readImage(fileName);
+                            const auto& proxySize = _p->proxySize;
+                            if (_p->proxyConvert && out.image &&
+                                (out.image->getWidth() > proxySize.w || out.image->getHeight() > proxySize.h))
+                            {
+                                // Resize the image if the reader does not
+                                // support proxies natively.
+                                auto info = Image::Info(proxySize, out.image->getType());
+                                info.name = out.image->getInfo().name;
+                                info.pixelAspectRatio = out.image->getInfo().pixelAspectRatio;
+                                auto tmp = Image::Image::create(info);
+                                tmp->setPluginName(out.image->getPluginName());
+                                tmp->setTags(out.image->getTags());
+                                _p->proxyConvert->process(*out.image, info, *tmp);
+                                out.image = tmp;
+                            }
                         }
                         catch (const std::exception& e)
                         {
@@ -305,7 +389,8 @@ namespace djv
                                 LogLevel::Error);
                         }
                         return out;
-                    });
+                    },
+                    this);
             }
 
             size_t ISequenceRead::_readQueue(size_t count, bool loop, bool cacheEnabled)
@@ -331,13 +416,13 @@ namespace djv
                             {
                                 const Frame::Number frameNumber = _sequence.getFrame(p.frame);
                                 const std::string fileName = _fileInfo.getFileName(frameNumber);
-                                futures.push_back(_getFuture(p.frame, fileName));
+                                futures.push_back(_getFuture(p.frame, fileName, TaskPriority::Queue));
                             }
                         }
                         else
                         {
                             const std::string fileName = _fileInfo.getFileName();
-                            futures.push_back(_getFuture(p.frame, fileName));
+                            futures.push_back(_getFuture(p.frame, fileName, TaskPriority::Queue));
                         }
                     }
 
@@ -371,9 +456,6 @@ namespace djv
                     images.push_back(std::make_pair(result.frame, result.image));
                     if (cacheEnabled)
                     {
-#if defined(DJV_MMAP)
-                        result.image->detach();
-#endif // DJV_MMAP
                         _cache.add(result.frame, result.image);
                     }
                 }
@@ -400,6 +482,21 @@ namespace djv
                 return futures.size();
             }
 
+            void ISequenceRead::_readAhead(bool loop, bool cacheEnabled, const AV::IO::InOutPoints& inOutPoints)
+            {
+                DJV_PRIVATE_PTR();
+                std::vector<std::string> fileNames;
+                const auto range = inOutPoints.getRange(_sequence.getFrameCount());
+                for (const auto frame : ReadAhead::getFrames(p.frame, p.direction, range, loop, readAheadFrameCount))
+                {
+                    if (!cacheEnabled || !_cache.contains(frame))
+                    {
+                        fileNames.push_back(_fileInfo.getFileName(_sequence.getFrame(frame)));
+                    }
+                }
+                p.readAhead->setFileNames(fileNames);
+            }
+
             void ISequenceRead::_readCache(size_t count, const AV::IO::InOutPoints& inOutPoints)
             {
                 DJV_PRIVATE_PTR();
@@ -438,7 +535,7 @@ namespace djv
                             if (!_cache.contains(frame))
                             {
                                 const std::string fileName = _fileInfo.getFileName(_sequence.getFrame(frame));
-                                p.cacheFutures.push_back(_getFuture(frame, fileName));
+                                p.cacheFutures.push_back(_getFuture(frame, fileName, TaskPriority::Cache));
                             }
                             ++frame;
                             if (frame > range.getMax())
@@ -464,7 +561,7 @@ namespace djv
                             if (!_cache.contains(frame))
                             {
                                 const std::string fileName = _fileInfo.getFileName(_sequence.getFrame(frame));
-                                p.cacheFutures.push_back(_getFuture(frame, fileName));
+                                p.cacheFutures.push_back(_getFuture(frame, fileName, TaskPriority::Cache));
                             }
                             --frame;
                             if (frame < range.getMin())
@@ -486,9 +583,6 @@ namespace djv
                         i->wait_for(std::chrono::seconds(0)) == std::future_status::ready)
                     {
                         const auto result = i->get();
-#if defined(DJV_MMAP)
-                        result.image->detach();
-#endif // DJV_MMAP
                         _cache.add(result.frame, result.image);
                         i = p.cacheFutures.erase(i);
                     }
@@ -555,7 +649,11 @@ namespace djv
                 p.glfwWindow = glfwCreateWindow(100, 100, "djv::IO::ISequenceWrite", NULL, NULL);
                 if (!p.glfwWindow)
                 {
-                    throw FileSystem::Error(_textSystem->getText(DJV_TEXT("error_glfw_window_creation")));
+                    // Fall back to converting the images on the CPU.
+                    _logSystem->log(
+                        "djv::AV::IO::ISequenceWrite",
+                        _textSystem->getText(DJV_TEXT("error_glfw_window_creation")),
+                        LogLevel::Warning);
                 }
 
                 p.running = true;
@@ -565,14 +663,17 @@ namespace djv
                     DJV_PRIVATE_PTR();
                     try
                     {
-                        glfwMakeContextCurrent(p.glfwWindow);
+                        if (p.glfwWindow)
+                        {
+                            glfwMakeContextCurrent(p.glfwWindow);
 #if defined(DJV_OPENGL_ES2)
-                        if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
+                            if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
 #else
-                        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+                            if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
 #endif
-                        {
-                            throw FileSystem::Error(_textSystem->getText(DJV_TEXT("error_glad_init")));
+                            {
+                                throw FileSystem::Error(_textSystem->getText(DJV_TEXT("error_glad_init")));
+                            }
                         }
 
                         p.convert = Image::Convert::create(_resourceSystem);
@@ -618,7 +719,8 @@ namespace djv
                                         ++p.frameNumber;
                                     }
                                     auto image = images[i];
-                                    const Image::Type imageType = _getImageType(image->getType());
+                                    // Planar YUV images are written as RGB.
+                                    const Image::Type imageType = _getImageType(Image::getRGBType(image->getType()));
                                     if (Image::Type::None == imageType)
                                     {
                                         throw FileSystem::Error(String::Format("{0}: {1}").
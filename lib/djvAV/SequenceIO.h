@@ -5,6 +5,7 @@
 #pragma once
 
 #include <djvAV/IO.h>
+#include <djvAV/IOThreadPool.h>
 
 #include <djvCore/Frame.h>
 
@@ -25,7 +26,9 @@ namespace djv
                     const ReadOptions&,
                     const std::shared_ptr<Core::TextSystem>&,
                     const std::shared_ptr<Core::ResourceSystem>&,
-                    const std::shared_ptr<Core::LogSystem>&);
+                    const std::shared_ptr<Core::LogSystem>&,
+                    const std::shared_ptr<ThreadPool>&,
+                    const std::shared_ptr<FrameCache>&);
                 ISequenceRead();
 
             public:
@@ -48,8 +51,9 @@ namespace djv
                 bool _hasWork() const;
                 size_t _getQueueCount(size_t threadCount) const;
                 struct Future;
-                std::future<Future> _getFuture(Core::Frame::Number, std::string fileName);
+                std::future<Future> _getFuture(Core::Frame::Number, std::string fileName, TaskPriority);
                 size_t _readQueue(size_t count, bool loop, bool cacheEnabled);
+                void _readAhead(bool loop, bool cacheEnabled, const AV::IO::InOutPoints&);
                 void _readCache(size_t count, const AV::IO::InOutPoints&);
 
                 DJV_PRIVATE();
@@ -32,10 +32,12 @@ namespace djv
                     const ReadOptions& readOptions,
                     const std::shared_ptr<TextSystem>& textSystem,
                     const std::shared_ptr<ResourceSystem>& resourceSystem,
-                    const std::shared_ptr<LogSystem>& logSystem)
+                    const std::shared_ptr<LogSystem>& logSystem,
+                    const std::shared_ptr<ThreadPool>& threadPool,
+                    const std::shared_ptr<FrameCache>& frameCache)
                 {
                     auto out = std::shared_ptr<Read>(new Read);
-                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem);
+                    out->_init(fileInfo, readOptions, textSystem, resourceSystem, logSystem, threadPool, frameCache);
                     return out;
                 }
 
@@ -140,6 +142,14 @@ namespace djv
                     std::shared_ptr<Image::Image> out;
                     auto io = FileSystem::FileIO::create();
                     const auto info = _open(fileName, io);
+#if defined(DJV_MMAP)
+                    if (!_compression && !_bgr)
+                    {
+                        out = Image::Image::create(info.video[0].info, io);
+                        out->setPluginName(pluginName);
+                        return out;
+                    }
+#endif // DJV_MMAP
                     out = Image::Image::create(info.video[0].info);
                     out->setPluginName(pluginName);
 
@@ -0,0 +1,841 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/ThumbnailDiskCache.h>
+
+#include <djvAV/IO.h>
+#include <djvAV/Image.h>
+
+#include <djvCore/FileIO.h>
+#include <djvCore/FileInfo.h>
+
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace
+        {
+            const char     magic[]        = { 'd', 'j', 'v', 'T' };
+            const uint32_t version        = 1;
+            const char*    indexFileName  = "index";
+            const char*    infoExtension  = ".info";
+            const char*    imageExtension = ".thumb";
+            const char*    tempExtension  = ".tmp";
+
+            //! The number of changes after which the index is written.
+            const size_t   indexChangesMax = 64;
+
+            //! The entry key, which is also stored in the entry to validate it.
+            struct Key
+            {
+                std::string fileName;
+                std::string options;
+                uint64_t    time        = 0;
+                uint64_t    size        = 0;
+                uint16_t    w           = 0;
+                uint16_t    h           = 0;
+                uint32_t    type        = 0;
+
+                bool operator == (const Key& other) const
+                {
+                    return fileName == other.fileName &&
+                        options == other.options &&
+                        time == other.time &&
+                        size == other.size &&
+                        w == other.w &&
+                        h == other.h &&
+                        type == other.type;
+                }
+            };
+
+            Key getKey(
+                const FileSystem::FileInfo& fileInfo,
+                const std::string&          options,
+                const Image::Size&          size = Image::Size(),
+                Image::Type                 type = Image::Type::None)
+            {
+                Key out;
+                out.fileName = fileInfo.getFileName();
+                out.options = options;
+                out.time = static_cast<uint64_t>(fileInfo.getTime());
+                out.size = fileInfo.getSize();
+                out.w = size.w;
+                out.h = size.h;
+                out.type = static_cast<uint32_t>(type);
+                return out;
+            }
+
+            //! Hash with FNV-1a so the entry file names do not change between
+            //! builds.
+            const uint64_t fnvOffset = 14695981039346656037ULL;
+
+            uint64_t hash(uint64_t value, const void* data, size_t size)
+            {
+                const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    value ^= p[i];
+                    value *= 1099511628211ULL;
+                }
+                return value;
+            }
+
+            std::string getOptionsHash(const std::string& value)
+            {
+                std::stringstream ss;
+                ss << std::hex << hash(fnvOffset, value.data(), value.size());
+                return ss.str();
+            }
+
+            std::string getEntryFileName(const Key& key, const std::string& extension)
+            {
+                uint64_t value = fnvOffset;
+                value = hash(value, key.fileName.data(), key.fileName.size());
+                value = hash(value, key.options.data(), key.options.size());
+                value = hash(value, &key.time, sizeof(key.time));
+                value = hash(value, &key.size, sizeof(key.size));
+                value = hash(value, &key.w, sizeof(key.w));
+                value = hash(value, &key.h, sizeof(key.h));
+                value = hash(value, &key.type, sizeof(key.type));
+                std::stringstream ss;
+                ss << std::hex << std::setfill('0') << std::setw(16) << value << extension;
+                return ss.str();
+            }
+
+            void writeU64(FileSystem::FileIO& io, uint64_t value)
+            {
+                io.write(&value, 1, sizeof(uint64_t));
+            }
+
+            uint64_t readU64(FileSystem::FileIO& io)
+            {
+                uint64_t out = 0;
+                io.read(&out, 1, sizeof(uint64_t));
+                return out;
+            }
+
+            void writeString(FileSystem::FileIO& io, const std::string& value)
+            {
+                io.writeU32(static_cast<uint32_t>(value.size()));
+                io.write(value);
+            }
+
+            std::string readString(FileSystem::FileIO& io)
+            {
+                uint32_t size = 0;
+                io.readU32(&size);
+                if (size > io.getSize() - io.getPos())
+                {
+                    throw std::runtime_error(io.getFileName());
+                }
+                std::string out(size, 0);
+                if (size)
+                {
+                    io.read(&out[0], size);
+                }
+                return out;
+            }
+
+            void writeHeader(FileSystem::FileIO& io, const Key& key)
+            {
+                io.write(magic, sizeof(magic));
+                io.writeU32(version);
+                writeString(io, key.fileName);
+                writeString(io, key.options);
+                writeU64(io, key.time);
+                writeU64(io, key.size);
+                io.writeU16(&key.w, 1);
+                io.writeU16(&key.h, 1);
+                io.writeU32(key.type);
+            }
+
+            bool readHeader(FileSystem::FileIO& io, const Key& key)
+            {
+                char fileMagic[sizeof(magic)];
+                io.read(fileMagic, sizeof(magic));
+                uint32_t fileVersion = 0;
+                io.readU32(&fileVersion);
+                if (memcmp(fileMagic, magic, sizeof(magic)) != 0 || fileVersion != version)
+                {
+                    return false;
+                }
+                Key fileKey;
+                fileKey.fileName = readString(io);
+                fileKey.options = readString(io);
+                fileKey.time = readU64(io);
+                fileKey.size = readU64(io);
+                io.readU16(&fileKey.w);
+                io.readU16(&fileKey.h);
+                io.readU32(&fileKey.type);
+                return fileKey == key;
+            }
+
+            void writeImageInfo(FileSystem::FileIO& io, const Image::Info& value)
+            {
+                writeString(io, value.name);
+                io.writeU16(&value.size.w, 1);
+                io.writeU16(&value.size.h, 1);
+                io.writeF32(value.pixelAspectRatio);
+                io.writeU32(static_cast<uint32_t>(value.type));
+                io.writeU8(value.layout.mirror.x);
+                io.writeU8(value.layout.mirror.y);
+                io.write32(value.layout.alignment);
+                io.writeU8(static_cast<uint8_t>(value.layout.endian));
+            }
+
+            Image::Info readImageInfo(FileSystem::FileIO& io)
+            {
+                Image::Info out;
+                out.name = readString(io);
+                io.readU16(&out.size.w);
+                io.readU16(&out.size.h);
+                io.readF32(&out.pixelAspectRatio);
+                uint32_t type = 0;
+                io.readU32(&type);
+                out.type = static_cast<Image::Type>(type);
+                uint8_t mirrorX = 0;
+                uint8_t mirrorY = 0;
+                io.readU8(&mirrorX);
+                io.readU8(&mirrorY);
+                out.layout.mirror.x = mirrorX != 0;
+                out.layout.mirror.y = mirrorY != 0;
+                int32_t alignment = 1;
+                io.read32(&alignment);
+                out.layout.alignment = alignment;
+                uint8_t endian = 0;
+                io.readU8(&endian);
+                out.layout.endian = static_cast<Memory::Endian>(endian);
+                return out;
+            }
+
+            void writeTags(FileSystem::FileIO& io, const Tags& value)
+            {
+                const auto& tags = value.getTags();
+                io.writeU32(static_cast<uint32_t>(tags.size()));
+                for (const auto& i : tags)
+                {
+                    writeString(io, i.first);
+                    writeString(io, i.second);
+                }
+            }
+
+            Tags readTags(FileSystem::FileIO& io)
+            {
+                Tags out;
+                uint32_t count = 0;
+                io.readU32(&count);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const std::string key = readString(io);
+                    out.setTag(key, readString(io));
+                }
+                return out;
+            }
+
+            void writeInfo(FileSystem::FileIO& io, const IO::Info& value)
+            {
+                writeString(io, value.fileName);
+                io.writeU32(static_cast<uint32_t>(value.video.size()));
+                for (const auto& i : value.video)
+                {
+                    writeImageInfo(io, i.info);
+                    io.write32(i.speed.getNum());
+                    io.write32(i.speed.getDen());
+                    const auto& ranges = i.sequence.getRanges();
+                    io.writeU32(static_cast<uint32_t>(ranges.size()));
+                    for (const auto& j : ranges)
+                    {
+                        writeU64(io, static_cast<uint64_t>(j.getMin()));
+                        writeU64(io, static_cast<uint64_t>(j.getMax()));
+                    }
+                    io.writeU32(static_cast<uint32_t>(i.sequence.getPad()));
+                    writeString(io, i.codec);
+                }
+                io.writeU32(static_cast<uint32_t>(value.audio.size()));
+                for (const auto& i : value.audio)
+                {
+                    writeString(io, i.info.name);
+                    io.writeU8(i.info.channelCount);
+                    io.writeU32(static_cast<uint32_t>(i.info.type));
+                    writeU64(io, i.info.sampleRate);
+                    writeU64(io, i.info.sampleCount);
+                    writeString(io, i.codec);
+                }
+                writeTags(io, value.tags);
+            }
+
+            IO::Info readInfo(FileSystem::FileIO& io)
+            {
+                IO::Info out;
+                out.fileName = readString(io);
+                uint32_t count = 0;
+                io.readU32(&count);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    IO::VideoInfo videoInfo;
+                    videoInfo.info = readImageInfo(io);
+                    int32_t num = 0;
+                    int32_t den = 0;
+                    io.read32(&num);
+                    io.read32(&den);
+                    videoInfo.speed = Time::Speed(num, den);
+                    uint32_t rangeCount = 0;
+                    io.readU32(&rangeCount);
+                    std::vector<Frame::Range> ranges;
+                    for (uint32_t j = 0; j < rangeCount; ++j)
+                    {
+                        const Frame::Number min = static_cast<Frame::Number>(readU64(io));
+                        const Frame::Number max = static_cast<Frame::Number>(readU64(io));
+                        ranges.push_back(Frame::Range(min, max));
+                    }
+                    uint32_t pad = 0;
+                    io.readU32(&pad);
+                    videoInfo.sequence = Frame::Sequence(ranges, pad);
+                    videoInfo.codec = readString(io);
+                    out.video.push_back(videoInfo);
+                }
+                io.readU32(&count);
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    IO::AudioInfo audioInfo;
+                    audioInfo.info.name = readString(io);
+                    io.readU8(&audioInfo.info.channelCount);
+                    uint32_t type = 0;
+                    io.readU32(&type);
+                    audioInfo.info.type = static_cast<Audio::Type>(type);
+                    audioInfo.info.sampleRate = static_cast<size_t>(readU64(io));
+                    audioInfo.info.sampleCount = static_cast<size_t>(readU64(io));
+                    audioInfo.codec = readString(io);
+                    out.audio.push_back(audioInfo);
+                }
+                out.tags = readTags(io);
+                return out;
+            }
+
+        } // namespace
+
+        struct ThumbnailDiskCache::Private
+        {
+            struct Entry
+            {
+                std::string fileName;
+                size_t byteCount = 0;
+            };
+
+            std::string path;
+            std::string options;
+            size_t maxByteCount = 0;
+            size_t byteCount = 0;
+            std::list<Entry> list;
+            std::unordered_map<std::string, std::list<Entry>::iterator> map;
+            size_t indexChanges = 0;
+            mutable std::mutex mutex;
+            std::mutex indexMutex;
+            std::atomic<size_t> tempCount;
+
+            std::string getPath(const std::string& fileName) const
+            {
+                return FileSystem::Path(path, fileName).get();
+            }
+
+            //! Get a unique temporary file name. Entries are written to a
+            //! temporary file and renamed so that readers never see a
+            //! partially written entry.
+            std::string getTempPath(const std::string& fileName)
+            {
+                std::stringstream ss;
+                ss << fileName << "." << tempCount++ << tempExtension;
+                return getPath(ss.str());
+            }
+        };
+
+        void ThumbnailDiskCache::_init(const std::string& path, size_t maxByteCount)
+        {
+            DJV_PRIVATE_PTR();
+            p.path = path;
+            p.maxByteCount = maxByteCount;
+            p.options = getOptionsHash(std::string());
+            p.tempCount = 0;
+            if (!FileSystem::FileInfo(path).doesExist())
+            {
+                FileSystem::Path::mkdir(FileSystem::Path(path));
+            }
+            _readIndex();
+            std::vector<std::string> removed;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                removed = _trim();
+            }
+            _rm(removed);
+        }
+
+        ThumbnailDiskCache::ThumbnailDiskCache() :
+            _p(new Private)
+        {}
+
+        ThumbnailDiskCache::~ThumbnailDiskCache()
+        {
+            try
+            {
+                _writeIndex();
+            }
+            catch (const std::exception&)
+            {}
+        }
+
+        std::shared_ptr<ThumbnailDiskCache> ThumbnailDiskCache::create(const std::string& path, size_t maxByteCount)
+        {
+            auto out = std::shared_ptr<ThumbnailDiskCache>(new ThumbnailDiskCache);
+            out->_init(path, maxByteCount);
+            return out;
+        }
+
+        const std::string& ThumbnailDiskCache::getPath() const
+        {
+            return _p->path;
+        }
+
+        size_t ThumbnailDiskCache::getMaxByteCount() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            return p.maxByteCount;
+        }
+
+        size_t ThumbnailDiskCache::getByteCount() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            return p.byteCount;
+        }
+
+        size_t ThumbnailDiskCache::getCount() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            return p.list.size();
+        }
+
+        float ThumbnailDiskCache::getPercentageUsed() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            return p.maxByteCount > 0 ? (p.byteCount / static_cast<float>(p.maxByteCount) * 100.F) : 0.F;
+        }
+
+        void ThumbnailDiskCache::setMaxByteCount(size_t value)
+        {
+            DJV_PRIVATE_PTR();
+            std::vector<std::string> removed;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.maxByteCount = value;
+                removed = _trim();
+            }
+            _rm(removed);
+        }
+
+        void ThumbnailDiskCache::setOptionsKey(const std::string& value)
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.mutex);
+            p.options = getOptionsHash(value);
+        }
+
+        bool ThumbnailDiskCache::getInfo(const FileSystem::FileInfo& fileInfo, IO::Info& out)
+        {
+            DJV_PRIVATE_PTR();
+            Key key;
+            std::string fileName;
+            bool found = false;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                key = getKey(fileInfo, p.options);
+                fileName = getEntryFileName(key, infoExtension);
+                found = p.map.find(fileName) != p.map.end();
+            }
+            if (found)
+            {
+                try
+                {
+                    auto io = FileSystem::FileIO::create();
+                    io->open(p.getPath(fileName), FileSystem::FileIO::Mode::Read);
+                    found = readHeader(*io, key);
+                    if (found)
+                    {
+                        out = readInfo(*io);
+                    }
+                }
+                catch (const std::exception&)
+                {
+                    found = false;
+                }
+                _update(fileName, found);
+            }
+            return found;
+        }
+
+        void ThumbnailDiskCache::addInfo(const FileSystem::FileInfo& fileInfo, const IO::Info& value)
+        {
+            DJV_PRIVATE_PTR();
+            Key key;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                key = getKey(fileInfo, p.options);
+            }
+            const std::string fileName = getEntryFileName(key, infoExtension);
+            const std::string tempPath = p.getTempPath(fileName);
+            size_t byteCount = 0;
+            try
+            {
+                auto io = FileSystem::FileIO::create();
+                io->open(tempPath, FileSystem::FileIO::Mode::Write);
+                writeHeader(*io, key);
+                writeInfo(*io, value);
+                byteCount = io->getPos();
+                io->close();
+                FileSystem::Path::rename(FileSystem::Path(tempPath), FileSystem::Path(p.getPath(fileName)));
+            }
+            catch (const std::exception&)
+            {
+                _rm({ tempPath });
+                throw;
+            }
+            _add(fileName, byteCount);
+        }
+
+        bool ThumbnailDiskCache::getImage(
+            const FileSystem::FileInfo&     fileInfo,
+            const Image::Size&              size,
+            Image::Type                     type,
+            std::shared_ptr<Image::Image>&  out)
+        {
+            DJV_PRIVATE_PTR();
+            Key key;
+            std::string fileName;
+            bool found = false;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                key = getKey(fileInfo, p.options, size, type);
+                fileName = getEntryFileName(key, imageExtension);
+                found = p.map.find(fileName) != p.map.end();
+            }
+            if (found)
+            {
+                try
+                {
+                    auto io = FileSystem::FileIO::create();
+                    io->open(p.getPath(fileName), FileSystem::FileIO::Mode::Read);
+                    found = readHeader(*io, key);
+                    if (found)
+                    {
+                        const std::string pluginName = readString(*io);
+                        const Tags tags = readTags(*io);
+                        const Image::Info info = readImageInfo(*io);
+                        const size_t dataByteCount = info.getDataByteCount();
+                        found = info.isValid() && io->getSize() - io->getPos() == dataByteCount;
+                        if (found)
+                        {
+                            // The data is read rather than memory mapped so
+                            // the entry can be replaced or removed while the
+                            // image is still in use.
+                            out = Image::Image::create(info);
+                            io->read(out->getData(), dataByteCount);
+                            out->setPluginName(pluginName);
+                            out->setTags(tags);
+                        }
+                    }
+                }
+                catch (const std::exception&)
+                {
+                    found = false;
+                }
+                _update(fileName, found);
+            }
+            return found;
+        }
+
+        void ThumbnailDiskCache::addImage(
+            const FileSystem::FileInfo&             fileInfo,
+            const Image::Size&                      size,
+            Image::Type                             type,
+            const std::shared_ptr<Image::Image>&    value)
+        {
+            DJV_PRIVATE_PTR();
+            Key key;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                key = getKey(fileInfo, p.options, size, type);
+            }
+            const std::string fileName = getEntryFileName(key, imageExtension);
+            const std::string tempPath = p.getTempPath(fileName);
+            size_t byteCount = 0;
+            try
+            {
+                auto io = FileSystem::FileIO::create();
+                io->open(tempPath, FileSystem::FileIO::Mode::Write);
+                writeHeader(*io, key);
+                writeString(*io, value->getPluginName());
+                writeTags(*io, value->getTags());
+                const auto& info = value->getInfo();
+                writeImageInfo(*io, info);
+                io->write(value->getData(), info.getDataByteCount());
+                byteCount = io->getPos();
+                io->close();
+                FileSystem::Path::rename(FileSystem::Path(tempPath), FileSystem::Path(p.getPath(fileName)));
+            }
+            catch (const std::exception&)
+            {
+                _rm({ tempPath });
+                throw;
+            }
+            _add(fileName, byteCount);
+        }
+
+        void ThumbnailDiskCache::clear()
+        {
+            DJV_PRIVATE_PTR();
+            std::vector<std::string> removed;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                for (const auto& i : p.list)
+                {
+                    removed.push_back(i.fileName);
+                }
+                p.list.clear();
+                p.map.clear();
+                p.byteCount = 0;
+                ++p.indexChanges;
+            }
+            _rm(removed);
+            _writeIndex();
+        }
+
+        void ThumbnailDiskCache::_add(const std::string& fileName, size_t byteCount)
+        {
+            DJV_PRIVATE_PTR();
+            std::vector<std::string> removed;
+            bool writeIndex = false;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.map.find(fileName);
+                if (i != p.map.end())
+                {
+                    p.byteCount -= i->second->byteCount;
+                    p.list.erase(i->second);
+                }
+                Private::Entry entry;
+                entry.fileName = fileName;
+                entry.byteCount = byteCount;
+                p.list.push_front(entry);
+                p.map[fileName] = p.list.begin();
+                p.byteCount += byteCount;
+                removed = _trim();
+                ++p.indexChanges;
+                writeIndex = p.indexChanges >= indexChangesMax;
+            }
+            _rm(removed);
+            if (writeIndex)
+            {
+                _writeIndex();
+            }
+        }
+
+        void ThumbnailDiskCache::_update(const std::string& fileName, bool found)
+        {
+            DJV_PRIVATE_PTR();
+            bool remove = false;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                const auto i = p.map.find(fileName);
+                if (i != p.map.end())
+                {
+                    if (found)
+                    {
+                        p.list.splice(p.list.begin(), p.list, i->second);
+                    }
+                    else
+                    {
+                        _remove(fileName);
+                        remove = true;
+                    }
+                    ++p.indexChanges;
+                }
+            }
+            if (remove)
+            {
+                _rm({ fileName });
+            }
+        }
+
+        void ThumbnailDiskCache::_remove(const std::string& fileName)
+        {
+            DJV_PRIVATE_PTR();
+            const auto i = p.map.find(fileName);
+            if (i != p.map.end())
+            {
+                p.byteCount -= i->second->byteCount;
+                p.list.erase(i->second);
+                p.map.erase(i);
+            }
+        }
+
+        std::vector<std::string> ThumbnailDiskCache::_trim()
+        {
+            DJV_PRIVATE_PTR();
+            std::vector<std::string> out;
+            while (p.byteCount > p.maxByteCount && p.list.size())
+            {
+                out.push_back(p.list.back().fileName);
+                _remove(p.list.back().fileName);
+            }
+            return out;
+        }
+
+        void ThumbnailDiskCache::_rm(const std::vector<std::string>& fileNames)
+        {
+            DJV_PRIVATE_PTR();
+            for (const auto& i : fileNames)
+            {
+                try
+                {
+                    FileSystem::Path::rm(FileSystem::Path(p.getPath(i)));
+                }
+                catch (const std::exception&)
+                {}
+            }
+        }
+
+        void ThumbnailDiskCache::_readIndex()
+        {
+            DJV_PRIVATE_PTR();
+
+            // Find the entries on disk, and remove temporary files left
+            // behind by an interrupted write.
+            FileSystem::DirectoryListOptions options;
+            options.fileExtensions = { infoExtension, imageExtension, tempExtension };
+            std::unordered_map<std::string, size_t> files;
+            std::vector<std::string> tempFiles;
+            for (const auto& i : FileSystem::FileInfo::directoryList(FileSystem::Path(p.path), options))
+            {
+                const std::string fileName = i.getFileName(Frame::invalid, false);
+                if (i.getPath().getExtension() == tempExtension)
+                {
+                    tempFiles.push_back(fileName);
+                }
+                else
+                {
+                    files[fileName] = i.getSize();
+                }
+            }
+            _rm(tempFiles);
+
+            // Read the least recently used order from the index. Entries that
+            // are not in the index were added after it was last written, so
+            // they are treated as the most recently used.
+            std::vector<std::string> order;
+            try
+            {
+                auto io = FileSystem::FileIO::create();
+                io->open(p.getPath(indexFileName), FileSystem::FileIO::Mode::Read);
+                char fileMagic[sizeof(magic)];
+                io->read(fileMagic, sizeof(magic));
+                uint32_t fileVersion = 0;
+                io->readU32(&fileVersion);
+                if (0 == memcmp(fileMagic, magic, sizeof(magic)) && version == fileVersion)
+                {
+                    uint32_t count = 0;
+                    io->readU32(&count);
+                    for (uint32_t i = 0; i < count; ++i)
+                    {
+                        order.push_back(readString(*io));
+                    }
+                }
+            }
+            catch (const std::exception&)
+            {}
+            std::lock_guard<std::mutex> lock(p.mutex);
+            for (const auto& i : order)
+            {
+                const auto j = files.find(i);
+                if (j != files.end() && p.map.find(i) == p.map.end())
+                {
+                    Private::Entry entry;
+                    entry.fileName = i;
+                    entry.byteCount = j->second;
+                    p.list.push_back(entry);
+                    p.map[i] = --p.list.end();
+                    p.byteCount += j->second;
+                    files.erase(j);
+                }
+            }
+            for (const auto& i : files)
+            {
+                Private::Entry entry;
+                entry.fileName = i.first;
+                entry.byteCount = i.second;
+                p.list.push_front(entry);
+                p.map[i.first] = p.list.begin();
+                p.byteCount += i.second;
+            }
+        }
+
+        void ThumbnailDiskCache::_writeIndex()
+        {
+            DJV_PRIVATE_PTR();
+
+            // Only one thread writes the index at a time, the entries are
+            // copied so the cache is not locked during the write.
+            std::lock_guard<std::mutex> indexLock(p.indexMutex);
+            std::vector<std::string> fileNames;
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                if (!p.indexChanges)
+                {
+                    return;
+                }
+                p.indexChanges = 0;
+                fileNames.reserve(p.list.size());
+                for (const auto& i : p.list)
+                {
+                    fileNames.push_back(i.fileName);
+                }
+            }
+
+            // Write to a temporary file and rename it so an interrupted write
+            // does not leave a partial index.
+            const std::string tempPath = p.getTempPath(indexFileName);
+            try
+            {
+                auto io = FileSystem::FileIO::create();
+                io->open(tempPath, FileSystem::FileIO::Mode::Write);
+                io->write(magic, sizeof(magic));
+                io->writeU32(version);
+                io->writeU32(static_cast<uint32_t>(fileNames.size()));
+                for (const auto& i : fileNames)
+                {
+                    writeString(*io, i);
+                }
+                io->close();
+                FileSystem::Path::rename(FileSystem::Path(tempPath), FileSystem::Path(p.getPath(indexFileName)));
+            }
+            catch (const std::exception&)
+            {
+                _rm({ tempPath });
+                throw;
+            }
+        }
+
+    } // namespace AV
+} // namespace djv
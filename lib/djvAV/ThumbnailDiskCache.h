@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAV/Pixel.h>
+
+#include <djvCore/Core.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace djv
+{
+    namespace Core
+    {
+        namespace FileSystem
+        {
+            class FileInfo;
+
+        } // namespace FileSystem
+    } // namespace Core
+
+    namespace AV
+    {
+        namespace IO
+        {
+            class Info;
+
+        } // namespace IO
+
+        namespace Image
+        {
+            class Size;
+            class Image;
+
+        } // namespace Image
+
+        //! This class provides a persistent cache of thumbnail images and
+        //! file information.
+        //!
+        //! Each entry is stored in a separate file, keyed by the file name,
+        //! modification time, size, options, and for images the thumbnail
+        //! size and type. The key is also stored in the entry so that it can be
+        //! validated when read. Image data is stored uncompressed after the
+        //! header.
+        //!
+        //! Entries and the index are written to temporary files and renamed,
+        //! and file I/O is done without holding the lock. The index, which
+        //! records the least recently used order, is written periodically
+        //! and when the cache is destroyed.
+        //!
+        //! When the maximum byte count is exceeded the least recently used
+        //! entries are removed.
+        class ThumbnailDiskCache
+        {
+            DJV_NON_COPYABLE(ThumbnailDiskCache);
+
+        protected:
+            void _init(const std::string& path, size_t maxByteCount);
+            ThumbnailDiskCache();
+
+        public:
+            ~ThumbnailDiskCache();
+
+            //! Create a new cache. The directory is created if it does not
+            //! exist.
+            static std::shared_ptr<ThumbnailDiskCache> create(const std::string& path, size_t maxByteCount);
+
+            const std::string& getPath() const;
+            size_t getMaxByteCount() const;
+            size_t getByteCount() const;
+            size_t getCount() const;
+            float getPercentageUsed() const;
+            void setMaxByteCount(size_t);
+
+            //! Set a string that identifies the options used to create the
+            //! entries. It is included in the key so entries created with
+            //! other options are ignored, and eventually removed.
+            void setOptionsKey(const std::string&);
+
+            //! \name Information
+            ///@{
+
+            bool getInfo(const Core::FileSystem::FileInfo&, IO::Info&);
+            void addInfo(const Core::FileSystem::FileInfo&, const IO::Info&);
+
+            ///@}
+
+            //! \name Images
+            ///@{
+
+            bool getImage(const Core::FileSystem::FileInfo&, const Image::Size&, Image::Type, std::shared_ptr<Image::Image>&);
+            void addImage(const Core::FileSystem::FileInfo&, const Image::Size&, Image::Type, const std::shared_ptr<Image::Image>&);
+
+            ///@}
+
+            //! Remove all of the entries.
+            void clear();
+
+        private:
+            void _add(const std::string& fileName, size_t byteCount);
+            void _update(const std::string& fileName, bool found);
+            void _remove(const std::string& fileName);
+            std::vector<std::string> _trim();
+            void _rm(const std::vector<std::string>&);
+            void _readIndex();
+            void _writeIndex();
+
+            DJV_PRIVATE();
+        };
+
+    } // namespace AV
+} // namespace djv
@@ -7,20 +7,21 @@
 #include <djvAV/Image.h>
 #include <djvAV/ImageConvert.h>
 #include <djvAV/IO.h>
+#include <djvAV/ThumbnailDiskCache.h>
 
 #include <djvCore/Cache.h>
 #include <djvCore/Context.h>
 #include <djvCore/LogSystem.h>
-#include <djvCore/OS.h>
 #include <djvCore/ResourceSystem.h>
 #include <djvCore/TextSystem.h>
 #include <djvCore/Timer.h>
 
-#define GLFW_INCLUDE_NONE
-#include <GLFW/glfw3.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 #include <atomic>
 #include <mutex>
+#include <set>
 #include <thread>
 
 using namespace djv::Core;
@@ -31,11 +32,11 @@ namespace djv
     {
         namespace
         {
-            //! \todo Should this be configurable?
-            const size_t infoProcessMax  = 4;
-            const size_t imageProcessMax = 4;
-            const size_t infoCacheMax    = 1000;
-            const size_t imageCacheMax   = 1000;
+            //! The maximum default number of worker threads.
+            const size_t threadCountMax = 8;
+            const size_t infoCacheMax   = 1000;
+            const size_t imageCacheMax  = 1000;
+            const size_t diskCacheMax   = 256 * Memory::megabyte;
 
             struct InfoRequest
             {
@@ -46,8 +47,7 @@ namespace djv
                 InfoRequest(InfoRequest&& other) noexcept :
                     uid(other.uid),
                     fileInfo(other.fileInfo),
-                    read(std::move(other.read)),
-                    infoFuture(std::move(other.infoFuture)),
+                    priority(other.priority),
                     promise(std::move(other.promise))
                 {}
 
@@ -60,8 +60,7 @@ namespace djv
                     {
                         uid = other.uid;
                         fileInfo = other.fileInfo;
-                        read = std::move(other.read);
-                        infoFuture = std::move(other.infoFuture);
+                        priority = other.priority;
                         promise = std::move(other.promise);
                     }
                     return *this;
@@ -69,8 +68,7 @@ namespace djv
 
                 UID uid = 0;
                 FileSystem::FileInfo fileInfo;
-                std::shared_ptr<IO::IRead> read;
-                std::future<IO::Info> infoFuture;
+                ThumbnailPriority priority = ThumbnailPriority::High;
                 std::promise<IO::Info> promise;
             };
 
@@ -85,7 +83,7 @@ namespace djv
                     fileInfo(other.fileInfo),
                     size(std::move(other.size)),
                     type(std::move(other.type)),
-                    read(std::move(other.read)),
+                    priority(other.priority),
                     promise(std::move(other.promise))
                 {}
 
@@ -100,7 +98,7 @@ namespace djv
                         fileInfo = other.fileInfo;
                         size = std::move(other.size);
                         type = std::move(other.type);
-                        read = std::move(other.read);
+                        priority = other.priority;
                         promise = std::move(other.promise);
                     }
                     return *this;
@@ -110,10 +108,34 @@ namespace djv
                 FileSystem::FileInfo fileInfo;
                 Image::Size size;
                 Image::Type type = Image::Type::None;
-                std::shared_ptr<IO::IRead> read;
+                ThumbnailPriority priority = ThumbnailPriority::High;
                 std::promise<std::shared_ptr<Image::Image> > promise;
             };
 
+            template<typename T>
+            typename std::list<T>::iterator findRequest(std::list<T>& requests, UID uid)
+            {
+                return std::find_if(
+                    requests.begin(),
+                    requests.end(),
+                    [uid](const T& value)
+                {
+                    return value.uid == uid;
+                });
+            }
+
+            template<typename T>
+            typename std::list<T>::iterator findRequest(std::list<T>& requests, ThumbnailPriority priority)
+            {
+                return std::find_if(
+                    requests.begin(),
+                    requests.end(),
+                    [priority](const T& value)
+                {
+                    return value.priority == priority;
+                });
+            }
+
             size_t getInfoCacheKey(const FileSystem::FileInfo& fileInfo)
             {
                 size_t out = 0;
@@ -131,6 +153,29 @@ namespace djv
                 return out;
             }
 
+            //! Get a string that identifies the options that affect the
+            //! thumbnails, so that the disk cache does not need to be cleared
+            //! when they change.
+            std::string getOptionsKey(const std::shared_ptr<IO::System>& io)
+            {
+                rapidjson::Document document;
+                document.SetObject();
+                auto& allocator = document.GetAllocator();
+                for (const auto& i : io->getPluginNames())
+                {
+                    document.AddMember(
+                        rapidjson::Value(i.c_str(), allocator),
+                        io->getOptions(i, allocator),
+                        allocator);
+                }
+                rapidjson::StringBuffer buffer;
+                rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+                document.Accept(writer);
+                std::stringstream ss;
+                ss << buffer.GetString() << Time::getDefaultSpeed();
+                return ss.str();
+            }
+
         } // namespace
         
         ThumbnailSystem::InfoFuture::InfoFuture()
@@ -160,21 +205,25 @@ namespace djv
 
             std::list<InfoRequest> infoRequests;
             std::list<ImageRequest> imageRequests;
+            std::set<UID> runningRequests;
+            std::set<UID> cancelledRequests;
             std::condition_variable requestCV;
-            std::mutex requestMutex;
-            std::list<InfoRequest> pendingInfoRequests;
-            std::list<ImageRequest> pendingImageRequests;
+            mutable std::mutex requestMutex;
 
             Memory::Cache<size_t, IO::Info> infoCache;
             std::atomic<float> infoCachePercentage;
             Memory::Cache<size_t, std::shared_ptr<Image::Image> > imageCache;
             std::atomic<float> imageCachePercentage;
-            std::atomic<bool> clearCache;
+            std::mutex cacheMutex;
+            std::shared_ptr<ThumbnailDiskCache> diskCache;
+            std::atomic<float> diskCachePercentage;
             std::shared_ptr<ValueObserver<bool> > ioOptionsObserver;
 
-            GLFWwindow * glfwWindow = nullptr;
+            std::shared_ptr<ResourceSystem> resourceSystem;
+            std::shared_ptr<LogSystem> logSystem;
             std::shared_ptr<Time::Timer> statsTimer;
-            std::thread thread;
+            std::vector<std::thread> threads;
+            std::atomic<bool> threadsRunning;
             std::atomic<bool> running;
         };
 
@@ -192,27 +241,21 @@ namespace djv
             p.infoCachePercentage = 0.F;
             p.imageCache.setMax(imageCacheMax);
             p.imageCachePercentage = 0.F;
-            p.clearCache = false;
+            p.diskCachePercentage = 0.F;
 
-#if defined(DJV_OPENGL_ES2)
-            glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
-#else // DJV_OPENGL_ES2
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
-            glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-            glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-#endif // DJV_OPENGL_ES2
-            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
-            if (OS::getIntEnv("DJV_OPENGL_DEBUG") != 0)
+            p.resourceSystem = context->getSystemT<ResourceSystem>();
+            p.logSystem = context->getSystemT<LogSystem>();
+            try
             {
-                glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+                p.diskCache = ThumbnailDiskCache::create(
+                    FileSystem::Path(p.resourceSystem->getPath(FileSystem::ResourcePath::Documents), "ThumbnailCache").get(),
+                    diskCacheMax);
+                p.diskCache->setOptionsKey(getOptionsKey(p.io));
+                p.diskCachePercentage = p.diskCache->getPercentageUsed();
             }
-            p.glfwWindow = glfwCreateWindow(100, 100, context->getName().c_str(), NULL, NULL);
-            if (!p.glfwWindow)
+            catch (const std::exception& e)
             {
-                throw ThumbnailError(p.textSystem->getText(DJV_TEXT("error_glfw_window_creation")));
+                _log(e.what(), LogLevel::Warning);
             }
 
             p.statsTimer = Time::Timer::create(context);
@@ -224,77 +267,20 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 std::stringstream ss;
                 {
-                    ss << "Info cache: " << p.infoCachePercentage << "%\n";
-                    ss << "Image cache: " << p.imageCachePercentage << '%';
+                    std::unique_lock<std::mutex> lock(p.requestMutex);
+                    ss << "Requests: " << p.infoRequests.size() + p.imageRequests.size() << '\n';
+                    ss << "Running: " << p.runningRequests.size() << '\n';
                 }
+                ss << "Info cache: " << p.infoCachePercentage << "%\n";
+                ss << "Image cache: " << p.imageCachePercentage << "%\n";
+                ss << "Disk cache: " << p.diskCachePercentage << '%';
                 _log(ss.str());
             });
 
-            auto logSystem = context->getSystemT<LogSystem>();
-            auto resourceSystem = context->getSystemT<ResourceSystem>();
             p.running = true;
-            p.thread = std::thread(
-                [this, resourceSystem, logSystem]
-            {
-                DJV_PRIVATE_PTR();
-                try
-                {
-                    glfwMakeContextCurrent(p.glfwWindow);
-#if defined(DJV_OPENGL_ES2)
-                    if (!gladLoadGLES2Loader((GLADloadproc)glfwGetProcAddress))
-#else // DJV_OPENGL_ES2
-                    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
-#endif // DJV_OPENGL_ES2
-                    {
-                        throw ThumbnailError(p.textSystem->getText(DJV_TEXT("error_glad_init")));
-                    }
-
-                    auto convert = Image::Convert::create(resourceSystem);
-
-                    const auto timeout = Time::getValue(Time::TimerValue::Medium);
-                    while (p.running)
-                    {
-                        if (p.clearCache)
-                        {
-                            p.clearCache = false;
-                            p.infoCache.clear();
-                            p.infoCachePercentage = 0.F;
-                            p.imageCache.clear();
-                            p.imageCachePercentage = 0.F;
-                        }
-
-                        bool infoRequests  = p.pendingInfoRequests.size();
-                        bool imageRequests = p.pendingImageRequests.size();
-                        {
-                            std::unique_lock<std::mutex> lock(p.requestMutex);
-                            if (p.requestCV.wait_for(
-                                lock,
-                                std::chrono::milliseconds(timeout),
-                                [this]
-                            {
-                                DJV_PRIVATE_PTR();
-                                return p.infoRequests.size() || p.imageRequests.size();
-                            }))
-                            {
-                                infoRequests  |= p.infoRequests.size () > 0;
-                                imageRequests |= p.imageRequests.size() > 0;
-                            }
-                        }
-                        if (infoRequests)
-                        {
-                            _handleInfoRequests();
-                        }
-                        if (imageRequests)
-                        {
-                            _handleImageRequests(convert);
-                        }
-                    }
-                }
-                catch (const std::exception& e)
-                {
-                    logSystem->log("djv::AV::ThumbnailSystem", e.what(), LogLevel::Error);
-                }
-            });
+            _startThreads(std::max(
+                std::min(static_cast<size_t>(std::thread::hardware_concurrency()), threadCountMax),
+                static_cast<size_t>(1)));
 
             auto weak = std::weak_ptr<ThumbnailSystem>(std::dynamic_pointer_cast<ThumbnailSystem>(shared_from_this()));
             p.ioOptionsObserver = ValueObserver<bool>::create(
@@ -319,14 +305,7 @@ namespace djv
         {
             DJV_PRIVATE_PTR();
             p.running = false;
-            if (p.thread.joinable())
-            {
-                p.thread.join();
-            }
-            if (p.glfwWindow)
-            {
-                glfwDestroyWindow(p.glfwWindow);
-            }
+            _stopThreads();
         }
 
         std::shared_ptr<ThumbnailSystem> ThumbnailSystem::create(const std::shared_ptr<Core::Context>& context)
@@ -336,77 +315,109 @@ namespace djv
             return out;
         }
 
-        ThumbnailSystem::InfoFuture ThumbnailSystem::getInfo(const FileSystem::FileInfo& fileInfo)
+        ThumbnailSystem::InfoFuture ThumbnailSystem::getInfo(
+            const FileSystem::FileInfo& fileInfo,
+            ThumbnailPriority           priority)
         {
             DJV_PRIVATE_PTR();
             InfoRequest request;
             request.fileInfo = fileInfo;
+            request.priority = priority;
             auto future = request.promise.get_future();
+            const UID uid = request.uid;
             {
                 std::unique_lock<std::mutex> lock(p.requestMutex);
                 p.infoRequests.push_back(std::move(request));
             }
             p.requestCV.notify_one();
-            return InfoFuture(future, request.uid);
+            return InfoFuture(future, uid);
         }
         
         void ThumbnailSystem::cancelInfo(UID uid)
         {
             DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            const auto i = findRequest(p.infoRequests, uid);
+            if (i != p.infoRequests.end())
             {
-                std::unique_lock<std::mutex> lock(p.requestMutex);
-                const auto i = std::find_if(
-                    p.infoRequests.rbegin(),
-                    p.infoRequests.rend(),
-                    [uid](const InfoRequest& value)
-                {
-                    return value.uid == uid;
-                });
-                if (i != p.infoRequests.rend())
-                {
-                    p.infoRequests.erase(--(i.base()));
-                }
+                p.infoRequests.erase(i);
+            }
+            else if (p.runningRequests.find(uid) != p.runningRequests.end())
+            {
+                p.cancelledRequests.insert(uid);
             }
         }
 
         ThumbnailSystem::ImageFuture ThumbnailSystem::getImage(
             const FileSystem::FileInfo& fileInfo,
             const Image::Size&          size,
-            Image::Type                 type)
+            Image::Type                 type,
+            ThumbnailPriority           priority)
         {
             DJV_PRIVATE_PTR();
             ImageRequest request;
             request.fileInfo = fileInfo;
             request.size = size;
             request.type = type;
+            request.priority = priority;
             auto future = request.promise.get_future();
+            const UID uid = request.uid;
             {
                 std::unique_lock<std::mutex> lock(p.requestMutex);
                 p.imageRequests.push_back(std::move(request));
             }
             p.requestCV.notify_one();
-            return ImageFuture(future, request.uid);
+            return ImageFuture(future, uid);
         }
         
         void ThumbnailSystem::cancelImage(UID uid)
         {
             DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            const auto i = findRequest(p.imageRequests, uid);
+            if (i != p.imageRequests.end())
             {
-                std::unique_lock<std::mutex> lock(p.requestMutex);
-                const auto i = std::find_if(
-                    p.imageRequests.rbegin(),
-                    p.imageRequests.rend(),
-                    [uid](const ImageRequest& value)
-                {
-                    return value.uid == uid;
-                });
-                if (i != p.imageRequests.rend())
+                p.imageRequests.erase(i);
+            }
+            else if (p.runningRequests.find(uid) != p.runningRequests.end())
+            {
+                p.cancelledRequests.insert(uid);
+            }
+        }
+
+        void ThumbnailSystem::setPriority(UID uid, ThumbnailPriority value)
+        {
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            const auto i = findRequest(p.infoRequests, uid);
+            if (i != p.infoRequests.end())
+            {
+                i->priority = value;
+            }
+            else
+            {
+                const auto j = findRequest(p.imageRequests, uid);
+                if (j != p.imageRequests.end())
                 {
-                    p.imageRequests.erase(--(i.base()));
+                    j->priority = value;
                 }
             }
         }
 
+        size_t ThumbnailSystem::getThreadCount() const
+        {
+            return _p->threads.size();
+        }
+
+        void ThumbnailSystem::setThreadCount(size_t value)
+        {
+            DJV_PRIVATE_PTR();
+            if (value == p.threads.size())
+                return;
+            _stopThreads();
+            _startThreads(value);
+        }
+
         float ThumbnailSystem::getInfoCachePercentage() const
         {
             return _p->infoCachePercentage;
@@ -417,226 +428,351 @@ namespace djv
             return _p->imageCachePercentage;
         }
 
-        void ThumbnailSystem::clearCache()
+        float ThumbnailSystem::getDiskCachePercentage() const
         {
-            _p->clearCache = true;
+            return _p->diskCachePercentage;
         }
 
-        void ThumbnailSystem::_handleInfoRequests()
+        void ThumbnailSystem::clearCache()
         {
             DJV_PRIVATE_PTR();
+            {
+                std::unique_lock<std::mutex> lock(p.cacheMutex);
+                p.infoCache.clear();
+                p.infoCachePercentage = 0.F;
+                p.imageCache.clear();
+                p.imageCachePercentage = 0.F;
+            }
+            if (p.diskCache)
+            {
+                p.diskCache->setOptionsKey(getOptionsKey(p.io));
+            }
+        }
 
-            // Process new requests.
-            while (p.pendingInfoRequests.size() < infoProcessMax)
+        void ThumbnailSystem::_startThreads(size_t value)
+        {
+            // The images are resized on the CPU so that each thread does not
+            // need an OpenGL context.
+            DJV_PRIVATE_PTR();
+            p.threadsRunning = true;
+            auto resourceSystem = p.resourceSystem;
+            auto logSystem = p.logSystem;
+            for (size_t i = 0; i < value; ++i)
             {
-                InfoRequest i;
+                p.threads.push_back(std::thread(
+                    [this, resourceSystem, logSystem]
                 {
-                    std::unique_lock<std::mutex> lock(p.requestMutex);
-                    if (p.infoRequests.size())
+                    try
                     {
-                        i = std::move(p.infoRequests.front());
-                        p.infoRequests.pop_front();
+                        auto convert = Image::Convert::create(Image::ConvertBackend::CPU, resourceSystem);
+                        convert->setThreadCount(1);
+                        _run(convert);
                     }
-                    else
+                    catch (const std::exception& e)
                     {
-                        break;
+                        logSystem->log("djv::AV::ThumbnailSystem", e.what(), LogLevel::Error);
                     }
+                }));
+            }
+        }
+
+        void ThumbnailSystem::_stopThreads()
+        {
+            DJV_PRIVATE_PTR();
+            {
+                std::unique_lock<std::mutex> lock(p.requestMutex);
+                p.threadsRunning = false;
+            }
+            p.requestCV.notify_all();
+            for (auto& i : p.threads)
+            {
+                if (i.joinable())
+                {
+                    i.join();
                 }
-                const auto key = getInfoCacheKey(i.fileInfo);
-                IO::Info info;
-                const bool cached = p.infoCache.get(key, info);
-                if (cached)
+            }
+            p.threads.clear();
+        }
+
+        void ThumbnailSystem::_run(const std::shared_ptr<Image::Convert>& convert)
+        {
+            DJV_PRIVATE_PTR();
+            const auto timeout = Time::getValue(Time::TimerValue::Medium);
+            while (p.running && p.threadsRunning)
+            {
+                InfoRequest infoRequest;
+                ImageRequest imageRequest;
+                bool info = false;
+                bool image = false;
                 {
-                    i.promise.set_value(info);
+                    std::unique_lock<std::mutex> lock(p.requestMutex);
+                    if (p.requestCV.wait_for(
+                        lock,
+                        std::chrono::milliseconds(timeout),
+                        [this]
+                    {
+                        DJV_PRIVATE_PTR();
+                        return p.infoRequests.size() || p.imageRequests.size() || !p.running || !p.threadsRunning;
+                    }) && p.running && p.threadsRunning)
+                    {
+                        // Take the first request with the highest priority.
+                        // Information requests are quick so they are taken
+                        // before image requests of the same priority.
+                        for (size_t i = 0; i < static_cast<size_t>(ThumbnailPriority::Count) && !info && !image; ++i)
+                        {
+                            const auto priority = static_cast<ThumbnailPriority>(i);
+                            const auto j = findRequest(p.infoRequests, priority);
+                            if (j != p.infoRequests.end())
+                            {
+                                infoRequest = std::move(*j);
+                                p.infoRequests.erase(j);
+                                p.runningRequests.insert(infoRequest.uid);
+                                info = true;
+                            }
+                            else
+                            {
+                                const auto k = findRequest(p.imageRequests, priority);
+                                if (k != p.imageRequests.end())
+                                {
+                                    imageRequest = std::move(*k);
+                                    p.imageRequests.erase(k);
+                                    p.runningRequests.insert(imageRequest.uid);
+                                    image = true;
+                                }
+                            }
+                        }
+                    }
                 }
-                else
+                if (info)
                 {
                     try
                     {
-                        i.read = p.io->read(i.fileInfo);
-                        i.infoFuture = i.read->getInfo();
-                        p.pendingInfoRequests.push_back(std::move(i));
+                        const auto value = _getInfo(infoRequest.fileInfo);
+                        if (!_isCancelled(infoRequest.uid))
+                        {
+                            infoRequest.promise.set_value(value);
+                        }
                     }
                     catch (const std::exception&)
                     {
                         try
                         {
-                            i.promise.set_exception(std::current_exception());
+                            infoRequest.promise.set_exception(std::current_exception());
                         }
                         catch (const std::exception& e)
                         {
                             _log(e.what(), LogLevel::Error);
                         }
                     }
+                    std::unique_lock<std::mutex> lock(p.requestMutex);
+                    p.runningRequests.erase(infoRequest.uid);
+                    p.cancelledRequests.erase(infoRequest.uid);
                 }
-            }
-
-            // Process pending requests.
-            auto i = p.pendingInfoRequests.begin();
-            while (i != p.pendingInfoRequests.end())
-            {
-                if (i->infoFuture.valid() &&
-                    i->infoFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                if (image)
                 {
                     try
                     {
-                        const auto info = i->infoFuture.get();
-                        p.infoCache.add(getInfoCacheKey(i->fileInfo), info);
-                        p.infoCachePercentage = p.infoCache.getPercentageUsed();
-                        i->promise.set_value(info);
+                        const auto value = _getImage(
+                            imageRequest.uid,
+                            imageRequest.fileInfo,
+                            imageRequest.size,
+                            imageRequest.type,
+                            convert);
+                        if (!_isCancelled(imageRequest.uid))
+                        {
+                            imageRequest.promise.set_value(value);
+                        }
                     }
                     catch (const std::exception&)
                     {
                         try
                         {
-                            i->promise.set_exception(std::current_exception());
+                            imageRequest.promise.set_exception(std::current_exception());
                         }
                         catch (const std::exception& e)
                         {
                             _log(e.what(), LogLevel::Error);
                         }
                     }
-                    i = p.pendingInfoRequests.erase(i);
-                }
-                else
-                {
-                    ++i;
+                    std::unique_lock<std::mutex> lock(p.requestMutex);
+                    p.runningRequests.erase(imageRequest.uid);
+                    p.cancelledRequests.erase(imageRequest.uid);
                 }
             }
         }
 
-        void ThumbnailSystem::_handleImageRequests(const std::shared_ptr<Image::Convert>& convert)
+        bool ThumbnailSystem::_isCancelled(UID uid) const
         {
             DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            return p.cancelledRequests.find(uid) != p.cancelledRequests.end();
+        }
 
-            // Process new requests.
-            while (p.pendingImageRequests.size() < imageProcessMax)
+        IO::Info ThumbnailSystem::_getInfo(const FileSystem::FileInfo& fileInfo)
+        {
+            DJV_PRIVATE_PTR();
+            const auto key = getInfoCacheKey(fileInfo);
+            IO::Info out;
             {
-                ImageRequest i;
+                std::unique_lock<std::mutex> lock(p.cacheMutex);
+                if (p.infoCache.get(key, out))
                 {
-                    std::unique_lock<std::mutex> lock(p.requestMutex);
-                    if (p.imageRequests.size())
-                    {
-                        i = std::move(p.imageRequests.front());
-                        p.imageRequests.pop_front();
-                    }
-                    else
-                    {
-                        break;
-                    }
+                    return out;
                 }
-                const auto key = getImageCacheKey(i.fileInfo, i.size, i.type);
-                std::shared_ptr<Image::Image> image;
-                p.imageCache.get(key, image);
-                if (image)
+            }
+            if (!(p.diskCache && p.diskCache->getInfo(fileInfo, out)))
+            {
+                out = p.io->read(fileInfo)->getInfo().get();
+                _addDiskCache(fileInfo, out);
+            }
+            {
+                std::unique_lock<std::mutex> lock(p.cacheMutex);
+                p.infoCache.add(key, out);
+                p.infoCachePercentage = p.infoCache.getPercentageUsed();
+            }
+            return out;
+        }
+
+        std::shared_ptr<Image::Image> ThumbnailSystem::_getImage(
+            UID                                     uid,
+            const FileSystem::FileInfo&             fileInfo,
+            const Image::Size&                      size,
+            Image::Type                             type,
+            const std::shared_ptr<Image::Convert>&  convert)
+        {
+            DJV_PRIVATE_PTR();
+            const auto key = getImageCacheKey(fileInfo, size, type);
+            std::shared_ptr<Image::Image> out;
+            {
+                std::unique_lock<std::mutex> lock(p.cacheMutex);
+                if (p.imageCache.get(key, out))
                 {
-                    i.promise.set_value(image);
+                    return out;
                 }
-                else
+            }
+            if (p.diskCache && p.diskCache->getImage(fileInfo, size, type, out))
+            {
+                std::unique_lock<std::mutex> lock(p.cacheMutex);
+                p.imageCache.add(key, out);
+                p.imageCachePercentage = p.imageCache.getPercentageUsed();
+                return out;
+            }
+
+            const auto info = _getInfo(fileInfo);
+            if (0 == info.video.size())
+            {
+                return nullptr;
+            }
+
+            // Use the smallest proxy that still covers the thumbnail size.
+            IO::ReadOptions options;
+            const auto& videoSize = info.video[0].info.size;
+            while (options.proxy < 15)
+            {
+                const auto proxySize = IO::getProxySize(videoSize, options.proxy + 1);
+                if (proxySize.w < size.w && proxySize.h < size.h)
                 {
-                    try
-                    {
-                        i.read = p.io->read(i.fileInfo);
-                        const auto info = i.read->getInfo().get();
-                        if (info.video.size() > 0)
-                        {
-                            p.pendingImageRequests.push_back(std::move(i));
-                        }
-                        else
-                        {
-                            i.promise.set_value(nullptr);
-                        }
-                    }
-                    catch (const std::exception&)
-                    {
-                        try
-                        {
-                            i.promise.set_exception(std::current_exception());
-                        }
-                        catch (const std::exception& e)
-                        {
-                            _log(e.what(), LogLevel::Error);
-                        }
-                    }
+                    break;
                 }
+                ++options.proxy;
             }
+            auto read = p.io->read(fileInfo, options);
 
-            // Process pending requests.
-            auto i = p.pendingImageRequests.begin();
-            while (i != p.pendingImageRequests.end())
+            // Wait for the first frame. The reader notifies the queue when a
+            // frame is added, the timeout is only for noticing whether the
+            // request has been cancelled.
+            const auto timeout = Time::getTime(Time::TimerValue::Fast);
             {
-                std::shared_ptr<Image::Image> image;
-                bool finished = false;
+                std::unique_lock<std::mutex> lock(read->getMutex());
+                auto& queue = read->getVideoQueue();
+                while (p.running && !_isCancelled(uid))
                 {
-                    std::lock_guard<std::mutex> lock(i->read->getMutex());
-                    auto& queue = i->read->getVideoQueue();
                     if (!queue.isEmpty())
                     {
-                        image = queue.getFrame().image;
+                        out = queue.getFrame().image;
+                        break;
                     }
                     if (queue.isFinished())
                     {
-                        finished = true;
+                        break;
                     }
+                    queue.getCV().wait_for(lock, timeout);
                 }
-                if (image)
+            }
+            if (!out || _isCancelled(uid))
+            {
+                return nullptr;
+            }
+
+            Image::Size imageSize = out->getSize();
+            imageSize.w *= out->getInfo().pixelAspectRatio;
+            if (size != imageSize || type != Image::Type::None)
+            {
+                Image::Size thumbnailSize = size;
+                const float aspect = thumbnailSize.h != 0 ? (thumbnailSize.w / static_cast<float>(thumbnailSize.h)) : 1.F;
+                const float imageAspect = imageSize.h != 0 ? (imageSize.w / static_cast<float>(imageSize.h)) : 1.F;
+                if (imageAspect < aspect)
                 {
-                    try
-                    {
-                        Image::Size imageSize = image->getSize();
-                        imageSize.w *= image->getInfo().pixelAspectRatio;
-                        if (i->size != imageSize || i->type != Image::Type::None)
-                        {
-                            Image::Size size = i->size;
-                            const float aspect = size.h != 0 ? (size.w / static_cast<float>(size.h)) : 1.F;
-                            const float imageAspect = imageSize.h != 0 ? (imageSize.w / static_cast<float>(imageSize.h)) : 1.F;
-                            if (imageAspect < aspect)
-                            {
-                                size.w = static_cast<uint16_t>(size.h * imageAspect);
-                            }
-                            else
-                            {
-                                size.h = static_cast<int>(size.w / imageAspect);
-                            }
-                            const auto type = i->type != Image::Type::None ? i->type : image->getType();
-                            auto info = Image::Info(size, type);
+                    thumbnailSize.w = static_cast<uint16_t>(thumbnailSize.h * imageAspect);
+                }
+                else
+                {
+                    thumbnailSize.h = static_cast<int>(thumbnailSize.w / imageAspect);
+                }
+                auto thumbnailInfo = Image::Info(thumbnailSize, type != Image::Type::None ? type : out->getType());
 #if defined(DJV_OPENGL_ES2)
-                            info.type = Image::Type::RGBA_U8;
+                thumbnailInfo.type = Image::Type::RGBA_U8;
 #endif // DJV_OPENGL_ES2
-                            auto tmp = Image::Image::create(info);
-                            tmp->setPluginName(image->getPluginName());
-                            tmp->setTags(image->getTags());
-                            convert->process(*image, info, *tmp);
-                            image = tmp;
-                        }
-                        p.imageCache.add(getImageCacheKey(i->fileInfo, i->size, i->type), image);
-                        p.imageCachePercentage = p.imageCache.getPercentageUsed();
-                        i->promise.set_value(image);
-                    }
-                    catch (const std::exception&)
-                    {
-                        try
-                        {
-                            i->promise.set_exception(std::current_exception());
-                        }
-                        catch (const std::exception& e)
-                        {
-                            _log(e.what(), LogLevel::Error);
-                        }
-                    }
+                auto tmp = Image::Image::create(thumbnailInfo);
+                tmp->setPluginName(out->getPluginName());
+                tmp->setTags(out->getTags());
+                convert->process(*out, thumbnailInfo, *tmp);
+                out = tmp;
+            }
+            {
+                std::unique_lock<std::mutex> lock(p.cacheMutex);
+                p.imageCache.add(key, out);
+                p.imageCachePercentage = p.imageCache.getPercentageUsed();
+            }
+            _addDiskCache(fileInfo, size, type, out);
+            return out;
+        }
+
+        void ThumbnailSystem::_addDiskCache(const FileSystem::FileInfo& fileInfo, const IO::Info& info)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.diskCache)
+            {
+                try
+                {
+                    p.diskCache->addInfo(fileInfo, info);
                 }
-                else if (finished)
+                catch (const std::exception& e)
                 {
-                    i->promise.set_value(nullptr);
+                    _log(e.what(), LogLevel::Warning);
                 }
-                if (image || finished)
+                p.diskCachePercentage = p.diskCache->getPercentageUsed();
+            }
+        }
+
+        void ThumbnailSystem::_addDiskCache(
+            const FileSystem::FileInfo&             fileInfo,
+            const Image::Size&                      size,
+            Image::Type                             type,
+            const std::shared_ptr<Image::Image>&    image)
+        {
+            DJV_PRIVATE_PTR();
+            if (p.diskCache)
+            {
+                try
                 {
-                    i = p.pendingImageRequests.erase(i);
+                    p.diskCache->addImage(fileInfo, size, type, image);
                 }
-                else
+                catch (const std::exception& e)
                 {
-                    ++i;
+                    _log(e.what(), LogLevel::Warning);
                 }
+                p.diskCachePercentage = p.diskCache->getPercentageUsed();
             }
         }
 
@@ -40,6 +40,17 @@ namespace djv
             
         } // namespace Image
             
+        //! This enumeration provides thumbnail request priorities. Requests
+        //! with a higher priority are started first.
+        enum class ThumbnailPriority
+        {
+            High,
+            Low,
+
+            Count,
+            First = High
+        };
+
         //! This class provides a thumbnail error.
         class ThumbnailError : public std::runtime_error
         {
@@ -48,6 +59,9 @@ namespace djv
         };
         
         //! This class provides a system for generating thumbnail images from files.
+        //!
+        //! Requests are handled by a bounded pool of worker threads, which
+        //! read the files and resize the images on the CPU.
         class ThumbnailSystem : public Core::ISystem
         {
             DJV_NON_COPYABLE(ThumbnailSystem);
@@ -60,8 +74,6 @@ namespace djv
             virtual ~ThumbnailSystem();
 
             //! Create a new thumbnail system.
-            //! Throws:
-            //! - ThumbnailError
             static std::shared_ptr<ThumbnailSystem> create(const std::shared_ptr<Core::Context>&);
 
             //! This structure provides information about a file.
@@ -74,9 +86,12 @@ namespace djv
             };
             
             //! Get information about a file.
-            InfoFuture getInfo(const Core::FileSystem::FileInfo&);
+            InfoFuture getInfo(
+                const Core::FileSystem::FileInfo&,
+                ThumbnailPriority = ThumbnailPriority::High);
 
-            //! Cancel information about a file.
+            //! Cancel information about a file. Requests that have already
+            //! been started are stopped as soon as possible.
             void cancelInfo(Core::UID);
 
             //! This structure provides a thumbnail image for a file.
@@ -92,23 +107,55 @@ namespace djv
             ImageFuture getImage(
                 const Core::FileSystem::FileInfo& path,
                 const Image::Size&                size,
-                Image::Type                       type = Image::Type::None);
+                Image::Type                       type     = Image::Type::None,
+                ThumbnailPriority                 priority = ThumbnailPriority::High);
 
-            //! Cancel a thumbnail image.
+            //! Cancel a thumbnail image. Requests that have already been
+            //! started are stopped as soon as possible.
             void cancelImage(Core::UID);
 
+            //! Set the priority of a request that has not been started.
+            void setPriority(Core::UID, ThumbnailPriority);
+
+            //! Get the number of worker threads.
+            size_t getThreadCount() const;
+
+            //! Set the number of worker threads. Requests that are running
+            //! are finished first. While the thread count is zero requests
+            //! are queued but not started.
+            void setThreadCount(size_t);
+
             //! Get the infromation cache percentage used.
             float getInfoCachePercentage() const;
 
             //! Get the image cache percentage used.
             float getImageCachePercentage() const;
 
-            //! Clear the cache.
+            //! Get the disk cache percentage used.
+            float getDiskCachePercentage() const;
+
+            //! Clear the cache. Entries in the disk cache are not removed, but
+            //! they are no longer used if the options have changed.
             void clearCache();
 
         private:
-            void _handleInfoRequests();
-            void _handleImageRequests(const std::shared_ptr<Image::Convert>&);
+            void _startThreads(size_t);
+            void _stopThreads();
+            void _run(const std::shared_ptr<Image::Convert>&);
+            bool _isCancelled(Core::UID) const;
+            IO::Info _getInfo(const Core::FileSystem::FileInfo&);
+            std::shared_ptr<Image::Image> _getImage(
+                Core::UID,
+                const Core::FileSystem::FileInfo&,
+                const Image::Size&,
+                Image::Type,
+                const std::shared_ptr<Image::Convert>&);
+            void _addDiskCache(const Core::FileSystem::FileInfo&, const IO::Info&);
+            void _addDiskCache(
+                const Core::FileSystem::FileInfo&,
+                const Image::Size&,
+                Image::Type,
+                const std::shared_ptr<Image::Image>&);
 
             DJV_PRIVATE();
         };
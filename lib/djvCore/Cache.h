@@ -6,7 +6,10 @@
 
 #include <djvCore/Core.h>
 
-#include <map>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
 #include <vector>
 
 namespace djv
@@ -15,10 +18,14 @@ namespace djv
     {
         namespace Memory
         {
-            //! This class provides a cache.
+            //! This class provides a least recently used (LRU) cache.
+            //!
+            //! The items are stored in a list ordered by use, with a hash map
+            //! for lookups, so that getting, adding, and evicting items are
+            //! constant time operations.
             //!
             //! \todo Return an iterator from get() instead of a value.
-            template<typename T, typename U>
+            template<typename T, typename U, typename H = std::hash<T> >
             class Cache
             {
             public:
@@ -41,18 +48,25 @@ namespace djv
                 void remove(const T& key);
                 void clear();
 
+                //! Get the keys, sorted.
                 std::vector<T> getKeys() const;
+
+                //! Get the values, sorted by key.
                 std::vector<U> getValues() const;
 
                 ///@}
 
             private:
+                typedef std::list<std::pair<T, U> > List;
+
                 void _updateMax();
+                std::vector<typename List::const_iterator> _getSorted() const;
 
                 size_t _max = 10000;
-                std::map<T, U> _map;
-                mutable std::map<T, int64_t> _counts;
-                mutable int64_t _counter = 0;
+
+                //! The most recently used items are at the front of the list.
+                mutable List _list;
+                std::unordered_map<T, typename List::iterator, H> _map;
             };
 
         } // namespace Memory
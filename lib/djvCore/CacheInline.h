@@ -10,137 +10,136 @@ namespace djv
     {
         namespace Memory
         {
-            template<typename T, typename U>
-            inline size_t Cache<T, U>::getMax() const
+            template<typename T, typename U, typename H>
+            inline size_t Cache<T, U, H>::getMax() const
             {
                 return _max;
             }
 
-            template<typename T, typename U>
-            inline void Cache<T, U>::setMax(size_t value)
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::setMax(size_t value)
             {
                 _max = value;
                 _updateMax();
             }
 
-            template<typename T, typename U>
-            inline size_t Cache<T, U>::getSize() const
+            template<typename T, typename U, typename H>
+            inline size_t Cache<T, U, H>::getSize() const
             {
                 return _map.size();
             }
 
-            template<typename T, typename U>
-            inline float Cache<T, U>::getPercentageUsed() const
+            template<typename T, typename U, typename H>
+            inline float Cache<T, U, H>::getPercentageUsed() const
             {
                 return _map.size() / static_cast<float>(_max) * 100.F;
             }
 
-            template<typename T, typename U>
-            inline bool Cache<T, U>::contains(const T& key) const
+            template<typename T, typename U, typename H>
+            inline bool Cache<T, U, H>::contains(const T& key) const
             {
                 return _map.find(key) != _map.end();
             }
 
-            template<typename T, typename U>
-            inline bool Cache<T, U>::get(const T& key, U& value) const
+            template<typename T, typename U, typename H>
+            inline bool Cache<T, U, H>::get(const T& key, U& value) const
             {
-                auto i = _map.find(key);
-                if (i != _map.end())
+                const auto i = _map.find(key);
+                const bool found = i != _map.end();
+                if (found)
                 {
-                    value = i->second;
-                    auto j = _counts.find(key);
-                    if (j != _counts.end())
-                    {
-                        ++_counter;
-                        j->second = _counter;
-                    }
-                    return true;
+                    _list.splice(_list.begin(), _list, i->second);
+                    value = i->second->second;
                 }
-                return i != _map.end();
+                return found;
             }
 
-            template<typename T, typename U>
-            inline void Cache<T, U>::add(const T& key, const U& value)
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::add(const T& key, const U& value)
             {
-                _map[key] = value;
-                ++_counter;
-                _counts[key] = _counter;
-                _updateMax();
+                const auto i = _map.find(key);
+                if (i != _map.end())
+                {
+                    i->second->second = value;
+                    _list.splice(_list.begin(), _list, i->second);
+                }
+                else
+                {
+                    _list.push_front(std::make_pair(key, value));
+                    _map[key] = _list.begin();
+                    _updateMax();
+                }
             }
 
-            template<typename T, typename U>
-            inline void Cache<T, U>::remove(const T& key)
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::remove(const T& key)
             {
                 const auto i = _map.find(key);
                 if (i != _map.end())
                 {
+                    _list.erase(i->second);
                     _map.erase(i);
                 }
-                const auto j = _counts.find(key);
-                if (j != _counts.end())
-                {
-                    _counts.erase(j);
-                }
-                _updateMax();
             }
             
-            template<typename T, typename U>
-            inline void Cache<T, U>::clear()
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::clear()
             {
+                _list.clear();
                 _map.clear();
             }
 
-            template<typename T, typename U>
-            inline std::vector<T> Cache<T, U>::getKeys() const
+            template<typename T, typename U, typename H>
+            inline std::vector<T> Cache<T, U, H>::getKeys() const
             {
                 std::vector<T> out;
-                for (const auto& i : _map)
+                for (const auto& i : _getSorted())
                 {
-                    out.push_back(i.first);
+                    out.push_back(i->first);
                 }
                 return out;
             }
 
-            template<typename T, typename U>
-            inline std::vector<U> Cache<T, U>::getValues() const
+            template<typename T, typename U, typename H>
+            inline std::vector<U> Cache<T, U, H>::getValues() const
             {
                 std::vector<U> out;
-                for (const auto& i : _map)
+                for (const auto& i : _getSorted())
                 {
-                    out.push_back(i.second);
+                    out.push_back(i->second);
                 }
                 return out;
             }
 
-            template<typename T, typename U>
-            inline void Cache<T, U>::_updateMax()
+            template<typename T, typename U, typename H>
+            inline void Cache<T, U, H>::_updateMax()
             {
-                if (_map.size() > _max)
+                while (_map.size() > _max)
                 {
-                    std::map<int64_t, T> sorted;
-                    for (const auto& i : _counts)
-                    {
-                        sorted[i.second] = i.first;
-                    }
-                    while (_map.size() > _max)
-                    {
-                        auto begin = sorted.begin();
-                        auto i = _map.find(begin->second);
-                        if (i != _map.end())
-                        {
-                            _map.erase(i);
-                        }
-                        auto j = _counts.find(begin->second);
-                        if (j != _counts.end())
-                        {
-                            _counts.erase(j);
-                        }
-                        sorted.erase(begin);
-                    }
+                    _map.erase(_list.back().first);
+                    _list.pop_back();
                 }
             }
 
+            template<typename T, typename U, typename H>
+            inline std::vector<typename Cache<T, U, H>::List::const_iterator> Cache<T, U, H>::_getSorted() const
+            {
+                std::vector<typename List::const_iterator> out;
+                out.reserve(_list.size());
+                for (auto i = _list.cbegin(); i != _list.cend(); ++i)
+                {
+                    out.push_back(i);
+                }
+                std::sort(
+                    out.begin(),
+                    out.end(),
+                    [](const typename List::const_iterator& a, const typename List::const_iterator& b)
+                    {
+                        return a->first < b->first;
+                    });
+                return out;
+            }
+
         } // namespace Memory
     } // namespace Core
 } // namespace djv
-
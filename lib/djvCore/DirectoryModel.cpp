@@ -6,10 +6,13 @@
 
 #include <djvCore/DirectoryWatcher.h>
 #include <djvCore/FileInfo.h>
+#include <djvCore/String.h>
 #include <djvCore/Timer.h>
 #include <djvCore/OS.h>
 
 #include <future>
+#include <map>
+#include <unordered_map>
 
 namespace djv
 {
@@ -17,11 +20,41 @@ namespace djv
     {
         namespace FileSystem
         {
+            namespace
+            {
+                //! Get the key used to find the file sequence for a file.
+                std::string getSequenceKey(const FileInfo& value)
+                {
+                    const auto& path = value.getPath();
+                    return path.getBaseName() + '/' + path.getExtension();
+                }
+
+                //! Get whether a file sequence contains the frame of the given file.
+                bool containsFrame(const FileInfo& sequence, const FileInfo& value)
+                {
+                    const std::string& number = value.getPath().getNumber();
+                    bool digits = number.size() > 0 && number.size() < 19;
+                    for (auto i = number.begin(); i != number.end() && digits; ++i)
+                    {
+                        digits = *i >= '0' && *i <= '9';
+                    }
+                    return digits && sequence.getSequence().contains(std::stoll(number));
+                }
+
+            } // namespace
+
+            bool DirectoryModelChanges::isEmpty() const
+            {
+                return added.empty() && removed.empty() && changed.empty();
+            }
+
             struct DirectoryModel::Private
             {
                 std::shared_ptr<ValueSubject<Path> > path;
                 std::shared_ptr<ListSubject<FileInfo> > fileInfo;
                 std::shared_ptr<ListSubject<std::string> > fileNames;
+                std::shared_ptr<ValueSubject<DirectoryModelChanges> > changes;
+                std::map<std::string, FileInfo> changedFiles;
                 std::shared_ptr<ListSubject<Path> > history;
                 std::shared_ptr<ValueSubject<size_t> > historyIndex;
                 size_t historyMax = 10;
@@ -47,6 +80,7 @@ namespace djv
                 p.path = ValueSubject<Path>::create();
                 p.fileInfo = ListSubject<FileInfo>::create();
                 p.fileNames = ListSubject<std::string>::create();
+                p.changes = ValueSubject<DirectoryModelChanges>::create();
                 p.history = ListSubject<Path>::create();
                 p.historyIndex = ValueSubject<size_t>::create(0);
                 p.hasUp = ValueSubject<bool>::create(false);
@@ -73,6 +107,14 @@ namespace djv
                         model->reload();
                     }
                 });
+                p.directoryWatcher->setChangesCallback(
+                    [weak](const std::vector<DirectoryChange>& value)
+                {
+                    if (auto model = weak.lock())
+                    {
+                        model->_applyChanges(value);
+                    }
+                });
             }
 
             DirectoryModel::DirectoryModel() :
@@ -126,6 +168,11 @@ namespace djv
                 return _p->fileNames;
             }
 
+            std::shared_ptr<IValueSubject<DirectoryModelChanges> > DirectoryModel::observeChanges() const
+            {
+                return _p->changes;
+            }
+
             void DirectoryModel::reload()
             {
                 _updatePath();
@@ -329,19 +376,27 @@ namespace djv
                 setFilter(std::string());
             }
 
+            DirectoryListOptions DirectoryModel::_getOptions() const
+            {
+                DJV_PRIVATE_PTR();
+                DirectoryListOptions out;
+                out.fileExtensions = p.fileExtensions;
+                out.fileSequences = p.fileSequences->get();
+                out.fileSequenceExtensions = p.fileSequenceExtensions;
+                out.showHidden = p.showHidden->get();
+                out.sort = p.sort->get();
+                out.reverseSort = p.reverseSort->get();
+                out.sortDirectoriesFirst = p.sortDirectoriesFirst->get();
+                out.filter = p.filter->get();
+                return out;
+            }
+
             void DirectoryModel::_updatePath()
             {
                 DJV_PRIVATE_PTR();
                 const Path path = p.path->get();
-                DirectoryListOptions options;
-                options.fileExtensions = p.fileExtensions;
-                options.fileSequences = p.fileSequences->get();
-                options.fileSequenceExtensions = p.fileSequenceExtensions;
-                options.showHidden = p.showHidden->get();
-                options.sort = p.sort->get();
-                options.reverseSort = p.reverseSort->get();
-                options.sortDirectoriesFirst = p.sortDirectoriesFirst->get();
-                options.filter = p.filter->get();
+                const DirectoryListOptions options = _getOptions();
+                p.changedFiles.clear();
                 p.future = std::async(
                     std::launch::async,
                     [path, options]
@@ -374,6 +429,190 @@ namespace djv
                 p.directoryWatcher->setPath(p.path->get());
             }
 
+            void DirectoryModel::_applyChanges(const std::vector<DirectoryChange>& value)
+            {
+                DJV_PRIVATE_PTR();
+                if (p.future.valid())
+                {
+                    // The directory is still being read, read it again so the
+                    // changes are included.
+                    _updatePath();
+                    return;
+                }
+
+                const Path& path = p.path->get();
+                const DirectoryListOptions options = _getOptions();
+                std::set<std::string> fileSequenceExtensions;
+                for (const auto& i : options.fileSequenceExtensions)
+                {
+                    fileSequenceExtensions.insert(String::toLower(i));
+                }
+                auto isSequence = [&options, &fileSequenceExtensions](const FileInfo& fileInfo)
+                {
+                    return options.fileSequences &&
+                        fileInfo.getType() != FileType::Directory &&
+                        !fileInfo.getPath().getNumber().empty() &&
+                        fileSequenceExtensions.find(String::toLower(fileInfo.getPath().getExtension())) != fileSequenceExtensions.end();
+                };
+
+                // Get information for the changed files that still exist.
+                std::vector<std::string> fileNames;
+                std::set<std::string> fileNamesSet;
+                for (const auto& i : value)
+                {
+                    if (fileNamesSet.insert(i.fileName).second)
+                    {
+                        fileNames.push_back(i.fileName);
+                    }
+                }
+                std::map<std::string, FileInfo> files;
+                for (auto& i : FileInfo::directoryListFiles(path, fileNames, options))
+                {
+                    files[i.getFileName(Frame::invalid, false)] = std::move(i);
+                }
+
+                // Index the current items by file name, and by sequence key for
+                // the items that can be file sequences.
+                std::vector<FileInfo> items = p.fileInfo->get();
+                std::vector<bool> removed(items.size(), false);
+                std::unordered_map<std::string, size_t> fileIndexes;
+                std::unordered_map<std::string, size_t> sequenceIndexes;
+                for (size_t i = 0; i < items.size(); ++i)
+                {
+                    const auto& item = items[i];
+                    if (item.getType() != FileType::Sequence)
+                    {
+                        fileIndexes[item.getFileName(Frame::invalid, false)] = i;
+                    }
+                    if (FileType::Sequence == item.getType() || isSequence(item))
+                    {
+                        sequenceIndexes[getSequenceKey(item)] = i;
+                    }
+                }
+
+                // Apply the changes.
+                DirectoryModelChanges changes;
+                for (const auto& fileName : fileNames)
+                {
+                    const auto i = files.find(fileName);
+                    if (i != files.end())
+                    {
+                        const FileInfo& fileInfo = i->second;
+                        auto j = fileIndexes.find(fileName);
+                        if (j != fileIndexes.end())
+                        {
+                            // Update an existing file.
+                            auto& item = items[j->second];
+                            if (item != fileInfo)
+                            {
+                                changes.changed.push_back(std::make_pair(item, fileInfo));
+                                item = fileInfo;
+                            }
+                        }
+                        else if (isSequence(fileInfo) &&
+                            (j = sequenceIndexes.find(getSequenceKey(fileInfo))) != sequenceIndexes.end() &&
+                            !removed[j->second])
+                        {
+                            // Add the frame to the existing file sequence. If the frame is
+                            // already in the sequence it is updated when the previous
+                            // information is known.
+                            auto& item = items[j->second];
+                            const FileInfo prev = item;
+                            if (FileType::Sequence == item.getType() && containsFrame(item, fileInfo))
+                            {
+                                const auto k = p.changedFiles.find(fileName);
+                                if (k != p.changedFiles.end())
+                                {
+                                    item.removeFromSequence(k->second);
+                                    item.addToSequence(fileInfo);
+                                }
+                            }
+                            else
+                            {
+                                item.addToSequence(fileInfo);
+                                if (prev.getType() != FileType::Sequence)
+                                {
+                                    fileIndexes.erase(prev.getFileName(Frame::invalid, false));
+                                }
+                            }
+                            if (item != prev)
+                            {
+                                changes.changed.push_back(std::make_pair(prev, item));
+                            }
+                        }
+                        else
+                        {
+                            // Add a new item.
+                            const size_t index = items.size();
+                            items.push_back(fileInfo);
+                            removed.push_back(false);
+                            fileIndexes[fileName] = index;
+                            if (isSequence(fileInfo))
+                            {
+                                sequenceIndexes[getSequenceKey(fileInfo)] = index;
+                            }
+                            changes.added.push_back(fileInfo);
+                        }
+                        p.changedFiles[fileName] = fileInfo;
+                    }
+                    else
+                    {
+                        const FileInfo fileInfo(Path(path, fileName), false);
+                        auto j = fileIndexes.find(fileName);
+                        if (j != fileIndexes.end())
+                        {
+                            // Remove an existing file.
+                            removed[j->second] = true;
+                            changes.removed.push_back(items[j->second]);
+                            fileIndexes.erase(j);
+                        }
+                        else if (isSequence(fileInfo) &&
+                            (j = sequenceIndexes.find(getSequenceKey(fileInfo))) != sequenceIndexes.end() &&
+                            !removed[j->second])
+                        {
+                            // Remove the frame from the file sequence. When a single
+                            // frame remains the item becomes a file.
+                            auto& item = items[j->second];
+                            const FileInfo prev = item;
+                            const auto k = p.changedFiles.find(fileName);
+                            if (item.removeFromSequence(k != p.changedFiles.end() ? k->second : fileInfo))
+                            {
+                                if (item.getType() != FileType::Sequence)
+                                {
+                                    item.stat();
+                                    fileIndexes[item.getFileName(Frame::invalid, false)] = j->second;
+                                }
+                                changes.changed.push_back(std::make_pair(prev, item));
+                            }
+                        }
+                        p.changedFiles.erase(fileName);
+                    }
+                }
+                if (changes.isEmpty())
+                    return;
+
+                // Update the contents.
+                std::vector<FileInfo> fileInfoList;
+                fileInfoList.reserve(items.size());
+                for (size_t i = 0; i < items.size(); ++i)
+                {
+                    if (!removed[i])
+                    {
+                        fileInfoList.push_back(std::move(items[i]));
+                    }
+                }
+                FileInfo::sortDirectoryList(fileInfoList, options);
+                std::vector<std::string> fileNamesList;
+                fileNamesList.reserve(fileInfoList.size());
+                for (const auto& fileInfo : fileInfoList)
+                {
+                    fileNamesList.push_back(fileInfo.getFileName(Frame::invalid, false));
+                }
+                p.fileInfo->setIfChanged(fileInfoList);
+                p.fileNames->setIfChanged(fileNamesList);
+                p.changes->setAlways(changes);
+            }
+
         } // namespace FileSystem
     } // namespace Core
 } // namespace djv
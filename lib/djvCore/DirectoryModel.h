@@ -16,7 +16,27 @@ namespace djv
 
         namespace FileSystem
         {
+            struct DirectoryChange;
+
+            //! This struct provides a batch of changes to the directory contents.
+            struct DirectoryModelChanges
+            {
+                std::vector<FileInfo> added;
+                std::vector<FileInfo> removed;
+
+                //! The items that changed, for example file sequences with new
+                //! frames. The first value is the previous item and the second is
+                //! the new item.
+                std::vector<std::pair<FileInfo, FileInfo> > changed;
+
+                bool isEmpty() const;
+            };
+
             //! This class provides a directory model.
+            //!
+            //! When the directory watcher reports the individual files that changed,
+            //! the changes are applied to the current contents instead of reading
+            //! the directory again.
             class DirectoryModel : public std::enable_shared_from_this<DirectoryModel>
             {
                 DJV_NON_COPYABLE(DirectoryModel);
@@ -45,6 +65,12 @@ namespace djv
                 std::shared_ptr<IListSubject<FileInfo> > observeFileInfo() const;
                 std::shared_ptr<IListSubject<std::string> > observeFileNames() const;
 
+                //! Observe the changes applied to the directory contents. The file
+                //! information and file names are updated before the changes are
+                //! sent. Changes are not sent when the directory is read again, for
+                //! example when the path or options change.
+                std::shared_ptr<IValueSubject<DirectoryModelChanges> > observeChanges() const;
+
                 void reload();
 
                 ///@}
@@ -96,7 +122,9 @@ namespace djv
                 ///@}
 
             private:
+                DirectoryListOptions _getOptions() const;
                 void _updatePath();
+                void _applyChanges(const std::vector<DirectoryChange>&);
 
                 DJV_PRIVATE();
             };
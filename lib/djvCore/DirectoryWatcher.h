@@ -8,6 +8,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace djv
 {
@@ -19,8 +21,29 @@ namespace djv
         {
             class Path;
 
+            //! This enumeration provides the types of directory changes.
+            enum class DirectoryChangeType
+            {
+                Created,
+                Deleted,
+                Modified
+            };
+
+            //! This struct provides a change to a file in a watched directory.
+            struct DirectoryChange
+            {
+                DirectoryChangeType type = DirectoryChangeType::Modified;
+                std::string         fileName;
+            };
+
             //! This class provides functionality for watching directory changes.
             //!
+            //! Changes are delivered on the main thread in batches. If the changes
+            //! callback is set and the platform reports the individual files that
+            //! changed, the batch is passed to the changes callback. Otherwise, for
+            //! example when events were lost, the callback is called and the
+            //! directory should be read again.
+            //!
             //! \bug What do we do about changes to the directory path (like deletion or moving)?
             class DirectoryWatcher : public std::enable_shared_from_this<DirectoryWatcher>
             {
@@ -37,6 +60,7 @@ namespace djv
                 void setPath(const Path&);
 
                 void setCallback(const std::function<void(void)>&);
+                void setChangesCallback(const std::function<void(const std::vector<DirectoryChange>&)>&);
 
             private:
                 DJV_PRIVATE();
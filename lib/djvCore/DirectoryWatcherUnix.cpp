@@ -96,7 +96,10 @@ namespace djv
                         _fd = ::inotify_init1(IN_NONBLOCK);
                         if (_fd)
                         {
-                            _wd = ::inotify_add_watch(_fd, _path.get().c_str(), IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB);
+                            _wd = ::inotify_add_watch(
+                                _fd,
+                                _path.get().c_str(),
+                                IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO);
                         }
                     }
 
@@ -133,28 +136,63 @@ namespace djv
                         return *this;
                     }
                                         
-                    ::time_t poll()
+                    //! Poll for events, appending the changed files. The overflow
+                    //! flag is set if events were lost.
+                    ::time_t poll(std::vector<DirectoryChange>& changes, bool& overflow)
                     {
                         if (_fd && _wd)
                         {
                             static const size_t bufferSize = 1024 * (sizeof(::inotify_event) + 16);
                             char buffer[bufferSize];
-                            const int length = ::read(_fd, buffer, bufferSize);
-                            int i = 0;
-                            while (i < length)
+                            int length = 0;
+                            while ((length = ::read(_fd, buffer, bufferSize)) > 0)
                             {
-                                ::inotify_event* event = (::inotify_event*)&buffer[i];
-                                if (event->len)
+                                int i = 0;
+                                while (i < length)
                                 {
-                                    if (event->mask & IN_CREATE ||
-                                        event->mask & IN_DELETE ||
-                                        event->mask & IN_MODIFY)
+                                    ::inotify_event* event = (::inotify_event*)&buffer[i];
+                                    if (event->mask & IN_Q_OVERFLOW)
                                     {
+                                        overflow = true;
                                         _lastModified = time(nullptr);
-                                        break;
                                     }
+                                    else if (event->len)
+                                    {
+                                        DirectoryChange change;
+                                        bool valid = true;
+                                        if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                                        {
+                                            change.type = DirectoryChangeType::Created;
+                                        }
+                                        else if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+                                        {
+                                            change.type = DirectoryChangeType::Deleted;
+                                        }
+                                        else if (event->mask & IN_MODIFY)
+                                        {
+                                            change.type = DirectoryChangeType::Modified;
+                                        }
+                                        else
+                                        {
+                                            valid = false;
+                                        }
+                                        if (valid)
+                                        {
+                                            change.fileName = event->name;
+
+                                            // Writing a file generates many modify events, only keep
+                                            // the first one.
+                                            if (changes.empty() ||
+                                                changes.back().type != change.type ||
+                                                changes.back().fileName != change.fileName)
+                                            {
+                                                changes.push_back(std::move(change));
+                                            }
+                                            _lastModified = time(nullptr);
+                                        }
+                                    }
+                                    i += sizeof(::inotify_event) + event->len;
                                 }
-                                i += sizeof(::inotify_event) + event->len;
                             }
                         }
                         return _lastModified;
@@ -178,8 +216,11 @@ namespace djv
                 std::timed_mutex mutex;
                 ::time_t lastModified = 0;
                 ::time_t threadModified = 0;
+                std::vector<DirectoryChange> changes;
+                bool overflow = false;
                 std::shared_ptr<Time::Timer> timer;
                 std::function<void(void)> callback;
+                std::function<void(const std::vector<DirectoryChange>&)> changesCallback;
             };
 
             void DirectoryWatcher::_init(const std::shared_ptr<Context>& context)
@@ -194,7 +235,9 @@ namespace djv
                     Path path;
                     bool pathInit = false;
                     std::unique_ptr<Notify> notify;
-                    ::time_t lastModified = 0;                    
+                    ::time_t lastModified = 0;
+                    std::vector<DirectoryChange> changes;
+                    bool overflow = false;
                     bool running = true;
                     while (running)
                     {
@@ -209,8 +252,19 @@ namespace djv
                                 {
                                     path = p.path;
                                     pathInit = true;
+                                    changes.clear();
+                                    overflow = false;
+                                    p.changes.clear();
+                                    p.overflow = false;
                                 }
-                                p.threadModified = lastModified;                                                        
+                                else
+                                {
+                                    p.changes.insert(p.changes.end(), changes.begin(), changes.end());
+                                    changes.clear();
+                                    p.overflow |= overflow;
+                                    overflow = false;
+                                }
+                                p.threadModified = lastModified;
                                 p.mutex.unlock();
                             }
                         }
@@ -230,7 +284,11 @@ namespace djv
                         if (notify)
                         {
                             // Poll for events.
+#if defined(DJV_PLATFORM_OSX)
                             lastModified = notify->poll();
+#else // DJV_PLATFORM_OSX
+                            lastModified = notify->poll(changes, overflow);
+#endif // DJV_PLATFORM_OSX
                         }
                         
                         std::this_thread::sleep_for(timeout);
@@ -248,11 +306,19 @@ namespace djv
                         auto & p = *watcher->_p;
                         if (p.mutex.try_lock_for(timeout))
                         {
-                            if (p.threadModified != p.lastModified)
-                            {                            
+                            if (p.threadModified != p.lastModified || p.changes.size())
+                            {
                                 p.lastModified = p.threadModified;
-                                
-                                if (p.callback)
+                                std::vector<DirectoryChange> changes;
+                                std::swap(changes, p.changes);
+                                const bool overflow = p.overflow;
+                                p.overflow = false;
+
+                                if (p.changesCallback && changes.size() && !overflow)
+                                {
+                                    p.changesCallback(changes);
+                                }
+                                else if (p.callback)
                                 {
                                     p.callback();
                                 }
@@ -298,6 +364,11 @@ namespace djv
                 _p->callback = value;
             }
 
+            void DirectoryWatcher::setChangesCallback(const std::function<void(const std::vector<DirectoryChange>&)>& value)
+            {
+                _p->changesCallback = value;
+            }
+
         } // namespace FileSystem
     } // namespace Core
 } // namespace djv
@@ -39,6 +39,7 @@ namespace djv
                 std::thread thread;
                 std::atomic<bool> running = true;
                 std::function<void(void)> callback;
+                std::function<void(const std::vector<DirectoryChange>&)> changesCallback;
                 std::shared_ptr<Time::Timer> timer;
             };
 
@@ -210,6 +211,12 @@ namespace djv
                 _p->callback = value;
             }
 
+            void DirectoryWatcher::setChangesCallback(const std::function<void(const std::vector<DirectoryChange>&)>& value)
+            {
+                //! \todo Use ReadDirectoryChangesW() to report the individual changes.
+                _p->changesCallback = value;
+            }
+
         } // namespace FileSystem
     } // namespace Core
 } // namespace djv
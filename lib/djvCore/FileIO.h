@@ -135,14 +135,34 @@ namespace djv
                 //! \name Memory Mapping
                 ///@{
 
+                //! This enumeration provides memory-map access hints.
+                enum class MmapAdvice
+                {
+                    Normal,
+                    Sequential,
+                    Random,
+                    WillNeed,
+
+                    Count,
+                    First = Normal
+                };
+
 #if defined(DJV_MMAP)
                 //! Get the current memory-map position.
                 const uint8_t * mmapP() const;
 
                 //! Get a pointer to the end of the memory-map.
                 const uint8_t * mmapEnd() const;
+
+                //! Set the access hint for a range of the memory-map. A size of
+                //! zero means the rest of the file.
+                void mmapAdvise(MmapAdvice, size_t offset = 0, size_t size = 0);
 #endif // DJV_MMAP
 
+                //! Ask the operating system to start reading a file into the
+                //! page cache in the background. Errors are ignored.
+                static void prefetch(const std::string& fileName);
+
                 ///@}
 
                 //! \name Endian
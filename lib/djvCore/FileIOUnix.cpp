@@ -11,6 +11,7 @@
 #include <djvCore/StringFormat.h>
 
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 #if defined(DJV_PLATFORM_LINUX)
@@ -164,7 +165,6 @@ namespace djv
                 if (Mode::Read == _mode && _size > 0)
                 {
                     _mmap = mmap(0, _size, PROT_READ, MAP_SHARED, _f, 0);
-                    madvise(_mmap, _size, MADV_SEQUENTIAL | MADV_SEQUENTIAL);
                     if (_mmap == (void *) - 1)
                     {
                         throw Error(getErrorMessage(ErrorType::MemoryMap, fileName));
@@ -172,6 +172,13 @@ namespace djv
                     _mmapStart = reinterpret_cast<const uint8_t *>(_mmap);
                     _mmapEnd   = _mmapStart + _size;
                     _mmapP     = _mmapStart;
+                    mmapAdvise(MmapAdvice::Sequential);
+
+                    // The mapping stays valid after the descriptor is closed.
+                    // Images that reference the mapping can live in the frame
+                    // cache for a long time, so don't hold on to descriptors.
+                    ::close(_f);
+                    _f = -1;
                 }
 #endif // DJV_MMAP
             }
@@ -226,6 +233,7 @@ namespace djv
                 }
                 _mmapStart = 0;
                 _mmapEnd   = 0;
+                _mmapP     = 0;
 #endif // DJV_MMAP
                 if (_f != -1)
                 {
@@ -318,6 +326,57 @@ namespace djv
                 _size = std::max(_pos, _size);
             }
 
+#if defined(DJV_MMAP)
+            void FileIO::mmapAdvise(MmapAdvice value, size_t offset, size_t size)
+            {
+                if (_mmap == (void *) - 1 || offset >= _size)
+                    return;
+                if (0 == size || offset + size > _size)
+                {
+                    size = _size - offset;
+                }
+                int advice = MADV_NORMAL;
+                switch (value)
+                {
+                case MmapAdvice::Sequential: advice = MADV_SEQUENTIAL; break;
+                case MmapAdvice::Random:     advice = MADV_RANDOM;     break;
+                case MmapAdvice::WillNeed:   advice = MADV_WILLNEED;   break;
+                default: break;
+                }
+
+                // The address must be aligned to a page boundary.
+                static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                const size_t alignedOffset = offset / pageSize * pageSize;
+                madvise(
+                    const_cast<uint8_t *>(_mmapStart) + alignedOffset,
+                    size + (offset - alignedOffset),
+                    advice);
+            }
+#endif // DJV_MMAP
+
+            void FileIO::prefetch(const std::string& fileName)
+            {
+                const int f = ::open(fileName.c_str(), O_RDONLY);
+                if (f != -1)
+                {
+#if defined(DJV_PLATFORM_LINUX)
+                    posix_fadvise(f, 0, 0, POSIX_FADV_WILLNEED);
+#elif defined(DJV_PLATFORM_OSX)
+                    _STAT info;
+                    if (0 == fstat(f, &info))
+                    {
+                        struct radvisory ra;
+                        ra.ra_offset = 0;
+                        ra.ra_count  = static_cast<int>(std::min(
+                            static_cast<off_t>(std::numeric_limits<int>::max()),
+                            info.st_size));
+                        fcntl(f, F_RDADVISE, &ra);
+                    }
+#endif // DJV_PLATFORM_LINUX
+                    ::close(f);
+                }
+            }
+
             void FileIO::_setPos(size_t in, bool seek)
             {
                 switch (_mode)
@@ -381,6 +381,67 @@ namespace djv
                 _size = std::max(_pos, _size);
             }
 
+#if defined(DJV_MMAP)
+            void FileIO::mmapAdvise(MmapAdvice value, size_t offset, size_t size)
+            {
+                if (!_mmapStart || offset >= _size)
+                    return;
+                if (0 == size || offset + size > _size)
+                {
+                    size = _size - offset;
+                }
+                switch (value)
+                {
+                case MmapAdvice::WillNeed:
+                {
+#if _WIN32_WINNT >= _WIN32_WINNT_WIN8
+                    WIN32_MEMORY_RANGE_ENTRY range;
+                    range.VirtualAddress = const_cast<uint8_t *>(_mmapStart) + offset;
+                    range.NumberOfBytes  = size;
+                    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif // _WIN32_WINNT_WIN8
+                    break;
+                }
+                default: break;
+                }
+            }
+#endif // DJV_MMAP
+
+            void FileIO::prefetch(const std::string& fileName)
+            {
+#if _WIN32_WINNT >= _WIN32_WINNT_WIN8
+                // Map the file and ask for the pages to be read into the system
+                // file cache. The pages stay cached after the view is unmapped.
+                HANDLE f = INVALID_HANDLE_VALUE;
+                try
+                {
+                    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t> utf16;
+                    f = CreateFileW(utf16.from_bytes(fileName).c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+                }
+                catch (const std::exception&)
+                {}
+                if (INVALID_HANDLE_VALUE == f)
+                    return;
+                LARGE_INTEGER size;
+                if (GetFileSizeEx(f, &size) && size.QuadPart > 0)
+                {
+                    if (HANDLE mmap = CreateFileMapping(f, 0, PAGE_READONLY, 0, 0, 0))
+                    {
+                        if (void* p = MapViewOfFile(mmap, FILE_MAP_READ, 0, 0, 0))
+                        {
+                            WIN32_MEMORY_RANGE_ENTRY range;
+                            range.VirtualAddress = p;
+                            range.NumberOfBytes  = static_cast<SIZE_T>(size.QuadPart);
+                            PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+                            UnmapViewOfFile(p);
+                        }
+                        CloseHandle(mmap);
+                    }
+                }
+                CloseHandle(f);
+#endif // _WIN32_WINNT_WIN8
+            }
+
             void FileIO::_setPos(size_t value, bool seek)
             {
                 switch (_mode)
@@ -4,6 +4,10 @@
 
 #include <djvCore/FileInfo.h>
 
+#include <regex>
+#include <thread>
+#include <unordered_map>
+
 //#pragma optimize("", off)
 
 namespace djv
@@ -126,34 +130,255 @@ namespace djv
                 return out;
             }
 
-            void FileInfo::_fileSequence(FileInfo& fileInfo, const DirectoryListOptions& options, std::vector<FileInfo>& out)
+            bool FileInfo::removeFromSequence(const FileInfo& value)
             {
-                std::string extension = fileInfo.getPath().getExtension();
-                std::transform(extension.begin(), extension.end(), extension.begin(), tolower);
-                const auto i = std::find(
-                    options.fileSequenceExtensions.begin(),
-                    options.fileSequenceExtensions.end(),
-                    extension);
-                if (options.fileSequences && i != options.fileSequenceExtensions.end())
+                if (_type != FileType::Sequence || !isCompatible(value))
+                    return false;
+
+                // Split the ranges that contain the removed frames.
+                const Frame::Sequence frames = _parseSequence(value._path.getNumber());
+                std::vector<Frame::Range> ranges = _sequence.getRanges();
+                bool removed = false;
+                for (const auto& range : frames.getRanges())
                 {
-                    const size_t size = out.size();
-                    size_t j = 0;
-                    for (; j < size; ++j)
+                    for (Frame::Number frame = range.getMin(); frame <= range.getMax(); ++frame)
                     {
-                        if (out[j].addToSequence(fileInfo))
+                        for (auto i = ranges.begin(); i != ranges.end(); ++i)
                         {
-                            break;
+                            if (i->contains(frame))
+                            {
+                                const Frame::Range tmp = *i;
+                                i = ranges.erase(i);
+                                if (frame < tmp.getMax())
+                                {
+                                    i = ranges.insert(i, Frame::Range(frame + 1, tmp.getMax()));
+                                }
+                                if (frame > tmp.getMin())
+                                {
+                                    ranges.insert(i, Frame::Range(tmp.getMin(), frame - 1));
+                                }
+                                removed = true;
+                                break;
+                            }
                         }
                     }
-                    if (size == j)
+                }
+                if (!removed)
+                    return false;
+
+                _size -= std::min(_size, value._size);
+                const Frame::Sequence sequence(ranges, _sequence.getPad());
+                if (1 == sequence.getFrameCount())
+                {
+                    _type = FileType::File;
+                    _path.setNumber(Frame::toString(ranges[0].getMin(), sequence.getPad()));
+                    _sequence = Frame::Sequence();
+                }
+                else
+                {
+                    setSequence(sequence);
+                }
+                return true;
+            }
+
+            void FileInfo::sortDirectoryList(std::vector<FileInfo>& value, const DirectoryListOptions& options)
+            {
+                _sort(options, value);
+            }
+
+            std::vector<FileInfo> FileInfo::_directoryList(
+                const Path& path,
+                const std::vector<DirectoryEntry>& entries,
+                const DirectoryListOptions& options)
+            {
+                std::vector<FileInfo> out;
+
+                // Filter the entries. The filter and extensions are prepared
+                // once instead of for each entry.
+                std::unique_ptr<std::regex> filterRegex;
+                if (options.filter.size())
+                {
+                    try
+                    {
+                        filterRegex.reset(new std::regex(options.filter, std::regex_constants::icase));
+                    }
+                    catch (const std::exception&)
                     {
-                        out.push_back(fileInfo);
+                        return out;
                     }
                 }
-                else
+                std::set<std::string> fileExtensions;
+                std::set<size_t> fileExtensionSizes;
+                for (const auto& i : options.fileExtensions)
+                {
+                    fileExtensions.insert(String::toLower(i));
+                    fileExtensionSizes.insert(i.size());
+                }
+                std::vector<const DirectoryEntry*> filtered;
+                filtered.reserve(entries.size());
+                for (const auto& entry : entries)
+                {
+                    const std::string& fileName = entry.name;
+                    if (entry.hidden && !options.showHidden)
+                        continue;
+                    if ("." == fileName || ".." == fileName)
+                        continue;
+                    if (filterRegex && !std::regex_search(fileName, *filterRegex))
+                        continue;
+                    if (!entry.directory && fileExtensions.size())
+                    {
+                        bool match = false;
+                        for (auto i = fileExtensionSizes.begin(); i != fileExtensionSizes.end() && !match; ++i)
+                        {
+                            match =
+                                fileName.size() >= *i &&
+                                fileExtensions.find(String::toLower(fileName.substr(fileName.size() - *i))) != fileExtensions.end();
+                        }
+                        if (!match)
+                            continue;
+                    }
+                    filtered.push_back(&entry);
+                }
+
+                // Get the file information in parallel.
+                std::vector<FileInfo> items(filtered.size());
+                const size_t batchSize = 1024;
+                const size_t threadCount = std::max(
+                    static_cast<size_t>(1),
+                    std::min(
+                        static_cast<size_t>(std::thread::hardware_concurrency()),
+                        (filtered.size() + batchSize - 1) / batchSize));
+                auto statItems = [&path, &filtered, &items, threadCount](size_t index)
+                {
+                    for (size_t i = index; i < items.size(); i += threadCount)
+                    {
+                        items[i].setPath(Path(path, filtered[i]->name));
+                    }
+                };
+                std::vector<std::thread> threads;
+                for (size_t i = 1; i < threadCount; ++i)
+                {
+                    threads.push_back(std::thread(statItems, i));
+                }
+                statItems(0);
+                for (auto& i : threads)
+                {
+                    i.join();
+                }
+
+                // Group the file sequences. Files are grouped by their base
+                // name and extension, with a hash table instead of comparing
+                // each file against the previous ones.
+                if (!options.fileSequences)
+                {
+                    out = std::move(items);
+                    return out;
+                }
+                std::set<std::string> fileSequenceExtensions;
+                for (const auto& i : options.fileSequenceExtensions)
                 {
-                    out.push_back(fileInfo);
+                    fileSequenceExtensions.insert(String::toLower(i));
                 }
+                struct Group
+                {
+                    size_t                    index = 0;
+                    size_t                    count = 0;
+                    std::vector<Frame::Range> ranges;
+                    size_t                    pad   = 0;
+                };
+                std::vector<Group> groups;
+                std::unordered_map<std::string, size_t> groupIndexes;
+                out.reserve(items.size());
+                for (auto& item : items)
+                {
+                    const std::string& number = item._path.getNumber();
+                    if (number.empty() ||
+                        FileType::Directory == item._type ||
+                        fileSequenceExtensions.find(String::toLower(item._path.getExtension())) == fileSequenceExtensions.end())
+                    {
+                        out.push_back(std::move(item));
+                        continue;
+                    }
+
+                    // Parse the frame number.
+                    Frame::Sequence sequence;
+                    bool digits = number.size() < 19;
+                    for (auto i = number.begin(); i != number.end() && digits; ++i)
+                    {
+                        digits = *i >= '0' && *i <= '9';
+                    }
+                    if (digits)
+                    {
+                        sequence = Frame::Sequence(
+                            Frame::Range(std::stoll(number)),
+                            number.size() >= 2 && '0' == number[0] ? number.size() : 0);
+                    }
+                    else
+                    {
+                        sequence = _parseSequence(number);
+                    }
+
+                    const std::string key = item._path.getBaseName() + '/' + item._path.getExtension();
+                    const auto i = groupIndexes.find(key);
+                    if (i == groupIndexes.end())
+                    {
+                        Group group;
+                        group.index = out.size();
+                        group.count = 1;
+                        group.ranges = sequence.getRanges();
+                        group.pad = sequence.getPad();
+                        groupIndexes[key] = groups.size();
+                        groups.push_back(std::move(group));
+                        out.push_back(std::move(item));
+                    }
+                    else
+                    {
+                        auto& group = groups[i->second];
+                        auto& fileInfo = out[group.index];
+                        ++group.count;
+                        for (const auto& range : sequence.getRanges())
+                        {
+                            group.ranges.push_back(range);
+                        }
+                        group.pad = std::max(group.pad, sequence.getPad());
+                        fileInfo._size += item._size;
+                        fileInfo._user = std::max(fileInfo._user, item._user);
+                        fileInfo._time = std::max(fileInfo._time, item._time);
+                    }
+                }
+                for (auto& group : groups)
+                {
+                    if (group.count > 1 && group.ranges.size())
+                    {
+                        // Sort and merge the ranges so they can be appended.
+                        std::sort(
+                            group.ranges.begin(), group.ranges.end(),
+                            [](const Frame::Range& a, const Frame::Range& b)
+                            {
+                                return a.getMin() < b.getMin();
+                            });
+                        std::vector<Frame::Range> ranges;
+                        ranges.push_back(group.ranges[0]);
+                        for (size_t i = 1; i < group.ranges.size(); ++i)
+                        {
+                            const auto& range = group.ranges[i];
+                            auto& back = ranges.back();
+                            if (range.getMin() <= back.getMax() + 1)
+                            {
+                                back = Frame::Range(back.getMin(), std::max(back.getMax(), range.getMax()));
+                            }
+                            else
+                            {
+                                ranges.push_back(range);
+                            }
+                        }
+                        auto& fileInfo = out[group.index];
+                        fileInfo._type = FileType::Sequence;
+                        fileInfo.setSequence(Frame::Sequence(ranges, group.pad));
+                    }
+                }
+
+                return out;
             }
 
             void FileInfo::_sort(const DirectoryListOptions& options, std::vector<FileInfo>& out)
@@ -171,15 +396,29 @@ namespace djv
                 switch (options.sort)
                 {
                 case DirectoryListSort::Name:
+                {
+                    // Get the file names once instead of for each comparison.
+                    std::vector<std::pair<std::string, size_t> > names;
+                    names.reserve(out.size());
+                    for (size_t i = 0; i < out.size(); ++i)
+                    {
+                        names.push_back(std::make_pair(out[i].getFileName(Frame::invalid, false), i));
+                    }
                     std::sort(
-                        out.begin(), out.end(),
-                        [&options](const FileInfo& a, const FileInfo& b)
+                        names.begin(), names.end(),
+                        [&options](const std::pair<std::string, size_t>& a, const std::pair<std::string, size_t>& b)
                     {
-                        return options.reverseSort ?
-                            (a.getFileName(Frame::invalid, false) > b.getFileName(Frame::invalid, false)) :
-                            (a.getFileName(Frame::invalid, false) < b.getFileName(Frame::invalid, false));
+                        return options.reverseSort ? (a.first > b.first) : (a.first < b.first);
                     });
+                    std::vector<FileInfo> tmp;
+                    tmp.reserve(out.size());
+                    for (const auto& i : names)
+                    {
+                        tmp.push_back(std::move(out[i.second]));
+                    }
+                    out = std::move(tmp);
                     break;
+                }
                 case DirectoryListSort::Size:
                     std::sort(
                         out.begin(), out.end(),
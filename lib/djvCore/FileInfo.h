@@ -132,6 +132,11 @@ namespace djv
                 void setSequence(const Frame::Sequence&);
                 bool isCompatible(const FileInfo&) const;
                 bool addToSequence(const FileInfo&);
+
+                //! Remove a file from the sequence. The size of the given file
+                //! is subtracted from the size of the sequence. When a single
+                //! frame remains the sequence becomes a file.
+                bool removeFromSequence(const FileInfo&);
                 
                 ///@}
 
@@ -144,6 +149,17 @@ namespace djv
                 //! Get the contents of the given directory.
                 static std::vector<FileInfo> directoryList(const Path& path, const DirectoryListOptions& options = DirectoryListOptions());
 
+                //! Get information for the given files in a directory. Files that
+                //! don't exist or don't match the options are skipped. The files are
+                //! not grouped into sequences or sorted.
+                static std::vector<FileInfo> directoryListFiles(
+                    const Path& path,
+                    const std::vector<std::string>& fileNames,
+                    const DirectoryListOptions& options = DirectoryListOptions());
+
+                //! Sort a directory listing.
+                static void sortDirectoryList(std::vector<FileInfo>&, const DirectoryListOptions& options = DirectoryListOptions());
+
                 //! Get the file sequence for the given file.
                 static FileInfo getFileSequence(const Path&, const std::set<std::string>& extensions);
 
@@ -156,8 +172,23 @@ namespace djv
                 explicit operator std::string() const;
 
             private:
+                //! This struct provides an entry from the platform directory listing.
+                struct DirectoryEntry
+                {
+                    std::string name;
+                    bool        directory = false;
+                    bool        hidden    = false;
+                };
+
                 static Frame::Sequence _parseSequence(const std::string&);
-                static void _fileSequence(FileInfo&, const DirectoryListOptions&, std::vector<FileInfo>&);
+
+                //! Filter the directory entries, get their information in
+                //! parallel, and group them into file sequences.
+                static std::vector<FileInfo> _directoryList(
+                    const Path&,
+                    const std::vector<DirectoryEntry>&,
+                    const DirectoryListOptions&);
+
                 static void _sort(const DirectoryListOptions&, std::vector<FileInfo>&);
                 
                 Path            _path;
@@ -9,8 +9,13 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <dirent.h>
+#include <fcntl.h>
 //#include <glob.h>
 #include <stdlib.h>
+#if defined(DJV_PLATFORM_LINUX)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // DJV_PLATFORM_LINUX
 
 //#pragma optimize("", off)
 
@@ -29,6 +34,37 @@ namespace djv
     {
         namespace FileSystem
         {
+            namespace
+            {
+#if defined(DJV_PLATFORM_LINUX)
+                //! This struct provides the layout of the getdents64() entries.
+                struct LinuxDirent64
+                {
+                    uint64_t       d_ino;
+                    int64_t        d_off;
+                    unsigned short d_reclen;
+                    unsigned char  d_type;
+                    char           d_name[1];
+                };
+
+                const size_t direntBufferSize = 256 * Memory::kilobyte;
+#endif // DJV_PLATFORM_LINUX
+
+                //! Get whether a directory entry is a directory, falling back to
+                //! stat() when the file system doesn't provide the type.
+                bool isDirectory(int fd, const char* name, unsigned char type)
+                {
+                    bool out = DT_DIR == type;
+                    if (DT_UNKNOWN == type || DT_LNK == type)
+                    {
+                        struct ::stat info;
+                        out = 0 == fstatat(fd, name, &info, 0) && S_ISDIR(info.st_mode);
+                    }
+                    return out;
+                }
+
+            } // namespace
+
             bool FileInfo::stat(std::string*)
             {
                 _exists      = false;
@@ -90,59 +126,50 @@ namespace djv
 
             std::vector<FileInfo> FileInfo::directoryList(const Path& value, const DirectoryListOptions& options)
             {
-                std::vector<FileInfo> out;
-                
                 // List the directory contents.
+                std::vector<DirectoryEntry> entries;
+#if defined(DJV_PLATFORM_LINUX)
+                // Read the entries in large batches with getdents64().
+                const int fd = open(value.get().c_str(), O_RDONLY | O_DIRECTORY);
+                if (fd != -1)
+                {
+                    std::vector<char> buf(direntBufferSize);
+                    while (true)
+                    {
+                        const long size = syscall(SYS_getdents64, fd, buf.data(), buf.size());
+                        if (size <= 0)
+                            break;
+                        for (long i = 0; i < size;)
+                        {
+                            const auto de = reinterpret_cast<const LinuxDirent64*>(buf.data() + i);
+                            DirectoryEntry entry;
+                            entry.name = de->d_name;
+                            entry.directory = isDirectory(fd, de->d_name, de->d_type);
+                            entry.hidden = entry.name.size() > 0 && '.' == entry.name[0];
+                            entries.push_back(std::move(entry));
+                            i += de->d_reclen;
+                        }
+                    }
+                    close(fd);
+                }
+#else // DJV_PLATFORM_LINUX
                 if (auto dir = opendir(value.get().c_str()))
                 {
+                    const int fd = dirfd(dir);
                     dirent* de = nullptr;
                     while ((de = readdir(dir)))
                     {
-                        FileInfo fileInfo(Path(value, de->d_name));
-                        
-                        const std::string fileName = fileInfo.getFileName(-1, false);
-                        
-                        bool filter = false;
-                        if (fileName.size() > 0 && '.' == fileName[0])
-                        {
-                            filter = !options.showHidden;
-                        }
-                        if (fileName.size() == 1 && '.' == fileName[0])
-                        {
-                            filter = true;
-                        }
-                        if (fileName.size() == 2 && '.' == fileName[0] && '.' == fileName[1])
-                        {
-                            filter = true;
-                        }
-                        if (options.filter.size() && !String::match(fileName, options.filter))
-                        {
-                            filter = true;
-                        }
-                        if (!filter && !(de->d_type & DT_DIR) && options.fileExtensions.size())
-                        {
-                            bool match = false;
-                            for (const auto& i : options.fileExtensions)
-                            {
-                                if (String::match(fileName, '\\' + i + '$'))
-                                {
-                                    match = true;
-                                    break;
-                                }
-                            }
-                            if (!match)
-                            {
-                                filter = true;
-                            }
-                        }
-
-                        if (!filter)
-                        {
-                            _fileSequence(fileInfo, options, out);
-                        }
+                        DirectoryEntry entry;
+                        entry.name = de->d_name;
+                        entry.directory = isDirectory(fd, de->d_name, de->d_type);
+                        entry.hidden = entry.name.size() > 0 && '.' == entry.name[0];
+                        entries.push_back(std::move(entry));
                     }
                     closedir(dir);
                 }
+#endif // DJV_PLATFORM_LINUX
+
+                std::vector<FileInfo> out = _directoryList(value, entries, options);
                     
                 // Sort the items.
                 _sort(options, out);
@@ -150,6 +177,29 @@ namespace djv
                 return out;
             }
 
+            std::vector<FileInfo> FileInfo::directoryListFiles(
+                const Path& value,
+                const std::vector<std::string>& fileNames,
+                const DirectoryListOptions& options)
+            {
+                std::vector<DirectoryEntry> entries;
+                for (const auto& i : fileNames)
+                {
+                    _STAT info;
+                    if (0 == _STAT_FNC(Path(value, i).get().c_str(), &info))
+                    {
+                        DirectoryEntry entry;
+                        entry.name = i;
+                        entry.directory = S_ISDIR(info.st_mode);
+                        entry.hidden = i.size() > 0 && '.' == i[0];
+                        entries.push_back(std::move(entry));
+                    }
+                }
+                DirectoryListOptions filesOptions = options;
+                filesOptions.fileSequences = false;
+                return _directoryList(value, entries, filesOptions);
+            }
+
         } // namespace FileSystem
     } // namespace Core
 } // namespace djv
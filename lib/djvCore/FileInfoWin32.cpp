@@ -210,6 +210,7 @@ namespace djv
                     // List the directory contents.
                     std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t> utf16;
                     WIN32_FIND_DATAW ffd;
+                    std::vector<DirectoryEntry> entries;
                     HANDLE hFind = FindFirstFileW(pathBuf, &ffd);
                     if (hFind != INVALID_HANDLE_VALUE)
                     {
@@ -217,47 +218,11 @@ namespace djv
                         {
                             do
                             {
-                                const std::string fileName = utf16.to_bytes(ffd.cFileName);
-
-                                bool filter = false;
-                                if (ffd.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN)
-                                {
-                                    filter = !options.showHidden;
-                                }
-                                if (fileName.size() == 1 && '.' == fileName[0])
-                                {
-                                    filter = true;
-                                }
-                                if (fileName.size() == 2 && '.' == fileName[0] && '.' == fileName[1])
-                                {
-                                    filter = true;
-                                }
-                                if (options.filter.size() && !String::match(fileName, options.filter))
-                                {
-                                    filter = true;
-                                }
-                                if (!filter && !(ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) && options.fileExtensions.size())
-                                {
-                                    bool match = false;
-                                    for (const auto& i : options.fileExtensions)
-                                    {
-                                        if (String::match(fileName, '\\' + i + '$'))
-                                        {
-                                            match = true;
-                                            break;
-                                        }
-                                    }
-                                    if (!match)
-                                    {
-                                        filter = true;
-                                    }
-                                }
-
-                                if (!filter)
-                                {
-                                    FileInfo fileInfo(Path(value, fileName));
-                                    _fileSequence(fileInfo, options, out);
-                                }
+                                DirectoryEntry entry;
+                                entry.name = utf16.to_bytes(ffd.cFileName);
+                                entry.directory = (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+                                entry.hidden = (ffd.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) != 0;
+                                entries.push_back(std::move(entry));
                             } while (FindNextFileW(hFind, &ffd) != 0);
                         }
                         catch (const std::exception&)
@@ -265,6 +230,7 @@ namespace djv
                             //! \bug How should we handle this error?
                         }
                         FindClose(hFind);
+                        out = _directoryList(value, entries, options);
                     }
                     else if (value.isServer())
                     {
@@ -291,6 +257,29 @@ namespace djv
                 return out;
             }
 
+            std::vector<FileInfo> FileInfo::directoryListFiles(
+                const Path& value,
+                const std::vector<std::string>& fileNames,
+                const DirectoryListOptions& options)
+            {
+                std::vector<DirectoryEntry> entries;
+                for (const auto& i : fileNames)
+                {
+                    const DWORD attributes = GetFileAttributesW(String::toWide(Path(value, i).get()).c_str());
+                    if (attributes != INVALID_FILE_ATTRIBUTES)
+                    {
+                        DirectoryEntry entry;
+                        entry.name = i;
+                        entry.directory = (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+                        entry.hidden = (attributes & FILE_ATTRIBUTE_HIDDEN) != 0;
+                        entries.push_back(std::move(entry));
+                    }
+                }
+                DirectoryListOptions filesOptions = options;
+                filesOptions.fileSequences = false;
+                return _directoryList(value, entries, filesOptions);
+            }
+
         } // namespace FileSystem
     } // namespace Core
 } // namespace djv
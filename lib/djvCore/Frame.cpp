@@ -17,6 +17,13 @@ namespace djv
         {
             void Sequence::add(const Range& value)
             {
+                // Ranges that are added in ascending order are appended.
+                if (_ranges.empty() || value.getMin() > _ranges.back().getMax() + 1)
+                {
+                    _ranges.push_back(value);
+                    return;
+                }
+
                 Range newRange(value);
                 auto i = _ranges.begin();
                 while (i != _ranges.end())
@@ -46,6 +46,7 @@ namespace djv
             struct IEventSystem::Private
             {
                 std::vector<std::shared_ptr<IObject> > objectsCreated;
+                std::vector<std::weak_ptr<IObject> > updateRequests;
                 std::shared_ptr<RootObject> rootObject;
                 std::weak_ptr<TextSystem> textSystem;
                 std::chrono::steady_clock::time_point t;
@@ -212,9 +213,20 @@ namespace djv
                     _initRecursive(p.rootObject, event);
                 }
 
-                // Update event.
+                // Update event. Only the objects that have requested an
+                // update receive the event; requests made while handling the
+                // event are delivered on the next tick.
                 Update updateEvent(p.t, dt);
-                _updateRecursive(p.rootObject, updateEvent);
+                std::vector<std::weak_ptr<IObject> > updateRequests;
+                updateRequests.swap(p.updateRequests);
+                for (const auto& i : updateRequests)
+                {
+                    if (auto object = i.lock())
+                    {
+                        object->_updateRequest = false;
+                        object->event(updateEvent);
+                    }
+                }
 
                 // Move event.
                 PointerMove moveEvent(p.pointerInfo);
@@ -449,15 +461,9 @@ namespace djv
                 _p->objectsCreated.push_back(object);
             }
 
-            void IEventSystem::_updateRecursive(const std::shared_ptr<IObject>& object, Update& event)
+            void IEventSystem::_requestUpdate(const std::shared_ptr<IObject>& object)
             {
-                object->event(event);
-                const auto children = object->_children;
-                for (const auto& child : children)
-                {
-                    child->_parentsEnabled = object->_enabled && object->_parentsEnabled;
-                    _updateRecursive(child, event);
-                }
+                _p->updateRequests.push_back(object);
             }
 
             void IEventSystem::_setHover(const std::shared_ptr<IObject>& value)
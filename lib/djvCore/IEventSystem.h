@@ -83,13 +83,13 @@ namespace djv
                 virtual void _hover(PointerMove&, std::shared_ptr<IObject>&) = 0;
 
             private:
-                void _updateRecursive(const std::shared_ptr<IObject>&, Update&);
+                void _requestUpdate(const std::shared_ptr<IObject>&);
                 void _setHover(const std::shared_ptr<IObject>&);
                 void _keyPress(std::shared_ptr<IObject>, KeyPress&);
 
                 DJV_PRIVATE();
 
-                friend class IObject;
+                friend class Core::IObject;
             };
 
         } // namespace Event
@@ -33,6 +33,7 @@ namespace djv
             _logSystem = context->getSystemT<LogSystem>();
             _textSystem = context->getSystemT<TextSystem>();
             auto eventSystem = context->getSystemT<Event::IEventSystem>();
+            _eventSystem = eventSystem;
             eventSystem->_objectCreated(shared_from_this());
         }
 
@@ -83,6 +84,8 @@ namespace djv
 
             value->_parent = shared_from_this();
             _children.push_back(value);
+            value->_parentsEnabled = _enabled && _parentsEnabled;
+            value->_parentsEnabledUpdate();
             
             Event::ChildAdded childAddedEvent(value);
             event(childAddedEvent);
@@ -100,6 +103,8 @@ namespace djv
                 _children.erase(i);
 
                 child->_parent.reset();
+                child->_parentsEnabled = true;
+                child->_parentsEnabledUpdate();
 
                 Event::ChildRemoved childRemovedEvent(child);
                 event(childRemovedEvent);
@@ -153,7 +158,10 @@ namespace djv
 
         void IObject::setEnabled(bool value)
         {
+            if (value == _enabled)
+                return;
             _enabled = value;
+            _parentsEnabledUpdate();
         }
 
         bool IObject::event(Event::Event& event)
@@ -256,6 +264,17 @@ namespace djv
             // Default implementation does nothing.
         }
 
+        void IObject::_requestUpdate()
+        {
+            if (_updateRequest)
+                return;
+            if (auto eventSystem = _eventSystem.lock())
+            {
+                _updateRequest = true;
+                eventSystem->_requestUpdate(shared_from_this());
+            }
+        }
+
         std::string IObject::_getText(const std::string& id) const
         {
             return _textSystem->getText(id);
@@ -275,6 +294,19 @@ namespace djv
             object->event(event);
         }
         
+        void IObject::_parentsEnabledUpdate()
+        {
+            const bool enabled = _enabled && _parentsEnabled;
+            for (const auto& i : _children)
+            {
+                if (i->_parentsEnabled != enabled)
+                {
+                    i->_parentsEnabled = enabled;
+                    i->_parentsEnabledUpdate();
+                }
+            }
+        }
+
         bool IObject::_eventFilter(Event::Event& event)
         {
             bool filtered = false;
@@ -133,6 +133,12 @@ namespace djv
             virtual void _initEvent(Event::Init&);
             virtual void _updateEvent(Event::Update&);
 
+            //! Request an update event for the next tick. Objects only receive
+            //! update events when they request them, so objects with pending
+            //! work (for example waiting on a future) should request another
+            //! update from the update event until the work is finished.
+            void _requestUpdate();
+
             //! Over-ride this function to filter events for other objects.
             virtual bool _eventFilter(const std::shared_ptr<IObject>&, Event::Event&) { return false; }
 
@@ -153,6 +159,7 @@ namespace djv
 
         private:
             void _eventInitRecursive(const std::shared_ptr<IObject>&, Event::Init&);
+            void _parentsEnabledUpdate();
             bool _eventFilter(Event::Event&);
 
             template<typename T>
@@ -171,6 +178,9 @@ namespace djv
             bool _enabled = true;
             bool _parentsEnabled = true;
 
+            std::weak_ptr<Event::IEventSystem> _eventSystem;
+            bool _updateRequest = false;
+
             std::vector<std::weak_ptr<IObject> > _filters;
 
             std::shared_ptr<ResourceSystem> _resourceSystem;
@@ -166,6 +166,16 @@ namespace djv
                 //! - std::exception
                 static void rmdir(const Path&);
 
+                //! Remove a file.
+                //! Throws:
+                //! - std::exception
+                static void rm(const Path&);
+
+                //! Rename a file, replacing the destination if it exists.
+                //! Throws:
+                //! - std::exception
+                static void rename(const Path& from, const Path& to);
+
                 //! Get the absolute path.
                 //! Throws:
                 //! - std::exception
@@ -47,6 +47,28 @@ namespace djv
                         arg(DJV_TEXT("error_cannot_be_removed")));
                 }
             }
+
+            void Path::rm(const Path& value)
+            {
+                if (::unlink(value.get().c_str()) != 0)
+                {
+                    //! \todo How can we translate this?
+                    throw std::invalid_argument(String::Format("{0}: {1}").
+                        arg(value.get()).
+                        arg(DJV_TEXT("error_cannot_be_removed")));
+                }
+            }
+
+            void Path::rename(const Path& from, const Path& to)
+            {
+                if (::rename(from.get().c_str(), to.get().c_str()) != 0)
+                {
+                    //! \todo How can we translate this?
+                    throw std::invalid_argument(String::Format("{0}: {1}").
+                        arg(from.get()).
+                        arg(DJV_TEXT("error_cannot_be_renamed")));
+                }
+            }
             
             Path Path::getAbsolute(const Path& value)
             {
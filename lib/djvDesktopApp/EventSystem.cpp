@@ -72,6 +72,7 @@ namespace djv
 #if defined(DJV_OPENGL_ES2)
             std::shared_ptr<AV::OpenGL::Shader> shader;
 #endif // DJV_OPENGL_ES2
+            std::shared_ptr<ValueObserver<bool> > colorSpacesChangedObserver;
             std::shared_ptr<Time::Timer> statsTimer;
         };
 
@@ -114,9 +115,21 @@ namespace djv
             glfwSetCharModsCallback(glfwWindow, _charCallback);
             glfwSetScrollCallback(glfwWindow, _scrollCallback);
 
+            // Images that were drawn while their color space conversions were
+            // being created need to be redrawn.
+            auto weak = std::weak_ptr<EventSystem>(std::dynamic_pointer_cast<EventSystem>(shared_from_this()));
+            p.colorSpacesChangedObserver = ValueObserver<bool>::create(
+                p.render->observeColorSpacesChanged(),
+                [weak](bool)
+            {
+                if (auto system = weak.lock())
+                {
+                    system->_p->redrawRequest = true;
+                }
+            });
+
             p.statsTimer = Time::Timer::create(context);
             p.statsTimer->setRepeating(true);
-            auto weak = std::weak_ptr<EventSystem>(std::dynamic_pointer_cast<EventSystem>(shared_from_this()));
             p.statsTimer->start(
                 Time::getTime(Time::TimerValue::VerySlow),
                 [weak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
@@ -204,6 +217,10 @@ namespace djv
 
             if (p.offscreenBuffer)
             {
+                // The whole frame buffer is redrawn when it has been
+                // re-created, otherwise only the regions of the widgets that
+                // have changed are redrawn.
+                const bool redrawAll = p.resizeRequest || p.redrawRequest;
                 bool resizeRequest = p.resizeRequest;
                 bool redrawRequest = p.redrawRequest;
                 p.resizeRequest = false;
@@ -213,8 +230,13 @@ namespace djv
                     resizeRequest |= _resizeRequest(i);
                     redrawRequest |= _redrawRequest(i);
                 }
+                if (resizeRequest || redrawRequest)
+                {
+                    _resetCounts();
+                }
 
                 const auto& size = p.offscreenBuffer->getSize();
+                const BBox2f viewport(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
                 if (resizeRequest)
                 {
                     for (const auto& i : rootObject->getChildrenT<UI::Window>())
@@ -222,33 +244,44 @@ namespace djv
                         i->resize(glm::vec2(size.w, size.h));
 
                         Event::InitLayout initLayout;
-                        _initLayoutRecursive(i, initLayout);
+                        _initLayoutDirtyRecursive(i, initLayout);
 
                         Event::PreLayout preLayout;
-                        _preLayoutRecursive(i, preLayout);
-
-                        if (i->isVisible())
-                        {
-                            Event::Layout layout;
-                            _layoutRecursive(i, layout);
+                        _preLayoutDirtyRecursive(i, preLayout);
 
-                            Event::Clip clip(BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h)));
-                            _clipRecursive(i, clip);
-                        }
+                        Event::Layout layout;
+                        Event::Clip clip(viewport);
+                        _layoutDirtyRecursive(i, layout, clip);
                     }
                 }
 
-                if (resizeRequest || redrawRequest)
+                std::vector<BBox2f> regions;
+                for (const auto& i : _redrawRegions())
+                {
+                    const BBox2f region = i.intersect(viewport);
+                    if (region.isValid())
+                    {
+                        regions.push_back(region);
+                    }
+                }
+                if (redrawAll)
+                {
+                    regions = { viewport };
+                }
+                if (regions.size())
                 {
                     p.offscreenBuffer->bind();
-                    p.render->beginFrame(size);
-                    for (const auto& i : rootObject->getChildrenT<UI::Window>())
+                    p.render->beginFrame(size, regions);
+                    for (const auto& region : regions)
                     {
-                        if (i->isVisible())
+                        for (const auto& i : rootObject->getChildrenT<UI::Window>())
                         {
-                            Event::Paint paintEvent(BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h)));
-                            Event::PaintOverlay paintOverlayEvent(BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h)));
-                            _paintRecursive(i, paintEvent, paintOverlayEvent);
+                            if (i->isVisible())
+                            {
+                                Event::Paint paintEvent(region);
+                                Event::PaintOverlay paintOverlayEvent(region);
+                                _paintRecursive(i, paintEvent, paintOverlayEvent);
+                            }
                         }
                     }
                     p.render->endFrame();
@@ -335,20 +368,26 @@ namespace djv
                 p.shader->setUniform("transform.mvp", viewMatrix);
                 p.shader->setUniform("imageFormat", 3);
                 p.shader->setUniform("colorMode", 5);
-                const GLfloat color[] = { 1.F, 1.F, 1.F, 1.F };
-                p.shader->setUniform("color", color);
                 p.shader->setUniform("textureSampler", 0);
                                 
-                auto vbo = AV::OpenGL::VBO::create(2 * 4, AV::OpenGL::VBOType::Pos2_F32_UV_U16);
-                std::vector<uint8_t> vboData(6 * (2 * 4 + 2 * 2));
+                auto vbo = AV::OpenGL::VBO::create(6, AV::OpenGL::VBOType::Pos2_F32_UV_U16_Color_U8);
+                std::vector<uint8_t> vboData(6 * AV::OpenGL::getVertexByteCount(AV::OpenGL::VBOType::Pos2_F32_UV_U16_Color_U8));
                 struct Data
                 {
                     float x;
                     float y;
                     uint16_t u;
                     uint16_t v;
+                    uint8_t r;
+                    uint8_t g;
+                    uint8_t b;
+                    uint8_t a;
                 };
                 Data* vboP = reinterpret_cast<Data*>(&vboData[0]);
+                for (size_t i = 0; i < 6; ++i)
+                {
+                    vboP[i].r = vboP[i].g = vboP[i].b = vboP[i].a = 255;
+                }
                 vboP->x = 0.F;
                 vboP->y = 0.F;
                 vboP->u = 0.F;
@@ -380,7 +419,7 @@ namespace djv
                 vboP->v = 0;
                 ++vboP;
                 vbo->copy(vboData);
-                auto vao = AV::OpenGL::VAO::create(AV::OpenGL::VBOType::Pos2_F32_UV_U16, vbo->getID());
+                auto vao = AV::OpenGL::VAO::create(AV::OpenGL::VBOType::Pos2_F32_UV_U16_Color_U8, vbo->getID());
                 vao->draw(GL_TRIANGLES, 0, 6);
 #else // DJV_OPENGL_ES2
                 glBindFramebuffer(GL_READ_FRAMEBUFFER, p.offscreenBuffer->getID());
@@ -27,10 +27,15 @@ namespace djv
             bool textLCDRenderingDirty = false;
             std::shared_ptr<ValueObserver<bool> > textLCDRenderingObserver;
             std::shared_ptr<Time::Timer> statsTimer;
+            size_t layoutCount = 0;
+            size_t paintCount = 0;
         };
 
         namespace
         {
+            //! The maximum number of redraw regions after merging.
+            const size_t redrawRegionsMax = 8;
+
             /*void getClassNames(const std::shared_ptr<IObject>& object, std::map<std::string, size_t>& out)
             {
                 const std::string& className = object->getClassName();
@@ -100,6 +105,10 @@ namespace djv
 
         void EventSystem::tick()
         {
+            // Widgets only receive update events when they request them, so
+            // the update time is set here for all of them.
+            Widget::_updateTime = std::chrono::steady_clock::now();
+
             IEventSystem::tick();
             DJV_PRIVATE_PTR();
             if (auto context = getContext().lock())
@@ -154,6 +163,16 @@ namespace djv
             }
         }
 
+        size_t EventSystem::getLayoutCount() const
+        {
+            return _p->layoutCount;
+        }
+
+        size_t EventSystem::getPaintCount() const
+        {
+            return _p->paintCount;
+        }
+
         void EventSystem::_pushClipRect(const Core::BBox2f &)
         {
             // Default implementation does nothing.
@@ -178,6 +197,61 @@ namespace djv
             return out;
         }
 
+        std::vector<BBox2f> EventSystem::_redrawRegions() const
+        {
+            std::vector<BBox2f> out;
+            out.swap(Widget::_redrawRegions);
+
+            // Round the regions out to whole pixels and merge the ones that
+            // overlap.
+            for (auto& i : out)
+            {
+                i.min.x = floorf(i.min.x);
+                i.min.y = floorf(i.min.y);
+                i.max.x = ceilf(i.max.x);
+                i.max.y = ceilf(i.max.y);
+            }
+            bool merged = true;
+            while (merged)
+            {
+                merged = false;
+                for (size_t i = 0; i < out.size(); ++i)
+                {
+                    for (size_t j = i + 1; j < out.size();)
+                    {
+                        if (out[i].intersects(out[j]))
+                        {
+                            out[i].expand(out[j]);
+                            out.erase(out.begin() + j);
+                            merged = true;
+                        }
+                        else
+                        {
+                            ++j;
+                        }
+                    }
+                }
+            }
+            if (out.size() > redrawRegionsMax)
+            {
+                BBox2f bbox = out[0];
+                for (size_t i = 1; i < out.size(); ++i)
+                {
+                    bbox.expand(out[i]);
+                }
+                out.clear();
+                out.push_back(bbox);
+            }
+            return out;
+        }
+
+        void EventSystem::_resetCounts()
+        {
+            DJV_PRIVATE_PTR();
+            p.layoutCount = 0;
+            p.paintCount = 0;
+        }
+
         void EventSystem::_initLayoutRecursive(const std::shared_ptr<Widget>& widget, Event::InitLayout& event)
         {
             for (const auto& child : widget->getChildWidgets())
@@ -201,6 +275,7 @@ namespace djv
             if (widget->isVisible())
             {
                 widget->event(event);
+                ++_p->layoutCount;
                 for (const auto & child : widget->getChildWidgets())
                 {
                     _layoutRecursive(child, event);
@@ -220,16 +295,105 @@ namespace djv
             event.setClipRect(clipRect);
         }
 
+        void EventSystem::_initLayoutDirtyRecursive(const std::shared_ptr<Widget>& widget, Event::InitLayout& event)
+        {
+            if (widget->_layoutDirty)
+            {
+                for (const auto& child : widget->getChildWidgets())
+                {
+                    _initLayoutDirtyRecursive(child, event);
+                }
+                widget->event(event);
+            }
+        }
+
+        void EventSystem::_preLayoutDirtyRecursive(const std::shared_ptr<Widget>& widget, Event::PreLayout& event)
+        {
+            if (widget->_layoutDirty)
+            {
+                for (const auto& child : widget->getChildWidgets())
+                {
+                    _preLayoutDirtyRecursive(child, event);
+                }
+                widget->event(event);
+            }
+        }
+
+        void EventSystem::_layoutDirtyRecursive(
+            const std::shared_ptr<Widget>& widget,
+            Event::Layout& layoutEvent,
+            Event::Clip& clipEvent,
+            bool visible,
+            bool clip)
+        {
+            DJV_PRIVATE_PTR();
+            visible &= widget->isVisible();
+            if (!visible && !clip)
+                return;
+
+            const bool layout = visible && (widget->_layoutDirty || widget->_geometryDirty);
+            if (layout)
+            {
+                widget->_layoutDirty = false;
+                widget->_geometryDirty = false;
+                widget->event(layoutEvent);
+                ++p.layoutCount;
+
+                // The clip rectangles of the children need to be updated
+                // when the widget has been laid out.
+                clip = true;
+            }
+
+            if (clip)
+            {
+                const bool clipped = widget->_clipped;
+                const BBox2f clipRect = widget->_clipRect;
+                widget->event(clipEvent);
+                if (widget->_clipped != clipped || widget->_clipRect != clipRect)
+                {
+                    if (!clipped)
+                    {
+                        Widget::_addRedrawRegion(clipRect);
+                    }
+                    widget->_addRedrawRegion();
+                }
+            }
+
+            const BBox2f clipRect = clipEvent.getClipRect();
+            for (const auto& child : widget->getChildWidgets())
+            {
+                if (layout && child->_geometryDirty)
+                {
+                    // The widget may draw something that depends on the
+                    // geometry of the children.
+                    widget->_addRedrawRegion();
+                }
+                if (clip ||
+                    (visible && (child->_layoutDirty || child->_geometryDirty || child->_childLayoutDirty)))
+                {
+                    clipEvent.setClipRect(clipRect.intersect(child->getGeometry()));
+                    _layoutDirtyRecursive(child, layoutEvent, clipEvent, visible, clip);
+                }
+            }
+            clipEvent.setClipRect(clipRect);
+
+            if (visible)
+            {
+                widget->_childLayoutDirty = false;
+            }
+        }
+
         void EventSystem::_paintRecursive(
             const std::shared_ptr<Widget> & widget,
             Event::Paint & event,
             Event::PaintOverlay& overlayEvent)
         {
-            if (widget->isVisible() && !widget->isClipped())
+            const BBox2f clipRect = event.getClipRect();
+            if (widget->isVisible() && !widget->isClipped() && clipRect.isValid())
             {
-                const BBox2f clipRect = event.getClipRect();
                 _pushClipRect(clipRect);
                 widget->event(event);
+                ++_p->paintCount;
                 for (const auto & child : widget->getChildWidgets())
                 {
                     const BBox2f childClipRect = clipRect.intersect(child->getGeometry());
@@ -28,6 +28,12 @@ namespace djv
 
             void tick() override;
 
+            //! Get the number of widgets laid out in the last frame.
+            size_t getLayoutCount() const;
+
+            //! Get the number of widgets painted in the last frame.
+            size_t getPaintCount() const;
+
         protected:
             virtual void _pushClipRect(const Core::BBox2f &);
             virtual void _popClipRect();
@@ -35,10 +41,31 @@ namespace djv
             bool _resizeRequest(const std::shared_ptr<Widget> &) const;
             bool _redrawRequest(const std::shared_ptr<Widget> &) const;
 
+            //! Get the regions that need to be redrawn and clear them.
+            //! Overlapping regions are merged.
+            std::vector<Core::BBox2f> _redrawRegions() const;
+
+            //! Reset the layout and paint counts at the start of a frame.
+            void _resetCounts();
+
             void _initLayoutRecursive(const std::shared_ptr<Widget>&, Core::Event::InitLayout&);
             void _preLayoutRecursive(const std::shared_ptr<Widget>&, Core::Event::PreLayout&);
             void _layoutRecursive(const std::shared_ptr<Widget> &, Core::Event::Layout &);
             void _clipRecursive(const std::shared_ptr<Widget> &, Core::Event::Clip &);
+
+            //! These functions only visit the widgets that have changed since
+            //! the last frame and their ancestors. The layout and clip events
+            //! are combined so that the clip rectangles are only updated for
+            //! the widgets that have been laid out.
+            void _initLayoutDirtyRecursive(const std::shared_ptr<Widget>&, Core::Event::InitLayout&);
+            void _preLayoutDirtyRecursive(const std::shared_ptr<Widget>&, Core::Event::PreLayout&);
+            void _layoutDirtyRecursive(
+                const std::shared_ptr<Widget>&,
+                Core::Event::Layout&,
+                Core::Event::Clip&,
+                bool visible = true,
+                bool clip = false);
+
             void _paintRecursive(
                 const std::shared_ptr<Widget> &,
                 Core::Event::Paint &,
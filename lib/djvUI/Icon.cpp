@@ -68,6 +68,7 @@ namespace djv
                     auto iconSystem = context->getSystemT<IconSystem>();
                     const auto& style = _getStyle();
                     p.imageFuture = iconSystem->getIcon(p.name, style->getMetric(MetricsRole::Icon));
+                    _requestUpdate();
                 }
                 else
                 {
@@ -182,6 +183,7 @@ namespace djv
                         auto iconSystem = context->getSystemT<IconSystem>();
                         const auto& style = _getStyle();
                         p.imageFuture = iconSystem->getIcon(p.name, style->getMetric(MetricsRole::Icon));
+                        _requestUpdate();
                     }
                 }
             }
@@ -204,6 +206,10 @@ namespace djv
                 }
                 _resize();
             }
+            if (p.imageFuture.valid())
+            {
+                _requestUpdate();
+            }
         }
             
     } // namespace UI
@@ -325,6 +325,13 @@ namespace djv
                     _log(e.what(), LogLevel::Error);
                 }
             }
+            if (p.fontMetricsFuture.valid() ||
+                p.textSizeFuture.valid() ||
+                p.sizeStringFuture.valid() ||
+                p.glyphsFuture.valid())
+            {
+                _requestUpdate();
+            }
         }
 
         void Label::_textUpdate()
@@ -336,6 +343,7 @@ namespace djv
                 p.glyphs.clear();
             }
             p.glyphsFuture = p.fontSystem->getGlyphs(p.text, p.fontInfo);
+            _requestUpdate();
         }
 
         void Label::_sizeStringUpdate()
@@ -344,6 +352,7 @@ namespace djv
             if (!p.sizeString.empty())
             {
                 p.sizeStringFuture = p.fontSystem->measure(p.sizeString, p.fontInfo);
+                _requestUpdate();
             }
         }
 
@@ -798,6 +798,14 @@ namespace djv
                     _log(e.what(), LogLevel::Error);
                 }
             }
+            if (p.fontMetricsFuture.valid() ||
+                p.textSizeFuture.valid() ||
+                p.sizeStringFuture.valid() ||
+                p.glyphGeomFuture.valid() ||
+                p.glyphsFuture.valid())
+            {
+                _requestUpdate();
+            }
         }
 
         std::string LineEditBase::_fromUtf32(const std::basic_string<djv_char_t>& value)
@@ -870,6 +878,7 @@ namespace djv
             }
             p.glyphGeomFuture = p.fontSystem->measureGlyphs(p.text, fontInfo);
             p.glyphsFuture = p.fontSystem->getGlyphs(p.text, fontInfo);
+            _requestUpdate();
         }
 
         void LineEditBase::_cursorUpdate()
@@ -31,6 +31,19 @@ namespace djv
     {
         namespace
         {
+            template<typename T>
+            bool isPending(const T& futures)
+            {
+                for (const auto& i : futures)
+                {
+                    if (i.second.valid())
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
             class MenuWidget : public Widget
             {
                 DJV_NON_COPYABLE(MenuWidget);
@@ -575,6 +588,15 @@ namespace djv
                         }
                     }
                 }
+                if (isPending(_iconFutures) ||
+                    isPending(_fontMetricsFutures) ||
+                    isPending(_textSizeFutures) ||
+                    isPending(_textGlyphsFutures) ||
+                    isPending(_shortcutSizeFutures) ||
+                    isPending(_shortcutGlyphsFutures))
+                {
+                    _requestUpdate();
+                }
             }
 
             std::shared_ptr<MenuWidget::Item> MenuWidget::_getItem(const glm::vec2 & pos) const
@@ -658,6 +680,7 @@ namespace djv
                                             auto iconSystem = context->getSystemT<IconSystem>();
                                             auto style = widget->_getStyle();
                                             widget->_iconFutures[item] = iconSystem->getIcon(value, style->getMetric(MetricsRole::Icon));
+                                            widget->_requestUpdate();
                                             widget->_resize();
                                         }
                                     }
@@ -671,6 +694,7 @@ namespace djv
                                 {
                                     item->text = value;
                                     widget->_textUpdateRequest = true;
+                                    widget->_requestUpdate();
                                 }
                             });
                         _fontObservers[item] = ValueObserver<std::string>::create(
@@ -681,6 +705,7 @@ namespace djv
                             {
                                 item->font = value;
                                 widget->_textUpdateRequest = true;
+                                widget->_requestUpdate();
                             }
                         });
                         _shortcutsObservers[item] = ListObserver<std::shared_ptr<Shortcut> >::create(
@@ -702,6 +727,7 @@ namespace djv
                                     }
                                     item->shortcutLabel = String::join(labels, ", ");
                                     widget->_textUpdateRequest = true;
+                                    widget->_requestUpdate();
                                 }
                             }
                         });
@@ -741,6 +767,7 @@ namespace djv
                     _shortcutGlyphsFutures[i.second] = _fontSystem->getGlyphs(i.second->shortcutLabel, i.second->fontInfo);
                     _hasShortcuts |= i.second->shortcutLabel.size() > 0;
                 }
+                _requestUpdate();
             }
 
             class MenuPopupWidget : public Widget
@@ -36,8 +36,17 @@ namespace djv
             AV::Font::Metrics fontMetrics;
             std::future<AV::Font::Metrics> fontMetricsFuture;
             typedef std::pair<AV::Font::FontInfo, float> TextCacheKey;
+            struct TextCacheKeyHash
+            {
+                size_t operator() (const TextCacheKey& value) const
+                {
+                    size_t out = std::hash<AV::Font::FontInfo>()(value.first);
+                    Memory::hashCombine(out, value.second);
+                    return out;
+                }
+            };
             typedef std::pair<std::vector<AV::Font::TextLine>, glm::vec2> TextCacheValue;
-            Memory::Cache<TextCacheKey, TextCacheValue> textCache;
+            Memory::Cache<TextCacheKey, TextCacheValue, TextCacheKeyHash> textCache;
             BBox2f clipRect;
 
             TextCacheValue textLines(float);
@@ -280,6 +289,10 @@ namespace djv
                     _log(e.what(), LogLevel::Error);
                 }
             }
+            if (p.fontMetricsFuture.valid())
+            {
+                _requestUpdate();
+            }
         }
 
         void TextBlock::_textUpdate()
@@ -290,6 +303,7 @@ namespace djv
                 style->getFontInfo(p.fontFace, p.fontSizeRole) :
                 style->getFontInfo(p.fontFamily, p.fontFace, p.fontSizeRole);
             p.fontMetricsFuture = p.fontSystem->getMetrics(p.fontInfo);
+            _requestUpdate();
             p.fontSystem->cacheGlyphs(p.text, p.fontInfo);
             p.textCache.clear();
             _resize();
@@ -38,6 +38,9 @@ namespace djv
             const Time::Duration tooltipTimeout = std::chrono::milliseconds(500);
             const float tooltipHideDelta = 1.F;
 
+            //! The maximum number of redraw regions before they are merged.
+            const size_t redrawRegionsMax = 64;
+
             size_t globalWidgetCount = 0;
 
             class DefaultTooltipWidget : public ITooltipWidget
@@ -92,6 +95,7 @@ namespace djv
         bool Widget::_tooltipsEnabled = true;
         bool Widget::_resizeRequest   = true;
         bool Widget::_redrawRequest   = true;
+        std::vector<BBox2f> Widget::_redrawRegions;
 
         void Widget::_init(const std::shared_ptr<Context>& context)
         {
@@ -148,7 +152,17 @@ namespace djv
             if (value == _geometry)
                 return;
             _geometry = value;
-            _resize();
+
+            // Changing the geometry does not change the size hints, so only
+            // this widget and its children need to be laid out again.
+            _resizeRequest = true;
+            _geometryDirty = true;
+            auto parent = std::dynamic_pointer_cast<Widget>(getParent().lock());
+            while (parent && !parent->_layoutDirty && !parent->_childLayoutDirty)
+            {
+                parent->_childLayoutDirty = true;
+                parent = std::dynamic_pointer_cast<Widget>(parent->getParent().lock());
+            }
         }
 
         void Widget::setMargin(const Layout::Margin & value)
@@ -481,11 +495,14 @@ namespace djv
 
         void Widget::setEnabled(bool value)
         {
+            if (value == isEnabled())
+                return;
             IObject::setEnabled(value);
             if (!value)
             {
                 releaseTextFocus();
             }
+            _redraw();
         }
 
         bool Widget::event(Event::Event & event)
@@ -516,9 +533,9 @@ namespace djv
                             }
                         }
                     }
+                    _redraw();
                     _clipped = newParent;
                     _clipRect = BBox2f(0.F, 0.F, 0.F, 0.F);
-                    _redraw();
                     break;
                 }
                 case Event::Type::ChildAdded:
@@ -566,6 +583,11 @@ namespace djv
                             const auto j = _pointerHover.find(i.first);
                             const auto t = std::chrono::duration_cast<std::chrono::milliseconds>(_updateTime - i.second.timer);
                             const auto& g = getGeometry();
+                            if (_tooltipsEnabled && !i.second.tooltip && t <= tooltipTimeout)
+                            {
+                                // Keep updating until the tooltip timeout.
+                                _requestUpdate();
+                            }
                             if (_tooltipsEnabled &&
                                 t > tooltipTimeout &&
                                 !i.second.tooltip &&
@@ -665,6 +687,7 @@ namespace djv
                     _pointerHover[id] = info.projectedPos;
                     _pointerToTooltips[id] = TooltipData();
                     _pointerToTooltips[id].timer = _updateTime;
+                    _requestUpdate();
                     _pointerEnterEvent(static_cast<Event::PointerEnter &>(event));
                     break;
                 }
@@ -699,6 +722,7 @@ namespace djv
                         {
                             i->second.tooltip.reset();
                             i->second.timer = _updateTime;
+                            _requestUpdate();
                         }
                     }
                     _pointerHover[id] = info.projectedPos;
@@ -869,6 +893,28 @@ namespace djv
             }
         }
 
+        void Widget::_resize()
+        {
+            _resizeRequest = true;
+            _addRedrawRegion();
+
+            // Changing the size hints may change the layout of the ancestors,
+            // so mark them as dirty up to the first one that already is.
+            _layoutDirty = true;
+            auto parent = std::dynamic_pointer_cast<Widget>(getParent().lock());
+            while (parent && !parent->_layoutDirty)
+            {
+                parent->_layoutDirty = true;
+                parent = std::dynamic_pointer_cast<Widget>(parent->getParent().lock());
+            }
+        }
+
+        void Widget::_redraw()
+        {
+            _redrawRequest = true;
+            _addRedrawRegion();
+        }
+
         void Widget::_setMinimumSize(const glm::vec2& value)
         {
             if (value == _minimumSize)
@@ -885,6 +931,42 @@ namespace djv
             _resize();
         }
 
+        void Widget::_addRedrawRegion()
+        {
+            if (!_clipped)
+            {
+                // Top-level widgets do not have a clip rectangle.
+                _addRedrawRegion(_clipRect.isValid() ? _clipRect : _geometry);
+            }
+        }
+
+        void Widget::_addRedrawRegion(const BBox2f& value)
+        {
+            if (!value.isValid())
+                return;
+            for (const auto& i : _redrawRegions)
+            {
+                if (i.contains(value))
+                {
+                    return;
+                }
+            }
+            if (_redrawRegions.size() < redrawRegionsMax)
+            {
+                _redrawRegions.push_back(value);
+            }
+            else
+            {
+                BBox2f bbox = value;
+                for (const auto& i : _redrawRegions)
+                {
+                    bbox.expand(i);
+                }
+                _redrawRegions.clear();
+                _redrawRegions.push_back(bbox);
+            }
+        }
+
         std::string Widget::_getTooltipText() const
         {
             std::stringstream out;
@@ -200,10 +200,12 @@ namespace djv
 
             ///@}
 
-            //! Call this function when the widget needs resizing.
+            //! Call this function when the widget needs resizing. The widget
+            //! and its ancestors are laid out again in the next frame.
             void _resize();
 
-            //! Call this function to redraw the widget.
+            //! Call this function to redraw the widget. Only the area covered
+            //! by the widget is repainted in the next frame.
             void _redraw();
 
             //! Set the minimum size. This is computed and set in the pre-layout event.
@@ -220,6 +222,9 @@ namespace djv
             virtual std::shared_ptr<ITooltipWidget> _createTooltip(const glm::vec2 & pos);
 
         private:
+            void _addRedrawRegion();
+            static void _addRedrawRegion(const Core::BBox2f&);
+
             std::vector<std::shared_ptr<Widget> > _childWidgets;
 
             static std::chrono::steady_clock::time_point _updateTime;
@@ -261,6 +266,11 @@ namespace djv
 
             static bool         _resizeRequest;
             static bool         _redrawRequest;
+            static std::vector<Core::BBox2f>
+                                _redrawRegions;
+            bool                _layoutDirty     = true;
+            bool                _geometryDirty   = true;
+            bool                _childLayoutDirty = false;
 
             std::weak_ptr<EventSystem>              _eventSystem;
             std::shared_ptr<AV::Render2D::Render>   _render;
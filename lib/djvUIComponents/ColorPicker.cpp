@@ -124,7 +124,8 @@ namespace djv
         {
             DJV_PRIVATE_PTR();
             p.comboBox->clearItems();
-            for (size_t i = static_cast<size_t>(AV::Image::Type::L_U8); i < static_cast<size_t>(AV::Image::Type::Count); ++i)
+            // The planar YUV types are not used for colors.
+            for (size_t i = static_cast<size_t>(AV::Image::Type::L_U8); i < static_cast<size_t>(AV::Image::Type::YUV_420P_U8); ++i)
             {
                 std::stringstream ss;
                 ss << static_cast<AV::Image::Type>(i);
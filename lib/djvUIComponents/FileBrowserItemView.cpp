@@ -246,52 +246,74 @@ namespace djv
                 {
                     const auto& style = _getStyle();
                     const auto& clipRect = event.getClipRect();
+                    const auto prefetchRect = clipRect.margin(0.F, clipRect.h(), 0.F, clipRect.h());
+                    auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
+                    auto ioSystem = context->getSystemT<AV::IO::System>();
                     for (const auto& i : p.itemGeometry)
                     {
-                        if (i.first < p.items.size() && i.second.intersects(clipRect))
+                        const bool visible = i.first < p.items.size() && i.second.intersects(clipRect);
+                        const bool prefetch = !visible && i.first < p.items.size() && i.second.intersects(prefetchRect);
+                        if ((visible || prefetch) && thumbnailSystem && ioSystem)
                         {
+                            // Items that are visible are handled first, then
+                            // the items that are a page away.
                             const auto& fileInfo = p.items[i.first];
+                            const auto priority = visible ? AV::ThumbnailPriority::High : AV::ThumbnailPriority::Low;
+                            if (p.ioInfo.find(i.first) == p.ioInfo.end())
                             {
-                                const auto j = p.nameLines.find(i.first);
-                                if (j == p.nameLines.end())
+                                const auto j = p.ioInfoFutures.find(i.first);
+                                if (j == p.ioInfoFutures.end())
                                 {
-                                    const auto k = p.nameLinesFutures.find(i.first);
-                                    if (k == p.nameLinesFutures.end())
+                                    if (ioSystem->canRead(fileInfo))
                                     {
-                                        const float m = style->getMetric(MetricsRole::MarginSmall);
-                                        const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
-                                        p.names[i.first] = fileInfo.getFileName(Frame::invalid, false);
-                                        p.nameLinesFutures[i.first] = p.fontSystem->textLines(
-                                            p.names[i.first],
-                                            p.thumbnailSize.w - static_cast<uint16_t>(m * 2.F),
-                                            fontInfo);
+                                        p.ioInfoFutures[i.first] = thumbnailSystem->getInfo(fileInfo, priority);
+                                        _requestUpdate();
                                     }
                                 }
+                                else
+                                {
+                                    thumbnailSystem->setPriority(j->second.uid, priority);
+                                }
                             }
-                            if (p.ioInfo.find(i.first) == p.ioInfo.end())
+                            if (p.thumbnails.find(i.first) == p.thumbnails.end())
                             {
-                                if (p.ioInfoFutures.find(i.first) == p.ioInfoFutures.end())
+                                const auto j = p.thumbnailFutures.find(i.first);
+                                if (j == p.thumbnailFutures.end())
                                 {
-                                    auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
-                                    auto ioSystem = context->getSystemT<AV::IO::System>();
-                                    if (thumbnailSystem && ioSystem)
+                                    if (ioSystem->canRead(fileInfo))
                                     {
-                                        if (ioSystem->canRead(fileInfo))
-                                        {
-                                            p.ioInfoFutures[i.first] = thumbnailSystem->getInfo(fileInfo);
-                                        }
+                                        p.thumbnailFutures[i.first] = thumbnailSystem->getImage(
+                                            fileInfo,
+                                            p.thumbnailSize,
+                                            AV::Image::Type::None,
+                                            priority);
+                                        _requestUpdate();
                                     }
                                 }
+                                else
+                                {
+                                    thumbnailSystem->setPriority(j->second.uid, priority);
+                                }
                             }
-                            if (p.thumbnails.find(i.first) == p.thumbnails.end())
+                        }
+                        if (visible)
+                        {
+                            const auto& fileInfo = p.items[i.first];
                             {
-                                if (p.thumbnailFutures.find(i.first) == p.thumbnailFutures.end())
+                                const auto j = p.nameLines.find(i.first);
+                                if (j == p.nameLines.end())
                                 {
-                                    auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
-                                    auto ioSystem = context->getSystemT<AV::IO::System>();
-                                    if (thumbnailSystem && ioSystem && ioSystem->canRead(fileInfo))
+                                    const auto k = p.nameLinesFutures.find(i.first);
+                                    if (k == p.nameLinesFutures.end())
                                     {
-                                        p.thumbnailFutures[i.first] = thumbnailSystem->getImage(fileInfo, p.thumbnailSize);
+                                        const float m = style->getMetric(MetricsRole::MarginSmall);
+                                        const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
+                                        p.names[i.first] = fileInfo.getFileName(Frame::invalid, false);
+                                        p.nameLinesFutures[i.first] = p.fontSystem->textLines(
+                                            p.names[i.first],
+                                            p.thumbnailSize.w - static_cast<uint16_t>(m * 2.F),
+                                            fontInfo);
+                                        _requestUpdate();
                                     }
                                 }
                             }
@@ -302,6 +324,7 @@ namespace djv
                                     const std::string& label = fileInfo.getFileName(Frame::invalid, false);
                                     const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
                                     p.nameGlyphsFutures[i.first] = p.fontSystem->getGlyphs(label, fontInfo);
+                                    _requestUpdate();
                                 }
                             }
                             if (p.sizeGlyphs.find(i.first) == p.sizeGlyphs.end())
@@ -316,6 +339,7 @@ namespace djv
                                     ss << _getText(ss2.str());
                                     const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
                                     p.sizeGlyphsFutures[i.first] = p.fontSystem->getGlyphs(ss.str(), fontInfo);
+                                    _requestUpdate();
                                 }
                             }
                             if (p.timeGlyphs.find(i.first) == p.timeGlyphs.end())
@@ -325,10 +349,11 @@ namespace djv
                                     const std::string& label = Time::getLabel(fileInfo.getTime());
                                     const auto fontInfo = style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium);
                                     p.timeGlyphsFutures[i.first] = p.fontSystem->getGlyphs(label, fontInfo);
+                                    _requestUpdate();
                                 }
                             }
                         }
-                        else if (auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>())
+                        else if (!prefetch && thumbnailSystem)
                         {
                             {
                                 const auto j = p.ioInfoFutures.find(i.first);
@@ -922,6 +947,18 @@ namespace djv
                         }
                     }
                 }
+                if (p.nameFontMetricsFuture.valid() ||
+                    p.nameLinesFutures.size() ||
+                    p.ioInfoFutures.size() ||
+                    p.thumbnailFutures.size() ||
+                    p.thumbnailTimers.size() ||
+                    p.iconsFutures.size() ||
+                    p.nameGlyphsFutures.size() ||
+                    p.sizeGlyphsFutures.size() ||
+                    p.timeGlyphsFutures.size())
+                {
+                    _requestUpdate();
+                }
             }
 
             std::string ItemView::_getTooltip(const FileSystem::FileInfo& fileInfo) const
@@ -1011,6 +1048,7 @@ namespace djv
                         default: name = "djvIconFile"; break;
                         }
                         p.iconsFutures[type] = iconSystem->getIcon(name, p.thumbnailSize.h);
+                        _requestUpdate();
                     }
                 }
             }
@@ -1059,6 +1097,7 @@ namespace djv
                                                 p.names[i.first],
                                                 p.thumbnailSize.w - static_cast<uint16_t>(m * 2.F),
                                                 fontInfo);
+                                            _requestUpdate();
                                         }
                                     }
                                 }
@@ -1068,6 +1107,7 @@ namespace djv
                                     if (ioSystem && ioSystem->canRead(fileInfo))
                                     {
                                         p.thumbnailFutures[i.first] = thumbnailSystem->getImage(fileInfo, p.thumbnailSize);
+                                        _requestUpdate();
                                     }
                                 }
                             }
@@ -1084,13 +1124,18 @@ namespace djv
                     const auto& style = _getStyle();
                     p.nameFontMetricsFuture = p.fontSystem->getMetrics(
                         style->getFontInfo(AV::Font::faceDefault, MetricsRole::FontMedium));
+                    _requestUpdate();
                     p.names.clear();
                     p.nameLines.clear();
                     p.nameLinesFutures.clear();
                     p.ioInfo.clear();
-                    p.ioInfoFutures.clear();
                     p.thumbnails.clear();
                     auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
+                    for (const auto& i : p.ioInfoFutures)
+                    {
+                        thumbnailSystem->cancelInfo(i.second.uid);
+                    }
+                    p.ioInfoFutures.clear();
                     for (const auto& i : p.itemGeometry)
                     {
                         const auto j = p.thumbnailFutures.find(i.first);
@@ -100,6 +100,8 @@ namespace djv
                         widget->_p->pointCount->setIfChanged(widget->_p->render->getPointCount());
                     }
                 });
+
+            _requestUpdate();
         }
 
         SceneWidget::SceneWidget() :
@@ -359,6 +361,9 @@ namespace djv
 #endif // DJV_OPENGL_ES2
                 glBindFramebuffer(GL_FRAMEBUFFER, 0);
             }
+
+            // The scene is rendered continuously.
+            _requestUpdate();
         }
 
         void SceneWidget::_sceneUpdate()
@@ -11,6 +11,7 @@
 #include <djvViewApp/FileSettings.h>
 #include <djvViewApp/FileSystem.h>
 #include <djvViewApp/HelpSystem.h>
+#include <djvViewApp/HistogramSystem.h>
 #include <djvViewApp/ImageSystem.h>
 #include <djvViewApp/InputSystem.h>
 #include <djvViewApp/MagnifySystem.h>
@@ -118,6 +119,7 @@ namespace djv
             p.systems.push_back(AudioSystem::create(shared_from_this()));
             p.systems.push_back(ColorPickerSystem::create(shared_from_this()));
             p.systems.push_back(MagnifySystem::create(shared_from_this()));
+            p.systems.push_back(HistogramSystem::create(shared_from_this()));
             //p.systems.push_back(AnnotateSystem::create(shared_from_this()));
             p.systems.push_back(ToolSystem::create(shared_from_this()));
             p.systems.push_back(HelpSystem::create(shared_from_this()));
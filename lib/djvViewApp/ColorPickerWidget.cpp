@@ -24,20 +24,12 @@
 #include <djvUI/RowLayout.h>
 #include <djvUI/ToolButton.h>
 
-#include <djvAV/OCIOSystem.h>
 #include <djvAV/ImageUtil.h>
-#include <djvAV/OpenGLOffscreenBuffer.h>
+#include <djvAV/OCIOSystem.h>
 #include <djvAV/Render2D.h>
-#if defined(DJV_OPENGL_ES2)
-#include <djvAV/OpenGLMesh.h>
-#include <djvAV/OpenGLShader.h>
-#include <djvAV/Shader.h>
-#endif // DJV_OPENGL_ES2
 
 #include <djvCore/Context.h>
-#if defined(DJV_OPENGL_ES2)
-#include <djvCore/ResourceSystem.h>
-#endif // DJV_OPENGL_ES2
+#include <djvCore/Math.h>
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/matrix_transform_2d.hpp>
@@ -54,9 +46,6 @@ namespace djv
         {
             //! \todo Should this be configurable?
             const size_t sampleSizeMax = 100;
-
-            //! \todo What is this really?
-            const size_t bufferSizeMin = 100;
         
         } // namespace
 
@@ -92,11 +81,6 @@ namespace djv
             std::shared_ptr<UI::FormLayout> formLayout;
             std::shared_ptr<UI::VerticalLayout> layout;
 
-            std::shared_ptr<AV::OpenGL::OffscreenBuffer> offscreenBuffer;
-#if defined(DJV_OPENGL_ES2)
-            std::shared_ptr<AV::OpenGL::Shader> shader;
-#endif // DJV_OPENGL_ES2
-
             std::map<std::string, std::shared_ptr<ValueObserver<bool> > > actionObservers;
             std::shared_ptr<ValueObserver<std::shared_ptr<MediaWidget> > > activeWidgetObserver;
             std::shared_ptr<ValueObserver<std::shared_ptr<AV::Image::Image> > > imageObserver;
@@ -173,14 +157,6 @@ namespace djv
             p.layout->addChild(hLayout);
             addChild(p.layout);
 
-#if defined(DJV_OPENGL_ES2)
-            auto resourceSystem = context->getSystemT<ResourceSystem>();
-            const Core::FileSystem::Path shaderPath = resourceSystem->getPath(Core::FileSystem::ResourcePath::Shaders);
-            p.shader = AV::OpenGL::Shader::create(AV::Render::Shader::create(
-                Core::FileSystem::Path(shaderPath, "djvAVRender2DVertex.glsl"),
-                Core::FileSystem::Path(shaderPath, "djvAVRender2DFragment.glsl")));
-#endif // DJV_OPENGL_ES2
-
             _sampleUpdate();
             _widgetUpdate();
 
@@ -547,27 +523,31 @@ namespace djv
                         p.imageAspectRatio);
                     pixelPos = glm::inverse(glm::translate(m, glm::vec2(-.5F, -.5F))) * pixelPos;
 
-                    const size_t sampleSize = std::max(p.sampleSize, bufferSizeMin);
-                    const AV::Image::Size size(sampleSize, sampleSize);
-                    const AV::Image::Type type = p.lockType != AV::Image::Type::None ? p.lockType : p.image->getType();
-                    
-                    bool create = !p.offscreenBuffer;
-                    create |= p.offscreenBuffer && size != p.offscreenBuffer->getSize();
-                    create |= p.offscreenBuffer && type != p.offscreenBuffer->getColorType();
-                    if (create)
+                    // Find the sample area in the image data.
+                    const auto& info = p.image->getInfo();
+                    const glm::mat3x3 mInverse = glm::inverse(m);
+                    const float sampleSize = static_cast<float>(p.sampleSize);
+                    const glm::vec3 c0 = mInverse * glm::vec3(0.F, 0.F, 1.F);
+                    const glm::vec3 c1 = mInverse * glm::vec3(sampleSize, sampleSize, 1.F);
+                    BBox2i area;
+                    area.min.x = static_cast<int>(floorf(std::min(c0.x, c1.x) + .5F));
+                    area.min.y = static_cast<int>(floorf(std::min(c0.y, c1.y) + .5F));
+                    area.max.x = std::max(area.min.x, static_cast<int>(floorf(std::max(c0.x, c1.x) + .5F)) - 1);
+                    area.max.y = std::max(area.min.y, static_cast<int>(floorf(std::max(c0.y, c1.y) + .5F)) - 1);
+                    if (info.layout.mirror.x != p.imageOptions.mirror.x)
                     {
-                        p.offscreenBuffer = AV::OpenGL::OffscreenBuffer::create(size, type);
+                        const int x = area.min.x;
+                        area.min.x = info.size.w - 1 - area.max.x;
+                        area.max.x = info.size.w - 1 - x;
+                    }
+                    if (info.layout.mirror.y != p.imageOptions.mirror.y)
+                    {
+                        const int y = area.min.y;
+                        area.min.y = info.size.h - 1 - area.max.y;
+                        area.max.y = info.size.h - 1 - y;
                     }
 
-                    p.offscreenBuffer->bind();
-                    const auto& render = _getRender();
-                    const auto imageFilterOptions = render->getImageFilterOptions();
-                    render->setImageFilterOptions(AV::Render2D::ImageFilterOptions(AV::Render2D::ImageFilter::Nearest));
-                    render->beginFrame(size);
-                    render->setFillColor(AV::Image::Color(0.F, 0.F, 0.F));
-                    render->drawRect(BBox2f(0.F, 0.F, sampleSize, sampleSize));
-                    render->setFillColor(AV::Image::Color(1.F, 1.F, 1.F));
-                    render->pushTransform(m);
+                    // Get the image options and color space.
                     auto options = p.imageOptions;
                     if (!p.applyColorOperations)
                     {
@@ -593,27 +573,94 @@ namespace djv
                         }
                         options.colorSpace.output = p.outputColorSpace;
                     }
-                    options.cache = AV::Render2D::ImageCache::Dynamic;
-                    render->drawImage(p.image, glm::vec2(0.F, 0.F), options);
-                    render->popTransform();
-                    render->endFrame();
-                    render->setImageFilterOptions(imageFilterOptions);
-                    auto data = AV::Image::Data::create(AV::Image::Info(p.sampleSize, p.sampleSize, type));
-                    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-#if !defined(DJV_OPENGL_ES2)  // \todo GL_READ_FRAMEBUFFER, glClampColor not in OpenGL ES 2
-                    glBindFramebuffer(GL_READ_FRAMEBUFFER, p.offscreenBuffer->getID());
-                    glClampColor(GL_CLAMP_READ_COLOR, GL_FALSE);
-#endif
-                    glPixelStorei(GL_PACK_ALIGNMENT, 1);
-                    glReadPixels(
-                        0,
-                        static_cast<int>(sampleSize) - static_cast<int>(data->getHeight()),
-                        data->getWidth(),
-                        data->getHeight(),
-                        AV::Image::getGLFormat(type),
-                        AV::Image::getGLType(type),
-                        data->getData());
-                    p.color = AV::Image::getAverageColor(data);
+
+                    // Normalize the sample area. When zoomed out the area is
+                    // subsampled to the number of pixels in the sample, and
+                    // only those pixels are converted.
+                    std::vector<glm::vec4> pixels;
+                    const size_t stepMax = std::numeric_limits<uint16_t>::max();
+                    const uint16_t xStep = static_cast<uint16_t>(Math::clamp(static_cast<size_t>(area.w()) / p.sampleSize, static_cast<size_t>(1), stepMax));
+                    const uint16_t yStep = static_cast<uint16_t>(Math::clamp(static_cast<size_t>(area.h()) / p.sampleSize, static_cast<size_t>(1), stepMax));
+                    if (const auto values = AV::Image::convertToFloat(*p.image, area, xStep, yStep))
+                    {
+                        const uint16_t w = values->getWidth();
+                        const uint16_t h = values->getHeight();
+                        const uint8_t c = AV::Image::getChannelCount(values->getType());
+                        for (uint16_t y = 0; y < h; ++y)
+                        {
+                            const AV::Image::F32_T* row = reinterpret_cast<const AV::Image::F32_T*>(values->getData(y));
+                            for (uint16_t x = 0; x < w; ++x)
+                            {
+                                const AV::Image::F32_T* v = row + x * c;
+                                switch (c)
+                                {
+                                case 1: pixels.push_back(glm::vec4(v[0], v[0], v[0], 1.F)); break;
+                                case 2: pixels.push_back(glm::vec4(v[0], v[0], v[0], v[1])); break;
+                                case 3: pixels.push_back(glm::vec4(v[0], v[1], v[2], 1.F)); break;
+                                case 4: pixels.push_back(glm::vec4(v[0], v[1], v[2], v[3])); break;
+                                default: break;
+                                }
+                            }
+                        }
+                    }
+
+                    // Apply the image options and color space to each pixel
+                    // before averaging, the same as the display.
+                    glm::vec4 v(0.F, 0.F, 0.F, 1.F);
+                    if (pixels.size())
+                    {
+                        for (auto& i : pixels)
+                        {
+                            i = AV::Render2D::applyImageOptions(i, options);
+                        }
+                        if (options.colorSpace.isValid())
+                        {
+                            if (auto context = getContext().lock())
+                            {
+                                auto ocioSystem = context->getSystemT<AV::OCIO::System>();
+                                ocioSystem->applyRGBA(options.colorSpace, &pixels[0][0], pixels.size());
+                            }
+                        }
+                        v = glm::vec4(0.F, 0.F, 0.F, 0.F);
+                        for (const auto& i : pixels)
+                        {
+                            v += i;
+                        }
+                        v = v * (1.F / static_cast<float>(pixels.size()));
+                    }
+                    switch (options.channelDisplay)
+                    {
+                    case AV::Render2D::ImageChannelDisplay::Red:   v.g = v.b = v.r; break;
+                    case AV::Render2D::ImageChannelDisplay::Green: v.r = v.b = v.g; break;
+                    case AV::Render2D::ImageChannelDisplay::Blue:  v.r = v.g = v.b; break;
+                    case AV::Render2D::ImageChannelDisplay::Alpha: v.r = v.g = v.b = v.a; break;
+                    default: break;
+                    }
+
+                    const uint8_t channelCount = AV::Image::getChannelCount(info.type);
+                    AV::Image::Color out(AV::Image::getFloatType(channelCount, 32));
+                    switch (channelCount)
+                    {
+                    case 1:
+                        out.setF32(v.r, 0);
+                        break;
+                    case 2:
+                        out.setF32(v.r, 0);
+                        out.setF32(v.a, 1);
+                        break;
+                    default:
+                        for (uint8_t c = 0; c < channelCount; ++c)
+                        {
+                            out.setF32(v[c], c);
+                        }
+                        break;
+                    }
+                    AV::Image::Type type = p.lockType != AV::Image::Type::None ? p.lockType : info.type;
+                    if (AV::Image::isYUVType(type))
+                    {
+                        type = AV::Image::getRGBType(type);
+                    }
+                    p.color = out.convert(type);
                 }
                 catch (const std::exception& e)
                 {
@@ -623,10 +670,6 @@ namespace djv
                     _log(String::join(messages, ' '), LogLevel::Error);
                 }
             }
-            else if (p.offscreenBuffer)
-            {
-                p.offscreenBuffer.reset();
-            }
             switch (p.imageRotate)
             {
             /*case UI::ImageRotate::_90:
@@ -19,10 +19,12 @@
 
 #include <djvAV/IO.h>
 #include <djvAV/FontSystem.h>
+#include <djvAV/ImageDataPool.h>
 #include <djvAV/Render2D.h>
 #include <djvAV/ThumbnailSystem.h>
 
 #include <djvCore/Context.h>
+#include <djvCore/Memory.h>
 #include <djvCore/Timer.h>
 
 using namespace djv::Core;
@@ -124,6 +126,18 @@ namespace djv
                 _lineGraphs["WidgetCount"] = UI::LineGraphWidget::create(context);
                 _lineGraphs["WidgetCount"]->setPrecision(0);
 
+                _labels["LayoutCount"] = UI::Label::create(context);
+                _labels["LayoutCountValue"] = UI::Label::create(context);
+                _labels["LayoutCountValue"]->setFontFamily(AV::Font::familyMono);
+                _lineGraphs["LayoutCount"] = UI::LineGraphWidget::create(context);
+                _lineGraphs["LayoutCount"]->setPrecision(0);
+
+                _labels["PaintCount"] = UI::Label::create(context);
+                _labels["PaintCountValue"] = UI::Label::create(context);
+                _labels["PaintCountValue"]->setFontFamily(AV::Font::familyMono);
+                _lineGraphs["PaintCount"] = UI::LineGraphWidget::create(context);
+                _lineGraphs["PaintCount"]->setPrecision(0);
+
                 _labels["Hover"] = UI::Label::create(context);
                 _labels["Grab"] = UI::Label::create(context);
                 _labels["KeyGrab"] = UI::Label::create(context);
@@ -149,6 +163,11 @@ namespace djv
                 _labels["IconCacheValue"]->setFontFamily(AV::Font::familyMono);
                 _thermometerWidgets["IconCache"] = UI::ThermometerWidget::create(context);
 
+                _labels["ImageDataPool"] = UI::Label::create(context);
+                _labels["ImageDataPoolValue"] = UI::Label::create(context);
+                _labels["ImageDataPoolValue"]->setFontFamily(AV::Font::familyMono);
+                _thermometerWidgets["ImageDataPool"] = UI::ThermometerWidget::create(context);
+
                 for (auto& i : _labels)
                 {
                     i.second->setTextHAlign(UI::TextHAlign::Left);
@@ -181,6 +200,16 @@ namespace djv
                 hLayout->addChild(_labels["WidgetCountValue"]);
                 _layout->addChild(hLayout);
                 _layout->addChild(_lineGraphs["WidgetCount"]);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["LayoutCount"]);
+                hLayout->addChild(_labels["LayoutCountValue"]);
+                _layout->addChild(hLayout);
+                _layout->addChild(_lineGraphs["LayoutCount"]);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["PaintCount"]);
+                hLayout->addChild(_labels["PaintCountValue"]);
+                _layout->addChild(hLayout);
+                _layout->addChild(_lineGraphs["PaintCount"]);
                 _layout->addChild(_labels["Hover"]);
                 _layout->addChild(_labels["Grab"]);
                 _layout->addChild(_labels["KeyGrab"]);
@@ -205,6 +234,11 @@ namespace djv
                 hLayout->addChild(_labels["IconCacheValue"]);
                 _layout->addChild(hLayout);
                 _layout->addChild(_thermometerWidgets["IconCache"]);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["ImageDataPool"]);
+                hLayout->addChild(_labels["ImageDataPoolValue"]);
+                _layout->addChild(hLayout);
+                _layout->addChild(_thermometerWidgets["ImageDataPool"]);
                 addChild(_layout);
 
                 _timer = Time::Timer::create(context);
@@ -253,6 +287,8 @@ namespace djv
                     const size_t objectCount = IObject::getGlobalObjectCount();
                     const size_t widgetCount = UI::Widget::getGlobalWidgetCount();
                     auto eventSystem = context->getSystemT<UI::EventSystem>();
+                    const size_t layoutCount = eventSystem->getLayoutCount();
+                    const size_t paintCount = eventSystem->getPaintCount();
                     auto fontSystem = context->getSystemT<AV::Font::System>();
                     const float glyphCachePercentage = fontSystem->getGlyphCachePercentage();
                     auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
@@ -260,15 +296,24 @@ namespace djv
                     const float thumbnailImageCachePercentage = thumbnailSystem->getImageCachePercentage();
                     auto iconSystem = context->getSystemT<UI::IconSystem>();
                     const float iconCachePercentage = iconSystem->getCachePercentage();
+                    const auto& imageDataPool = AV::Image::DataPool::getGlobal();
+                    const AV::Image::DataPoolStats imageDataPoolStats = imageDataPool->getStats();
+                    const size_t imageDataPoolMax = imageDataPool->getMaxByteCount();
+                    const float imageDataPoolPercentage = imageDataPoolMax > 0 ?
+                        (imageDataPoolStats.byteCount / static_cast<float>(imageDataPoolMax) * 100.F) :
+                        0.F;
 
                     _lineGraphs["FPS"]->addSample(fps);
                     _lineGraphs["TotalSystemTime"]->addSample(totalSystemTime.count());
                     _lineGraphs["TopSystemTime"]->addSample(topSystemTimeValue.count());
                     _lineGraphs["ObjectCount"]->addSample(objectCount);
                     _lineGraphs["WidgetCount"]->addSample(widgetCount);
+                    _lineGraphs["LayoutCount"]->addSample(layoutCount);
+                    _lineGraphs["PaintCount"]->addSample(paintCount);
                     _thermometerWidgets["ThumbnailInfoCache"]->setPercentage(thumbnailInfoCachePercentage);
                     _thermometerWidgets["ThumbnailImageCache"]->setPercentage(thumbnailImageCachePercentage);
                     _thermometerWidgets["IconCache"]->setPercentage(iconCachePercentage);
+                    _thermometerWidgets["ImageDataPool"]->setPercentage(imageDataPoolPercentage);
                     _thermometerWidgets["GlyphCache"]->setPercentage(glyphCachePercentage);
 
                     {
@@ -322,6 +367,26 @@ namespace djv
                         ss << widgetCount;
                         _labels["WidgetCountValue"]->setText(ss.str());
                     }
+                    {
+                        std::stringstream ss;
+                        ss << _getText(DJV_TEXT("debug_general_layout_count")) << ":";
+                        _labels["LayoutCount"]->setText(ss.str());
+                    }
+                    {
+                        std::stringstream ss;
+                        ss << layoutCount;
+                        _labels["LayoutCountValue"]->setText(ss.str());
+                    }
+                    {
+                        std::stringstream ss;
+                        ss << _getText(DJV_TEXT("debug_general_paint_count")) << ":";
+                        _labels["PaintCount"]->setText(ss.str());
+                    }
+                    {
+                        std::stringstream ss;
+                        ss << paintCount;
+                        _labels["PaintCountValue"]->setText(ss.str());
+                    }
                     {
                         std::stringstream ss;
                         auto object = eventSystem->observeHover()->get();
@@ -398,6 +463,19 @@ namespace djv
                         ss << std::fixed << iconCachePercentage << "%";
                         _labels["IconCacheValue"]->setText(ss.str());
                     }
+                    {
+                        std::stringstream ss;
+                        ss << _getText(DJV_TEXT("debug_general_image_data_pool")) << ":";
+                        _labels["ImageDataPool"]->setText(ss.str());
+                    }
+                    {
+                        std::stringstream ss;
+                        ss << imageDataPoolStats.hits << "/" << imageDataPoolStats.misses << " ";
+                        std::stringstream ss2;
+                        ss2 << Memory::getUnitLabel(imageDataPoolStats.byteCount);
+                        ss << Memory::getSizeLabel(imageDataPoolStats.byteCount) << _getText(ss2.str());
+                        _labels["ImageDataPoolValue"]->setText(ss.str());
+                    }
                 }
             }
 
@@ -439,6 +517,12 @@ namespace djv
                 _lineGraphs["VBOSize"] = UI::LineGraphWidget::create(context);
                 _lineGraphs["VBOSize"]->setPrecision(0);
 
+                _labels["UploadWait"] = UI::Label::create(context);
+                _labels["UploadWaitValue"] = UI::Label::create(context);
+                _labels["UploadWaitValue"]->setFontFamily(AV::Font::familyMono);
+                _lineGraphs["UploadWait"] = UI::LineGraphWidget::create(context);
+                _lineGraphs["UploadWait"]->setPrecision(2);
+
                 for (auto& i : _labels)
                 {
                     i.second->setTextHAlign(UI::TextHAlign::Left);
@@ -461,6 +545,11 @@ namespace djv
                 hLayout->addChild(_labels["VBOSizeValue"]);
                 _layout->addChild(hLayout);
                 _layout->addChild(_lineGraphs["VBOSize"]);
+                hLayout = UI::HorizontalLayout::create(context);
+                hLayout->addChild(_labels["UploadWait"]);
+                hLayout->addChild(_labels["UploadWaitValue"]);
+                _layout->addChild(hLayout);
+                _layout->addChild(_lineGraphs["UploadWait"]);
                 addChild(_layout);
 
                 _timer = Time::Timer::create(context);
@@ -493,10 +582,12 @@ namespace djv
                 const float textureAtlasPercentage = render->getTextureAtlasPercentage();
                 const size_t dynamicTextureCount = render->getDynamicTextureCount();
                 const size_t vboSize = render->getVBOSize();
+                const float uploadWait = render->getUploadWaitTime().count() / 1000.F;
 
                 _thermometerWidgets["TextureAtlas"]->setPercentage(textureAtlasPercentage);
                 _lineGraphs["DynamicTextureCount"]->addSample(dynamicTextureCount);
                 _lineGraphs["VBOSize"]->addSample(vboSize);
+                _lineGraphs["UploadWait"]->addSample(uploadWait);
 
                 {
                     std::stringstream ss;
@@ -529,6 +620,17 @@ namespace djv
                     ss << vboSize;
                     _labels["VBOSizeValue"]->setText(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_upload_wait")) << ":";
+                    _labels["UploadWait"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(2);
+                    ss << std::fixed << uploadWait << "ms";
+                    _labels["UploadWaitValue"]->setText(ss.str());
+                }
             }
 
             class MediaDebugWidget : public UI::Widget
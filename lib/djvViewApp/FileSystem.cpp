@@ -20,6 +20,7 @@
 #include <djvUI/Shortcut.h>
 
 #include <djvAV/AVSystem.h>
+#include <djvAV/IOFrameCache.h>
 
 #include <djvCore/Context.h>
 #include <djvCore/FileInfo.h>
@@ -403,15 +404,13 @@ namespace djv
                 {
                     if (auto system = weak.lock())
                     {
-                        size_t cacheMaxByteCount  = 0;
+                        size_t cacheMaxByteCount = 0;
                         size_t cacheByteCount = 0;
-                        for (const auto& i : system->_p->media->get())
+                        if (auto context = system->getContext().lock())
                         {
-                            if (i->hasCache())
-                            {
-                                cacheMaxByteCount  += i->getCacheMaxByteCount();
-                                cacheByteCount += i->getCacheByteCount();
-                            }
+                            const auto& frameCache = context->getSystemT<AV::IO::System>()->getFrameCache();
+                            cacheMaxByteCount = frameCache->getMaxByteCount();
+                            cacheByteCount = frameCache->getByteCount();
                         }
                         const float percentage = cacheMaxByteCount ?
                             (cacheByteCount / static_cast<float>(cacheMaxByteCount) * 100.F) :
@@ -630,6 +629,7 @@ namespace djv
             if (p.currentMedia->setIfChanged(media))
             {
                 _actionsUpdate();
+                _cacheUpdate();
             }
         }
 
@@ -662,23 +662,22 @@ namespace djv
 
         void FileSystem::_cacheUpdate()
         {
+            // All of the media share one frame cache. Only the current media
+            // reads ahead, the frames of the other media are kept until the
+            // cache runs out of memory.
             DJV_PRIVATE_PTR();
-            size_t cacheCount = 0;
-            const auto& media = p.media->get();
-            for (const auto& i : media)
-            {
-                if (i->hasCache())
-                {
-                    ++cacheCount;
-                }
-            }
             const bool cacheEnabled = p.settings->observeCacheEnabled()->get();
             const size_t cacheMaxByteCount = p.settings->observeCacheMaxGB()->get() * Memory::gigabyte;
-            const size_t mediaCacheSizeByteCount = cacheCount > 0 ? (cacheMaxByteCount / cacheCount) : 0;
-            for (const auto& i : media)
+            if (auto context = getContext().lock())
+            {
+                const auto& frameCache = context->getSystemT<AV::IO::System>()->getFrameCache();
+                frameCache->setMaxByteCount(cacheEnabled ? cacheMaxByteCount : 0);
+            }
+            const auto& currentMedia = p.currentMedia->get();
+            for (const auto& i : p.media->get())
             {
                 i->setCacheEnabled(cacheEnabled);
-                i->setCacheMaxByteCount(mediaCacheSizeByteCount);
+                i->setCacheMaxByteCount(i == currentMedia ? cacheMaxByteCount : 0);
             }
         }
 
@@ -297,6 +297,12 @@ namespace djv
                     ++j;
                 }
             }
+            if (p.fontMetricsFuture.valid() ||
+                p.textSizeFutures.size() ||
+                p.glyphsFutures.size())
+            {
+                _requestUpdate();
+            }
         }
 
         void HUDWidget::_textUpdate()
@@ -305,6 +311,7 @@ namespace djv
             const auto& style = _getStyle();
             const auto fontInfo = style->getFontInfo(AV::Font::familyMono, std::string(), UI::MetricsRole::FontMedium);
             p.fontMetricsFuture = p.fontSystem->getMetrics(fontInfo);
+            _requestUpdate();
             p.textSizeFutures.clear();
             {
                 std::stringstream ss;
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2019-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvViewApp/HistogramSettings.h>
+
+#if defined(GetObject)
+#undef GetObject
+#endif // GetObject
+
+// These need to be included last on OSX.
+#include <djvCore/RapidJSONTemplates.h>
+#include <djvUI/ISettingsTemplates.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace ViewApp
+    {
+        struct HistogramSettings::Private
+        {
+            bool logScale = false;
+            bool applyColorOperations = false;
+            bool applyColorSpace = false;
+            std::map<std::string, BBox2f> widgetGeom;
+        };
+
+        void HistogramSettings::_init(const std::shared_ptr<Core::Context>& context)
+        {
+            ISettings::_init("djv::ViewApp::HistogramSettings", context);
+            _load();
+        }
+
+        HistogramSettings::HistogramSettings() :
+            _p(new Private)
+        {}
+
+        HistogramSettings::~HistogramSettings()
+        {}
+
+        std::shared_ptr<HistogramSettings> HistogramSettings::create(const std::shared_ptr<Core::Context>& context)
+        {
+            auto out = std::shared_ptr<HistogramSettings>(new HistogramSettings);
+            out->_init(context);
+            return out;
+        }
+
+        bool HistogramSettings::getLogScale() const
+        {
+            return _p->logScale;
+        }
+
+        void HistogramSettings::setLogScale(bool value)
+        {
+            _p->logScale = value;
+        }
+
+        bool HistogramSettings::getApplyColorOperations() const
+        {
+            return _p->applyColorOperations;
+        }
+
+        void HistogramSettings::setApplyColorOperations(bool value)
+        {
+            _p->applyColorOperations = value;
+        }
+
+        bool HistogramSettings::getApplyColorSpace() const
+        {
+            return _p->applyColorSpace;
+        }
+
+        void HistogramSettings::setApplyColorSpace(bool value)
+        {
+            _p->applyColorSpace = value;
+        }
+
+        const std::map<std::string, BBox2f>& HistogramSettings::getWidgetGeom() const
+        {
+            return _p->widgetGeom;
+        }
+
+        void HistogramSettings::setWidgetGeom(const std::map<std::string, BBox2f>& value)
+        {
+            _p->widgetGeom = value;
+        }
+
+        void HistogramSettings::load(const rapidjson::Value & value)
+        {
+            if (value.IsObject())
+            {
+                DJV_PRIVATE_PTR();
+                UI::Settings::read("logScale", value, p.logScale);
+                UI::Settings::read("applyColorOperations", value, p.applyColorOperations);
+                UI::Settings::read("applyColorSpace", value, p.applyColorSpace);
+                UI::Settings::read("WidgetGeom", value, p.widgetGeom);
+            }
+        }
+
+        rapidjson::Value HistogramSettings::save(rapidjson::Document::AllocatorType& allocator)
+        {
+            DJV_PRIVATE_PTR();
+            rapidjson::Value out(rapidjson::kObjectType);
+            UI::Settings::write("logScale", p.logScale, out, allocator);
+            UI::Settings::write("applyColorOperations", p.applyColorOperations, out, allocator);
+            UI::Settings::write("applyColorSpace", p.applyColorSpace, out, allocator);
+            UI::Settings::write("WidgetGeom", p.widgetGeom, out, allocator);
+            return out;
+        }
+
+    } // namespace ViewApp
+} // namespace djv
+
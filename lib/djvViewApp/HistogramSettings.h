@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2019-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvUI/ISettings.h>
+
+#include <djvCore/BBox.h>
+#include <djvCore/ValueObserver.h>
+
+#include <map>
+
+namespace djv
+{
+    namespace ViewApp
+    {
+        //! This class provides the histogram settings.
+        class HistogramSettings : public UI::Settings::ISettings
+        {
+            DJV_NON_COPYABLE(HistogramSettings);
+
+        protected:
+            void _init(const std::shared_ptr<Core::Context>&);
+
+            HistogramSettings();
+
+        public:
+            virtual ~HistogramSettings();
+
+            static std::shared_ptr<HistogramSettings> create(const std::shared_ptr<Core::Context>&);
+
+            bool getLogScale() const;
+            void setLogScale(bool);
+
+            bool getApplyColorOperations() const;
+            void setApplyColorOperations(bool);
+
+            bool getApplyColorSpace() const;
+            void setApplyColorSpace(bool);
+
+            const std::map<std::string, Core::BBox2f>& getWidgetGeom() const;
+            void setWidgetGeom(const std::map<std::string, Core::BBox2f>&);
+
+            void load(const rapidjson::Value &) override;
+            rapidjson::Value save(rapidjson::Document::AllocatorType&) override;
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace ViewApp
+} // namespace djv
+
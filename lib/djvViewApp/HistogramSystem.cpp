@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2019-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvViewApp/HistogramSystem.h>
+
+#include <djvViewApp/HistogramSettings.h>
+#include <djvViewApp/HistogramWidget.h>
+
+#include <djvUI/Action.h>
+#include <djvUI/Shortcut.h>
+
+#include <djvCore/Context.h>
+#include <djvCore/TextSystem.h>
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace ViewApp
+    {
+        struct HistogramSystem::Private
+        {
+            std::shared_ptr<HistogramSettings> settings;
+            std::map<std::string, std::shared_ptr<UI::Action> > actions;
+            std::weak_ptr<HistogramWidget> widget;
+        };
+
+        void HistogramSystem::_init(const std::shared_ptr<Context>& context)
+        {
+            IToolSystem::_init("djv::ViewApp::HistogramSystem", context);
+            DJV_PRIVATE_PTR();
+
+            p.settings = HistogramSettings::create(context);
+            _setWidgetGeom(p.settings->getWidgetGeom());
+
+            p.actions["Histogram"] = UI::Action::create();
+            p.actions["Histogram"]->setIcon("djvIconColor");
+            p.actions["Histogram"]->setShortcut(GLFW_KEY_J, UI::Shortcut::getSystemModifier());
+
+            _textUpdate();
+        }
+
+        HistogramSystem::HistogramSystem() :
+            _p(new Private)
+        {}
+
+        HistogramSystem::~HistogramSystem()
+        {
+            DJV_PRIVATE_PTR();
+            _closeWidget("Histogram");
+            p.settings->setWidgetGeom(_getWidgetGeom());
+        }
+
+        std::shared_ptr<HistogramSystem> HistogramSystem::create(const std::shared_ptr<Context>& context)
+        {
+            auto out = std::shared_ptr<HistogramSystem>(new HistogramSystem);
+            out->_init(context);
+            return out;
+        }
+
+        ToolActionData HistogramSystem::getToolAction() const
+        {
+            return
+            {
+                _p->actions["Histogram"],
+                "D"
+            };
+        }
+
+        void HistogramSystem::setCurrentTool(bool value, int index)
+        {
+            DJV_PRIVATE_PTR();
+            if (value)
+            {
+                if (p.widget.expired())
+                {
+                    if (auto context = getContext().lock())
+                    {
+                        auto widget = HistogramWidget::create(context);
+                        widget->setLogScale(p.settings->getLogScale());
+                        widget->setApplyColorOperations(p.settings->getApplyColorOperations());
+                        widget->setApplyColorSpace(p.settings->getApplyColorSpace());
+                        p.widget = widget;
+                        _openWidget("Histogram", widget);
+                    }
+                }
+            }
+            else if (-1 == index)
+            {
+                _closeWidget("Histogram");
+            }
+        }
+
+        std::map<std::string, std::shared_ptr<UI::Action> > HistogramSystem::getActions() const
+        {
+            return _p->actions;
+        }
+
+        void HistogramSystem::_closeWidget(const std::string& value)
+        {
+            DJV_PRIVATE_PTR();
+            const auto i = p.actions.find(value);
+            if (i != p.actions.end())
+            {
+                i->second->setChecked(false);
+            }
+            if (auto widget = p.widget.lock())
+            {
+                p.settings->setLogScale(widget->getLogScale());
+                p.settings->setApplyColorOperations(widget->getApplyColorOperations());
+                p.settings->setApplyColorSpace(widget->getApplyColorSpace());
+                p.widget.reset();
+            }
+            IToolSystem::_closeWidget(value);
+        }
+
+        void HistogramSystem::_textUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            if (p.actions.size())
+            {
+                p.actions["Histogram"]->setText(_getText(DJV_TEXT("menu_tools_histogram")));
+                p.actions["Histogram"]->setTooltip(_getText(DJV_TEXT("menu_histogram_tooltip")));
+            }
+        }
+        
+    } // namespace ViewApp
+} // namespace djv
+
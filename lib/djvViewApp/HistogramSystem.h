@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2019-2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvViewApp/IToolSystem.h>
+
+namespace djv
+{
+    namespace ViewApp
+    {
+        //! This class provides the histogram system.
+        class HistogramSystem : public IToolSystem
+        {
+            DJV_NON_COPYABLE(HistogramSystem);
+
+        protected:
+            void _init(const std::shared_ptr<Core::Context>&);
+            HistogramSystem();
+
+        public:
+            ~HistogramSystem() override;
+
+            static std::shared_ptr<HistogramSystem> create(const std::shared_ptr<Core::Context>&);
+
+            ToolActionData getToolAction() const override;
+            void setCurrentTool(bool, int) override;
+
+            std::map<std::string, std::shared_ptr<UI::Action> > getActions() const override;
+
+        protected:
+            void _closeWidget(const std::string&) override;
+            void _textUpdate() override;
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace ViewApp
+} // namespace djv
+
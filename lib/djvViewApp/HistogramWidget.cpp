@@ -4,21 +4,364 @@
 
 #include <djvViewApp/HistogramWidget.h>
 
+#include <djvViewApp/MediaWidget.h>
+#include <djvViewApp/ViewWidget.h>
+#include <djvViewApp/WindowSystem.h>
+
+#include <djvUI/Action.h>
+#include <djvUI/Menu.h>
+#include <djvUI/PopupMenu.h>
+#include <djvUI/RowLayout.h>
+
+#include <djvAV/IO.h>
+#include <djvAV/IOThreadPool.h>
+#include <djvAV/ImageHistogram.h>
+#include <djvAV/OCIOSystem.h>
+#include <djvAV/OpenGLOffscreenBuffer.h>
+#include <djvAV/Render2D.h>
+
+#include <djvCore/Cache.h>
+#include <djvCore/Context.h>
+#include <djvCore/Memory.h>
+
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_transform_2d.hpp>
+
+#include <future>
+
 using namespace djv::Core;
 
 namespace djv
 {
     namespace ViewApp
     {
+        namespace
+        {
+            //! The maximum number of cached histograms.
+            const size_t cacheMax = 100;
+
+            //! The maximum size of the image rendered when applying the color
+            //! space or color operations.
+            //!
+            //! \todo Should this be configurable?
+            const uint16_t renderSizeMax = 512;
+
+            class GraphWidget : public UI::Widget
+            {
+                DJV_NON_COPYABLE(GraphWidget);
+
+            protected:
+                void _init(const std::shared_ptr<Context>&);
+                GraphWidget();
+
+            public:
+                virtual ~GraphWidget();
+
+                static std::shared_ptr<GraphWidget> create(const std::shared_ptr<Context>&);
+
+                void setHistogram(const AV::Image::Histogram&);
+                void setLogScale(bool);
+
+            protected:
+                void _preLayoutEvent(Event::PreLayout&) override;
+                void _paintEvent(Event::Paint&) override;
+
+            private:
+                AV::Image::Histogram _histogram;
+                bool _logScale = false;
+            };
+
+            void GraphWidget::_init(const std::shared_ptr<Context>& context)
+            {
+                Widget::_init(context);
+                setClassName("djv::ViewApp::HistogramWidget::GraphWidget");
+                setBackgroundRole(UI::ColorRole::Trough);
+            }
+
+            GraphWidget::GraphWidget()
+            {}
+
+            GraphWidget::~GraphWidget()
+            {}
+
+            std::shared_ptr<GraphWidget> GraphWidget::create(const std::shared_ptr<Context>& context)
+            {
+                auto out = std::shared_ptr<GraphWidget>(new GraphWidget);
+                out->_init(context);
+                return out;
+            }
+
+            void GraphWidget::setHistogram(const AV::Image::Histogram& value)
+            {
+                if (value == _histogram)
+                    return;
+                _histogram = value;
+                _redraw();
+            }
+
+            void GraphWidget::setLogScale(bool value)
+            {
+                if (value == _logScale)
+                    return;
+                _logScale = value;
+                _redraw();
+            }
+
+            void GraphWidget::_preLayoutEvent(Event::PreLayout&)
+            {
+                const auto& style = _getStyle();
+                const float sw = style->getMetric(UI::MetricsRole::Swatch);
+                _setMinimumSize(glm::vec2(sw * 4.F, sw * 2.F));
+            }
+
+            void GraphWidget::_paintEvent(Event::Paint&)
+            {
+                if (!_histogram.isValid())
+                    return;
+
+                const auto& style = _getStyle();
+                const BBox2f& g = getMargin().bbox(getGeometry(), style);
+
+                std::vector<std::pair<AV::Image::HistogramChannel, AV::Image::Color> > channels;
+                if (_histogram.getChannelCount() >= 3)
+                {
+                    channels.push_back(std::make_pair(AV::Image::HistogramChannel::Red, AV::Image::Color(1.F, 0.F, 0.F, .5F)));
+                    channels.push_back(std::make_pair(AV::Image::HistogramChannel::Green, AV::Image::Color(0.F, 1.F, 0.F, .5F)));
+                    channels.push_back(std::make_pair(AV::Image::HistogramChannel::Blue, AV::Image::Color(0.F, 0.F, 1.F, .5F)));
+                }
+                channels.push_back(std::make_pair(AV::Image::HistogramChannel::Luminance, AV::Image::Color(1.F, 1.F, 1.F, .25F)));
+
+                // Scale all of the channels by the same maximum so they can be
+                // compared.
+                size_t max = 0;
+                for (const auto& i : channels)
+                {
+                    max = std::max(max, _histogram.getMax(i.first));
+                }
+                if (!max)
+                    return;
+                const float maxScaled = _logScale ? logf(static_cast<float>(max) + 1.F) : static_cast<float>(max);
+
+                const auto& render = _getRender();
+                const float binWidth = g.w() / static_cast<float>(AV::Image::histogramBinCount);
+                std::vector<BBox2f> rects;
+                for (const auto& i : channels)
+                {
+                    rects.clear();
+                    const auto& bins = _histogram.getBins(i.first);
+                    for (size_t j = 0; j < bins.size(); ++j)
+                    {
+                        if (bins[j])
+                        {
+                            const float v = _logScale ? logf(static_cast<float>(bins[j]) + 1.F) : static_cast<float>(bins[j]);
+                            const float h = floorf(v / maxScaled * g.h());
+                            const float x0 = floorf(g.min.x + j * binWidth);
+                            const float x1 = floorf(g.min.x + (j + 1) * binWidth);
+                            rects.push_back(BBox2f(x0, g.max.y - h, std::max(x1 - x0, 1.F), h));
+                        }
+                    }
+                    render->setFillColor(i.second);
+                    render->drawRects(rects);
+                }
+            }
+
+        } // namespace
+
         struct HistogramWidget::Private
         {
+            bool logScale = false;
+            bool applyColorOperations = false;
+            bool applyColorSpace = false;
+            std::shared_ptr<AV::Image::Image> image;
+            AV::Render2D::ImageOptions imageOptions;
+            size_t imageOptionsGeneration = 0;
+            AV::OCIO::Config ocioConfig;
+            std::string outputColorSpace;
+            std::shared_ptr<MediaWidget> activeWidget;
+
+            size_t key = 0;
+            Memory::Cache<size_t, AV::Image::Histogram> cache;
+            std::shared_ptr<AV::Image::Data> pendingData;
+            size_t pendingKey = 0;
+            std::future<AV::Image::Histogram> future;
+            size_t futureKey = 0;
+
+            std::map<std::string, std::shared_ptr<UI::Action> > actions;
+            std::shared_ptr<GraphWidget> graphWidget;
+            std::shared_ptr<UI::Menu> settingsMenu;
+            std::shared_ptr<UI::PopupMenu> settingsPopupMenu;
+            std::shared_ptr<UI::VerticalLayout> layout;
 
+            std::shared_ptr<AV::OpenGL::OffscreenBuffer> offscreenBuffer;
+
+            std::map<std::string, std::shared_ptr<ValueObserver<bool> > > actionObservers;
+            std::shared_ptr<ValueObserver<std::shared_ptr<MediaWidget> > > activeWidgetObserver;
+            std::shared_ptr<ValueObserver<std::shared_ptr<AV::Image::Image> > > imageObserver;
+            std::shared_ptr<ValueObserver<AV::Render2D::ImageOptions> > imageOptionsObserver;
+            std::shared_ptr<ValueObserver<AV::OCIO::Config> > ocioConfigObserver;
+            std::shared_ptr<ValueObserver<bool> > colorSpacesChangedObserver;
         };
 
         void HistogramWidget::_init(const std::shared_ptr<Context>& context)
         {
             MDIWidget::_init(context);
+
+            DJV_PRIVATE_PTR();
             setClassName("djv::ViewApp::HistogramWidget");
+
+            p.cache.setMax(cacheMax);
+
+            p.actions["LogScale"] = UI::Action::create();
+            p.actions["LogScale"]->setButtonType(UI::ButtonType::Toggle);
+            p.actions["ApplyColorOperations"] = UI::Action::create();
+            p.actions["ApplyColorOperations"]->setButtonType(UI::ButtonType::Toggle);
+            p.actions["ApplyColorSpace"] = UI::Action::create();
+            p.actions["ApplyColorSpace"]->setButtonType(UI::ButtonType::Toggle);
+
+            p.graphWidget = GraphWidget::create(context);
+            p.graphWidget->setMargin(UI::MetricsRole::MarginSmall);
+
+            p.settingsMenu = UI::Menu::create(context);
+            p.settingsMenu->setIcon("djvIconSettings");
+            p.settingsMenu->addAction(p.actions["LogScale"]);
+            p.settingsMenu->addAction(p.actions["ApplyColorOperations"]);
+            p.settingsMenu->addAction(p.actions["ApplyColorSpace"]);
+            p.settingsPopupMenu = UI::PopupMenu::create(context);
+            p.settingsPopupMenu->setMenu(p.settingsMenu);
+
+            p.layout = UI::VerticalLayout::create(context);
+            p.layout->setSpacing(UI::MetricsRole::None);
+            p.layout->setBackgroundRole(UI::ColorRole::Background);
+            p.layout->setShadowOverlay({ UI::Side::Top });
+            p.layout->addChild(p.graphWidget);
+            p.layout->setStretch(p.graphWidget, UI::RowStretch::Expand);
+            auto hLayout = UI::HorizontalLayout::create(context);
+            hLayout->setSpacing(UI::MetricsRole::None);
+            hLayout->addExpander();
+            hLayout->addChild(p.settingsPopupMenu);
+            p.layout->addChild(hLayout);
+            addChild(p.layout);
+
+            _widgetUpdate();
+
+            auto weak = std::weak_ptr<HistogramWidget>(std::dynamic_pointer_cast<HistogramWidget>(shared_from_this()));
+            p.actionObservers["LogScale"] = ValueObserver<bool>::create(
+                p.actions["LogScale"]->observeChecked(),
+                [weak](bool value)
+            {
+                if (auto widget = weak.lock())
+                {
+                    widget->_p->logScale = value;
+                    widget->_widgetUpdate();
+                }
+            });
+
+            p.actionObservers["ApplyColorOperations"] = ValueObserver<bool>::create(
+                p.actions["ApplyColorOperations"]->observeChecked(),
+                [weak](bool value)
+            {
+                if (auto widget = weak.lock())
+                {
+                    widget->_p->applyColorOperations = value;
+                    widget->_histogramUpdate();
+                    widget->_widgetUpdate();
+                }
+            });
+
+            p.actionObservers["ApplyColorSpace"] = ValueObserver<bool>::create(
+                p.actions["ApplyColorSpace"]->observeChecked(),
+                [weak](bool value)
+            {
+                if (auto widget = weak.lock())
+                {
+                    widget->_p->applyColorSpace = value;
+                    widget->_histogramUpdate();
+                    widget->_widgetUpdate();
+                }
+            });
+
+            if (auto windowSystem = context->getSystemT<WindowSystem>())
+            {
+                p.activeWidgetObserver = ValueObserver<std::shared_ptr<MediaWidget> >::create(
+                    windowSystem->observeActiveWidget(),
+                    [weak](const std::shared_ptr<MediaWidget>& value)
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            widget->_p->activeWidget = value;
+                            if (widget->_p->activeWidget)
+                            {
+                                widget->_p->imageObserver = ValueObserver<std::shared_ptr<AV::Image::Image> >::create(
+                                    widget->_p->activeWidget->getViewWidget()->observeImage(),
+                                    [weak](const std::shared_ptr<AV::Image::Image>& value)
+                                    {
+                                        if (auto widget = weak.lock())
+                                        {
+                                            widget->_p->image = value;
+                                            widget->_histogramUpdate();
+                                        }
+                                    });
+
+                                widget->_p->imageOptionsObserver = ValueObserver<AV::Render2D::ImageOptions>::create(
+                                    widget->_p->activeWidget->getViewWidget()->observeImageOptions(),
+                                    [weak](const AV::Render2D::ImageOptions& value)
+                                    {
+                                        if (auto widget = weak.lock())
+                                        {
+                                            if (value != widget->_p->imageOptions)
+                                            {
+                                                widget->_p->imageOptions = value;
+                                                ++widget->_p->imageOptionsGeneration;
+                                                widget->_histogramUpdate();
+                                            }
+                                        }
+                                    });
+                            }
+                            else
+                            {
+                                widget->_p->image.reset();
+                                widget->_p->imageObserver.reset();
+                                widget->_p->imageOptionsObserver.reset();
+                                widget->_histogramUpdate();
+                            }
+                        }
+                    });
+            }
+
+            auto ocioSystem = context->getSystemT<AV::OCIO::System>();
+            auto contextWeak = std::weak_ptr<Context>(context);
+            p.ocioConfigObserver = ValueObserver<AV::OCIO::Config>::create(
+                ocioSystem->observeCurrentConfig(),
+                [weak, contextWeak](const AV::OCIO::Config& value)
+                {
+                    if (auto context = contextWeak.lock())
+                    {
+                        if (auto widget = weak.lock())
+                        {
+                            auto ocioSystem = context->getSystemT<AV::OCIO::System>();
+                            widget->_p->ocioConfig = value;
+                            widget->_p->outputColorSpace = ocioSystem->getColorSpace(value.display, value.view);
+                            widget->_histogramUpdate();
+                        }
+                    }
+                });
+
+            // Histograms may have been computed while the color space
+            // conversion was still being created.
+            p.colorSpacesChangedObserver = ValueObserver<bool>::create(
+                _getRender()->observeColorSpacesChanged(),
+                [weak](bool)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        if (widget->_p->applyColorSpace)
+                        {
+                            widget->_p->cache.clear();
+                            widget->_p->key = 0;
+                            widget->_histogramUpdate();
+                        }
+                    }
+                });
         }
 
         HistogramWidget::HistogramWidget() :
@@ -35,15 +378,259 @@ namespace djv
             return out;
         }
 
+        bool HistogramWidget::getLogScale() const
+        {
+            return _p->logScale;
+        }
+
+        void HistogramWidget::setLogScale(bool value)
+        {
+            DJV_PRIVATE_PTR();
+            if (value == p.logScale)
+                return;
+            p.logScale = value;
+            _widgetUpdate();
+        }
+
+        bool HistogramWidget::getApplyColorOperations() const
+        {
+            return _p->applyColorOperations;
+        }
+
+        void HistogramWidget::setApplyColorOperations(bool value)
+        {
+            DJV_PRIVATE_PTR();
+            if (value == p.applyColorOperations)
+                return;
+            p.applyColorOperations = value;
+            _histogramUpdate();
+            _widgetUpdate();
+        }
+
+        bool HistogramWidget::getApplyColorSpace() const
+        {
+            return _p->applyColorSpace;
+        }
+
+        void HistogramWidget::setApplyColorSpace(bool value)
+        {
+            DJV_PRIVATE_PTR();
+            if (value == p.applyColorSpace)
+                return;
+            p.applyColorSpace = value;
+            _histogramUpdate();
+            _widgetUpdate();
+        }
+
         void HistogramWidget::_initEvent(Event::Init & event)
         {
             MDIWidget::_initEvent(event);
+            DJV_PRIVATE_PTR();
             if (event.getData().text)
             {
-                setTitle(_getText(DJV_TEXT("Histogram")));
+                setTitle(_getText(DJV_TEXT("widget_histogram")));
+
+                p.actions["LogScale"]->setText(_getText(DJV_TEXT("widget_histogram_log_scale")));
+                p.actions["LogScale"]->setTooltip(_getText(DJV_TEXT("widget_histogram_log_scale_tooltip")));
+                p.actions["ApplyColorOperations"]->setText(_getText(DJV_TEXT("widget_histogram_apply_color_operations")));
+                p.actions["ApplyColorOperations"]->setTooltip(_getText(DJV_TEXT("widget_histogram_apply_color_operations_tooltip")));
+                p.actions["ApplyColorSpace"]->setText(_getText(DJV_TEXT("widget_histogram_apply_color_space")));
+                p.actions["ApplyColorSpace"]->setTooltip(_getText(DJV_TEXT("widget_histogram_apply_color_space_tooltip")));
+
+                p.settingsPopupMenu->setTooltip(_getText(DJV_TEXT("widget_histogram_settings_tooltip")));
+            }
+        }
+
+        void HistogramWidget::_updateEvent(Event::Update& event)
+        {
+            MDIWidget::_updateEvent(event);
+            DJV_PRIVATE_PTR();
+            if (p.future.valid() &&
+                p.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                try
+                {
+                    const auto histogram = p.future.get();
+                    p.cache.add(p.futureKey, histogram);
+                    if (p.futureKey == p.key)
+                    {
+                        p.graphWidget->setHistogram(histogram);
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    _log(e.what(), LogLevel::Error);
+                }
+            }
+
+            // Only the latest request is kept while a histogram is being
+            // computed, older requests are dropped.
+            if (!p.future.valid() && p.pendingData)
+            {
+                const auto data = p.pendingData;
+                p.pendingData.reset();
+                p.futureKey = p.pendingKey;
+
+                // Use the same number of threads as the I/O thread pool, so
+                // the histogram respects the user's thread limit.
+                size_t threadCount = 1;
+                if (auto context = getContext().lock())
+                {
+                    auto ioSystem = context->getSystemT<AV::IO::System>();
+                    threadCount = ioSystem->getThreadPool()->getThreadCount();
+                }
+                p.future = std::async(
+                    std::launch::async,
+                    [data, threadCount]
+                    {
+                        return AV::Image::getHistogram(*data, threadCount);
+                    });
+            }
+            if (p.future.valid())
+            {
+                _requestUpdate();
             }
         }
 
+        void HistogramWidget::_histogramUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            if (!p.image || !p.image->isValid())
+            {
+                p.key = 0;
+                p.pendingData.reset();
+                p.offscreenBuffer.reset();
+                p.graphWidget->setHistogram(AV::Image::Histogram());
+                return;
+            }
+
+            // The cache key identifies the image data and the options applied
+            // to it.
+            size_t key = 0;
+            Memory::hashCombine(key, p.image->getUID());
+            Memory::hashCombine(key, p.applyColorOperations);
+            Memory::hashCombine(key, p.applyColorSpace);
+            std::string inputColorSpace;
+            if (p.applyColorOperations)
+            {
+                Memory::hashCombine(key, p.imageOptionsGeneration);
+            }
+            if (p.applyColorSpace)
+            {
+                auto i = p.ocioConfig.fileColorSpaces.find(p.image->getPluginName());
+                if (i != p.ocioConfig.fileColorSpaces.end())
+                {
+                    inputColorSpace = i->second;
+                }
+                else
+                {
+                    i = p.ocioConfig.fileColorSpaces.find(std::string());
+                    if (i != p.ocioConfig.fileColorSpaces.end())
+                    {
+                        inputColorSpace = i->second;
+                    }
+                }
+                Memory::hashCombine(key, inputColorSpace);
+                Memory::hashCombine(key, p.outputColorSpace);
+            }
+            if (key == p.key)
+                return;
+            p.key = key;
+
+            AV::Image::Histogram histogram;
+            if (p.cache.get(key, histogram))
+            {
+                p.pendingData.reset();
+                p.graphWidget->setHistogram(histogram);
+                return;
+            }
+
+            std::shared_ptr<AV::Image::Data> data = p.image;
+            if (p.applyColorOperations || p.applyColorSpace)
+            {
+                // Render a reduced resolution copy of the image with the color
+                // space and color operations applied.
+                try
+                {
+                    const uint16_t w = p.image->getWidth();
+                    const uint16_t h = p.image->getHeight();
+                    const float scale = std::min(1.F, renderSizeMax / static_cast<float>(std::max(w, h)));
+                    const AV::Image::Size size(
+                        std::max(1, static_cast<int>(w * scale)),
+                        std::max(1, static_cast<int>(h * scale)));
+                    const AV::Image::Type type = AV::Image::Type::RGBA_F32;
+                    if (!p.offscreenBuffer || size != p.offscreenBuffer->getSize())
+                    {
+                        p.offscreenBuffer = AV::OpenGL::OffscreenBuffer::create(size, type);
+                    }
+
+                    p.offscreenBuffer->bind();
+                    const auto& render = _getRender();
+                    render->beginFrame(size);
+                    render->setFillColor(AV::Image::Color(1.F, 1.F, 1.F));
+                    render->pushTransform(glm::scale(glm::mat3x3(1.F), glm::vec2(scale, scale)));
+                    auto options = p.imageOptions;
+                    options.channelDisplay = AV::Render2D::ImageChannelDisplay::Color;
+                    options.mirror = AV::Image::Mirror();
+                    if (!p.applyColorOperations)
+                    {
+                        options.colorEnabled    = false;
+                        options.levelsEnabled   = false;
+                        options.exposureEnabled = false;
+                        options.softClipEnabled = false;
+                    }
+                    if (p.applyColorSpace)
+                    {
+                        options.colorSpace.input = inputColorSpace;
+                        options.colorSpace.output = p.outputColorSpace;
+                    }
+                    else
+                    {
+                        options.colorSpace = AV::OCIO::Convert();
+                    }
+                    options.cache = AV::Render2D::ImageCache::Dynamic;
+                    render->drawImage(p.image, glm::vec2(0.F, 0.F), options);
+                    render->popTransform();
+                    render->endFrame();
+                    auto rendered = AV::Image::Data::create(AV::Image::Info(size, type));
+                    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#if !defined(DJV_OPENGL_ES2)  // \todo GL_READ_FRAMEBUFFER, glClampColor not in OpenGL ES 2
+                    glBindFramebuffer(GL_READ_FRAMEBUFFER, p.offscreenBuffer->getID());
+                    glClampColor(GL_CLAMP_READ_COLOR, GL_FALSE);
+#endif
+                    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+                    glReadPixels(
+                        0,
+                        0,
+                        size.w,
+                        size.h,
+                        AV::Image::getGLFormat(type),
+                        AV::Image::getGLType(type),
+                        rendered->getData());
+                    data = rendered;
+                }
+                catch (const std::exception& e)
+                {
+                    std::vector<std::string> messages;
+                    messages.push_back(_getText(DJV_TEXT("error_cannot_compute_histogram")));
+                    messages.push_back(e.what());
+                    _log(String::join(messages, ' '), LogLevel::Error);
+                    return;
+                }
+            }
+            p.pendingData = data;
+            p.pendingKey = key;
+            _requestUpdate();
+        }
+
+        void HistogramWidget::_widgetUpdate()
+        {
+            DJV_PRIVATE_PTR();
+            p.actions["LogScale"]->setChecked(p.logScale);
+            p.actions["ApplyColorOperations"]->setChecked(p.applyColorOperations);
+            p.actions["ApplyColorSpace"]->setChecked(p.applyColorSpace);
+            p.graphWidget->setLogScale(p.logScale);
+        }
+
     } // namespace ViewApp
 } // namespace djv
-
@@ -24,13 +24,25 @@ namespace djv
 
             static std::shared_ptr<HistogramWidget> create(const std::shared_ptr<Core::Context>&);
 
+            bool getLogScale() const;
+            void setLogScale(bool);
+
+            bool getApplyColorOperations() const;
+            void setApplyColorOperations(bool);
+
+            bool getApplyColorSpace() const;
+            void setApplyColorSpace(bool);
+
         protected:
             void _initEvent(Core::Event::Init &) override;
+            void _updateEvent(Core::Event::Update&) override;
 
         private:
+            void _histogramUpdate();
+            void _widgetUpdate();
+
             DJV_PRIVATE();
         };
 
     } // namespace ViewApp
 } // namespace djv
-
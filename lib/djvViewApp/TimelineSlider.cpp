@@ -351,6 +351,7 @@ namespace djv
                                     tick->size.y = p.fontMetrics.lineHeight;
                                     tick->text = Time::toString(p.sequence.getFrame(i.second(unit, speedF)), p.speed, p.timeUnits);
                                     tick->glyphsFuture = p.fontSystem->getGlyphs(tick->text, p.fontInfo);
+                                    _requestUpdate();
                                     tick->textPos = glm::vec2(x + tick->size.x + m - g.min.x, textY);
                                     x2 = x + p.maxFrameLength + m * 2.F;
                                     ++timeTicksCount;
@@ -661,6 +662,19 @@ namespace djv
                     }
                 }
             }
+            bool pending =
+                p.fontMetricsFuture.valid() ||
+                p.currentFrameSizeFuture.valid() ||
+                p.currentFrameGlyphsFuture.valid() ||
+                p.maxFrameSizeFuture.valid();
+            for (const auto& i : p.timeTicks)
+            {
+                pending |= i->glyphsFuture.valid();
+            }
+            if (pending)
+            {
+                _requestUpdate();
+            }
         }
 
         Frame::Index TimelineSlider::_posToFrame(float value) const
@@ -738,6 +752,7 @@ namespace djv
                 const auto& style = _getStyle();
                 p.fontInfo = style->getFontInfo(AV::Font::familyMono, AV::Font::faceDefault, UI::MetricsRole::FontSmall);
                 p.fontMetricsFuture = p.fontSystem->getMetrics(p.fontInfo);
+                _requestUpdate();
                 std::string maxFrameText;
                 switch (p.timeUnits)
                 {
@@ -769,6 +784,7 @@ namespace djv
                 p.currentFrameText = Time::toString(p.sequence.getFrame(p.currentFrame), p.speed, p.timeUnits);
                 p.currentFrameSizeFuture = p.fontSystem->measure(p.currentFrameText, p.fontInfo);
                 p.currentFrameGlyphsFuture = p.fontSystem->getGlyphs(p.currentFrameText, p.fontInfo);
+                _requestUpdate();
             }
         }
 
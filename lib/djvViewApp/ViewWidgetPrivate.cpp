@@ -237,6 +237,7 @@ namespace djv
                 const auto& style = _getStyle();
                 const auto fontInfo = style->getFontInfo(AV::Font::familyMono, AV::Font::faceDefault, UI::MetricsRole::FontSmall);
                 _fontMetricsFuture = _fontSystem->getMetrics(fontInfo);
+                _requestUpdate();
             }
         }
 
@@ -303,6 +304,12 @@ namespace djv
                     ++textGlyphsFuturesIt;
                 }
             }
+            if (_fontMetricsFuture.valid() ||
+                _textSizeFutures.size() ||
+                _textGlyphsFutures.size())
+            {
+                _requestUpdate();
+            }
         }
 
         std::string GridOverlay::_getLabel(const GridPos& value) const
@@ -367,6 +374,7 @@ namespace djv
             const auto fontInfo = style->getFontInfo(AV::Font::familyMono, AV::Font::faceDefault, UI::MetricsRole::FontSmall);
             _textSizeFutures[pos] = _fontSystem->measure(label, fontInfo);
             _textGlyphsFutures[pos] = _fontSystem->getGlyphs(label, fontInfo);
+            _requestUpdate();
         }
 
         void GridOverlay::_textUpdate()
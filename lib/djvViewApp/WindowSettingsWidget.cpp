@@ -638,6 +638,10 @@ namespace djv
                 }
                 p.imageWidget->setImage(p.image);
             }
+            if (p.imageFuture.future.valid())
+            {
+                _requestUpdate();
+            }
         }
 
         void BackgroundImageSettingsWidget::_widgetUpdate()
@@ -660,6 +664,7 @@ namespace djv
                     const float s = style->getMetric(UI::MetricsRole::TextColumn);
                     auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
                     p.imageFuture = thumbnailSystem->getImage(p.fileName, AV::Image::Size(s, s));
+                    _requestUpdate();
                 }
             }
         }
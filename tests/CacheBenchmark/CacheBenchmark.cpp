@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCore/Cache.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+using namespace djv;
+
+namespace
+{
+    //! The previous cache implementation, kept for comparison. When
+    //! the cache is full every add sorts all of the entries to find
+    //! the oldest.
+    class MapCache
+    {
+    public:
+        void setMax(size_t value)
+        {
+            _max = value;
+        }
+
+        bool get(int key, int& value)
+        {
+            const auto i = _map.find(key);
+            const bool found = i != _map.end();
+            if (found)
+            {
+                value = i->second;
+                _counts[key] = ++_counter;
+            }
+            return found;
+        }
+
+        void add(int key, int value)
+        {
+            _map[key] = value;
+            _counts[key] = ++_counter;
+            if (_map.size() > _max)
+            {
+                std::map<int64_t, int> sorted;
+                for (const auto& i : _counts)
+                {
+                    sorted[i.second] = i.first;
+                }
+                while (_map.size() > _max)
+                {
+                    const auto begin = sorted.begin();
+                    _map.erase(begin->second);
+                    _counts.erase(begin->second);
+                    sorted.erase(begin);
+                }
+            }
+        }
+
+    private:
+        size_t _max = 0;
+        std::map<int, int> _map;
+        std::map<int, int64_t> _counts;
+        int64_t _counter = 0;
+    };
+
+    //! Fill the cache and then add new keys while reading back
+    //! recent ones, like scrolling through a list of thumbnails.
+    template<typename T>
+    float benchmark(T& cache, size_t max, size_t count)
+    {
+        cache.setMax(max);
+        const auto start = std::chrono::steady_clock::now();
+        int value = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const int key = static_cast<int>(i);
+            cache.get(key - static_cast<int>(max / 2), value);
+            cache.add(key, key);
+        }
+        const std::chrono::duration<float> delta = std::chrono::steady_clock::now() - start;
+        return delta.count();
+    }
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    const size_t count = 10000;
+    std::cout << std::setw(12) << std::left << "max";
+    std::cout << std::setw(16) << std::left << "lru";
+    std::cout << std::setw(16) << std::left << "map";
+    std::cout << "(seconds)" << std::endl;
+    for (size_t max : { 10, 100, 1000 })
+    {
+        Core::Memory::Cache<int, int> cache;
+        MapCache mapCache;
+        std::cout << std::setw(12) << std::left << max;
+        std::cout << std::setw(16) << std::left << std::fixed << std::setprecision(6) << benchmark(cache, max, count);
+        std::cout << std::setw(16) << std::left << std::fixed << std::setprecision(6) << benchmark(mapCache, max, count);
+        std::cout << std::endl;
+    }
+    return 0;
+}
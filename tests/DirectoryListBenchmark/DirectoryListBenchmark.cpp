@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCore/FileIO.h>
+#include <djvCore/FileInfo.h>
+#include <djvCore/Path.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace djv;
+
+namespace
+{
+    //! The number of file sequences in each directory.
+    const size_t sequenceCount = 10;
+
+    //! Get the file names for a synthetic render directory. Most of the files
+    //! are frames of a few sequences, the rest are files that are filtered
+    //! out by extension.
+    std::vector<std::string> getFileNames(size_t count)
+    {
+        std::vector<std::string> out;
+        out.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::stringstream ss;
+            if (i % 100 == 99)
+            {
+                ss << "notes" << i << ".txt";
+            }
+            else
+            {
+                ss << "shot" << (i % sequenceCount) << "." << std::setw(7) << std::setfill('0') << (i / sequenceCount) << ".exr";
+            }
+            out.push_back(ss.str());
+        }
+        return out;
+    }
+
+    //! Get the time in milliseconds to list a directory.
+    float benchmark(const Core::FileSystem::Path& path, const Core::FileSystem::DirectoryListOptions& options, size_t& count)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        count = Core::FileSystem::FileInfo::directoryList(path, options).size();
+        const std::chrono::duration<float> delta = std::chrono::steady_clock::now() - start;
+        return delta.count() * 1000.F;
+    }
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    // Optionally only benchmark the given file counts.
+    std::vector<size_t> counts;
+    for (int i = 1; i < argc; ++i)
+    {
+        counts.push_back(std::stoul(argv[i]));
+    }
+    if (counts.empty())
+    {
+        counts = { 10000, 100000, 1000000 };
+    }
+
+    std::cout << std::setw(12) << std::left << "files";
+    std::cout << std::setw(16) << std::left << "items";
+    std::cout << std::setw(16) << std::left << "sequences";
+    std::cout << "(ms)" << std::endl;
+    for (auto count : counts)
+    {
+        std::stringstream ss;
+        ss << "DirectoryListBenchmark" << count;
+        const Core::FileSystem::Path path(ss.str());
+        const auto fileNames = getFileNames(count);
+        try
+        {
+            Core::FileSystem::Path::mkdir(path);
+            for (const auto& i : fileNames)
+            {
+                auto io = Core::FileSystem::FileIO::create();
+                io->open(Core::FileSystem::Path(path, i).get(), Core::FileSystem::FileIO::Mode::Write);
+            }
+
+            Core::FileSystem::DirectoryListOptions options;
+            options.fileExtensions = { ".exr" };
+            size_t itemCount = 0;
+            const float items = benchmark(path, options, itemCount);
+            options.fileSequences = true;
+            options.fileSequenceExtensions = { ".exr" };
+            size_t sequenceItemCount = 0;
+            const float sequences = benchmark(path, options, sequenceItemCount);
+
+            std::cout << std::setw(12) << std::left << count;
+            std::cout << std::setw(16) << std::left << std::fixed << std::setprecision(1) << items;
+            std::cout << std::setw(16) << std::left << std::fixed << std::setprecision(1) << sequences;
+            std::cout << itemCount << " items, " << sequenceItemCount << " sequences" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            std::cout << e.what() << std::endl;
+        }
+        for (const auto& i : fileNames)
+        {
+            try
+            {
+                Core::FileSystem::Path::rm(Core::FileSystem::Path(path, i));
+            }
+            catch (const std::exception&)
+            {}
+        }
+        try
+        {
+            Core::FileSystem::Path::rmdir(path);
+        }
+        catch (const std::exception&)
+        {}
+    }
+    return 0;
+}
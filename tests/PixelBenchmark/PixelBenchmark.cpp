@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/Pixel.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace djv;
+
+namespace
+{
+    const size_t pixelCount = 1920 * 1080;
+    const float minTime = .1F;
+
+    //! Get the conversion rate in input gigabytes per second.
+    float benchmark(
+        const std::vector<uint8_t>& in,
+        AV::Image::Type inType,
+        std::vector<uint8_t>& out,
+        AV::Image::Type outType,
+        AV::Image::ConvertSIMD simd)
+    {
+        size_t count = 0;
+        const auto start = std::chrono::steady_clock::now();
+        std::chrono::duration<float> delta(0.F);
+        do
+        {
+            AV::Image::convert(in.data(), inType, out.data(), outType, pixelCount, simd);
+            ++count;
+            delta = std::chrono::steady_clock::now() - start;
+        } while (delta.count() < minTime);
+        return in.size() * count / delta.count() / (1024.F * 1024.F * 1024.F);
+    }
+
+    std::string getLabel(AV::Image::Type value)
+    {
+        std::stringstream ss;
+        ss << value;
+        return ss.str();
+    }
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+    const auto simd = AV::Image::getConvertSIMD();
+    std::vector<AV::Image::ConvertSIMD> simdList;
+    for (auto i : { AV::Image::ConvertSIMD::None, AV::Image::ConvertSIMD::SSE4_1, AV::Image::ConvertSIMD::AVX2 })
+    {
+        if (i <= simd)
+        {
+            simdList.push_back(i);
+        }
+    }
+
+    // Optionally only benchmark conversions from the given type.
+    const std::string filter = argc > 1 ? argv[1] : std::string();
+
+    std::cout << std::setw(24) << std::left << "input";
+    std::cout << std::setw(24) << std::left << "output";
+    for (auto i : { "none", "sse4.1", "avx2" })
+    {
+        std::cout << std::setw(12) << std::left << i;
+    }
+    std::cout << "(GB/s)" << std::endl;
+    for (auto inType : AV::Image::getTypeEnums())
+    {
+        if (AV::Image::Type::None == inType || AV::Image::isYUVType(inType))
+            continue;
+        const std::string inLabel = getLabel(inType);
+        if (!filter.empty() && inLabel.find(filter) == std::string::npos)
+            continue;
+        std::vector<uint8_t> in(pixelCount * AV::Image::getByteCount(inType));
+        for (auto outType : AV::Image::getTypeEnums())
+        {
+            if (AV::Image::Type::None == outType || AV::Image::isYUVType(outType))
+                continue;
+            std::vector<uint8_t> out(pixelCount * AV::Image::getByteCount(outType));
+            std::cout << std::setw(24) << std::left << inLabel;
+            std::cout << std::setw(24) << std::left << getLabel(outType);
+            for (auto i : simdList)
+            {
+                std::cout << std::setw(12) << std::left << std::fixed << std::setprecision(2) <<
+                    benchmark(in, inType, out, outType, i);
+            }
+            std::cout << std::endl;
+        }
+    }
+    return 0;
+}
@@ -105,6 +105,8 @@ private:
     void _render();
 
     GLFWwindow*  _glfwWindow   = nullptr;
+    bool         _stats        = false;
+    std::chrono::duration<float> _cpuTime = std::chrono::duration<float>::zero();
     std::shared_ptr<AV::Render2D::Render> _render2D;
     RandomColor* _randomColors = nullptr;
     RandomColor* _currentColor = nullptr;
@@ -123,10 +125,34 @@ void Application::_init(std::list<std::string>& args)
 {
     CmdLine::Application::_init(args);
 
+    // Parse the command line:
+    // -stats Print the primitives, draw calls, and CPU time per frame.
+    // -no_batching Disable merging primitives into batches.
+    bool batching = true;
+    auto arg = args.begin();
+    while (arg != args.end())
+    {
+        if ("-stats" == *arg)
+        {
+            arg = args.erase(arg);
+            _stats = true;
+        }
+        else if ("-no_batching" == *arg)
+        {
+            arg = args.erase(arg);
+            batching = false;
+        }
+        else
+        {
+            ++arg;
+        }
+    }
+
     _glfwWindow = getSystemT<AV::GLFW::System>()->getGLFWWindow();
     //glfwSetWindowSize(_glfwWindow, 1280, 720);
     glfwShowWindow(_glfwWindow);
     _render2D = getSystemT<AV::Render2D::Render>();
+    _render2D->setPrimitiveBatching(batching);
 
     static const std::vector<std::string> names =
     {
@@ -184,7 +210,17 @@ void Application::run()
         std::chrono::duration<float> delta = now - time;
         time = now;
         const float dt = delta.count();
-        std::cout << "FPS: " << (dt > 0.f ? 1.f / dt : 0.f) << std::endl;
+        if (_stats)
+        {
+            std::cout << "Primitives: " << _render2D->getPrimitiveCount() <<
+                " Draws: " << _render2D->getDrawCount() <<
+                " CPU: " << _cpuTime.count() * 1000.f << "ms" <<
+                " FPS: " << (dt > 0.f ? 1.f / dt : 0.f) << std::endl;
+        }
+        else
+        {
+            std::cout << "FPS: " << (dt > 0.f ? 1.f / dt : 0.f) << std::endl;
+        }
     }
 }
 
@@ -315,6 +351,7 @@ void Application::_render()
         _generateRandomNumbers();
     }
     _initRandomNumbers();
+    const auto start = std::chrono::steady_clock::now();
     _render2D->beginFrame(windowSize);
     for (size_t i = 0; i < drawCount / 5; ++i)
     {
@@ -325,6 +362,7 @@ void Application::_render()
         _drawRandomIcon();
     }
     _render2D->endFrame();
+    _cpuTime = std::chrono::steady_clock::now() - start;
 }
 
 int main(int argc, char ** argv)
@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/FFmpegTest.h>
+
+#include <djvAV/IO.h>
+
+#include <djvCore/Context.h>
+#include <djvCore/Timer.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        namespace
+        {
+            const std::string pluginName = "FFmpeg";
+
+            //! The encoder uses the default group of pictures size of twelve
+            //! frames, so there are keyframes at 0, 12, 24, and 36.
+            const size_t frameCount = 40;
+
+            //! Each frame is a different shade of gray.
+            uint8_t getGray(size_t frame)
+            {
+                return static_cast<uint8_t>(frame * 6);
+            }
+
+            void write(const std::shared_ptr<IO::System>& io, const FileSystem::Path& path)
+            {
+                const Image::Info imageInfo(64, 64, Image::Type::RGBA_U8);
+                IO::Info info;
+                info.video.push_back(IO::VideoInfo(
+                    imageInfo,
+                    Time::Speed(Time::FPS::_24),
+                    Frame::Sequence(Frame::Range(0, frameCount - 1))));
+                auto write = io->write(FileSystem::FileInfo(path), info);
+                for (size_t i = 0; i < frameCount; ++i)
+                {
+                    auto image = Image::Image::create(imageInfo);
+                    memset(image->getData(), getGray(i), image->getDataByteCount());
+                    std::lock_guard<std::mutex> lock(write->getMutex());
+                    write->getVideoQueue().addFrame(IO::VideoFrame(i, image));
+                }
+                {
+                    std::lock_guard<std::mutex> lock(write->getMutex());
+                    write->getVideoQueue().setFinished(true);
+                }
+                while (write->isRunning())
+                {
+                    std::this_thread::sleep_for(Time::getTime(Time::TimerValue::Fast));
+                }
+            }
+
+            //! Wait for the next frame from a reader.
+            IO::VideoFrame readFrame(const std::shared_ptr<IO::IRead>& read)
+            {
+                IO::VideoFrame out;
+                std::unique_lock<std::mutex> lock(read->getMutex());
+                auto& queue = read->getVideoQueue();
+                if (queue.getCV().wait_for(
+                    lock,
+                    std::chrono::seconds(10),
+                    [&queue]
+                    {
+                        return !queue.isEmpty() || queue.isFinished();
+                    }) && !queue.isEmpty())
+                {
+                    out = queue.popFrame();
+                }
+                return out;
+            }
+
+            bool compare(const std::shared_ptr<Image::Image>& a, const std::shared_ptr<Image::Image>& b)
+            {
+                return a && b &&
+                    a->getInfo() == b->getInfo() &&
+                    0 == memcmp(a->getData(), b->getData(), a->getDataByteCount());
+            }
+
+        } // namespace
+
+        FFmpegTest::FFmpegTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::FFmpegTest", context)
+        {}
+        
+        void FFmpegTest::run()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto io = context->getSystemT<IO::System>();
+                const auto pluginNames = io->getPluginNames();
+                if (pluginNames.find(pluginName) == pluginNames.end())
+                {
+                    _print("FFmpeg is not available");
+                    return;
+                }
+                _roundTrip();
+                _seek();
+            }
+        }
+
+        void FFmpegTest::_roundTrip()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto io = context->getSystemT<IO::System>();
+                rapidjson::Document document;
+                auto& allocator = document.GetAllocator();
+                const auto pluginOptions = io->getOptions(pluginName, allocator);
+                const FileSystem::Path path("FFmpegTest_roundTrip.mov");
+                try
+                {
+                    {
+                        rapidjson::Value options(rapidjson::kObjectType);
+                        options.AddMember("Codec", toJSON(std::string("mpeg4"), allocator), allocator);
+                        io->setOptions(pluginName, options);
+                    }
+                    write(io, path);
+
+                    // The file can only be read if the trailer was written.
+                    auto read = io->read(FileSystem::FileInfo(path));
+                    const auto info = read->getInfo().get();
+                    DJV_ASSERT(1 == info.video.size());
+                    DJV_ASSERT(Image::Size(64, 64) == info.video[0].info.size);
+                    DJV_ASSERT(Time::Speed(Time::FPS::_24) == info.video[0].speed);
+                    DJV_ASSERT(frameCount == info.video[0].sequence.getFrameCount());
+                    for (size_t i = 0; i < frameCount; ++i)
+                    {
+                        const auto frame = readFrame(read);
+                        DJV_ASSERT(static_cast<Frame::Index>(i) == frame.frame);
+                        DJV_ASSERT(frame.image);
+
+                        // Planar YUV images are passed through, so compare the
+                        // luma with the expected limited range value.
+                        int expected = getGray(i);
+                        if (Image::isYUVType(frame.image->getType()))
+                        {
+                            expected = 16 + expected * 219 / 255;
+                        }
+                        const int value = frame.image->getPlaneData(0)[0];
+                        DJV_ASSERT(abs(value - expected) <= 4);
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    _print(e.what());
+                }
+                io->setOptions(pluginName, pluginOptions);
+                try
+                {
+                    FileSystem::Path::rm(path);
+                }
+                catch (const std::exception&)
+                {}
+            }
+        }
+
+        void FFmpegTest::_seek()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto io = context->getSystemT<IO::System>();
+                rapidjson::Document document;
+                auto& allocator = document.GetAllocator();
+                const auto pluginOptions = io->getOptions(pluginName, allocator);
+                const FileSystem::Path path("FFmpegTest_seek.mov");
+                try
+                {
+                    {
+                        rapidjson::Value options(rapidjson::kObjectType);
+                        options.AddMember("Codec", toJSON(std::string("mpeg4"), allocator), allocator);
+                        io->setOptions(pluginName, options);
+                    }
+                    write(io, path);
+
+                    // Decode every frame in order for reference.
+                    std::vector<std::shared_ptr<Image::Image> > images;
+                    {
+                        auto read = io->read(FileSystem::FileInfo(path));
+                        const auto info = read->getInfo().get();
+                        DJV_ASSERT(1 == info.video.size());
+                        for (size_t i = 0; i < frameCount; ++i)
+                        {
+                            const auto frame = readFrame(read);
+                            DJV_ASSERT(static_cast<Frame::Index>(i) == frame.frame);
+                            DJV_ASSERT(frame.image);
+                            images.push_back(frame.image);
+                        }
+                    }
+
+                    // Seek within a group of pictures, forwards and backwards
+                    // across groups of pictures, and step backwards across the
+                    // start of a group of pictures. Seeking must decode the same
+                    // images as reading in order.
+                    auto read = io->read(FileSystem::FileInfo(path));
+                    read->getInfo().get();
+                    struct Data
+                    {
+                        Frame::Index  frame;
+                        IO::Direction direction;
+                        size_t        count;
+                    };
+                    const std::vector<Data> data =
+                    {
+                        { 3, IO::Direction::Forward, 1 },
+                        { 8, IO::Direction::Forward, 1 },
+                        { 5, IO::Direction::Forward, 1 },
+                        { 30, IO::Direction::Forward, 3 },
+                        { 14, IO::Direction::Forward, 1 },
+                        { 26, IO::Direction::Reverse, 4 },
+                        { 39, IO::Direction::Reverse, 2 },
+                        { 0, IO::Direction::Forward, 2 }
+                    };
+                    for (const auto& i : data)
+                    {
+                        read->seek(i.frame, i.direction);
+                        for (size_t j = 0; j < i.count; ++j)
+                        {
+                            const Frame::Index frameIndex = IO::Direction::Forward == i.direction ?
+                                (i.frame + j) :
+                                (i.frame - j);
+                            const auto frame = readFrame(read);
+                            DJV_ASSERT(frameIndex == frame.frame);
+                            DJV_ASSERT(compare(images[frameIndex], frame.image));
+                        }
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    _print(e.what());
+                }
+                io->setOptions(pluginName, pluginOptions);
+                try
+                {
+                    FileSystem::Path::rm(path);
+                }
+                catch (const std::exception&)
+                {}
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
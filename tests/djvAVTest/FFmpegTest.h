@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class FFmpegTest : public Test::ITest
+        {
+        public:
+            FFmpegTest(const std::shared_ptr<Core::Context>&);
+            
+            void run() override;
+            
+        private:
+            void _roundTrip();
+            void _seek();
+        };
+        
+    } // namespace AVTest
+} // namespace djv
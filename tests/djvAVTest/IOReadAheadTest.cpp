@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/IOReadAheadTest.h>
+
+#include <djvAV/IOReadAhead.h>
+#include <djvAV/IOThreadPool.h>
+
+#include <djvCore/FileIO.h>
+#include <djvCore/Path.h>
+
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        IOReadAheadTest::IOReadAheadTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::IOReadAheadTest", context)
+        {}
+        
+        void IOReadAheadTest::run()
+        {
+            _read();
+            _frames();
+        }
+
+        void IOReadAheadTest::_read()
+        {
+            std::vector<std::string> fileNames;
+            const size_t byteCount = 12345;
+            for (size_t i = 0; i < 10; ++i)
+            {
+                std::stringstream ss;
+                ss << "IOReadAheadTest." << i;
+                fileNames.push_back(ss.str());
+                auto io = FileSystem::FileIO::create();
+                io->open(fileNames.back(), FileSystem::FileIO::Mode::Write);
+                std::vector<uint8_t> buf(byteCount);
+                io->write(buf.data(), buf.size());
+            }
+
+            auto threadPool = IO::ThreadPool::create(4);
+            {
+                auto readAhead = IO::ReadAhead::create(threadPool);
+                DJV_ASSERT(0 == readAhead->getPendingCount());
+                readAhead->setFileNames(fileNames);
+                while (readAhead->getPendingCount())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                for (const auto& i : fileNames)
+                {
+                    DJV_ASSERT(readAhead->isRead(i));
+                }
+
+                // Files that have already been read are skipped.
+                readAhead->setFileNames(fileNames);
+                DJV_ASSERT(0 == readAhead->getPendingCount());
+
+                readAhead->clear();
+                DJV_ASSERT(!readAhead->isRead(fileNames[0]));
+            }
+
+            {
+                // Missing files are ignored.
+                auto readAhead = IO::ReadAhead::create(threadPool);
+                readAhead->setFileNames({ "IOReadAheadTest.missing" });
+                while (readAhead->getPendingCount())
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                DJV_ASSERT(readAhead->isRead("IOReadAheadTest.missing"));
+            }
+
+            {
+                // Pending files are dropped when the files change or the
+                // read-ahead is destroyed.
+                auto readAhead = IO::ReadAhead::create(threadPool);
+                readAhead->setFileNames(fileNames);
+                readAhead->setFileNames({ fileNames[0] });
+                DJV_ASSERT(readAhead->getPendingCount() <= 1 + threadPool->getThreadCount());
+                readAhead->setFileNames(fileNames);
+            }
+            while (threadPool->getPendingCount())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            for (const auto& i : fileNames)
+            {
+                FileSystem::Path::rm(FileSystem::Path(i));
+            }
+        }
+
+        void IOReadAheadTest::_frames()
+        {
+            typedef std::vector<Frame::Index> Frames;
+            const Range::Range<Frame::Index> range(0, 9);
+            {
+                const Frames frames = IO::ReadAhead::getFrames(3, IO::Direction::Forward, range, false, 4);
+                DJV_ASSERT(Frames({ 3, 4, 5, 6 }) == frames);
+            }
+            {
+                // The frames stop at the end of the range.
+                const Frames frames = IO::ReadAhead::getFrames(8, IO::Direction::Forward, range, false, 4);
+                DJV_ASSERT(Frames({ 8, 9 }) == frames);
+            }
+            {
+                // The frames wrap around when looping.
+                const Frames frames = IO::ReadAhead::getFrames(8, IO::Direction::Forward, range, true, 4);
+                DJV_ASSERT(Frames({ 8, 9, 0, 1 }) == frames);
+            }
+            {
+                // The frames are not repeated when the range is smaller than
+                // the count.
+                const Frames frames = IO::ReadAhead::getFrames(1, IO::Direction::Forward, Range::Range<Frame::Index>(0, 2), true, 10);
+                DJV_ASSERT(Frames({ 1, 2, 0 }) == frames);
+            }
+            {
+                const Frames frames = IO::ReadAhead::getFrames(1, IO::Direction::Reverse, range, false, 4);
+                DJV_ASSERT(Frames({ 1, 0 }) == frames);
+            }
+            {
+                const Frames frames = IO::ReadAhead::getFrames(1, IO::Direction::Reverse, range, true, 4);
+                DJV_ASSERT(Frames({ 1, 0, 9, 8 }) == frames);
+            }
+            {
+                // The frames are limited to the in/out points.
+                const auto inOutRange = IO::InOutPoints(true, 2, 5).getRange(10);
+                DJV_ASSERT(Frames({ 4, 5 }) == IO::ReadAhead::getFrames(4, IO::Direction::Forward, inOutRange, false, 4));
+                DJV_ASSERT(Frames({ 4, 5, 2, 3 }) == IO::ReadAhead::getFrames(4, IO::Direction::Forward, inOutRange, true, 4));
+                DJV_ASSERT(Frames({ 3, 2, 5, 4 }) == IO::ReadAhead::getFrames(3, IO::Direction::Reverse, inOutRange, true, 4));
+
+                // Frames outside of the in/out points start from the in or out
+                // point when looping.
+                DJV_ASSERT(Frames() == IO::ReadAhead::getFrames(7, IO::Direction::Forward, inOutRange, false, 4));
+                DJV_ASSERT(Frames({ 2, 3, 4, 5 }) == IO::ReadAhead::getFrames(7, IO::Direction::Forward, inOutRange, true, 4));
+                DJV_ASSERT(Frames({ 5, 4, 3, 2 }) == IO::ReadAhead::getFrames(0, IO::Direction::Reverse, inOutRange, true, 4));
+            }
+        }
+        
+    } // namespace AVTest
+} // namespace djv
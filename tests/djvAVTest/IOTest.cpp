@@ -5,11 +5,14 @@
 #include <djvAVTest/IOTest.h>
 
 #include <djvAV/IO.h>
+#include <djvAV/IOFrameCache.h>
 
 #include <djvCore/Context.h>
 #include <djvCore/String.h>
 #include <djvCore/Timer.h>
 
+#include <thread>
+
 using namespace djv::Core;
 using namespace djv::AV;
 
@@ -32,6 +35,7 @@ namespace djv
             _audioQueue();
             _cache();
             _io();
+            _region();
             _system();
             _operators();
         }
@@ -251,6 +255,112 @@ namespace djv
                     _print(ss.str());
                 }
             }
+            
+            {
+                const Image::Info imageInfo(1, 2, Image::Type::RGB_U8);
+                const size_t byteCount = imageInfo.getDataByteCount();
+                auto frameCache = IO::FrameCache::create();
+                frameCache->setMaxByteCount(byteCount * 10);
+                IO::Cache cache;
+                cache.setFrameCache(frameCache, "a", 0);
+                cache.setMax(20);
+                cache.setSequenceSize(100);
+                for (Frame::Index i = 0; i < 10; ++i)
+                {
+                    cache.add(i, Image::Image::create(imageInfo));
+                }
+                DJV_ASSERT(10 == cache.getCount());
+                DJV_ASSERT(byteCount * 10 == cache.getTotalByteCount());
+                DJV_ASSERT(Frame::Sequence(0, 9) == cache.getFrames());
+
+                // Frames in the window near the playhead are kept.
+                cache.setCurrentFrame(50);
+                for (Frame::Index i = 50; i < 55; ++i)
+                {
+                    cache.add(i, Image::Image::create(imageInfo));
+                }
+                DJV_ASSERT(10 == frameCache->getCount());
+                for (Frame::Index i = 50; i < 55; ++i)
+                {
+                    DJV_ASSERT(cache.contains(i));
+                }
+
+                // Frames of a closed reader are evicted first.
+                {
+                    IO::Cache cache2;
+                    cache2.setFrameCache(frameCache, "b", 0);
+                    cache2.add(0, Image::Image::create(imageInfo));
+                }
+                cache.add(55, Image::Image::create(imageInfo));
+                DJV_ASSERT(10 == frameCache->getCount());
+                DJV_ASSERT(byteCount * 10 == frameCache->getByteCount());
+                DJV_ASSERT(cache.contains(55));
+
+                // Frames are found again when the file is re-opened.
+                IO::Cache cache3;
+                cache3.setFrameCache(frameCache, "a", 0);
+                DJV_ASSERT(cache3.contains(55));
+
+                // Proxies are cached separately from full resolution frames.
+                IO::Cache cache4;
+                cache4.setFrameCache(frameCache, "a", 0, 1);
+                DJV_ASSERT(!cache4.contains(55));
+
+                // Frames read with different color spaces are cached
+                // separately.
+                IO::Cache cache5;
+                cache5.setFrameCache(frameCache, "a", 0, 0, "ACES");
+                DJV_ASSERT(!cache5.contains(55));
+                cache5.add(55, Image::Image::create(imageInfo));
+                DJV_ASSERT(cache3.contains(55));
+                DJV_ASSERT(cache5.contains(55));
+
+                cache.clear();
+                cache5.clear();
+                DJV_ASSERT(0 == frameCache->getCount());
+            }
+
+            {
+                // Frames outside of the window are evicted least recently
+                // used first.
+                const Image::Info imageInfo(1, 2, Image::Type::RGB_U8);
+                const size_t byteCount = imageInfo.getDataByteCount();
+                auto frameCache = IO::FrameCache::create();
+                DJV_ASSERT(0 == frameCache->getMaxByteCount());
+                frameCache->setMaxByteCount(byteCount * 3);
+                const Core::UID reader = frameCache->addReader("a", 0);
+                frameCache->setReaderWindow(reader, Frame::Sequence(10, 19), 10, IO::Direction::Forward, Range::Range<Frame::Index>(0, 99));
+                for (Frame::Index i = 0; i < 3; ++i)
+                {
+                    frameCache->add(reader, i, Image::Image::create(imageInfo));
+                }
+                std::shared_ptr<Image::Image> image;
+                DJV_ASSERT(frameCache->get(reader, 0, image));
+                frameCache->add(reader, 3, Image::Image::create(imageInfo));
+                DJV_ASSERT(frameCache->contains(reader, 0));
+                DJV_ASSERT(!frameCache->contains(reader, 1));
+                DJV_ASSERT(frameCache->contains(reader, 2));
+                DJV_ASSERT(frameCache->contains(reader, 3));
+                DJV_ASSERT(byteCount * 3 == frameCache->getByteCount());
+
+                // Frames inside of the window are evicted furthest from the
+                // playhead first.
+                for (Frame::Index i = 10; i < 13; ++i)
+                {
+                    frameCache->add(reader, i, Image::Image::create(imageInfo));
+                }
+                frameCache->add(reader, 13, Image::Image::create(imageInfo));
+                DJV_ASSERT(Frame::Sequence(10, 12) == frameCache->getFrames(reader));
+                frameCache->removeReader(reader);
+            }
+
+            {
+                DJV_ASSERT(Image::Size(0, 0) == IO::getProxySize(Image::Size(0, 0), 1));
+                DJV_ASSERT(Image::Size(11, 7) == IO::getProxySize(Image::Size(11, 7), 0));
+                DJV_ASSERT(Image::Size(6, 4) == IO::getProxySize(Image::Size(11, 7), 1));
+                DJV_ASSERT(Image::Size(3, 2) == IO::getProxySize(Image::Size(11, 7), 2));
+                DJV_ASSERT(Image::Size(1, 1) == IO::getProxySize(Image::Size(11, 7), 8));
+            }
         }
         
         void IOTest::_io()
@@ -343,6 +453,36 @@ namespace djv
                                         }
                                     }
                                 }
+
+                                {
+                                    IO::ReadOptions options;
+                                    options.proxy = 1;
+                                    auto read = io->read(FileSystem::FileInfo(path), options);
+                                    std::shared_ptr<Image::Image> proxy;
+                                    bool running = true;
+                                    while (running)
+                                    {
+                                        {
+                                            std::lock_guard<std::mutex> lock(read->getMutex());
+                                            auto& readQueue = read->getVideoQueue();
+                                            if (!readQueue.isEmpty())
+                                            {
+                                                proxy = readQueue.popFrame().image;
+                                                running = false;
+                                            }
+                                            else if (readQueue.isFinished())
+                                            {
+                                                running = false;
+                                            }
+                                        }
+                                        if (running)
+                                        {
+                                            std::this_thread::sleep_for(Time::getTime(Time::TimerValue::Fast));
+                                        }
+                                    }
+                                    DJV_ASSERT(proxy);
+                                    DJV_ASSERT(IO::getProxySize(size, 1) == proxy->getSize());
+                                }
                             }
                             catch (const std::exception&)
                             {}
@@ -352,6 +492,120 @@ namespace djv
             }
         }
         
+        void IOTest::_region()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto io = context->getSystemT<AV::IO::System>();
+                const std::string pluginName = "OpenEXR";
+                rapidjson::Document document;
+                auto& allocator = document.GetAllocator();
+                const auto pluginOptions = io->getOptions(pluginName, allocator);
+                const FileSystem::Path path("IOTest_region.exr");
+                try
+                {
+                    // Write a tiled file with mipmap levels. The red channel
+                    // is the X coordinate and the green channel is the Y
+                    // coordinate.
+                    {
+                        rapidjson::Value options(rapidjson::kObjectType);
+                        options.AddMember("Tiled", toJSON(true, allocator), allocator);
+                        options.AddMember("TileSize", toJSON(static_cast<size_t>(4), allocator), allocator);
+                        io->setOptions(pluginName, options);
+                    }
+                    const Image::Info imageInfo(16, 8, Image::Type::RGBA_F16);
+                    auto image = Image::Image::create(imageInfo);
+                    for (uint16_t y = 0; y < imageInfo.size.h; ++y)
+                    {
+                        for (uint16_t x = 0; x < imageInfo.size.w; ++x)
+                        {
+                            auto p = reinterpret_cast<Image::F16_T*>(image->getData(x, y));
+                            p[0] = x;
+                            p[1] = y;
+                            p[2] = 0.F;
+                            p[3] = 1.F;
+                        }
+                    }
+                    {
+                        IO::Info info;
+                        info.video.push_back(imageInfo);
+                        auto write = io->write(FileSystem::FileInfo(path), info);
+                        {
+                            std::lock_guard<std::mutex> lock(write->getMutex());
+                            auto& writeQueue = write->getVideoQueue();
+                            writeQueue.addFrame(IO::VideoFrame(0, image));
+                            writeQueue.setFinished(true);
+                        }
+                        while (write->isRunning())
+                        {
+                            std::this_thread::sleep_for(Time::getTime(Time::TimerValue::Fast));
+                        }
+                    }
+
+                    // Read a region at full resolution and from the mipmap
+                    // levels, checking the size and the first pixel.
+                    struct Data
+                    {
+                        size_t      proxy;
+                        Image::Size size;
+                        float       x;
+                        float       y;
+                    };
+                    const std::vector<Data> data =
+                    {
+                        { 0, Image::Size(8, 4), 2.F, 1.F },
+                        { 1, Image::Size(4, 2), 2.5F, .5F },
+                        { 2, Image::Size(2, 1), 1.5F, 1.5F }
+                    };
+                    for (const auto& i : data)
+                    {
+                        IO::ReadOptions options;
+                        options.region = BBox2i(2, 1, 8, 4);
+                        options.proxy = i.proxy;
+                        auto read = io->read(FileSystem::FileInfo(path), options);
+                        std::shared_ptr<Image::Image> regionImage;
+                        bool running = true;
+                        while (running)
+                        {
+                            {
+                                std::lock_guard<std::mutex> lock(read->getMutex());
+                                auto& readQueue = read->getVideoQueue();
+                                if (!readQueue.isEmpty())
+                                {
+                                    regionImage = readQueue.popFrame().image;
+                                    running = false;
+                                }
+                                else if (readQueue.isFinished())
+                                {
+                                    running = false;
+                                }
+                            }
+                            if (running)
+                            {
+                                std::this_thread::sleep_for(Time::getTime(Time::TimerValue::Fast));
+                            }
+                        }
+                        DJV_ASSERT(regionImage);
+                        DJV_ASSERT(i.size == regionImage->getSize());
+                        auto p = reinterpret_cast<const Image::F16_T*>(regionImage->getData(0, 0));
+                        DJV_ASSERT(i.x == static_cast<float>(p[0]));
+                        DJV_ASSERT(i.y == static_cast<float>(p[1]));
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    _print(e.what());
+                }
+                io->setOptions(pluginName, pluginOptions);
+                try
+                {
+                    FileSystem::Path::rm(path);
+                }
+                catch (const std::exception&)
+                {}
+            }
+        }
+
         void IOTest::_system()
         {
             if (auto context = getContext().lock())
@@ -25,6 +25,7 @@ namespace djv
             void _audioQueue();
             void _cache();
             void _io();
+            void _region();
             void _system();
             void _operators();
         };
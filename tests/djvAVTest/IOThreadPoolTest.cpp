@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/IOThreadPoolTest.h>
+
+#include <djvAV/IOThreadPool.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        IOThreadPoolTest::IOThreadPoolTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::IOThreadPoolTest", context)
+        {}
+        
+        void IOThreadPoolTest::run()
+        {
+            {
+                auto threadPool = IO::ThreadPool::create(4);
+                DJV_ASSERT(4 == threadPool->getThreadCount());
+                std::vector<std::future<int> > futures;
+                for (int i = 0; i < 100; ++i)
+                {
+                    futures.push_back(threadPool->run<int>(
+                        IO::TaskPriority::Cache,
+                        [i]
+                        {
+                            return i * 2;
+                        }));
+                }
+                for (int i = 0; i < 100; ++i)
+                {
+                    DJV_ASSERT(i * 2 == futures[i].get());
+                }
+            }
+            
+            {
+                auto threadPool = IO::ThreadPool::create(1);
+                std::promise<void> promise;
+                auto blocked = promise.get_future().share();
+                threadPool->addTask(
+                    IO::TaskPriority::Queue,
+                    [blocked]
+                    {
+                        blocked.wait();
+                    });
+                std::mutex mutex;
+                std::vector<IO::TaskPriority> order;
+                std::vector<std::future<bool> > futures;
+                for (auto priority : { IO::TaskPriority::Cache, IO::TaskPriority::Queue })
+                {
+                    futures.push_back(threadPool->run<bool>(
+                        priority,
+                        [&mutex, &order, priority]
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            order.push_back(priority);
+                            return true;
+                        }));
+                }
+                promise.set_value();
+                for (auto& i : futures)
+                {
+                    DJV_ASSERT(i.get());
+                }
+                DJV_ASSERT(2 == order.size());
+                DJV_ASSERT(IO::TaskPriority::Queue == order[0]);
+                DJV_ASSERT(IO::TaskPriority::Cache == order[1]);
+            }
+
+            {
+                auto threadPool = IO::ThreadPool::create(1);
+                std::promise<void> promise;
+                auto blocked = promise.get_future().share();
+                auto running = threadPool->run<bool>(
+                    IO::TaskPriority::Queue,
+                    [blocked]
+                    {
+                        blocked.wait();
+                        return true;
+                    });
+                int owner = 0;
+                std::atomic<size_t> count(0);
+                std::vector<std::future<bool> > futures;
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    futures.push_back(threadPool->run<bool>(
+                        IO::TaskPriority::Cache,
+                        [&count]
+                        {
+                            ++count;
+                            return true;
+                        },
+                        &owner));
+                }
+                auto other = threadPool->run<bool>(
+                    IO::TaskPriority::Cache,
+                    []
+                    {
+                        return true;
+                    });
+                DJV_ASSERT(10 == threadPool->cancel(&owner));
+                DJV_ASSERT(0 == threadPool->cancel(&owner));
+                promise.set_value();
+                DJV_ASSERT(running.get());
+                DJV_ASSERT(other.get());
+                for (auto& i : futures)
+                {
+                    try
+                    {
+                        i.get();
+                        DJV_ASSERT(false);
+                    }
+                    catch (const std::future_error&)
+                    {}
+                }
+                DJV_ASSERT(0 == count);
+                DJV_ASSERT(0 == threadPool->getPendingCount());
+            }
+        }
+        
+    } // namespace AVTest
+} // namespace djv
+
@@ -9,6 +9,9 @@
 #include <djvCore/Context.h>
 #include <djvCore/ResourceSystem.h>
 
+#include <cstring>
+#include <stdexcept>
+
 using namespace djv::Core;
 using namespace djv::AV;
 
@@ -45,9 +48,208 @@ namespace djv
                     _print(ss.str());
                 }
                 //DJV_ASSERT(Image::U8Range.max == u8);
+
+                _cpu(context);
+                _yuv(context);
+                if (Image::ConvertBackend::OpenGL == convert->getBackend())
+                {
+                    _openGL(context);
+                }
+            }
+        }
+
+        void ImageConvertTest::_cpu(const std::shared_ptr<Core::Context>& context)
+        {
+            auto convert = Image::Convert::create(Image::ConvertBackend::CPU, context->getSystemT<ResourceSystem>());
+            DJV_ASSERT(Image::ConvertBackend::CPU == convert->getBackend());
+
+            for (auto inType : Image::getTypeEnums())
+            {
+                if (Image::Type::None == inType || Image::isYUVType(inType))
+                    continue;
+                const Image::Info inInfo(3, 2, inType);
+                auto in = Image::Data::create(inInfo);
+                for (size_t i = 0; i < in->getDataByteCount(); ++i)
+                {
+                    in->getData()[i] = static_cast<uint8_t>(i * 17);
+                }
+                for (auto outType : Image::getTypeEnums())
+                {
+                    if (Image::Type::None == outType || Image::isYUVType(outType))
+                        continue;
+                    const Image::Info outInfo(3, 2, outType);
+                    auto out = Image::Data::create(outInfo);
+                    out->zero();
+                    convert->process(*in, outInfo, *out);
+                    auto reference = Image::Data::create(outInfo);
+                    reference->zero();
+                    for (uint16_t y = 0; y < inInfo.size.h; ++y)
+                    {
+                        Image::convert(in->getData(y), inType, reference->getData(y), outType, inInfo.size.w);
+                    }
+                    DJV_ASSERT(0 == memcmp(out->getData(), reference->getData(), out->getDataByteCount()));
+                }
+            }
+
+            {
+                const Image::Info inInfo(2, 2, Image::Type::L_U8, Image::Layout(Image::Mirror(true, true)));
+                auto in = Image::Data::create(inInfo);
+                in->getData()[0] = 0;
+                in->getData()[1] = 1;
+                in->getData()[2] = 2;
+                in->getData()[3] = 3;
+                const Image::Info outInfo(2, 2, Image::Type::L_U8);
+                auto out = Image::Data::create(outInfo);
+                convert->process(*in, outInfo, *out);
+                DJV_ASSERT(3 == out->getData()[0]);
+                DJV_ASSERT(2 == out->getData()[1]);
+                DJV_ASSERT(1 == out->getData()[2]);
+                DJV_ASSERT(0 == out->getData()[3]);
+            }
+
+            {
+                const Image::Info inInfo(1, 1, Image::Type::L_U16, Image::Layout(Image::Mirror(), 1, Memory::opposite(Memory::getEndian())));
+                auto in = Image::Data::create(inInfo);
+                in->getData()[0] = 1;
+                in->getData()[1] = 2;
+                const Image::Info outInfo(1, 1, Image::Type::L_U16);
+                auto out = Image::Data::create(outInfo);
+                convert->process(*in, outInfo, *out);
+                DJV_ASSERT(2 == out->getData()[0]);
+                DJV_ASSERT(1 == out->getData()[1]);
+            }
+
+            {
+                const Image::Info inInfo(4, 4, Image::Type::L_F32);
+                auto in = Image::Data::create(inInfo);
+                Image::F32_T* inP = reinterpret_cast<Image::F32_T*>(in->getData());
+                for (size_t i = 0; i < 16; ++i)
+                {
+                    inP[i] = static_cast<float>(i);
+                }
+                const Image::Info outInfo(2, 2, Image::Type::L_F32);
+                auto out = Image::Data::create(outInfo);
+                convert->process(*in, outInfo, *out);
+                const Image::F32_T* outP = reinterpret_cast<const Image::F32_T*>(out->getData());
+                DJV_ASSERT(2.5F == outP[0]);
+                DJV_ASSERT(4.5F == outP[1]);
+                DJV_ASSERT(10.5F == outP[2]);
+                DJV_ASSERT(12.5F == outP[3]);
+
+                const Image::Info outInfo2(8, 8, Image::Type::L_F32);
+                auto out2 = Image::Data::create(outInfo2);
+                convert->process(*in, outInfo2, *out2);
+                const Image::F32_T* out2P = reinterpret_cast<const Image::F32_T*>(out2->getData());
+                DJV_ASSERT(0.F == out2P[0]);
+                DJV_ASSERT(.25F == out2P[1]);
+                DJV_ASSERT(15.F == out2P[63]);
+            }
+
+            {
+                // The result does not depend on the number of threads.
+                DJV_ASSERT(convert->getThreadCount() >= 1);
+                convert->setThreadCount(0);
+                DJV_ASSERT(1 == convert->getThreadCount());
+                const Image::Info inInfo(64, 512, Image::Type::RGB_U8);
+                auto in = Image::Data::create(inInfo);
+                for (size_t i = 0; i < in->getDataByteCount(); ++i)
+                {
+                    in->getData()[i] = static_cast<uint8_t>(i * 7);
+                }
+                const Image::Info outInfo(32, 256, Image::Type::RGBA_U16);
+                auto out = Image::Data::create(outInfo);
+                convert->process(*in, outInfo, *out);
+                convert->setThreadCount(4);
+                DJV_ASSERT(4 == convert->getThreadCount());
+                auto out2 = Image::Data::create(outInfo);
+                convert->process(*in, outInfo, *out2);
+                DJV_ASSERT(*out == *out2);
+            }
+        }
+
+        void ImageConvertTest::_yuv(const std::shared_ptr<Core::Context>& context)
+        {
+            auto convert = Image::Convert::create(Image::ConvertBackend::CPU, context->getSystemT<ResourceSystem>());
+
+            {
+                // Black and white pixels with neutral chroma.
+                const Image::Info inInfo(3, 2, Image::Type::YUV_420P_U8);
+                auto in = Image::Data::create(inInfo);
+                DJV_ASSERT(3 == inInfo.getPlaneCount());
+                memset(in->getPlaneData(0), 235, inInfo.getPlaneByteCount(0));
+                in->getPlaneData(0)[0] = 16;
+                memset(in->getPlaneData(1), 128, inInfo.getPlaneByteCount(1));
+                memset(in->getPlaneData(2), 128, inInfo.getPlaneByteCount(2));
+                const Image::Info outInfo(3, 2, Image::Type::RGB_U8);
+                auto out = Image::Data::create(outInfo);
+                convert->process(*in, outInfo, *out);
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    DJV_ASSERT(0 == out->getData(0, 0)[i]);
+                    DJV_ASSERT(255 == out->getData(1, 0)[i]);
+                    DJV_ASSERT(255 == out->getData(2, 1)[i]);
+                }
+            }
+
+            {
+                // Saturated red.
+                const Image::Info inInfo(2, 2, Image::Type::YUV_444P_U16);
+                auto in = Image::Data::create(inInfo);
+                const Image::U16_T yuv[] = { 63 << 8, 102 << 8, 240 << 8 };
+                for (uint8_t plane = 0; plane < 3; ++plane)
+                {
+                    Image::U16_T* p = reinterpret_cast<Image::U16_T*>(in->getPlaneData(plane));
+                    for (size_t i = 0; i < 4; ++i)
+                    {
+                        p[i] = yuv[plane];
+                    }
+                }
+                const Image::Info outInfo(2, 2, Image::Type::RGB_U8);
+                auto out = Image::Data::create(outInfo);
+                convert->process(*in, outInfo, *out);
+                const uint8_t* outP = out->getData(1, 1);
+                DJV_ASSERT(outP[0] > 250);
+                DJV_ASSERT(outP[1] < 5);
+                DJV_ASSERT(outP[2] < 5);
+            }
+
+            {
+                // Planar YUV output is not supported.
+                const Image::Info inInfo(2, 2, Image::Type::RGB_U8);
+                auto in = Image::Data::create(inInfo);
+                const Image::Info outInfo(2, 2, Image::Type::YUV_420P_U8);
+                auto out = Image::Data::create(outInfo);
+                try
+                {
+                    convert->process(*in, outInfo, *out);
+                    DJV_ASSERT(false);
+                }
+                catch (const std::invalid_argument&)
+                {}
+            }
+        }
+
+        void ImageConvertTest::_openGL(const std::shared_ptr<Core::Context>& context)
+        {
+            auto resourceSystem = context->getSystemT<ResourceSystem>();
+            auto glConvert = Image::Convert::create(Image::ConvertBackend::OpenGL, resourceSystem);
+            auto cpuConvert = Image::Convert::create(Image::ConvertBackend::CPU, resourceSystem);
+            for (const auto& mirror : { Image::Mirror(), Image::Mirror(true, false), Image::Mirror(false, true) })
+            {
+                const Image::Info inInfo(17, 13, Image::Type::RGBA_U8, Image::Layout(mirror));
+                auto in = Image::Data::create(inInfo);
+                for (size_t i = 0; i < in->getDataByteCount(); ++i)
+                {
+                    in->getData()[i] = static_cast<uint8_t>(i * 7);
+                }
+                const Image::Info outInfo(17, 13, Image::Type::RGBA_U8);
+                auto glOut = Image::Data::create(outInfo);
+                glConvert->process(*in, outInfo, *glOut);
+                auto cpuOut = Image::Data::create(outInfo);
+                cpuConvert->process(*in, outInfo, *cpuOut);
+                DJV_ASSERT(0 == memcmp(glOut->getData(), cpuOut->getData(), glOut->getDataByteCount()));
             }
         }
                 
     } // namespace AVTest
 } // namespace djv
-
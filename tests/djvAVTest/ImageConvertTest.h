@@ -14,6 +14,11 @@ namespace djv
             ImageConvertTest(const std::shared_ptr<Core::Context>&);
             
             void run() override;
+
+        private:
+            void _cpu(const std::shared_ptr<Core::Context>&);
+            void _yuv(const std::shared_ptr<Core::Context>&);
+            void _openGL(const std::shared_ptr<Core::Context>&);
         };
         
     } // namespace AVTest
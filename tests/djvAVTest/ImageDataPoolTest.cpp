@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/ImageDataPoolTest.h>
+
+#include <djvAV/ImageData.h>
+#include <djvAV/ImageDataPool.h>
+
+#include <djvCore/Memory.h>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        ImageDataPoolTest::ImageDataPoolTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::ImageDataPoolTest", context)
+        {}
+        
+        void ImageDataPoolTest::run()
+        {
+            _sizeClass();
+            _pool();
+            _data();
+        }
+
+        void ImageDataPoolTest::_sizeClass()
+        {
+            DJV_ASSERT(4096 == Image::DataPool::getSizeClass(1));
+            DJV_ASSERT(4096 == Image::DataPool::getSizeClass(4096));
+            DJV_ASSERT(8192 == Image::DataPool::getSizeClass(4097));
+            for (size_t i : { 100000, 1000000, 12345678, 4096 * 2160 * 16 })
+            {
+                const size_t sizeClass = Image::DataPool::getSizeClass(i);
+                DJV_ASSERT(sizeClass >= i);
+                DJV_ASSERT(sizeClass - i <= i / 8 + 4096);
+                DJV_ASSERT(sizeClass == Image::DataPool::getSizeClass(sizeClass));
+            }
+        }
+
+        void ImageDataPoolTest::_pool()
+        {
+            auto pool = Image::DataPool::create();
+            pool->setMaxByteCount(Memory::megabyte);
+            DJV_ASSERT(Memory::megabyte == pool->getMaxByteCount());
+
+            uint8_t* a = pool->allocate(1000);
+            DJV_ASSERT(a);
+            DJV_ASSERT(0 == reinterpret_cast<uintptr_t>(a) % 4096);
+            Image::DataPoolStats stats = pool->getStats();
+            DJV_ASSERT(0 == stats.hits);
+            DJV_ASSERT(1 == stats.misses);
+            DJV_ASSERT(4096 == stats.usedByteCount);
+            DJV_ASSERT(0 == stats.byteCount);
+
+            // Buffers in the same size class are reused.
+            pool->release(a, 1000);
+            stats = pool->getStats();
+            DJV_ASSERT(0 == stats.usedByteCount);
+            DJV_ASSERT(4096 == stats.byteCount);
+            uint8_t* b = pool->allocate(2000);
+            DJV_ASSERT(a == b);
+            stats = pool->getStats();
+            DJV_ASSERT(1 == stats.hits);
+            DJV_ASSERT(0 == stats.byteCount);
+            pool->release(b, 2000);
+
+            // Buffers larger than the maximum are not kept.
+            uint8_t* c = pool->allocate(2 * Memory::megabyte);
+            pool->release(c, 2 * Memory::megabyte);
+            stats = pool->getStats();
+            DJV_ASSERT(4096 == stats.byteCount);
+
+            // Other size classes are freed to make room.
+            uint8_t* d = pool->allocate(Memory::megabyte);
+            pool->release(d, Memory::megabyte);
+            stats = pool->getStats();
+            DJV_ASSERT(Memory::megabyte == stats.byteCount);
+
+            pool->clear();
+            stats = pool->getStats();
+            DJV_ASSERT(0 == stats.byteCount);
+        }
+
+        void ImageDataPoolTest::_data()
+        {
+            // Use a separate pool so that other image data doesn't change the
+            // statistics or reuse the buffer.
+            auto pool = Image::DataPool::create();
+            const Image::Info info(123, 45, Image::Type::RGBA_F32);
+            const size_t sizeClass = Image::DataPool::getSizeClass(info.getDataByteCount());
+            const uint8_t* p = nullptr;
+            {
+                auto data = Image::Data::create(info, pool);
+                p = data->getData();
+                const Image::DataPoolStats stats = pool->getStats();
+                DJV_ASSERT(1 == stats.misses);
+                DJV_ASSERT(sizeClass == stats.usedByteCount);
+            }
+            Image::DataPoolStats stats = pool->getStats();
+            DJV_ASSERT(0 == stats.usedByteCount);
+            DJV_ASSERT(sizeClass == stats.byteCount);
+            {
+                auto data = Image::Data::create(info, pool);
+                DJV_ASSERT(p == data->getData());
+                stats = pool->getStats();
+                DJV_ASSERT(1 == stats.hits);
+                DJV_ASSERT(0 == stats.byteCount);
+            }
+        }
+        
+    } // namespace AVTest
+} // namespace djv
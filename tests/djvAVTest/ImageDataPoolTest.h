@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class ImageDataPoolTest : public Test::ITest
+        {
+        public:
+            ImageDataPoolTest(const std::shared_ptr<Core::Context>&);
+            
+            void run() override;
+
+        private:
+            void _sizeClass();
+            void _pool();
+            void _data();
+        };
+        
+    } // namespace AVTest
+} // namespace djv
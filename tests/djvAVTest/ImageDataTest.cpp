@@ -6,6 +6,7 @@
 
 #include <djvAV/ImageData.h>
 
+#include <djvCore/FileIO.h>
 #include <djvCore/Memory.h>
 
 using namespace djv::Core;
@@ -26,6 +27,7 @@ namespace djv
             _size();
             _info();
             _data();
+            _mmap();
             _operators();
             _serialize();
         }
@@ -216,8 +218,87 @@ namespace djv
                 auto data2 = Image::Data::create(info);
                 DJV_ASSERT(data->getUID() != data2->getUID());
             }
+
+            {
+                const Image::Info info(1, 2, Image::Type::RGB_U8);
+                DJV_ASSERT(1 == info.getPlaneCount());
+                DJV_ASSERT(info.size == info.getPlaneSize(0));
+                DJV_ASSERT(info.getScanlineByteCount() == info.getPlaneScanlineByteCount(0));
+                DJV_ASSERT(info.getDataByteCount() == info.getPlaneByteCount(0));
+            }
+
+            {
+                const Image::Info info(5, 3, Image::Type::YUV_420P_U8);
+                DJV_ASSERT(3 == info.getPlaneCount());
+                DJV_ASSERT(Image::Size(5, 3) == info.getPlaneSize(0));
+                DJV_ASSERT(Image::Size(3, 2) == info.getPlaneSize(1));
+                DJV_ASSERT(Image::Size(3, 2) == info.getPlaneSize(2));
+                DJV_ASSERT(15 == info.getPlaneByteCount(0));
+                DJV_ASSERT(6 == info.getPlaneByteCount(1));
+                DJV_ASSERT(15 == info.getPlaneOffset(1));
+                DJV_ASSERT(21 == info.getPlaneOffset(2));
+                DJV_ASSERT(27 == info.getDataByteCount());
+                auto data = Image::Data::create(info);
+                DJV_ASSERT(data->getPlaneData(1) == data->getData() + info.getPlaneOffset(1));
+                DJV_ASSERT(data->getPlaneData(2) == data->getData() + info.getPlaneOffset(2));
+            }
+
+            {
+                const Image::Info info(4, 2, Image::Type::YUV_422P_U16, Image::Layout(Image::Mirror(), 4));
+                DJV_ASSERT(Image::Size(2, 2) == info.getPlaneSize(1));
+                DJV_ASSERT(4 == info.getPlaneScanlineByteCount(1));
+                DJV_ASSERT(16 + 8 + 8 == info.getDataByteCount());
+            }
         }
         
+        void ImageDataTest::_mmap()
+        {
+#if defined(DJV_MMAP)
+            const std::string fileName = "ImageDataTest.mmap";
+            const Image::Info info(3, 2, Image::Type::RGB_U8);
+            const size_t headerByteCount = 4;
+            {
+                auto io = FileSystem::FileIO::create();
+                io->open(fileName, FileSystem::FileIO::Mode::Write);
+                std::vector<uint8_t> buf(headerByteCount + info.getDataByteCount());
+                for (size_t i = 0; i < buf.size(); ++i)
+                {
+                    buf[i] = static_cast<uint8_t>(i);
+                }
+                io->write(buf.data(), buf.size());
+            }
+            FileSystem::FileIO::prefetch(fileName);
+
+            {
+                auto io = FileSystem::FileIO::create();
+                io->open(fileName, FileSystem::FileIO::Mode::Read);
+                io->setPos(headerByteCount);
+                auto data = Image::Data::create(info, io);
+                const auto& constData = *data;
+                DJV_ASSERT(data->isMapped());
+                DJV_ASSERT(constData.getData() == io->mmapP());
+                DJV_ASSERT(info.getDataByteCount() == data->getDataByteCount());
+                DJV_ASSERT(headerByteCount == *constData.getData());
+
+                // Writing to the data detaches it from the file.
+                *data->getData() = 0;
+                DJV_ASSERT(!data->isMapped());
+                DJV_ASSERT(0 == *constData.getData());
+                DJV_ASSERT(headerByteCount + 1 == *constData.getData(1, 0));
+            }
+
+            {
+                // Truncated files are copied.
+                auto io = FileSystem::FileIO::create();
+                io->open(fileName, FileSystem::FileIO::Mode::Read);
+                io->setPos(headerByteCount + 1);
+                auto data = Image::Data::create(info, io);
+                DJV_ASSERT(!data->isMapped());
+                DJV_ASSERT(headerByteCount + 1 == *data->getData());
+            }
+#endif // DJV_MMAP
+        }
+
         void ImageDataTest::_util()
         {
             {
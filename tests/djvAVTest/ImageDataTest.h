@@ -21,6 +21,7 @@ namespace djv
             void _size();
             void _info();
             void _data();
+            void _mmap();
             void _util();
             void _operators();
             void _serialize();
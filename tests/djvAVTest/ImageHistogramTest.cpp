@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/ImageHistogramTest.h>
+
+#include <djvAV/ImageData.h>
+#include <djvAV/ImageHistogram.h>
+
+#include <djvCore/Memory.h>
+
+#include <limits>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        ImageHistogramTest::ImageHistogramTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::ImageHistogramTest", context)
+        {}
+        
+        void ImageHistogramTest::run()
+        {
+            _histogram();
+            _types();
+            _threads();
+            _add();
+        }
+
+        void ImageHistogramTest::_histogram()
+        {
+            {
+                const Image::Histogram histogram;
+                DJV_ASSERT(!histogram.isValid());
+                DJV_ASSERT(0 == histogram.getPixelCount());
+                DJV_ASSERT(0 == histogram.getMax(Image::HistogramChannel::Red));
+            }
+            {
+                const Image::Histogram histogram = Image::getHistogram(*Image::Data::create(Image::Info()));
+                DJV_ASSERT(!histogram.isValid());
+            }
+            {
+                auto data = Image::Data::create(Image::Info(4, 2, Image::Type::RGBA_U8));
+                uint8_t* p = data->getData();
+                for (size_t i = 0; i < 8; ++i, p += 4)
+                {
+                    p[0] = i < 4 ? 0 : 255;
+                    p[1] = 10;
+                    p[2] = static_cast<uint8_t>(i);
+                    p[3] = 255;
+                }
+                const Image::Histogram histogram = Image::getHistogram(*data);
+                DJV_ASSERT(histogram.isValid());
+                DJV_ASSERT(4 == histogram.getChannelCount());
+                DJV_ASSERT(8 == histogram.getPixelCount());
+                const auto& red = histogram.getBins(Image::HistogramChannel::Red);
+                DJV_ASSERT(Image::histogramBinCount == red.size());
+                DJV_ASSERT(4 == red[0]);
+                DJV_ASSERT(4 == red[255]);
+                DJV_ASSERT(8 == histogram.getBins(Image::HistogramChannel::Green)[10]);
+                DJV_ASSERT(8 == histogram.getMax(Image::HistogramChannel::Green));
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    DJV_ASSERT(1 == histogram.getBins(Image::HistogramChannel::Blue)[i]);
+                }
+                DJV_ASSERT(8 == histogram.getBins(Image::HistogramChannel::Alpha)[255]);
+                size_t luminance = 0;
+                for (auto i : histogram.getBins(Image::HistogramChannel::Luminance))
+                {
+                    luminance += i;
+                }
+                DJV_ASSERT(8 == luminance);
+            }
+        }
+
+        void ImageHistogramTest::_types()
+        {
+            {
+                auto data = Image::Data::create(Image::Info(3, 1, Image::Type::LA_U8));
+                uint8_t* p = data->getData();
+                p[0] = 0;   p[1] = 255;
+                p[2] = 128; p[3] = 255;
+                p[4] = 255; p[5] = 0;
+                const Image::Histogram histogram = Image::getHistogram(*data);
+                DJV_ASSERT(2 == histogram.getChannelCount());
+                DJV_ASSERT(histogram.getBins(Image::HistogramChannel::Red).empty());
+                const auto& luminance = histogram.getBins(Image::HistogramChannel::Luminance);
+                DJV_ASSERT(1 == luminance[0]);
+                DJV_ASSERT(1 == luminance[128]);
+                DJV_ASSERT(1 == luminance[255]);
+                DJV_ASSERT(2 == histogram.getBins(Image::HistogramChannel::Alpha)[255]);
+            }
+            {
+                auto data = Image::Data::create(Image::Info(5, 1, Image::Type::L_F32));
+                Image::F32_T* p = reinterpret_cast<Image::F32_T*>(data->getData());
+                p[0] = -1.F;
+                p[1] = 1.F;
+                p[2] = 2.F;
+                p[3] = std::numeric_limits<float>::infinity();
+                p[4] = std::numeric_limits<float>::quiet_NaN();
+                const Image::Histogram histogram = Image::getHistogram(*data);
+                const auto& luminance = histogram.getBins(Image::HistogramChannel::Luminance);
+                DJV_ASSERT(2 == luminance[0]);
+                DJV_ASSERT(3 == luminance[255]);
+                DJV_ASSERT(histogram.getBins(Image::HistogramChannel::Alpha).empty());
+            }
+            {
+                const Image::Layout layout(
+                    Image::Mirror(),
+                    1,
+                    Memory::opposite(Memory::getEndian()));
+                auto data = Image::Data::create(Image::Info(2, 1, Image::Type::L_U16, layout));
+                const Image::U16_T values[] = { 0, Image::U16Range.getMax() };
+                Memory::endian(values, data->getData(), 2, 2);
+                const Image::Histogram histogram = Image::getHistogram(*data);
+                const auto& luminance = histogram.getBins(Image::HistogramChannel::Luminance);
+                DJV_ASSERT(1 == luminance[0]);
+                DJV_ASSERT(1 == luminance[255]);
+            }
+        }
+
+        void ImageHistogramTest::_threads()
+        {
+            auto data = Image::Data::create(Image::Info(61, 257, Image::Type::RGB_U16));
+            Image::U16_T* p = reinterpret_cast<Image::U16_T*>(data->getData());
+            const size_t pixelCount = static_cast<size_t>(data->getWidth()) * data->getHeight();
+            for (size_t i = 0; i < pixelCount * 3; ++i)
+            {
+                p[i] = static_cast<Image::U16_T>(i * 7919);
+            }
+            const Image::Histogram histogram = Image::getHistogram(*data, 1);
+            DJV_ASSERT(pixelCount == histogram.getPixelCount());
+            for (size_t threadCount : { 0, 2, 3, 8, 64 })
+            {
+                DJV_ASSERT(histogram == Image::getHistogram(*data, threadCount));
+            }
+        }
+
+        void ImageHistogramTest::_add()
+        {
+            auto a = Image::Data::create(Image::Info(2, 2, Image::Type::RGB_U8));
+            auto b = Image::Data::create(Image::Info(2, 3, Image::Type::RGB_U8));
+            a->zero();
+            b->zero();
+            Image::Histogram histogram;
+            histogram.add(Image::getHistogram(*a));
+            DJV_ASSERT(histogram == Image::getHistogram(*a));
+            histogram.add(Image::getHistogram(*b));
+            DJV_ASSERT(10 == histogram.getPixelCount());
+            DJV_ASSERT(10 == histogram.getBins(Image::HistogramChannel::Red)[0]);
+            DJV_ASSERT(histogram != Image::getHistogram(*a));
+            histogram.add(Image::Histogram());
+            DJV_ASSERT(10 == histogram.getPixelCount());
+        }
+        
+    } // namespace AVTest
+} // namespace djv
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/ImageUtilTest.h>
+
+#include <djvAV/ImageData.h>
+#include <djvAV/ImageUtil.h>
+
+#include <djvCore/Math.h>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        ImageUtilTest::ImageUtilTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::ImageUtilTest", context)
+        {}
+
+        void ImageUtilTest::run()
+        {
+            _convertToFloat();
+            _convertToFloatYUV();
+        }
+
+        void ImageUtilTest::_convertToFloat()
+        {
+            DJV_ASSERT(!Image::convertToFloat(*Image::Data::create(Image::Info()), BBox2i(0, 0, 1, 1)));
+            {
+                // Each pixel is its coordinates.
+                auto data = Image::Data::create(Image::Info(4, 3, Image::Type::RGB_U8));
+                for (uint16_t y = 0; y < 3; ++y)
+                {
+                    for (uint16_t x = 0; x < 4; ++x)
+                    {
+                        uint8_t* p = data->getData(x, y);
+                        p[0] = x;
+                        p[1] = y;
+                        p[2] = 255;
+                    }
+                }
+                auto values = Image::convertToFloat(*data, BBox2i(1, 1, 2, 2));
+                DJV_ASSERT(values);
+                DJV_ASSERT(Image::Type::RGB_F32 == values->getType());
+                DJV_ASSERT(2 == values->getWidth());
+                DJV_ASSERT(2 == values->getHeight());
+                const Image::F32_T* p = reinterpret_cast<const Image::F32_T*>(values->getData(1, 1));
+                DJV_ASSERT(fuzzyCompare(p[0], 2.F / 255.F, .0001F));
+                DJV_ASSERT(fuzzyCompare(p[1], 2.F / 255.F, .0001F));
+                DJV_ASSERT(fuzzyCompare(p[2], 1.F, .0001F));
+
+                // Areas are clamped to the image.
+                values = Image::convertToFloat(*data, BBox2i(2, -10, 100, 11));
+                DJV_ASSERT(values);
+                DJV_ASSERT(2 == values->getWidth());
+                DJV_ASSERT(1 == values->getHeight());
+                DJV_ASSERT(!Image::convertToFloat(*data, BBox2i(10, 10, 2, 2)));
+
+                // Only the sampled pixels are copied.
+                values = Image::convertToFloat(*data, BBox2i(0, 0, 4, 3), 3, 2);
+                DJV_ASSERT(values);
+                DJV_ASSERT(2 == values->getWidth());
+                DJV_ASSERT(2 == values->getHeight());
+                for (uint16_t y = 0; y < 2; ++y)
+                {
+                    for (uint16_t x = 0; x < 2; ++x)
+                    {
+                        p = reinterpret_cast<const Image::F32_T*>(values->getData(x, y));
+                        DJV_ASSERT(fuzzyCompare(p[0], x * 3 / 255.F, .0001F));
+                        DJV_ASSERT(fuzzyCompare(p[1], y * 2 / 255.F, .0001F));
+                    }
+                }
+            }
+            {
+                const Image::Layout layout(
+                    Image::Mirror(),
+                    1,
+                    Memory::opposite(Memory::getEndian()));
+                auto data = Image::Data::create(Image::Info(3, 1, Image::Type::L_U16, layout));
+                const Image::U16_T values[] = { 0, Image::U16Range.getMax(), Image::U16Range.getMax() };
+                Memory::endian(values, data->getData(), 3, 2);
+                for (uint16_t step = 1; step < 3; ++step)
+                {
+                    auto out = Image::convertToFloat(*data, BBox2i(1, 0, 2, 1), step, step);
+                    DJV_ASSERT(out);
+                    DJV_ASSERT(Image::Type::L_F32 == out->getType());
+                    DJV_ASSERT(fuzzyCompare(reinterpret_cast<const Image::F32_T*>(out->getData())[0], 1.F, .0001F));
+                }
+            }
+        }
+
+        void ImageUtilTest::_convertToFloatYUV()
+        {
+            auto yuv = Image::Data::create(Image::Info(8, 8, Image::Type::YUV_420P_U8));
+            const auto& info = yuv->getInfo();
+            for (uint8_t plane = 0; plane < 3; ++plane)
+            {
+                const uint16_t h = 0 == plane ? 8 : 4;
+                const uint16_t w = 0 == plane ? 8 : 4;
+                for (uint16_t y = 0; y < h; ++y)
+                {
+                    uint8_t* p = yuv->getPlaneData(plane) + y * info.getPlaneScanlineByteCount(plane);
+                    for (uint16_t x = 0; x < w; ++x)
+                    {
+                        p[x] = 0 == plane ? static_cast<uint8_t>(16 + x * 8 + y * 16) : 128;
+                    }
+                }
+            }
+            auto rgb = Image::Data::create(Image::Info(8, 8, Image::Type::RGB_U8));
+            Image::convertYUV(*yuv, *rgb);
+            const auto full = Image::convertToFloat(*rgb, BBox2i(0, 0, 8, 8));
+
+            // Planar YUV images are converted to RGB, only for the sampled
+            // pixels.
+            for (uint16_t step = 1; step < 4; ++step)
+            {
+                const BBox2i area(1, 2, 6, 5);
+                const auto values = Image::convertToFloat(*yuv, area, step, step);
+                DJV_ASSERT(values);
+                DJV_ASSERT(Image::Type::RGB_F32 == values->getType());
+                const uint16_t w = (6 + step - 1) / step;
+                const uint16_t h = (5 + step - 1) / step;
+                DJV_ASSERT(w == values->getWidth());
+                DJV_ASSERT(h == values->getHeight());
+                for (uint16_t y = 0; y < h; ++y)
+                {
+                    for (uint16_t x = 0; x < w; ++x)
+                    {
+                        const Image::F32_T* a = reinterpret_cast<const Image::F32_T*>(values->getData(x, y));
+                        const Image::F32_T* b = reinterpret_cast<const Image::F32_T*>(full->getData(
+                            static_cast<uint16_t>(area.min.x + x * step),
+                            static_cast<uint16_t>(area.min.y + y * step)));
+                        for (uint8_t c = 0; c < 3; ++c)
+                        {
+                            DJV_ASSERT(fuzzyCompare(a[c], b[c], .0001F));
+                        }
+                    }
+                }
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class ImageUtilTest : public Test::ITest
+        {
+        public:
+            ImageUtilTest(const std::shared_ptr<Core::Context>&);
+            
+            void run() override;
+
+        private:
+            void _convertToFloat();
+            void _convertToFloatYUV();
+        };
+        
+    } // namespace AVTest
+} // namespace djv
@@ -6,6 +6,9 @@
 
 #include <djvAV/Pixel.h>
 
+#include <cstring>
+#include <limits>
+
 using namespace djv::Core;
 using namespace djv::AV;
 
@@ -33,6 +36,7 @@ namespace djv
             _enum();
             _constants();
             _convert();
+            _simd();
         }
                 
         void PixelTest::_enum()
@@ -186,6 +190,111 @@ namespace djv
                 CONVERT(F32, Image::F32Range, U32);
                 CONVERT(F32, Image::F32Range, F16);
             }
+
+            {
+                Image::U8_T u8 = 0;
+                Image::convert_U16_U8(128, u8);
+                DJV_ASSERT(0 == u8);
+                Image::convert_U16_U8(129, u8);
+                DJV_ASSERT(1 == u8);
+                Image::convert_U16_U8(Image::U16Range.getMax(), u8);
+                DJV_ASSERT(Image::U8Range.getMax() == u8);
+            }
+        }
+
+        void PixelTest::_simd()
+        {
+            {
+                std::stringstream ss;
+                ss << "SIMD: " << static_cast<int>(Image::getConvertSIMD());
+                _print(ss.str());
+            }
+
+            // Compare the SIMD conversions with the scalar conversions. The
+            // sizes are chosen to exercise both the vector and remainder loops,
+            // and the floating point values include out of range, infinite,
+            // and NaN values.
+            const std::vector<float> special =
+            {
+                -1.F,
+                -0.F,
+                1.F,
+                2.F,
+                std::numeric_limits<float>::infinity(),
+                -std::numeric_limits<float>::infinity(),
+                std::numeric_limits<float>::quiet_NaN()
+            };
+            for (size_t size : { 1, 7, 13, 37 })
+            {
+                for (auto inType : Image::getTypeEnums())
+                {
+                    if (Image::Type::None == inType)
+                        continue;
+                    const size_t inByteCount = size * Image::getByteCount(inType);
+                    std::vector<uint8_t> in(inByteCount);
+                    const size_t valueCount = inByteCount / Image::getByteCount(Image::getDataType(inType));
+                    switch (Image::getDataType(inType))
+                    {
+                    case Image::DataType::F16:
+                        for (size_t i = 0; i < valueCount; ++i)
+                        {
+                            reinterpret_cast<Image::F16_T*>(in.data())[i] = (i % 2) ?
+                                special[(i / 2) % special.size()] :
+                                (i / static_cast<float>(valueCount) * 3.F - 1.F);
+                        }
+                        break;
+                    case Image::DataType::F32:
+                        for (size_t i = 0; i < valueCount; ++i)
+                        {
+                            reinterpret_cast<Image::F32_T*>(in.data())[i] = (i % 2) ?
+                                special[(i / 2) % special.size()] :
+                                (i / static_cast<float>(valueCount) * 3.F - 1.F);
+                        }
+                        break;
+                    default:
+                        for (size_t i = 0; i < inByteCount; ++i)
+                        {
+                            in[i] = static_cast<uint8_t>(i * 97 + 13);
+                        }
+                        break;
+                    }
+                    for (auto outType : Image::getTypeEnums())
+                    {
+                        if (Image::Type::None == outType)
+                            continue;
+                        const size_t outByteCount = size * Image::getByteCount(outType);
+                        std::vector<uint8_t> scalar(outByteCount, 0);
+                        Image::convert(in.data(), inType, scalar.data(), outType, size, Image::ConvertSIMD::None);
+                        for (auto simd : { Image::ConvertSIMD::SSE4_1, Image::ConvertSIMD::AVX2 })
+                        {
+                            std::vector<uint8_t> out(outByteCount, 0);
+                            Image::convert(in.data(), inType, out.data(), outType, size, simd);
+                            DJV_ASSERT(0 == memcmp(scalar.data(), out.data(), outByteCount));
+                        }
+                    }
+                }
+            }
+
+            // Check the clamping of out of range values.
+            for (auto simd : { Image::ConvertSIMD::None, Image::ConvertSIMD::SSE4_1, Image::ConvertSIMD::AVX2 })
+            {
+                std::vector<Image::F32_T> in;
+                std::vector<Image::U8_T> result;
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    for (const auto j : special)
+                    {
+                        in.push_back(j);
+                    }
+                    for (const Image::U8_T j : { 0, 0, 255, 255, 255, 0, 0 })
+                    {
+                        result.push_back(j);
+                    }
+                }
+                std::vector<Image::U8_T> out(in.size(), 0);
+                Image::convert(in.data(), Image::Type::L_F32, out.data(), Image::Type::L_U8, in.size(), simd);
+                DJV_ASSERT(result == out);
+            }
         }
         
     } // namespace AVTest
@@ -19,6 +19,7 @@ namespace djv
             void _enum();
             void _constants();
             void _convert();
+            void _simd();
         };
         
     } // namespace AVTest
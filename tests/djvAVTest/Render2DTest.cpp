@@ -11,6 +11,7 @@
 #include <djvAV/Render2D.h>
 
 #include <djvCore/Context.h>
+#include <djvCore/Math.h>
 #include <djvCore/Timer.h>
 
 using namespace djv::Core;
@@ -27,6 +28,7 @@ namespace djv
         void Render2DTest::run()
         {
             _operators();
+            _imageOptions();
             _system();
         }
         
@@ -121,6 +123,61 @@ namespace djv
                 DJV_ASSERT(options != Render2D::ImageOptions());
             }
         }
+
+        void Render2DTest::_imageOptions()
+        {
+            const glm::vec4 color(.25F, .5F, .75F, .5F);
+            {
+                const Render2D::ImageOptions options;
+                DJV_ASSERT(color == Render2D::applyImageOptions(color, options));
+            }
+            {
+                Render2D::ImageOptions options;
+                options.color.invert = true;
+                DJV_ASSERT(color == Render2D::applyImageOptions(color, options));
+                options.colorEnabled = true;
+                const glm::vec4 value = Render2D::applyImageOptions(color, options);
+                DJV_ASSERT(fuzzyCompare(value.r, .75F, .0001F));
+                DJV_ASSERT(fuzzyCompare(value.g, .5F, .0001F));
+                DJV_ASSERT(fuzzyCompare(value.b, .25F, .0001F));
+                DJV_ASSERT(fuzzyCompare(value.a, .5F, .0001F));
+            }
+            {
+                Render2D::ImageOptions options;
+                options.colorEnabled = true;
+                options.color.brightness = 2.F;
+                const glm::vec4 value = Render2D::applyImageOptions(color, options);
+                DJV_ASSERT(fuzzyCompare(value.r, .5F, .0001F));
+                DJV_ASSERT(fuzzyCompare(value.g, 1.F, .0001F));
+                DJV_ASSERT(fuzzyCompare(value.b, 1.5F, .0001F));
+                DJV_ASSERT(fuzzyCompare(value.a, .5F, .0001F));
+            }
+            {
+                Render2D::ImageOptions options;
+                options.levelsEnabled = true;
+                options.levels.outLow = .5F;
+                options.levels.outHigh = .5F;
+                const glm::vec4 value = Render2D::applyImageOptions(color, options);
+                DJV_ASSERT(fuzzyCompare(value.r, .625F, .0001F));
+                DJV_ASSERT(fuzzyCompare(value.g, .75F, .0001F));
+                DJV_ASSERT(fuzzyCompare(value.b, .875F, .0001F));
+            }
+            {
+                Render2D::ImageOptions options;
+                options.softClipEnabled = true;
+                options.softClip = .5F;
+                const glm::vec4 value = Render2D::applyImageOptions(glm::vec4(2.F, .25F, 0.F, 1.F), options);
+                DJV_ASSERT(value.r > .5F && value.r < 1.F);
+                DJV_ASSERT(fuzzyCompare(value.g, .25F, .0001F));
+            }
+            {
+                Render2D::ImageOptions options;
+                options.exposureEnabled = true;
+                const glm::vec4 value = Render2D::applyImageOptions(glm::vec4(0.F, 0.F, 0.F, 1.F), options);
+                DJV_ASSERT(fuzzyCompare(value.r, 0.F, .0001F));
+                DJV_ASSERT(fuzzyCompare(value.a, 1.F, .0001F));
+            }
+        }
         
     } // namespace AVTest
 } // namespace djv
@@ -18,6 +18,7 @@ namespace djv
         private:
             void _system();
             void _operators();
+            void _imageOptions();
         };
         
     } // namespace AVTest
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2004-2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/ThumbnailDiskCacheTest.h>
+
+#include <djvAV/IO.h>
+#include <djvAV/Image.h>
+#include <djvAV/ThumbnailDiskCache.h>
+
+#include <djvCore/FileIO.h>
+#include <djvCore/FileInfo.h>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        ThumbnailDiskCacheTest::ThumbnailDiskCacheTest(const std::shared_ptr<Core::Context>& context) :
+            ITest("djv::AVTest::ThumbnailDiskCacheTest", context)
+        {}
+
+        void ThumbnailDiskCacheTest::run()
+        {
+            const std::string path = "ThumbnailDiskCacheTest";
+            const std::string fileName = "ThumbnailDiskCacheTest.txt";
+            FileSystem::FileIO::writeLines(fileName, { "ThumbnailDiskCacheTest" });
+            const FileSystem::FileInfo fileInfo(fileName);
+
+            IO::Info info;
+            info.fileName = fileName;
+            info.video.push_back(IO::VideoInfo(
+                Image::Info(64, 32, Image::Type::RGB_U16),
+                Time::Speed(24000, 1001),
+                Frame::Sequence(1, 100, 4)));
+            info.video[0].codec = "codec";
+            info.audio.push_back(IO::AudioInfo(Audio::Info(2, Audio::Type::S16, 48000, 1000)));
+            info.tags.setTag("key", "value");
+
+            auto image = Image::Image::create(Image::Info(16, 8, Image::Type::RGBA_U8));
+            for (size_t i = 0; i < image->getDataByteCount(); ++i)
+            {
+                image->getData()[i] = static_cast<uint8_t>(i);
+            }
+            image->setPluginName("plugin");
+            Tags tags;
+            tags.setTag("key", "value");
+            image->setTags(tags);
+            const Image::Size size(16, 16);
+
+            {
+                auto cache = ThumbnailDiskCache::create(path, Memory::megabyte);
+                cache->clear();
+                DJV_ASSERT(path == cache->getPath());
+                DJV_ASSERT(Memory::megabyte == cache->getMaxByteCount());
+                DJV_ASSERT(0 == cache->getCount());
+                DJV_ASSERT(0.F == cache->getPercentageUsed());
+
+                IO::Info info2;
+                DJV_ASSERT(!cache->getInfo(fileInfo, info2));
+                cache->addInfo(fileInfo, info);
+                DJV_ASSERT(cache->getInfo(fileInfo, info2));
+                DJV_ASSERT(info == info2);
+
+                std::shared_ptr<Image::Image> image2;
+                DJV_ASSERT(!cache->getImage(fileInfo, size, Image::Type::None, image2));
+                cache->addImage(fileInfo, size, Image::Type::None, image);
+                DJV_ASSERT(cache->getImage(fileInfo, size, Image::Type::None, image2));
+                DJV_ASSERT(*image == *image2);
+                DJV_ASSERT(image->getPluginName() == image2->getPluginName());
+                DJV_ASSERT(image->getTags() == image2->getTags());
+                DJV_ASSERT(!cache->getImage(fileInfo, Image::Size(32, 32), Image::Type::None, image2));
+                DJV_ASSERT(!cache->getImage(fileInfo, size, Image::Type::RGBA_U8, image2));
+
+                DJV_ASSERT(2 == cache->getCount());
+                DJV_ASSERT(cache->getByteCount() > image->getDataByteCount());
+                std::stringstream ss;
+                ss << "percentage used: " << cache->getPercentageUsed();
+                _print(ss.str());
+
+                cache->setOptionsKey("options");
+                DJV_ASSERT(!cache->getInfo(fileInfo, info2));
+                cache->setOptionsKey(std::string());
+                DJV_ASSERT(cache->getInfo(fileInfo, info2));
+            }
+
+            {
+                auto cache = ThumbnailDiskCache::create(path, Memory::megabyte);
+                DJV_ASSERT(2 == cache->getCount());
+                IO::Info info2;
+                DJV_ASSERT(cache->getInfo(fileInfo, info2));
+                DJV_ASSERT(info == info2);
+                std::shared_ptr<Image::Image> image2;
+                DJV_ASSERT(cache->getImage(fileInfo, size, Image::Type::None, image2));
+                DJV_ASSERT(*image == *image2);
+
+                // The information was used least recently so it is removed first.
+                cache->setMaxByteCount(cache->getByteCount() - 1);
+                DJV_ASSERT(1 == cache->getCount());
+                DJV_ASSERT(!cache->getInfo(fileInfo, info2));
+                DJV_ASSERT(cache->getImage(fileInfo, size, Image::Type::None, image2));
+
+                cache->clear();
+                DJV_ASSERT(0 == cache->getCount());
+                DJV_ASSERT(0 == cache->getByteCount());
+                DJV_ASSERT(!cache->getImage(fileInfo, size, Image::Type::None, image2));
+            }
+
+            {
+                FileSystem::FileIO::writeLines(fileName, { "ThumbnailDiskCacheTest", "modified" });
+                auto cache = ThumbnailDiskCache::create(path, Memory::megabyte);
+                cache->addInfo(fileInfo, info);
+                IO::Info info2;
+                DJV_ASSERT(!cache->getInfo(FileSystem::FileInfo(fileName), info2));
+                cache->clear();
+            }
+
+            FileSystem::Path::rm(FileSystem::Path(path, "index"));
+            FileSystem::Path::rmdir(FileSystem::Path(path));
+            FileSystem::Path::rm(FileSystem::Path(fileName));
+        }
+
+    } // namespace AVTest
+} // namespace djv
+
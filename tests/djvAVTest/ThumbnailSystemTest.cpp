@@ -83,6 +83,69 @@ namespace djv
                 }
                 
                 system->clearCache();
+
+                // Queue the requests with the worker threads stopped, then
+                // start a single worker so the order is deterministic.
+                const size_t threadCount = system->getThreadCount();
+                system->setThreadCount(0);
+                DJV_ASSERT(0 == system->getThreadCount());
+                std::vector<ThumbnailSystem::ImageFuture> futures;
+                futures.push_back(system->getImage(fileInfo, Image::Size(16, 16), Image::Type::None, ThumbnailPriority::Low));
+                futures.push_back(system->getImage(fileInfo, Image::Size(20, 20), Image::Type::None, ThumbnailPriority::Low));
+                futures.push_back(system->getImage(fileInfo, Image::Size(24, 24), Image::Type::None, ThumbnailPriority::High));
+                system->setPriority(futures[1].uid, ThumbnailPriority::High);
+                std::vector<ThumbnailSystem::ImageFuture> cancelledFutures;
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    cancelledFutures.push_back(system->getImage(fileInfo, Image::Size(8 + i, 8 + i), Image::Type::None, ThumbnailPriority::High));
+                }
+                for (const auto& i : cancelledFutures)
+                {
+                    system->cancelImage(i.uid);
+                }
+                system->setThreadCount(1);
+                DJV_ASSERT(1 == system->getThreadCount());
+
+                // The requests are expected to complete in priority order:
+                // the second request (raised to high priority), the third,
+                // and then the first. Whenever a request has completed the
+                // ones before it must have completed too. The futures are
+                // checked in reverse order so a request that completes
+                // during the check cannot cause a false failure.
+                const std::vector<size_t> order = { 1, 2, 0 };
+                std::vector<bool> ready(order.size(), false);
+                while (!ready[order.size() - 1])
+                {
+                    _tickFor(Time::getTime(Time::TimerValue::Fast));
+                    for (size_t i = order.size(); i > 0; --i)
+                    {
+                        ready[i - 1] = futures[order[i - 1]].future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                    }
+                    for (size_t i = 1; i < ready.size(); ++i)
+                    {
+                        DJV_ASSERT(!ready[i] || ready[i - 1]);
+                    }
+                }
+                for (auto& i : futures)
+                {
+                    image = i.future.get();
+                    DJV_ASSERT(image);
+                }
+
+                // Cancelled requests never deliver a value.
+                for (auto& i : cancelledFutures)
+                {
+                    DJV_ASSERT(i.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+                    try
+                    {
+                        i.future.get();
+                        DJV_ASSERT(false);
+                    }
+                    catch (const std::future_error&)
+                    {}
+                }
+
+                system->setThreadCount(threadCount);
             }
         }
         
@@ -41,6 +41,29 @@ namespace djv
                 DJV_ASSERT(cache.getKeys() == std::vector<int>({ 2, 3 }));
                 DJV_ASSERT(cache.getValues() == std::vector<std::string>({ "b", "c" }));
             }
+
+            {
+                Memory::Cache<int, std::string> cache;
+                cache.setMax(3);
+                cache.add(1, "a");
+                cache.add(2, "b");
+                cache.add(3, "c");
+                std::string value;
+                DJV_ASSERT(cache.get(1, value));
+                cache.add(2, "d");
+                cache.add(4, "e");
+                DJV_ASSERT(!cache.contains(3));
+                DJV_ASSERT(cache.getKeys() == std::vector<int>({ 1, 2, 4 }));
+                DJV_ASSERT(cache.getValues() == std::vector<std::string>({ "a", "d", "e" }));
+                cache.remove(1);
+                DJV_ASSERT(2 == cache.getSize());
+                cache.setMax(1);
+                DJV_ASSERT(cache.getKeys() == std::vector<int>({ 4 }));
+                DJV_ASSERT(100.F == cache.getPercentageUsed());
+                cache.clear();
+                DJV_ASSERT(0 == cache.getSize());
+                DJV_ASSERT(!cache.get(4, value));
+            }
         }
         
     } // namespace CoreTest
@@ -108,6 +108,66 @@ namespace djv
 
                 _tickFor(std::chrono::milliseconds(1000));
             }
+            
+            if (auto context = getContext().lock())
+            {
+                const FileSystem::Path path("DirectoryModelTest2");
+                FileSystem::Path::mkdir(path);
+                for (const auto& i : { "render.0001.exr", "render.0002.exr", "render.0003.exr" })
+                {
+                    FileSystem::FileIO::writeLines(std::string(FileSystem::Path(path, i)), { i });
+                }
+
+                auto model = FileSystem::DirectoryModel::create(context);
+                model->setFileSequences(true);
+                model->setFileSequenceExtensions({ ".exr" });
+                model->setPath(path);
+                std::vector<FileSystem::DirectoryModelChanges> changes;
+                auto changesObserver = ValueObserver<FileSystem::DirectoryModelChanges>::create(
+                    model->observeChanges(),
+                    [&changes](const FileSystem::DirectoryModelChanges& value)
+                    {
+                        if (!value.isEmpty())
+                        {
+                            changes.push_back(value);
+                        }
+                    });
+                _tickFor(std::chrono::milliseconds(1000));
+                DJV_ASSERT(1 == model->observeFileInfo()->getSize());
+
+                // The new frames are added to the sequence.
+                for (const auto& i : { "render.0004.exr", "render.0006.exr", "notes.txt" })
+                {
+                    FileSystem::FileIO::writeLines(std::string(FileSystem::Path(path, i)), { i });
+                }
+                _tickFor(std::chrono::milliseconds(2000));
+                auto fileInfo = model->observeFileInfo()->get();
+                DJV_ASSERT(2 == fileInfo.size());
+                DJV_ASSERT(FileSystem::FileType::Sequence == fileInfo[1].getType());
+                DJV_ASSERT(5 == fileInfo[1].getSequence().getFrameCount());
+                for (const auto& i : changes)
+                {
+                    std::stringstream ss;
+                    ss << "changes: " << i.added.size() << " added, " << i.removed.size() << " removed, " <<
+                        i.changed.size() << " changed";
+                    _print(ss.str());
+                }
+
+                // The removed frames are split from the sequence.
+                FileSystem::Path::rm(FileSystem::Path(path, "render.0002.exr"));
+                FileSystem::Path::rm(FileSystem::Path(path, "notes.txt"));
+                _tickFor(std::chrono::milliseconds(2000));
+                fileInfo = model->observeFileInfo()->get();
+                DJV_ASSERT(1 == fileInfo.size());
+                DJV_ASSERT(4 == fileInfo[0].getSequence().getFrameCount());
+                DJV_ASSERT(3 == fileInfo[0].getSequence().getRanges().size());
+
+                for (const auto& i : { "render.0001.exr", "render.0003.exr", "render.0004.exr", "render.0006.exr" })
+                {
+                    FileSystem::Path::rm(FileSystem::Path(path, i));
+                }
+                FileSystem::Path::rmdir(path);
+            }
         }
         
     } // namespace CoreTest
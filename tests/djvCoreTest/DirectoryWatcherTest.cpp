@@ -33,6 +33,12 @@ namespace djv
                     {
                         changed = true;
                     });
+                std::vector<FileSystem::DirectoryChange> changes;
+                watcher->setChangesCallback(
+                    [&changes](const std::vector<FileSystem::DirectoryChange>& value)
+                    {
+                        changes.insert(changes.end(), value.begin(), value.end());
+                    });
                 
                 _tickFor(std::chrono::milliseconds(1000));
                 
@@ -47,6 +53,12 @@ namespace djv
                 std::stringstream ss;
                 ss << "changed: " << changed;
                 _print(ss.str());
+                for (const auto& i : changes)
+                {
+                    std::stringstream ss;
+                    ss << "change: " << static_cast<int>(i.type) << " " << i.fileName;
+                    _print(ss.str());
+                }
             }
         }
         
@@ -185,6 +185,18 @@ namespace djv
                 fileInfo.addToSequence(fileInfo2);
                 DJV_ASSERT(Frame::Sequence(Frame::Range(1, 110), 4) == fileInfo.getSequence());
             }
+
+            {
+                FileSystem::FileInfo fileInfo("render.1.exr", false);
+                fileInfo.addToSequence(FileSystem::FileInfo("render.2.exr", false));
+                fileInfo.addToSequence(FileSystem::FileInfo("render.3.exr", false));
+                DJV_ASSERT(!fileInfo.removeFromSequence(FileSystem::FileInfo("render.4.exr", false)));
+                DJV_ASSERT(fileInfo.removeFromSequence(FileSystem::FileInfo("render.2.exr", false)));
+                DJV_ASSERT("render.1,3.exr" == fileInfo.getFileName());
+                DJV_ASSERT(fileInfo.removeFromSequence(FileSystem::FileInfo("render.1.exr", false)));
+                DJV_ASSERT(FileSystem::FileType::File == fileInfo.getType());
+                DJV_ASSERT("render.3.exr" == fileInfo.getFileName());
+            }
             
             {
                 FileSystem::FileInfo fileInfo("render.1.exr");
@@ -241,6 +253,61 @@ namespace djv
                 _print(ss.str());
                 DJV_ASSERT(fileInfo.getFileName(Frame::invalid, false) == "render.1-3.exr");
             }
+
+            {
+                const FileSystem::Path path("FileInfoTest");
+                FileSystem::Path::mkdir(path);
+                const std::vector<std::string> fileNames =
+                {
+                    "render.0003.exr",
+                    "render.0001.exr",
+                    "render.0002.exr",
+                    "render.0010.exr",
+                    "comp.0001.EXR",
+                    "single.0001.exr",
+                    "notes.txt",
+                    ".hidden.exr"
+                };
+                for (const auto& i : fileNames)
+                {
+                    auto io = FileSystem::FileIO::create();
+                    io->open(FileSystem::Path(path, i).get(), FileSystem::FileIO::Mode::Write);
+                    io->write(i);
+                }
+                FileSystem::DirectoryListOptions options;
+                options.fileExtensions = { ".exr" };
+                options.fileSequences = true;
+                options.fileSequenceExtensions = { ".exr" };
+                const auto list = FileSystem::FileInfo::directoryList(path, options);
+                std::vector<std::string> listFileNames;
+                for (const auto& i : list)
+                {
+                    listFileNames.push_back(i.getFileName(Frame::invalid, false));
+                }
+                {
+                    std::stringstream ss;
+                    ss << "directory list: " << String::join(listFileNames, ", ");
+                    _print(ss.str());
+                }
+                DJV_ASSERT(3 == list.size());
+                DJV_ASSERT("comp.0001.EXR" == listFileNames[0]);
+                DJV_ASSERT("render.0001-0003,0010.exr" == listFileNames[1]);
+                DJV_ASSERT(FileSystem::FileType::Sequence == list[1].getType());
+                DJV_ASSERT(4 == list[1].getSequence().getFrameCount());
+                DJV_ASSERT(list[1].getSize() > 0);
+                DJV_ASSERT("single.0001.exr" == listFileNames[2]);
+                DJV_ASSERT(FileSystem::FileType::File == list[2].getType());
+
+                options.showHidden = true;
+                options.filter = "RENDER";
+                DJV_ASSERT(1 == FileSystem::FileInfo::directoryList(path, options).size());
+
+                for (const auto& i : fileNames)
+                {
+                    FileSystem::Path::rm(FileSystem::Path(path, i));
+                }
+                FileSystem::Path::rmdir(path);
+            }
             
             {
                 FileSystem::Path path;
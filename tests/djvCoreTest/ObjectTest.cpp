@@ -43,6 +43,41 @@ namespace djv
                 }
             };
             
+            class UpdateObject : public IObject
+            {
+                DJV_NON_COPYABLE(UpdateObject);
+
+            protected:
+                UpdateObject()
+                {}
+
+            public:
+                static std::shared_ptr<UpdateObject> create(const std::shared_ptr<Context>& context)
+                {
+                    auto out = std::shared_ptr<UpdateObject>(new UpdateObject);
+                    out->_init(context);
+                    return out;
+                }
+
+                void requestUpdate()
+                {
+                    _requestUpdate();
+                }
+
+                size_t updateCount = 0;
+                bool requestFromUpdate = false;
+
+            protected:
+                void _updateEvent(Event::Update&) override
+                {
+                    ++updateCount;
+                    if (requestFromUpdate)
+                    {
+                        _requestUpdate();
+                    }
+                }
+            };
+
             class TestEventSystem : public Event::IEventSystem
             {
                 DJV_NON_COPYABLE(TestEventSystem);
@@ -94,6 +129,11 @@ namespace djv
                     child2->setEnabled(false);
                     DJV_ASSERT(!child2->isEnabled());
                     parent->addChild(child2);
+                    DJV_ASSERT(!child2->isEnabled(true));
+                    parent->setEnabled(false);
+                    DJV_ASSERT(!child->isEnabled(true));
+                    parent->setEnabled(true);
+                    DJV_ASSERT(child->isEnabled(true));
                     child2->moveToFront();
                     child2->moveToBack();
                     
@@ -127,6 +167,51 @@ namespace djv
                     DJV_ASSERT(!child->getParent().lock());
                 }
 
+                {
+                    auto a = UpdateObject::create(context);
+                    auto b = UpdateObject::create(context);
+                    system->tick();
+                    DJV_ASSERT(0 == a->updateCount);
+                    DJV_ASSERT(0 == b->updateCount);
+
+                    // Only the objects that request an update receive one.
+                    a->requestUpdate();
+                    system->tick();
+                    DJV_ASSERT(1 == a->updateCount);
+                    DJV_ASSERT(0 == b->updateCount);
+
+                    // Each request is delivered once, and repeated requests
+                    // before the next tick are combined.
+                    system->tick();
+                    DJV_ASSERT(1 == a->updateCount);
+                    a->requestUpdate();
+                    a->requestUpdate();
+                    b->requestUpdate();
+                    system->tick();
+                    DJV_ASSERT(2 == a->updateCount);
+                    DJV_ASSERT(1 == b->updateCount);
+
+                    // Requests made while the updates are being delivered
+                    // arrive on the next tick.
+                    a->requestFromUpdate = true;
+                    a->requestUpdate();
+                    system->tick();
+                    DJV_ASSERT(3 == a->updateCount);
+                    system->tick();
+                    DJV_ASSERT(4 == a->updateCount);
+                    a->requestFromUpdate = false;
+                    system->tick();
+                    DJV_ASSERT(5 == a->updateCount);
+                    system->tick();
+                    DJV_ASSERT(5 == a->updateCount);
+                    DJV_ASSERT(1 == b->updateCount);
+
+                    // Requests from destroyed objects are ignored.
+                    b->requestUpdate();
+                    b.reset();
+                    system->tick();
+                }
+
                 context->removeSystem(system);
             }
             
@@ -5,6 +5,8 @@
 #include <djvCoreTest/PathTest.h>
 
 #include <djvCore/Error.h>
+#include <djvCore/FileIO.h>
+#include <djvCore/FileInfo.h>
 #include <djvCore/Path.h>
 
 using namespace djv::Core;
@@ -237,6 +239,40 @@ namespace djv
                     _print(Error::format(e));
                 }
             }
+
+            {
+                const FileSystem::Path path("foo.txt");
+                FileSystem::FileIO::writeLines(path.get(), { "foo" });
+                FileSystem::Path::rm(path);
+                DJV_ASSERT(!FileSystem::FileInfo(path).doesExist());
+                try
+                {
+                    FileSystem::Path::rm(path);
+                }
+                catch (const std::exception & e)
+                {
+                    _print(Error::format(e));
+                }
+            }
+
+            {
+                const FileSystem::Path from("foo.txt");
+                const FileSystem::Path to("bar.txt");
+                FileSystem::FileIO::writeLines(from.get(), { "foo" });
+                FileSystem::FileIO::writeLines(to.get(), { "bar" });
+                FileSystem::Path::rename(from, to);
+                DJV_ASSERT(!FileSystem::FileInfo(from).doesExist());
+                DJV_ASSERT(std::vector<std::string>({ "foo" }) == FileSystem::FileIO::readLines(to.get()));
+                FileSystem::Path::rm(to);
+                try
+                {
+                    FileSystem::Path::rename(from, to);
+                }
+                catch (const std::exception & e)
+                {
+                    _print(Error::format(e));
+                }
+            }
             
             {
                 const FileSystem::Path path = FileSystem::Path::getAbsolute(FileSystem::Path("."));
@@ -40,15 +40,22 @@
 #include <djvAVTest/AudioTest.h>
 #include <djvAVTest/ColorTest.h>
 #include <djvAVTest/EnumTest.h>
+#include <djvAVTest/FFmpegTest.h>
 #include <djvAVTest/FontSystemTest.h>
 #include <djvAVTest/IOTest.h>
+#include <djvAVTest/IOReadAheadTest.h>
+#include <djvAVTest/IOThreadPoolTest.h>
 #include <djvAVTest/ImageConvertTest.h>
+#include <djvAVTest/ImageDataPoolTest.h>
 #include <djvAVTest/ImageDataTest.h>
+#include <djvAVTest/ImageHistogramTest.h>
 #include <djvAVTest/ImageTest.h>
+#include <djvAVTest/ImageUtilTest.h>
 #include <djvAVTest/OCIOSystemTest.h>
 #include <djvAVTest/OCIOTest.h>
 #include <djvAVTest/PixelTest.h>
 #include <djvAVTest/Render2DTest.h>
+#include <djvAVTest/ThumbnailDiskCacheTest.h>
 #include <djvAVTest/ThumbnailSystemTest.h>
 #include <djvAVTest/TagsTest.h>
 
@@ -127,15 +134,22 @@ int main(int argc, char ** argv)
             tests.emplace_back(new AVTest::AudioTest(context));
             tests.emplace_back(new AVTest::ColorTest(context));
             tests.emplace_back(new AVTest::EnumTest(context));
+            tests.emplace_back(new AVTest::FFmpegTest(context));
             tests.emplace_back(new AVTest::FontSystemTest(context));
             tests.emplace_back(new AVTest::IOTest(context));
+            tests.emplace_back(new AVTest::IOReadAheadTest(context));
+            tests.emplace_back(new AVTest::IOThreadPoolTest(context));
             tests.emplace_back(new AVTest::ImageConvertTest(context));
+            tests.emplace_back(new AVTest::ImageDataPoolTest(context));
             tests.emplace_back(new AVTest::ImageDataTest(context));
+            tests.emplace_back(new AVTest::ImageHistogramTest(context));
             tests.emplace_back(new AVTest::ImageTest(context));
+            tests.emplace_back(new AVTest::ImageUtilTest(context));
             tests.emplace_back(new AVTest::OCIOSystemTest(context));
             tests.emplace_back(new AVTest::OCIOTest(context));
             tests.emplace_back(new AVTest::PixelTest(context));
             tests.emplace_back(new AVTest::Render2DTest(context));
+            tests.emplace_back(new AVTest::ThumbnailDiskCacheTest(context));
             tests.emplace_back(new AVTest::ThumbnailSystemTest(context));
             tests.emplace_back(new AVTest::TagsTest(context));
 
@@ -117,6 +117,29 @@ namespace djv
                 }
                 ++_tick;
             }
+
+            //! Run the layout passes that only visit the widgets that have
+            //! changed.
+            void layoutDirty(const std::shared_ptr<Widget>& widget, const glm::vec2& size)
+            {
+                _resetCounts();
+                widget->resize(size);
+
+                Event::InitLayout initLayout;
+                _initLayoutDirtyRecursive(widget, initLayout);
+
+                Event::PreLayout preLayout;
+                _preLayoutDirtyRecursive(widget, preLayout);
+
+                Event::Layout layout;
+                Event::Clip clip(BBox2f(0.F, 0.F, size.x, size.y));
+                _layoutDirtyRecursive(widget, layout, clip);
+            }
+
+            std::vector<BBox2f> getRedrawRegions() const
+            {
+                return _redrawRegions();
+            }
             
         protected:
             void _hover(const std::shared_ptr<IObject>& object, Core::Event::PointerMove& event, std::shared_ptr<Core::IObject>& hover)
@@ -159,6 +182,56 @@ namespace djv
             Event::PointerInfo _pointerInfo;
         };
         
+        namespace
+        {
+            //! This class provides a widget that places its children in a row
+            //! of 100x100 cells and counts how many times it is laid out.
+            class LayoutWidget : public Widget
+            {
+                DJV_NON_COPYABLE(LayoutWidget);
+
+            protected:
+                LayoutWidget()
+                {}
+
+            public:
+                static std::shared_ptr<LayoutWidget> create(const std::shared_ptr<Context>& context)
+                {
+                    auto out = std::shared_ptr<LayoutWidget>(new LayoutWidget);
+                    out->_init(context);
+                    return out;
+                }
+
+                size_t layoutCount = 0;
+
+            protected:
+                void _layoutEvent(Event::Layout&) override
+                {
+                    ++layoutCount;
+                    const BBox2f& g = getGeometry();
+                    float x = g.min.x;
+                    for (const auto& i : getChildWidgets())
+                    {
+                        i->setGeometry(BBox2f(x, g.min.y, 100.F, 100.F));
+                        x += 100.F;
+                    }
+                }
+            };
+
+            bool contains(const std::vector<BBox2f>& regions, const BBox2f& value)
+            {
+                for (const auto& i : regions)
+                {
+                    if (i.contains(value))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+        } // namespace
+
         WidgetTest::WidgetTest(const std::shared_ptr<Core::Context>& context) :
             ITickTest("djv::UITest::WidgetTest", context)
         {}
@@ -168,64 +241,159 @@ namespace djv
             if (auto context = getContext().lock())
             {
                 auto system = TestEventSystem::create(context);
-                {
-                    auto widget = PushButton::create(context);
-                    
-                    auto widget2 = ListButton::create(context);
-                    widget2->setHAlign(HAlign::Left);
-                    widget2->setHAlign(HAlign::Left);
-                    auto widget3 = ToolButton::create(context);
-                    widget3->setHAlign(HAlign::Right);
-                    auto widget4 = ToggleButton::create(context);
-                    widget4->setHAlign(HAlign::Center);
-                    
-                    auto widget5 = IntSlider::create(context);
-                    widget5->setVAlign(VAlign::Top);
-                    widget5->setVAlign(VAlign::Top);
-                    auto widget6 = FloatSlider::create(context);
-                    widget6->setVAlign(VAlign::Bottom);
-                    auto widget7 = LineEdit::create(context);
-                    widget7->setVAlign(VAlign::Center);
-                    
-                    auto stackLayout = StackLayout::create(context);
-                    stackLayout->addChild(widget);
-                    stackLayout->addChild(widget2);
-                    stackLayout->addChild(widget3);
-                    stackLayout->addChild(widget4);
-                    stackLayout->addChild(widget5);
-                    stackLayout->addChild(widget6);
-                    
-                    auto rowLayout = HorizontalLayout::create(context);
-                    auto label = Label::create(context);
-                    label->setText("Hello world!");
-                    rowLayout->addChild(label);
-                    auto icon = Icon::create(context);
-                    icon->setIcon("djvIconFileOpen");
-                    rowLayout->addChild(icon);
-
-                    auto formLayout = FormLayout::create(context);
-                    formLayout->addChild(CheckBox::create(context));
-                    formLayout->addChild(ColorSwatch::create(context));
-
-                    auto gridLayout = GridLayout::create(context);
-                    gridLayout->addChild(stackLayout);
-                    gridLayout->addChild(rowLayout);
-                    gridLayout->setGridPos(rowLayout, 1, 0);
-                    gridLayout->addChild(formLayout);
-                    gridLayout->setGridPos(formLayout, 0, 1);
-
-                    auto window = Window::create(context);
-                    window->addChild(gridLayout);
-                    if (auto parentWindow = gridLayout->getWindow())
-                    {
-                        DJV_ASSERT(window == parentWindow);
-                    }
-                    window->show();
-                    
-                    _tickFor(std::chrono::milliseconds(1000));
-                    
-                    window->close();
-                }
+                _widgets(context);
+                _dirty(context, system);
+            }
+        }
+
+        void WidgetTest::_widgets(const std::shared_ptr<Core::Context>& context)
+        {
+            auto widget = PushButton::create(context);
+            
+            auto widget2 = ListButton::create(context);
+            widget2->setHAlign(HAlign::Left);
+            widget2->setHAlign(HAlign::Left);
+            auto widget3 = ToolButton::create(context);
+            widget3->setHAlign(HAlign::Right);
+            auto widget4 = ToggleButton::create(context);
+            widget4->setHAlign(HAlign::Center);
+            
+            auto widget5 = IntSlider::create(context);
+            widget5->setVAlign(VAlign::Top);
+            widget5->setVAlign(VAlign::Top);
+            auto widget6 = FloatSlider::create(context);
+            widget6->setVAlign(VAlign::Bottom);
+            auto widget7 = LineEdit::create(context);
+            widget7->setVAlign(VAlign::Center);
+            
+            auto stackLayout = StackLayout::create(context);
+            stackLayout->addChild(widget);
+            stackLayout->addChild(widget2);
+            stackLayout->addChild(widget3);
+            stackLayout->addChild(widget4);
+            stackLayout->addChild(widget5);
+            stackLayout->addChild(widget6);
+            
+            auto rowLayout = HorizontalLayout::create(context);
+            auto label = Label::create(context);
+            label->setText("Hello world!");
+            rowLayout->addChild(label);
+            auto icon = Icon::create(context);
+            icon->setIcon("djvIconFileOpen");
+            rowLayout->addChild(icon);
+
+            auto formLayout = FormLayout::create(context);
+            formLayout->addChild(CheckBox::create(context));
+            formLayout->addChild(ColorSwatch::create(context));
+
+            auto gridLayout = GridLayout::create(context);
+            gridLayout->addChild(stackLayout);
+            gridLayout->addChild(rowLayout);
+            gridLayout->setGridPos(rowLayout, 1, 0);
+            gridLayout->addChild(formLayout);
+            gridLayout->setGridPos(formLayout, 0, 1);
+
+            auto window = Window::create(context);
+            window->addChild(gridLayout);
+            if (auto parentWindow = gridLayout->getWindow())
+            {
+                DJV_ASSERT(window == parentWindow);
+            }
+            window->show();
+            
+            _tickFor(std::chrono::milliseconds(1000));
+            
+            window->close();
+        }
+
+        void WidgetTest::_dirty(const std::shared_ptr<Core::Context>& context, const std::shared_ptr<TestEventSystem>& system)
+        {
+            const glm::vec2 size(1280.F, 720.F);
+            auto window = Window::create(context);
+            auto parent = LayoutWidget::create(context);
+            auto a = LayoutWidget::create(context);
+            auto b = LayoutWidget::create(context);
+            parent->addChild(a);
+            parent->addChild(b);
+            window->addChild(parent);
+            window->show();
+
+            // The first layout visits every widget.
+            system->layoutDirty(window, size);
+            DJV_ASSERT(system->getLayoutCount() >= 4);
+            DJV_ASSERT(1 == parent->layoutCount);
+            DJV_ASSERT(1 == a->layoutCount);
+            DJV_ASSERT(1 == b->layoutCount);
+            DJV_ASSERT(BBox2f(0.F, 0.F, 100.F, 100.F) == a->getGeometry());
+            DJV_ASSERT(BBox2f(100.F, 0.F, 100.F, 100.F) == b->getGeometry());
+            system->getRedrawRegions();
+
+            // Nothing is laid out or redrawn when nothing has changed.
+            system->layoutDirty(window, size);
+            DJV_ASSERT(0 == system->getLayoutCount());
+            DJV_ASSERT(system->getRedrawRegions().empty());
+
+            {
+                // Hiding a widget lays out its ancestors, but not its siblings,
+                // and redraws the area it covered.
+                b->setVisible(false);
+                system->layoutDirty(window, size);
+                DJV_ASSERT(2 == parent->layoutCount);
+                DJV_ASSERT(1 == a->layoutCount);
+                DJV_ASSERT(1 == b->layoutCount);
+                const auto regions = system->getRedrawRegions();
+                DJV_ASSERT(contains(regions, BBox2f(100.F, 0.F, 100.F, 100.F)));
+                DJV_ASSERT(!contains(regions, BBox2f(0.F, 0.F, 100.F, 100.F)));
+            }
+            {
+                // Showing the widget lays it out again and redraws it.
+                b->setVisible(true);
+                system->layoutDirty(window, size);
+                DJV_ASSERT(3 == parent->layoutCount);
+                DJV_ASSERT(1 == a->layoutCount);
+                DJV_ASSERT(2 == b->layoutCount);
+                const auto regions = system->getRedrawRegions();
+                DJV_ASSERT(contains(regions, BBox2f(100.F, 0.F, 100.F, 100.F)));
+                DJV_ASSERT(!contains(regions, BBox2f(0.F, 0.F, 100.F, 100.F)));
+            }
+            {
+                // Changing the geometry only lays out the widget, and redraws
+                // both the old and new areas.
+                a->setGeometry(BBox2f(0.F, 200.F, 100.F, 100.F));
+                system->layoutDirty(window, size);
+                DJV_ASSERT(1 == system->getLayoutCount());
+                DJV_ASSERT(3 == parent->layoutCount);
+                DJV_ASSERT(2 == a->layoutCount);
+                DJV_ASSERT(2 == b->layoutCount);
+                const auto regions = system->getRedrawRegions();
+                DJV_ASSERT(contains(regions, BBox2f(0.F, 0.F, 100.F, 100.F)));
+                DJV_ASSERT(contains(regions, BBox2f(0.F, 200.F, 100.F, 100.F)));
+                DJV_ASSERT(!contains(regions, BBox2f(100.F, 0.F, 100.F, 100.F)));
+            }
+            {
+                // Adding a child lays out the parent and the new child, and
+                // redraws the parent since the layout may have changed.
+                auto c = LayoutWidget::create(context);
+                parent->addChild(c);
+                system->layoutDirty(window, size);
+                DJV_ASSERT(4 == parent->layoutCount);
+                DJV_ASSERT(3 == a->layoutCount);
+                DJV_ASSERT(2 == b->layoutCount);
+                DJV_ASSERT(1 == c->layoutCount);
+                DJV_ASSERT(BBox2f(200.F, 0.F, 100.F, 100.F) == c->getGeometry());
+                DJV_ASSERT(contains(system->getRedrawRegions(), parent->getGeometry()));
+
+                // Removing a child lays out the parent and the siblings that
+                // moved, and redraws the parent.
+                parent->removeChild(a);
+                system->layoutDirty(window, size);
+                DJV_ASSERT(5 == parent->layoutCount);
+                DJV_ASSERT(3 == a->layoutCount);
+                DJV_ASSERT(3 == b->layoutCount);
+                DJV_ASSERT(2 == c->layoutCount);
+                DJV_ASSERT(BBox2f(0.F, 0.F, 100.F, 100.F) == b->getGeometry());
+                DJV_ASSERT(BBox2f(100.F, 0.F, 100.F, 100.F) == c->getGeometry());
+                DJV_ASSERT(contains(system->getRedrawRegions(), parent->getGeometry()));
             }
         }
 
@@ -8,12 +8,18 @@ namespace djv
 {
     namespace UITest
     {
+        class TestEventSystem;
+
         class WidgetTest : public Test::ITickTest
         {
         public:
             WidgetTest(const std::shared_ptr<Core::Context>&);
             
             void run() override;
+
+        private:
+            void _widgets(const std::shared_ptr<Core::Context>&);
+            void _dirty(const std::shared_ptr<Core::Context>&, const std::shared_ptr<TestEventSystem>&);
         };
         
     } // namespace UITest